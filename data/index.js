@@ -13,6 +13,7 @@ let ws = null;
 let nrOfMdlColumns = 4;
 let onUICommands = [];
 let model = []; //model.json (as send by the server), used by FindVar
+let modelChunks = []; //chunks of the module being received (binary ws message type 2)
 let savedView = null;
 
 //C++ equivalents
@@ -54,6 +55,8 @@ async function fetchModel() {
 }
 
 class Modules {
+  handles = {} //var per handle (variable.h), see findVarByHandle
+
   findVar(pid, id, parent = model) {
     for (var variable of parent) {
       if (variable.pid == pid && variable.id == id)
@@ -67,6 +70,21 @@ class Modules {
       console.log("dev findVar not found", pid, id)
     return null;
   }
+
+  //finds the var with handle h (binary values), handles are rebuilt if not found (new module or new children)
+  findVarByHandle(handle) {
+    if (!this.handles[handle]) {
+      this.handles = {};
+      let addHandles = (parent) => {
+        for (let variable of parent) {
+          if (variable.h != null) this.handles[variable.h] = variable;
+          if (variable.n) addHandles(variable.n);
+        }
+      }
+      addHandles(model);
+    }
+    return this.handles[handle];
+  }
   
 }
 
@@ -169,6 +187,29 @@ function makeWS() {
         if (canvasNode)
           previewBoard(canvasNode, buffer);
       }
+      else if (buffer[0] == 2) { //chunk of a module, buffer[1] is 1 if last chunk
+        modelChunks.push(buffer.slice(2));
+        if (buffer[1]) {
+          let len = 0;
+          for (let chunk of modelChunks) len += chunk.length;
+          let moduleBuffer = new Uint8Array(len);
+          let offset = 0;
+          for (let chunk of modelChunks) {
+            moduleBuffer.set(chunk, offset);
+            offset += chunk.length;
+          }
+          modelChunks = [];
+          let json = null;
+          try {
+            json = JSON.parse(new TextDecoder().decode(moduleBuffer));
+          } catch (error) {
+            console.error("makeWS module json error", error);
+          }
+          if (json) receiveJson(json);
+        }
+      }
+      else if (buffer[0] == 3) //values of variables
+        receiveValues(e.data);
       else 
         userFun(buffer);
     } 
@@ -186,29 +227,7 @@ function makeWS() {
           json = null;
           console.error("makeWS json error", error, e.data); // error in the above string (in this case, yes)!
       }
-      if (json) {
-        //receive model per module to stay under websocket size limit of 8192
-        if (json.type && ["appmod","usermod", "sysmod"].includes(json.type)) { //generate array of variables
-          let found = false;
-          for (let module of model) {
-            if (module.id == json.id)
-              found = true;
-          }
-          if (!found && json.o) { //initModule done
-            model.push((json)); //this is the model
-            addModule(json);
-          }
-          else
-            console.log("html of module already generated", json);
-        }
-        else { //update
-          if (!Array.isArray(json)) //only the model is an array
-            // console.log("WS receive update", json);
-            receiveData(json);
-          else
-            console.log("dev array not expected", json);
-        }
-      }
+      if (json) receiveJson(json);
     }
   }
   ws.onclose = (e)=>{
@@ -226,6 +245,105 @@ function makeWS() {
   }
 }
 
+const valueSizes = [1, 1, 2, 4, 4, 12]; //bool, uint8, uint16, int32, float, coord3D (see wsValueTags in SysModWeb.h)
+
+//binary values received over ws: records of [handle:2][tag:1][rowNr:1][value], converted to json updates
+function receiveValues(arrayBuffer) {
+  let view = new DataView(arrayBuffer);
+  let json = {};
+  let offset = 1; //byte 0 is the message type
+  while (offset + 4 <= view.byteLength) {
+    let handle = view.getUint16(offset, true);
+    let tag = view.getUint8(offset + 2);
+    let rowNr = view.getUint8(offset + 3);
+    offset += 4;
+    if (tag >= valueSizes.length || offset + valueSizes[tag] > view.byteLength) {
+      console.log("dev receiveValues invalid record", handle, tag, offset);
+      break;
+    }
+    let value;
+    if (tag == 0) value = view.getUint8(offset) != 0;
+    else if (tag == 1) value = view.getUint8(offset);
+    else if (tag == 2) value = view.getUint16(offset, true);
+    else if (tag == 3) value = view.getInt32(offset, true);
+    else if (tag == 4) value = view.getFloat32(offset, true);
+    else value = {"x":view.getInt32(offset, true), "y":view.getInt32(offset + 4, true), "z":view.getInt32(offset + 8, true)};
+    offset += valueSizes[tag];
+
+    let variable = controller.modules.findVarByHandle(handle);
+    if (variable) {
+      let pidid = variable.pid + "." + variable.id;
+      if (rowNr != UINT8_MAX) { //update the row in (a copy of) the value array
+        if (!json[pidid]) json[pidid] = {"value": Array.isArray(variable.value)?[...variable.value]:[]};
+        json[pidid].value[rowNr] = value;
+      }
+      else
+        json[pidid] = {"value": value};
+    }
+  }
+  receiveData(json);
+}
+
+//values of checkbox, number, range and coord3D variables are send binary (WS_BIN_VALUES) if the variable has a handle, returns false if not possible
+function sendBinaryValue(varId, value) {
+  if (!ws || ws.readyState != WebSocket.OPEN) return false;
+  let idRow = varId.split("#");
+  let pidid = idRow[0].split(".");
+  let variable = controller.modules.findVar(pidid[0], pidid[1]);
+  if (!variable || variable.h == null || variable.type == "button") return false;
+  let rowNr = idRow.length > 1?parseInt(idRow[1]):UINT8_MAX;
+
+  let tag;
+  if (typeof value == "boolean") tag = 0;
+  else if (typeof value == "number" && Number.isInteger(value))
+    tag = (value >= 0 && value <= 255)?1:(value >= 0 && value <= 65535)?2:3;
+  else if (typeof value == "number") tag = 4;
+  else if (value && typeof value == "object" && Number.isInteger(value.x) && Number.isInteger(value.y) && Number.isInteger(value.z)) tag = 5;
+  else return false; //strings, NaN etc
+
+  let view = new DataView(new ArrayBuffer(5 + valueSizes[tag]));
+  view.setUint8(0, 3); //values of variables
+  view.setUint16(1, variable.h, true);
+  view.setUint8(3, tag);
+  view.setUint8(4, rowNr);
+  if (tag <= 1) view.setUint8(5, value === true?1:value === false?0:value);
+  else if (tag == 2) view.setUint16(5, value, true);
+  else if (tag == 3) view.setInt32(5, value, true);
+  else if (tag == 4) view.setFloat32(5, value, true);
+  else {
+    view.setInt32(5, value.x, true);
+    view.setInt32(9, value.y, true);
+    view.setInt32(13, value.z, true);
+  }
+  ws.send(view.buffer);
+  return true;
+}
+
+//json received over ws: a module of the model or updates
+function receiveJson(json) {
+  //receive model per module to stay under websocket size limit of 8192
+  if (json.type && ["appmod","usermod", "sysmod"].includes(json.type)) { //generate array of variables
+    let found = false;
+    for (let module of model) {
+      if (module.id == json.id)
+        found = true;
+    }
+    if (!found && json.o) { //initModule done
+      model.push((json)); //this is the model
+      addModule(json);
+    }
+    else
+      console.log("html of module already generated", json);
+  }
+  else { //update
+    if (!Array.isArray(json)) //only the model is an array
+      // console.log("WS receive update", json);
+      receiveData(json);
+    else
+      console.log("dev array not expected", json);
+  }
+}
+
 function linearToLogarithm(json, value) {
   if (value == 0) return 0;
 
@@ -716,7 +834,7 @@ function varRemoveValuesForRow(variable, rowNr) {
   if (variable.n) {
     for (let childVar of variable.n) {
       if (Array.isArray(childVar.value)) {
-        childVar.value.splice(rowNr);
+        childVar.value.splice(rowNr, 1);
       }
       varRemoveValuesForRow(childVar, rowNr);
     }
@@ -758,6 +876,7 @@ function receiveData(json) {
 
         let modelVar = controller.modules.findVar(variable.pid, variable.id);
         modelVar.n = variable.n;
+        controller.modules.handles = {}; //new children
 
         //create new ndiv
         if (modelVar.n) {
@@ -836,6 +955,16 @@ function receiveData(json) {
           let rowNr = value.rowNr == null?UINT8_MAX:value.rowNr;
           variable.fun = -2; // request processed
 
+          if (value.rows) { //bulk update of a column (setValues): only the changed rows, merged in (a copy of) the value array
+            let newValue = Array.isArray(value.value)?value.value:Array.isArray(variable.value)?[...variable.value]:[];
+            for (let rowKey of Object.keys(value.rows))
+              newValue[parseInt(rowKey)] = value.rows[rowKey];
+            if (value.length != null) newValue.length = value.length;
+            value.value = newValue;
+            delete value.rows;
+            delete value.length;
+          }
+
           value.chk = "onUI";
           changeHTML(variable, value, rowNr); //changeHTML will find the rownumbers if needed
         }
@@ -1397,7 +1526,8 @@ function sendValue(varNode) {
     command[varId].value = isNaN(varNode.value)?varNode.value:parseFloat(varNode.value); //type number is default but html converts numbers in <option> to string, float to remove the quotes from all type of numbers
   console.log("sendValue", command);
   
-  requestJson(command);
+  if (command[varId].value == null || !sendBinaryValue(varId, command[varId].value))
+    requestJson(command);
 }
 
 let isModal = false;
@@ -11,6 +11,7 @@ class Controller {
 
   //kept vars public as other classes uses them
   ws = null
+  modelChunks = [] //chunks of the module being received (binary ws message type 2)
   sysInfo = {}
 
   modules = null
@@ -116,6 +117,30 @@ class Controller {
             this.modules.previewBoard(canvasNode, buffer);
           }
         }
+        else if (buffer[0]==2) { //chunk of a module, buffer[1] is 1 if last chunk
+          this.modelChunks.push(buffer.slice(2));
+          if (buffer[1]) {
+            let len = 0;
+            for (let chunk of this.modelChunks) len += chunk.length;
+            let moduleBuffer = new Uint8Array(len);
+            let offset = 0;
+            for (let chunk of this.modelChunks) {
+              moduleBuffer.set(chunk, offset);
+              offset += chunk.length;
+            }
+            this.modelChunks = [];
+            let json = null;
+            try {
+              json = JSON.parse(new TextDecoder().decode(moduleBuffer));
+            } catch (error) {
+              console.error("makeWS module json error", error);
+            }
+            if (json) this.receiveJson(json);
+          }
+        }
+        else if (buffer[0]==3) { //values of variables
+          this.receiveValues(e.data);
+        }
         else {
           userFun(buffer);
         }
@@ -129,29 +154,7 @@ class Controller {
             json = null;
             console.error("makeWS json error", error, e.data); // error in the above string (in this case, yes)!
         }
-        if (json) {
-          //receive model per module to stay under websocket size limit of 8192
-          if (json.type && ["appmod","usermod", "sysmod"].includes(json.type)) { //generate array of variables
-            let found = false;
-            for (let module of this.modules.model) {
-              if (module.id == json.id)
-                found = true;
-            }
-            if (!found && json.o) { //initModule done
-              this.modules.addModule(json);
-            }
-            else
-              console.log("html of module already generated", json);
-          }
-          else { //update
-            if (!Array.isArray(json)) {//only the model is an array
-              // console.log("WS receive update", json);
-              this.receiveData(json);
-            }
-            else
-              console.log("dev array not expected", json);
-          }
-        }
+        if (json) this.receiveJson(json);
       }
     }
     this.ws.onclose = (e)=>{
@@ -167,6 +170,31 @@ class Controller {
     }
   } // makeWS
 
+  //json received over ws: a module of the model or updates
+  receiveJson(json) {
+    //receive model per module to stay under websocket size limit of 8192
+    if (json.type && ["appmod","usermod", "sysmod"].includes(json.type)) { //generate array of variables
+      let found = false;
+      for (let module of this.modules.model) {
+        if (module.id == json.id)
+          found = true;
+      }
+      if (!found && json.o) { //initModule done
+        this.modules.addModule(json);
+      }
+      else
+        console.log("html of module already generated", json);
+    }
+    else { //update
+      if (!Array.isArray(json)) {//only the model is an array
+        // console.log("WS receive update", json);
+        this.receiveData(json);
+      }
+      else
+        console.log("dev array not expected", json);
+    }
+  }
+
   requestJson(command) {
     if (window.location.href.includes("127.0.0.1")) { //Live Server
       // after a short delay (ws roundtrip)
@@ -182,6 +210,44 @@ class Controller {
     }
   }
 
+  //binary values: records of [handle:2][tag:1][rowNr:1][value] (see wsValueTags in SysModWeb.h), converted to json updates
+  receiveValues(arrayBuffer) {
+    const valueSizes = [1, 1, 2, 4, 4, 12]; //bool, uint8, uint16, int32, float, coord3D
+    let view = new DataView(arrayBuffer);
+    let json = {};
+    let offset = 1; //byte 0 is the message type
+    while (offset + 4 <= view.byteLength) {
+      let handle = view.getUint16(offset, true);
+      let tag = view.getUint8(offset + 2);
+      let rowNr = view.getUint8(offset + 3);
+      offset += 4;
+      if (tag >= valueSizes.length || offset + valueSizes[tag] > view.byteLength) {
+        console.log("dev receiveValues invalid record", handle, tag, offset);
+        break;
+      }
+      let value;
+      if (tag == 0) value = view.getUint8(offset) != 0;
+      else if (tag == 1) value = view.getUint8(offset);
+      else if (tag == 2) value = view.getUint16(offset, true);
+      else if (tag == 3) value = view.getInt32(offset, true);
+      else if (tag == 4) value = view.getFloat32(offset, true);
+      else value = {"x":view.getInt32(offset, true), "y":view.getInt32(offset + 4, true), "z":view.getInt32(offset + 8, true)};
+      offset += valueSizes[tag];
+
+      let variable = this.modules.findVarByHandle(handle);
+      if (variable) {
+        let pidid = variable.pid + "." + variable.id;
+        if (rowNr != UINT8_MAX) { //update the row in (a copy of) the value array
+          if (!json[pidid]) json[pidid] = {"value": Array.isArray(variable.value)?[...variable.value]:[]};
+          json[pidid].value[rowNr] = value;
+        }
+        else
+          json[pidid] = {"value": value};
+      }
+    }
+    this.receiveData(json);
+  }
+
   receiveData(json) {
     // console.log("receiveData", json)
     if (isObject(json)) {
@@ -16,6 +16,7 @@ const pinTypeInvalid = UINT8_MAX;
 class Modules {
 
   model = [] //model.json (as send by the server), used by FindVar
+  handles = {} //var per handle (variable.h), see findVarByHandle
 
   //generates html for a module
   //for some strange reason, this method does not accept this.otherMethodInThisClass ???
@@ -88,6 +89,18 @@ class Modules {
     })
   }
 
+  //finds the var with handle h (binary values), handles are rebuilt if not found (e.g. new module)
+  findVarByHandle(handle) {
+    if (!this.handles[handle]) {
+      let handles = {};
+      this.walkThroughModel(function(parent, variable) {
+        if (variable.h != null) handles[variable.h] = variable;
+      })
+      this.handles = handles;
+    }
+    return this.handles[handle];
+  }
+
   findParentVar(pid, id) {
     // console.log("findVar", id, parent, model);
     return this.walkThroughModel(function(parent, variable) {
@@ -0,0 +1,341 @@
+/*
+   @title     StarBase
+   @file      SysJsonAllocators.cpp
+   @date      20241219
+   @repo      https://github.com/ewowi/StarBase, submit changes to this file as PRs to ewowi/StarBase
+   @Authors   https://github.com/ewowi/StarBase/commits/main
+   @Copyright © 2024 Github StarBase Commit Authors
+   @license   GNU GENERAL PUBLIC LICENSE Version 3, 29 June 2007
+   @license   For non GPL-v3 usage, commercial licenses must be purchased. Contact moonmodules@icloud.com
+*/
+
+#include "SysJsonAllocators.h"
+
+JsonBlockPool instanceJsonPool("instances", 1024 + 2 * JSON_ALIGN, 4);
+
+static void *heapMalloc(size_t size) {
+  if (psramFound()) return ps_malloc(size); // use PSRAM if it exists
+  else              return malloc(size);    // fallback
+}
+
+// JsonAllocator
+
+JsonAllocator::JsonAllocator(const char * name): name(name) {
+  all().push_back(this);
+}
+
+JsonAllocator::~JsonAllocator() {
+  std::vector<JsonAllocator *> &allocators = all();
+  for (std::vector<JsonAllocator *>::iterator it = allocators.begin(); it != allocators.end(); ++it)
+    if (*it == this) {allocators.erase(it); break;}
+}
+
+std::vector<JsonAllocator *> &JsonAllocator::all() {
+  static std::vector<JsonAllocator *> allocators; //not a global: allocators are made during static initialization
+  return allocators;
+}
+
+void *JsonAllocator::heapAllocate(size_t size, bool fallback) {
+  Header *block = (Header *)heapMalloc(size + JSON_ALIGN);
+  portENTER_CRITICAL(&mux);
+  if (block) {
+    count(size, 0);
+    if (fallback) fallbacks++;
+  }
+  else
+    failures++;
+  portEXIT_CRITICAL(&mux);
+  if (!block) return nullptr;
+  block->size = size;
+  block->kind = k_heap;
+  return payload(block);
+}
+
+void *JsonAllocator::heapReallocate(void *pointer, size_t size) {
+  size_t oldSize = header(pointer)->size;
+  Header *block = (Header *)(psramFound()?ps_realloc(header(pointer), size + JSON_ALIGN):realloc(header(pointer), size + JSON_ALIGN));
+  portENTER_CRITICAL(&mux);
+  if (block) count(size, oldSize); else failures++;
+  portEXIT_CRITICAL(&mux);
+  if (!block) return nullptr; //pointer still valid (realloc)
+  block->size = size;
+  return payload(block);
+}
+
+void JsonAllocator::heapDeallocate(void *pointer) {
+  size_t size = header(pointer)->size;
+  free(header(pointer));
+  portENTER_CRITICAL(&mux);
+  count(0, size);
+  portEXIT_CRITICAL(&mux);
+}
+
+void *JsonAllocator::move(void *pointer, size_t size) {
+  void *result = allocate(size);
+  if (!result) return nullptr;
+  memcpy(result, pointer, min((size_t)header(pointer)->size, size));
+  deallocate(pointer);
+  return result;
+}
+
+// JsonArena
+
+void* JsonArena::allocate(size_t size) {
+  uint8_t sizeClass = 0;
+  while (sizeClass < JSON_ARENA_CLASSES && classSize(sizeClass) < size + JSON_ALIGN) sizeClass++;
+  if (sizeClass == JSON_ARENA_CLASSES) return heapAllocate(size, false); //pools of values: big and long lived, the heap is fine
+
+  for (;;) {
+    portENTER_CRITICAL(&mux);
+    Header *block = (Header *)freeLists[sizeClass];
+    if (block)
+      freeLists[sizeClass] = *(void **)block;
+    else if (chunkUsed + classSize(sizeClass) <= JSON_ARENA_CHUNK) {
+      block = (Header *)(chunk + chunkUsed);
+      chunkUsed += classSize(sizeClass);
+    }
+    if (block) {
+      block->size = size;
+      block->kind = sizeClass;
+      count(size, 0);
+      portEXIT_CRITICAL(&mux);
+      return payload(block);
+    }
+    portEXIT_CRITICAL(&mux);
+
+    //new chunk, outside the mux
+    uint8_t *newChunk = (uint8_t *)heapMalloc(JSON_ARENA_CHUNK);
+    if (!newChunk) return heapAllocate(size, true); //the heap may still have a smaller block
+
+    portENTER_CRITICAL(&mux);
+    //the rest of the current chunk to the free lists
+    for (int8_t rest = JSON_ARENA_CLASSES - 1; rest >= 0; rest--)
+      while (chunk && chunkUsed + classSize(rest) <= JSON_ARENA_CHUNK) {
+        *(void **)(chunk + chunkUsed) = freeLists[rest];
+        freeLists[rest] = chunk + chunkUsed;
+        chunkUsed += classSize(rest);
+      }
+    chunk = newChunk;
+    chunkUsed = 0;
+    reserved += JSON_ARENA_CHUNK;
+    portEXIT_CRITICAL(&mux);
+  }
+}
+
+void JsonArena::deallocate(void* pointer) {
+  if (!pointer) return;
+  Header *block = header(pointer);
+  uint32_t sizeClass = block->kind;
+  if (sizeClass == k_heap) {heapDeallocate(pointer); return;}
+  portENTER_CRITICAL(&mux);
+  count(0, block->size);
+  *(void **)block = freeLists[sizeClass];
+  freeLists[sizeClass] = block;
+  portEXIT_CRITICAL(&mux);
+}
+
+void* JsonArena::reallocate(void* pointer, size_t size) {
+  if (!pointer) return allocate(size);
+  Header *block = header(pointer);
+  if (block->kind == k_heap)
+    return size + JSON_ALIGN > classSize(JSON_ARENA_CLASSES - 1)?heapReallocate(pointer, size):move(pointer, size);
+  if (size + JSON_ALIGN <= classSize(block->kind)) { //fits the block
+    portENTER_CRITICAL(&mux);
+    count(size, block->size);
+    block->size = size;
+    portEXIT_CRITICAL(&mux);
+    return pointer;
+  }
+  return move(pointer, size);
+}
+
+size_t JsonArena::largestFree() {
+  portENTER_CRITICAL(&mux);
+  size_t result = JSON_ARENA_CHUNK - chunkUsed;
+  for (uint8_t sizeClass = 0; sizeClass < JSON_ARENA_CLASSES; sizeClass++)
+    if (freeLists[sizeClass]) result = max(result, classSize(sizeClass));
+  portEXIT_CRITICAL(&mux);
+  return result > JSON_ALIGN?result - JSON_ALIGN:0;
+}
+
+// JsonBumpArena
+
+JsonBumpArena::~JsonBumpArena() {
+  for (size_t i = 0; i < chunkCount; i++) free(chunks[i]);
+}
+
+void* JsonBumpArena::allocate(size_t size) {
+  size_t total = (size + JSON_ALIGN + JSON_ALIGN - 1) & ~(JSON_ALIGN - 1);
+  if (total > JSON_BUMP_CHUNK) return heapAllocate(size, true);
+
+  for (;;) {
+    portENTER_CRITICAL(&mux);
+    if (chunkNr < chunkCount && chunkUsed + total > JSON_BUMP_CHUNK) { //next chunk, the rest of this one is used again after the reset
+      chunkNr++;
+      chunkUsed = 0;
+      last = nullptr;
+    }
+    if (chunkNr < chunkCount) {
+      Header *block = (Header *)(chunks[chunkNr] + chunkUsed);
+      chunkUsed += total;
+      block->size = size;
+      block->kind = chunkNr;
+      count(size, 0);
+      live++;
+      last = payload(block);
+      portEXIT_CRITICAL(&mux);
+      return payload(block);
+    }
+    portEXIT_CRITICAL(&mux);
+
+    //new chunk, outside the mux
+    uint8_t *newChunk = (uint8_t *)heapMalloc(JSON_BUMP_CHUNK);
+    if (!newChunk) return heapAllocate(size, true);
+    portENTER_CRITICAL(&mux);
+    bool added = chunkCount < JSON_BUMP_CHUNKS;
+    if (added) {
+      chunks[chunkCount++] = newChunk;
+      reserved += JSON_BUMP_CHUNK;
+    }
+    portEXIT_CRITICAL(&mux);
+    if (!added) {
+      free(newChunk);
+      return heapAllocate(size, true);
+    }
+  }
+}
+
+void JsonBumpArena::deallocate(void* pointer) {
+  if (!pointer) return;
+  Header *block = header(pointer);
+  if (block->kind == k_heap) {heapDeallocate(pointer); return;}
+  portENTER_CRITICAL(&mux);
+  count(0, block->size);
+  if (pointer == last) { //give the space back
+    chunkUsed = (uint8_t *)block - chunks[chunkNr];
+    last = nullptr;
+  }
+  if (--live == 0) { //reset
+    chunkNr = 0;
+    chunkUsed = 0;
+    last = nullptr;
+  }
+  portEXIT_CRITICAL(&mux);
+}
+
+void* JsonBumpArena::reallocate(void* pointer, size_t size) {
+  if (!pointer) return allocate(size);
+  Header *block = header(pointer);
+  if (block->kind == k_heap)
+    return size + JSON_ALIGN > JSON_BUMP_CHUNK?heapReallocate(pointer, size):move(pointer, size);
+
+  portENTER_CRITICAL(&mux);
+  bool inPlace = size <= block->size; //shrink
+  if (pointer == last) { //grow (or shrink) the last allocation
+    size_t used = ((uint8_t *)pointer - chunks[chunkNr] + size + JSON_ALIGN - 1) & ~(JSON_ALIGN - 1);
+    if (used <= JSON_BUMP_CHUNK) {
+      chunkUsed = used;
+      inPlace = true;
+    }
+  }
+  if (inPlace) {
+    count(size, block->size);
+    block->size = size;
+  }
+  portEXIT_CRITICAL(&mux);
+  return inPlace?pointer:move(pointer, size);
+}
+
+size_t JsonBumpArena::largestFree() {
+  portENTER_CRITICAL(&mux);
+  size_t result = chunkNr + 1 < chunkCount?JSON_BUMP_CHUNK:chunkNr < chunkCount?JSON_BUMP_CHUNK - chunkUsed:0;
+  portEXIT_CRITICAL(&mux);
+  return result > JSON_ALIGN?result - JSON_ALIGN:0;
+}
+
+// JsonBlockPool
+
+JsonBlockPool::JsonBlockPool(const char * name, size_t blockSize, uint8_t blockCount, size_t smallSize, uint8_t smallCount): JsonAllocator(name) {
+  this->blockSize = (blockSize + JSON_ALIGN - 1) & ~(JSON_ALIGN - 1);
+  this->blockCount = min(blockCount, (uint8_t)32);
+  this->smallSize = (smallSize + JSON_ALIGN - 1) & ~(JSON_ALIGN - 1);
+  this->smallCount = min(smallCount, (uint8_t)32);
+  freeBlocks = this->blockCount == 32?UINT32_MAX:(1UL << this->blockCount) - 1;
+  freeSmall = this->smallCount == 32?UINT32_MAX:(1UL << this->smallCount) - 1;
+}
+
+JsonBlockPool::~JsonBlockPool() {
+  free(blocks);
+}
+
+void* JsonBlockPool::allocate(size_t size) {
+  if (size + JSON_ALIGN > blockSize) return heapAllocate(size, true);
+
+  if (!blocks) { //first use
+    uint8_t *newBlocks = (uint8_t *)heapMalloc(blockCount * blockSize + smallCount * smallSize);
+    if (!newBlocks) return heapAllocate(size, true);
+    portENTER_CRITICAL(&mux);
+    if (!blocks) {
+      blocks = newBlocks;
+      newBlocks = nullptr;
+      reserved = blockCount * blockSize + smallCount * smallSize;
+    }
+    portEXIT_CRITICAL(&mux);
+    free(newBlocks); //made by another task at the same time
+  }
+
+  Header *block = nullptr;
+  portENTER_CRITICAL(&mux);
+  if (size + JSON_ALIGN <= smallSize && freeSmall) {
+    uint8_t index = __builtin_ctz(freeSmall);
+    freeSmall &= ~(1UL << index);
+    block = (Header *)(blocks + blockCount * blockSize + index * smallSize);
+    block->kind = 32 + index;
+  }
+  else if (freeBlocks) {
+    uint8_t index = __builtin_ctz(freeBlocks);
+    freeBlocks &= ~(1UL << index);
+    block = (Header *)(blocks + index * blockSize);
+    block->kind = index;
+  }
+  if (block) {
+    block->size = size;
+    count(size, 0);
+  }
+  portEXIT_CRITICAL(&mux);
+
+  return block?payload(block):heapAllocate(size, true);
+}
+
+void JsonBlockPool::deallocate(void* pointer) {
+  if (!pointer) return;
+  Header *block = header(pointer);
+  if (block->kind == k_heap) {heapDeallocate(pointer); return;}
+  portENTER_CRITICAL(&mux);
+  count(0, block->size);
+  if (block->kind < 32) freeBlocks |= 1UL << block->kind;
+  else freeSmall |= 1UL << (block->kind - 32);
+  portEXIT_CRITICAL(&mux);
+}
+
+void* JsonBlockPool::reallocate(void* pointer, size_t size) {
+  if (!pointer) return allocate(size);
+  Header *block = header(pointer);
+  if (block->kind == k_heap)
+    return size + JSON_ALIGN > blockSize?heapReallocate(pointer, size):move(pointer, size);
+  if (size <= capacity(block->kind)) {
+    portENTER_CRITICAL(&mux);
+    count(size, block->size);
+    block->size = size;
+    portEXIT_CRITICAL(&mux);
+    return pointer;
+  }
+  return move(pointer, size);
+}
+
+size_t JsonBlockPool::largestFree() {
+  portENTER_CRITICAL(&mux);
+  size_t result = !blocks || freeBlocks?blockSize:freeSmall?smallSize:0;
+  portEXIT_CRITICAL(&mux);
+  return result > JSON_ALIGN?result - JSON_ALIGN:0;
+}
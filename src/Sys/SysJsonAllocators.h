@@ -0,0 +1,129 @@
+/*
+   @title     StarBase
+   @file      SysJsonAllocators.h
+   @date      20241219
+   @repo      https://github.com/ewowi/StarBase, submit changes to this file as PRs to ewowi/StarBase
+   @Authors   https://github.com/ewowi/StarBase/commits/main
+   @Copyright © 2024 Github StarBase Commit Authors
+   @license   GNU GENERAL PUBLIC LICENSE Version 3, 29 June 2007
+   @license   For non GPL-v3 usage, commercial licenses must be purchased. Contact moonmodules@icloud.com
+*/
+
+#pragma once
+#include "SysModule.h"
+
+// https://arduinojson.org/v7/api/jsondocument/
+//allocators per use of JsonDocuments so they do not fragment the general heap together:
+//  JsonArena: long lived (model, presets), small allocations in size classes reused via free lists
+//  JsonBumpArena: responses cleared each tick, bump allocation, reset when all is freed
+//  JsonBlockPool: short lived documents (instance messages), a fixed set of blocks in one allocation
+//allocations which don't fit are served by the heap (fallbacks). Chunks and blocks are never given back
+
+#define JSON_ALIGN 8 //header before each allocation: size and kind, keeps the alignment ArduinoJson needs
+#define JSON_ARENA_CHUNK 4096
+#define JSON_ARENA_CLASSES 3 //block sizes 32, 64 and 128 (with header)
+#define JSON_BUMP_CHUNK 4096
+#define JSON_BUMP_CHUNKS 16 //max per arena, then the heap
+
+class JsonAllocator: public ArduinoJson::Allocator {
+public:
+  const char * name;
+  size_t used = 0; //bytes allocated now, without headers
+  size_t highWater = 0;
+  size_t reserved = 0; //bytes of chunks / blocks taken from the heap
+  uint32_t fallbacks = 0; //allocations served by the heap as they did not fit
+  uint32_t failures = 0;
+
+  explicit JsonAllocator(const char * name);
+  virtual ~JsonAllocator();
+
+  //largest allocation served without the heap
+  virtual size_t largestFree() = 0;
+
+  //all allocators, for the stats (System arenas)
+  static std::vector<JsonAllocator *> &all();
+
+protected:
+  struct Header {
+    uint32_t size; //requested
+    uint32_t kind; //k_heap or allocator specific
+  };
+  static const uint32_t k_heap = UINT32_MAX;
+
+  portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED; //no heap calls inside, (re)allocating the heap is done outside
+
+  static Header *header(void *pointer) {return (Header *)((uint8_t *)pointer - JSON_ALIGN);}
+  static void *payload(void *block) {return (uint8_t *)block + JSON_ALIGN;}
+  void count(size_t added, size_t removed) {
+    used += added - removed;
+    if (used > highWater) highWater = used;
+  }
+  //psram if found, with header
+  void *heapAllocate(size_t size, bool fallback);
+  void *heapReallocate(void *pointer, size_t size);
+  void heapDeallocate(void *pointer);
+  //new block, copy, free old: for a reallocate which changes blocks
+  void *move(void *pointer, size_t size);
+};
+
+//long lived: model and presets. Values and strings change all the time, freed blocks are reused by the same size class
+class JsonArena: public JsonAllocator {
+public:
+  explicit JsonArena(const char * name): JsonAllocator(name) {}
+
+  void* allocate(size_t size) override;
+  void deallocate(void* pointer) override;
+  void* reallocate(void* pointer, size_t size) override;
+  size_t largestFree() override;
+
+private:
+  static size_t classSize(uint8_t sizeClass) {return 32 << sizeClass;}
+  void *freeLists[JSON_ARENA_CLASSES] = {}; //linked via the first word of the block
+  uint8_t *chunk = nullptr; //current
+  size_t chunkUsed = JSON_ARENA_CHUNK;
+};
+
+//resettable: the response documents, built and cleared (to<JsonObject>) each flush. Continues where the last allocation ended
+class JsonBumpArena: public JsonAllocator {
+public:
+  explicit JsonBumpArena(const char * name): JsonAllocator(name) {}
+  ~JsonBumpArena();
+
+  void* allocate(size_t size) override;
+  void deallocate(void* pointer) override;
+  void* reallocate(void* pointer, size_t size) override;
+  size_t largestFree() override;
+
+private:
+  uint8_t *chunks[JSON_BUMP_CHUNKS] = {}; //no vector: added under the mux
+  size_t chunkCount = 0;
+  size_t chunkNr = 0; //current
+  size_t chunkUsed = 0;
+  size_t live = 0; //allocations not freed: 0 resets to the first chunk
+  void *last = nullptr; //can grow in place
+};
+
+//fixed size blocks in one allocation, big ones (pools of values) and small ones (strings): temporary documents of instance messages
+class JsonBlockPool: public JsonAllocator {
+public:
+  JsonBlockPool(const char * name, size_t blockSize, uint8_t blockCount, size_t smallSize = 64, uint8_t smallCount = 32);
+  ~JsonBlockPool();
+
+  void* allocate(size_t size) override;
+  void deallocate(void* pointer) override;
+  void* reallocate(void* pointer, size_t size) override;
+  size_t largestFree() override;
+
+private:
+  size_t blockSize; //with header
+  uint8_t blockCount; //max 32
+  size_t smallSize;
+  uint8_t smallCount; //max 32
+  uint8_t *blocks = nullptr; //blockCount blocks then smallCount small blocks, allocated at first use
+  uint32_t freeBlocks; //bit per block
+  uint32_t freeSmall;
+
+  size_t capacity(uint32_t kind) {return (kind < 32?blockSize:smallSize) - JSON_ALIGN;}
+};
+
+extern JsonBlockPool instanceJsonPool;
@@ -15,6 +15,7 @@
 #include "SysModPrint.h"
 #include "SysModModel.h"
 #include "SysModSystem.h"
+#include "SysStarJson.h"
 
 // #include <FS.h>
 
@@ -24,6 +25,8 @@ SysModFiles::SysModFiles() :SysModule("Files") {
     ppf(" fail\n");
     success = false;
   }
+  else
+    scanIndex();
 };
 
 void SysModFiles::setup() {
@@ -87,54 +90,141 @@ void SysModFiles::setup() {
 }
 
 void SysModFiles::loop20ms() {
+  refreshIndex();
+}
+
+void SysModFiles::refreshIndex() {
+
+  if (!filesChanged && !dirtyCount) return;
 
-  if (filesChanged) {
+  size_t oldCount = fileNames.size();
+
+  char paths[FILES_DIRTY_MAX][32];
+  portENTER_CRITICAL(&dirtyMux);
+  uint8_t count = dirtyCount;
+  memcpy(paths, dirtyPaths, count * sizeof(paths[0]));
+  dirtyCount = 0;
+  portEXIT_CRITICAL(&dirtyMux);
+
+  if (filesChanged || count > FILES_DIRTY_MAX) { //overflow: count is FILES_DIRTY_MAX + 1
     filesChanged = false;
+    scanIndex();
+  }
+  else
+    for (uint8_t i = 0; i < count; i++) refreshIndex(paths[i]);
 
-    File root = LittleFS.open("/");
-    File file = root.openNextFile();
-
-    //repopulate file list
-    fileNames.clear();
-    fileSizes.clear();
-    fileTimes.clear();
-    uint8_t rowNr = 0;
-    while (file) {
-
-      while (rowNr >= fileNames.size()) fileNames.push_back(VectorString()); //create vector space if needed...
-      strlcpy(fileNames[rowNr].s, file.name(), sizeof(fileNames[rowNr].s));
-      while (rowNr >= fileSizes.size()) fileSizes.push_back(UINT8_MAX); //create vector space if needed...
-      fileSizes[rowNr] = file.size(); 
-      while (rowNr >= fileTimes.size()) fileTimes.push_back(UINT8_MAX); //create vector space if needed...
-      fileTimes[rowNr] = file.getLastWrite(); // - millis()/1000; if (details.time < 0) details.time = 0;
-
-      file.close();
-      file = root.openNextFile();
-      rowNr++;
-    }
-    root.close();
+  pushChanges(oldCount);
+
+  mdl->setValue("Files", "totalSize", files->usedBytes());
+}
+
+void SysModFiles::markChanged(const char * path) {
+  if (*path == '/') path++;
+  if (strchr(path, '/')) return; //not in root, not indexed
+  portENTER_CRITICAL(&dirtyMux);
+  bool found = false;
+  for (uint8_t i = 0; i < min(dirtyCount, (uint8_t)FILES_DIRTY_MAX); i++)
+    if (strncmp(dirtyPaths[i], path, sizeof(dirtyPaths[i])) == 0) found = true;
+  if (!found) {
+    if (dirtyCount < FILES_DIRTY_MAX) strlcpy(dirtyPaths[dirtyCount], path, sizeof(dirtyPaths[dirtyCount]));
+    if (dirtyCount <= FILES_DIRTY_MAX) dirtyCount++; //FILES_DIRTY_MAX + 1: rescan
+  }
+  portEXIT_CRITICAL(&dirtyMux);
+}
+
+void SysModFiles::scanIndex() {
+  fileNames.clear();
+  fileSizes.clear();
+  fileTimes.clear();
 
-    mdl->setValue("Files", "totalSize", files->usedBytes());
+  File root = LittleFS.open("/");
+  File file = root.openNextFile();
+  while (file) {
+    bool found;
+    size_t rowNr = findIndex(file.name(), &found); //keep sorted whatever order
+    VectorString name;
+    strlcpy(name.s, file.name(), sizeof(name.s));
+    fileNames.insert(fileNames.begin() + rowNr, name);
+    fileSizes.insert(fileSizes.begin() + rowNr, file.size());
+    fileTimes.insert(fileTimes.begin() + rowNr, file.getLastWrite()); // - millis()/1000; if (details.time < 0) details.time = 0;
+    file.close();
+    file = root.openNextFile();
+  }
+  root.close();
+}
 
-    uint8_t rowNrL = 0;
-    for (VectorString name: fileNames) {
-      mdl->setValue("files", "name", JsonString(name.s), rowNrL);
-      mdl->setValue("files", "edit", JsonString(name.s), rowNrL);
-      rowNrL++;
+void SysModFiles::refreshIndex(const char * name) {
+  char path[33] = "/";
+  strlcat(path, name, sizeof(path));
+  bool found;
+  size_t rowNr = findIndex(name, &found);
+
+  File file = LittleFS.exists(path)?LittleFS.open(path, FILE_READ):File();
+  if (file) {
+    if (!found) {
+      VectorString vectorString;
+      strlcpy(vectorString.s, name, sizeof(vectorString.s));
+      fileNames.insert(fileNames.begin() + rowNr, vectorString);
+      fileSizes.insert(fileSizes.begin() + rowNr, 0);
+      fileTimes.insert(fileTimes.begin() + rowNr, 0);
     }
-    rowNrL = 0; for (uint16_t size: fileSizes) mdl->setValue("files", "size", size, rowNrL++);
-    rowNrL = 0; for (uint16_t time: fileTimes) mdl->setValue("files", "time", time, rowNrL++);
+    fileSizes[rowNr] = file.size();
+    fileTimes[rowNr] = file.getLastWrite();
+    file.close();
+  }
+  else if (found) {
+    fileNames.erase(fileNames.begin() + rowNr);
+    fileSizes.erase(fileSizes.begin() + rowNr);
+    fileTimes.erase(fileTimes.begin() + rowNr);
   }
 }
 
+size_t SysModFiles::findIndex(const char * name, bool *found) {
+  size_t low = 0, high = fileNames.size();
+  while (low < high) {
+    size_t mid = (low + high) / 2;
+    if (strncmp(fileNames[mid].s, name, sizeof(fileNames[mid].s)) < 0) low = mid + 1;
+    else high = mid;
+  }
+  *found = low < fileNames.size() && strncmp(fileNames[low].s, name, sizeof(fileNames[low].s)) == 0;
+  return low;
+}
+
+void SysModFiles::pushChanges(size_t oldCount) {
+  Variable tableVar = Variable("Files", "files");
+  if (!tableVar.var) return; //before setup
+
+  //new rows on the client(s), the cells follow
+  for (size_t rowNr = oldCount; rowNr < fileNames.size(); rowNr++)
+    tableVar.insertRow(rowNr);
+
+  //per column the changed cells only
+  std::vector<JsonString> names;
+  for (const VectorString &fileName: fileNames) names.push_back(JsonString(fileName.s));
+  Variable("files", "name").setValues(names);
+  Variable("files", "edit").setValues(names);
+  Variable("files", "size").setValues(fileSizes);
+  Variable("files", "time").setValues(fileTimes);
+
+  //removed rows, from the last
+  for (size_t rowNr = oldCount; rowNr-- > fileNames.size(); )
+    tableVar.deleteRow(rowNr);
+}
+
 void SysModFiles::loop10s() {
   mdl->setValue("Files", "totalSize", files->usedBytes());
 }
 
 bool SysModFiles::remove(const char * path) {
   ppf("File remove %s\n", path);
+  markChanged(path);
   return LittleFS.remove(path);
-  filesChanged = true;
+}
+
+bool SysModFiles::rename(const char * from, const char * to) {
+  markChanged(from);
+  markChanged(to);
+  return LittleFS.rename(from, to);
 }
 
 size_t SysModFiles::usedBytes() {
@@ -146,88 +236,60 @@ size_t SysModFiles::totalBytes() {
 }
 
 File SysModFiles::open(const char * path, const char * mode, const bool create) {
+  if (create || mode[0] != 'r' || mode[1] == '+') markChanged(path); //written: size and time refreshed in loop20ms
   return LittleFS.open(path, mode, create);
 }
 
-// https://techtutorialsx.com/2019/02/24/esp32-arduino-listing-files-in-a-spiffs-file-system-specific-path/
+//from the index, in the order of the files table
 void SysModFiles::dirToJson(JsonArray array, bool nameOnly, const char * filter) {
-  File root = LittleFS.open("/");
-  File file = root.openNextFile();
-
-  while (file) {
-
-    if (filter == nullptr || strnstr(file.name(), filter, 32) != nullptr) {
+  for (size_t rowNr = 0; rowNr < fileNames.size(); rowNr++) {
+    const char *name = fileNames[rowNr].s;
+    if (filter == nullptr || strnstr(name, filter, 32) != nullptr) {
       if (nameOnly) {
-        array.add(JsonString(file.name()));
+        array.add(JsonString(name));
       }
       else {
         JsonArray row = array.add<JsonArray>();
-        row.add(JsonString(file.name()));
-        row.add(file.size());
+        row.add(JsonString(name));
+        row.add(fileSizes[rowNr]);
         char urlString[32] = "file/";
-        strlcat(urlString, file.name(), sizeof(urlString));
+        strlcat(urlString, name, sizeof(urlString));
         row.add(JsonString(urlString));
       }
-      // ppf("FILE: %s %d\n", file.name(), file.size());
     }
-
-    file.close();
-    file = root.openNextFile();
   }
-
-  root.close();
 }
 
 bool SysModFiles::seqNrToName(char * fileName, size_t seqNr, const char * filter) {
-
-  File root = LittleFS.open("/");
-  File file = root.openNextFile();
-
   size_t counter = 0;
-  while (file) {
-    if (filter == nullptr || strnstr(file.name(), filter, 32) != nullptr) {
+  for (VectorString &name: fileNames) {
+    if (filter == nullptr || strnstr(name.s, filter, 32) != nullptr) {
       if (counter == seqNr) {
-        // ppf("seqNrToName: %d %s %d\n", seqNr, file.name(), file.size());
-        root.close();
         strlcat(fileName, "/", 32); //add root prefix
-        strlcat(fileName, file.name(), 32);
-        file.close();
+        strlcat(fileName, name.s, 32);
         return true;
       }
       counter++;
     }
-    file.close();
-    file = root.openNextFile();
   }
-
-  root.close();
   return false;
 }
 
 bool SysModFiles::nameToSeqNr(const char * fileName, size_t *seqNr, const char * filter) {
-
-  File root = LittleFS.open("/");
-  File file = root.openNextFile();
-
   *seqNr = UINT8_MAX;
+  if (*fileName == '/') fileName++;
 
   size_t counter = 0;
-  while (file) {
-    if (filter == nullptr || strnstr(file.name(), filter, 32) != nullptr) {
-      if (strnstr(fileName, file.name(), 32) != nullptr) { //fileName starts with "/"
-        ppf("nameToSeqNr: %d %s - %s %d found !!\n", *seqNr, fileName, file.name(), file.size());
-        root.close();
+  for (VectorString &name: fileNames) {
+    if (filter == nullptr || strnstr(name.s, filter, 32) != nullptr) {
+      if (strncmp(fileName, name.s, 32) == 0) {
+        ppf("nameToSeqNr: %d %s found !!\n", counter, fileName);
         *seqNr = counter;
-        file.close();
         return true;
       }
       counter++;
     }
-    file.close();
-    file = root.openNextFile();
   }
-
-  root.close();
   return false;
 }
 
@@ -256,32 +318,126 @@ bool SysModFiles::readObjectFromFile(const char* path, JsonDocument* dest) {
 bool SysModFiles::writeObjectToFile(const char* path, JsonDocument* dest) {
   File f = open(path, FILE_WRITE);
   if (f) {
-    serializeJson(*dest, f);
-    f.close();
-    filesChanged = true;
-    return true;
+    bool result;
+    {
+      StarJsonBufferedPrint out(f); //page sized writes instead of one per token
+      serializeJson(*dest, out);
+      result = out.flushBuffer();
+    }
+    f.close(); //open marked it changed
+    if (!result) ppf("File %s write not complete\n", path);
+    return result;
   } else {
     ppf("File %s open not successful\n", path);
     return false;
   }
 }
 
-void SysModFiles::removeFiles(const char * filter, bool reverse) {
-  File root = LittleFS.open("/");
-  File file = root.openNextFile();
+//header of a snapshot file, followed by the MessagePack data
+struct SnapshotHeader {
+  char magic[4] = {'S','B','M','P'};
+  uint8_t version = 2;
+  uint32_t sourceHash = 0;
+  uint32_t jsonMicros = 0;
+};
 
-  while (file) {
-    if (filter == nullptr || reverse?strnstr(file.name(), filter, 32) == nullptr: strnstr(file.name(), filter, 32) != nullptr) {
-      char fileName[32] = "/";
-      strlcat(fileName, file.name(), sizeof(fileName));
-      file.close(); //close otherwise not removeable
-      remove(fileName);
+static void snapshotPath(char * snapshotPath, size_t size, const char * path) {
+  strlcpy(snapshotPath, path, size);
+  char * ext = strrchr(snapshotPath, '.');
+  if (ext) *ext = '\0';
+  strlcat(snapshotPath, ".mpk", size);
+}
+
+bool SysModFiles::readSnapshot(const char* path, JsonDocument* dest, uint32_t sourceHash, unsigned long *jsonMicros) {
+  char mpkPath[32];
+  snapshotPath(mpkPath, sizeof(mpkPath), path);
+  if (!LittleFS.exists(mpkPath)) return false;
+
+  File f = open(mpkPath, FILE_READ);
+  if (!f) return false;
+
+  SnapshotHeader header;
+  SnapshotHeader expected;
+  bool valid = f.read((uint8_t *)&header, sizeof(header)) == sizeof(header) && memcmp(header.magic, expected.magic, sizeof(header.magic)) == 0 && header.version == expected.version;
+  if (valid && header.sourceHash != sourceHash) {
+    ppf("readSnapshot %s outdated %08x != %08x\n", mpkPath, header.sourceHash, sourceHash);
+    valid = false;
+  }
+
+  if (valid) {
+    DeserializationError error = deserializeMsgPack(*dest, f, DeserializationOption::NestingLimit(20)); //StarBase requires more then 10
+    if (error) {
+      ppf("readSnapshot %s deserializeMsgPack failed with code %s\n", mpkPath, error.c_str());
+      valid = false;
     }
-    else
-      file.close();
+    else if (jsonMicros) *jsonMicros = header.jsonMicros;
+  }
+  f.close();
 
-    file = root.openNextFile();
+  if (!valid) remove(mpkPath); //will be recreated from the json file
+  return valid;
+}
+
+bool SysModFiles::writeSnapshot(const char* path, JsonDocument* src, uint32_t sourceHash, unsigned long jsonMicros) {
+  char mpkPath[32];
+  snapshotPath(mpkPath, sizeof(mpkPath), path);
+  char tmpPath[36];
+  print->fFormat(tmpPath, sizeof(tmpPath), "%s.tmp", mpkPath);
+
+  File f = open(tmpPath, FILE_WRITE);
+  if (!f) {
+    ppf("File %s open not successful\n", tmpPath);
+    return false;
   }
+  SnapshotHeader header;
+  header.sourceHash = sourceHash;
+  header.jsonMicros = jsonMicros;
+  f.write((uint8_t *)&header, sizeof(header));
+  size_t size = serializeMsgPack(*src, f);
+  f.close();
+
+  //rename only if complete, so a snapshot is never half written
+  bool result = size && rename(tmpPath, mpkPath);
+  ppf("writeSnapshot %s %d bytes %s\n", mpkPath, size, result?"":"failed");
+  if (!result) remove(tmpPath);
+  return result;
+}
 
-  root.close();
+void SysModFiles::removeSnapshot(const char* path) {
+  char mpkPath[32];
+  snapshotPath(mpkPath, sizeof(mpkPath), path);
+  if (LittleFS.exists(mpkPath)) remove(mpkPath);
+}
+
+size_t SysModFiles::fileSize(const char* path) {
+  if (!LittleFS.exists(path)) return 0;
+  File f = open(path, FILE_READ);
+  size_t size = f?f.size():0;
+  f.close();
+  return size;
+}
+
+uint32_t SysModFiles::contentHash(const char* path, uint32_t hash) {
+  if (!LittleFS.exists(path)) return hash;
+  File f = open(path, FILE_READ);
+  if (!f) return hash;
+  uint8_t buffer[256];
+  size_t len;
+  while ((len = f.read(buffer, sizeof(buffer))) > 0) {
+    for (size_t i = 0; i < len; i++)
+      hash = (hash ^ buffer[i]) * 16777619;
+  }
+  f.close();
+  return hash;
+}
+
+void SysModFiles::removeFiles(const char * filter, bool reverse) {
+  std::vector<VectorString> names = fileNames; //the index changes in loop20ms only, copy to be sure
+  for (VectorString &name: names) {
+    if (filter == nullptr || reverse?strnstr(name.s, filter, 32) == nullptr: strnstr(name.s, filter, 32) != nullptr) {
+      char fileName[33] = "/";
+      strlcat(fileName, name.s, sizeof(fileName));
+      remove(fileName);
+    }
+  }
 }
\ No newline at end of file
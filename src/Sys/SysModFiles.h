@@ -18,8 +18,9 @@ class SysModFiles: public SysModule {
 
 public:
 
-  bool filesChanged = true; //init files table;
+  bool filesChanged = true; //rescan the whole directory (init files table)
 
+  //index of the root directory, sorted by name as LittleFS lists them, also the files table
   std::vector<VectorString> fileNames;
   std::vector<uint16_t> fileSizes;
   std::vector<uint16_t> fileTimes;
@@ -31,6 +32,9 @@ public:
 
   bool remove(const char * path);
 
+  //rename, replaces to if it exists (atomic in LittleFS)
+  bool rename(const char * from, const char * to);
+
   size_t usedBytes();
 
   size_t totalBytes();
@@ -52,9 +56,40 @@ public:
   //name is copied from WLED but better to call it readJsonFrom file
   bool writeObjectToFile(const char* path, JsonDocument* dest);
 
+  //binary (MessagePack) snapshot of a json file (/name.json -> /name.mpk) for faster reading
+  //valid if sourceHash (contentHash of the json file(s) it was made from) is unchanged, jsonMicros: time it took to read the json
+  bool readSnapshot(const char* path, JsonDocument* dest, uint32_t sourceHash, unsigned long *jsonMicros = nullptr);
+  bool writeSnapshot(const char* path, JsonDocument* src, uint32_t sourceHash, unsigned long jsonMicros);
+  //call if the json file is changed
+  void removeSnapshot(const char* path);
+
+  //0 if not exists
+  size_t fileSize(const char* path);
+
+  //FNV-1a of the bytes of the file, continuing from hash (to combine files), hash if not exists
+  uint32_t contentHash(const char* path, uint32_t hash = 2166136261);
+
   //remove files meeting filter condition, if no filter, all, if reverse then all but filter
   void removeFiles(const char * filter = nullptr, bool reverse = false);
 
+  //path created, written, renamed or removed: its index entry and table row are refreshed in loop20ms (any task)
+  void markChanged(const char * path);
+
+  //apply the changes marked so far to the index and table now (loopTask), e.g. before using a just uploaded file
+  void refreshIndex();
+
+private:
+  #define FILES_DIRTY_MAX 8 //more changes before loop20ms: rescan the directory
+  char dirtyPaths[FILES_DIRTY_MAX][32];
+  uint8_t dirtyCount = 0;
+  portMUX_TYPE dirtyMux = portMUX_INITIALIZER_UNLOCKED;
+
+  void scanIndex();
+  void refreshIndex(const char * name); //name without /
+  size_t findIndex(const char * name, bool *found); //row of name, or where it would be inserted
+  //push the changed cells of the index to the files table, rows added or removed since oldCount rows
+  void pushChanges(size_t oldCount);
+
 };
 
 extern SysModFiles *files;
\ No newline at end of file
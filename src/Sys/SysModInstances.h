@@ -17,6 +17,8 @@
 #include "SysModSystem.h"
 #include "SysModNetwork.h" //for localIP
 #include "SysModules.h"
+#include "SysModWeb.h" //for WSValue
+#include "SysModModel.h"
 
 struct DMX {
   byte universe:3; //3 bits / 8
@@ -41,15 +43,148 @@ struct VarData {
   byte value;
 }; //4
 
-//note: changing SysData and jsonData sizes: all instances should have the same version so change with care
+//note: changing SysData and values sizes: all instances should have the same version so change with care
+
+//columns of the instances table, ic_dash: all ins<pid>_<id> columns
+enum instanceColumns {ic_name, ic_show, ic_link, ic_IP, ic_type, ic_version, ic_uptime, ic_now, ic_timestamp, ic_time, ic_ms, ic_offset, ic_jitter, ic_dash, ic_count};
+static const char * instanceColumnIds[ic_dash] = {"name", "show", "link", "IP", "type", "version", "uptime", "now", "timestamp", "time", "ms", "offset", "jitter"};
+
+#define INSTANCE_MAX_VALUES 8 //dash values (each row counts) stored per instance
+#define INSTANCE_TIMEOUT 32 //seconds without announcement before an instance is removed (announced each 10s)
+#define INSTANCE_WHEEL_SIZE 64 //seconds, > INSTANCE_TIMEOUT
+
+#define TIMESYNC_SAMPLES 8 //per instance, the one with the lowest rtt is used (least queuing)
+#define TIMESYNC_STEP_MS 100 //larger offsets are corrected at once, smaller ones slewed 1 ms per 20 ms
+
+//time sync exchange with another instance, offsets as if the own clock was never adjusted (see SysModInstances::clockAdjusted)
+struct TimeSyncSample {
+  int32_t offset; //of the instance now clock (millis() + timebase) to ours
+  int32_t tokiOffset; //of the instance toki to ours, rtt compensated
+  uint16_t rtt;
+};
+
+//dash value of another instance
+struct InstanceValue {
+  uint32_t key; //varIndexKey of pid.id
+  WSValue value; //tag, rowNr (UINT8_MAX if not an array) and value, handle not used
+};
 
 struct InstanceInfo {
   IPAddress ip;
   char name[32];
   uint32_t version; //release/version date build
-  unsigned long timeStamp; //when was the package received, used to check on aging
+  unsigned long timeStamp; //when was the package received
+  uint32_t expirySecond = 0; //millis()/1000 when removed if no new announcement, see SysModInstances::touchInstance
   SysData sysData;
-  JsonDocument jsonData;
+  InstanceValue values[INSTANCE_MAX_VALUES]; //bounded instead of a JsonDocument per instance
+  uint8_t valuesCount = 0;
+
+  //set the value of a dash var, arrays one value per row. Strings are not stored. Returns true if changed
+  bool setValue(uint32_t key, JsonVariant value) {
+    if (key == 0) return false; //unknown var, see dashKey
+    WSValue newValues[INSTANCE_MAX_VALUES];
+    uint8_t newCount = 0;
+    if (value.is<JsonArray>()) {
+      uint8_t rowNr = 0;
+      for (JsonVariant element: value.as<JsonArray>()) {
+        if (newCount < INSTANCE_MAX_VALUES && web->valueToWSValue(element, newValues[newCount])) newValues[newCount++].rowNr = rowNr;
+        rowNr++;
+      }
+    }
+    else if (web->valueToWSValue(value, newValues[newCount]))
+      newValues[newCount++].rowNr = UINT8_MAX;
+    return setValues(key, newValues, newCount);
+  }
+  //binary value: a row (rowNr) only replaces that row, UINT8_MAX all values of key
+  bool setValue(uint32_t key, const WSValue &wsValue) {
+    if (key == 0) return false;
+    if (wsValue.rowNr == UINT8_MAX) return setValues(key, &wsValue, 1);
+    for (uint8_t v = 0; v < valuesCount; v++) {
+      if (values[v].key != key) continue;
+      if (values[v].value.rowNr == UINT8_MAX) break; //stored as single value, replace all
+      if (values[v].value.rowNr != wsValue.rowNr) continue;
+      if (sameValue(values[v].value, wsValue)) return false;
+      values[v].value = wsValue;
+      return true;
+    }
+    //new row
+    uint8_t count = 0;
+    for (uint8_t v = 0; v < valuesCount; v++)
+      if (values[v].key != key || values[v].value.rowNr != UINT8_MAX) values[count++] = values[v];
+    if (count == INSTANCE_MAX_VALUES) {
+      ppf("dev instance %s values full (%d)\n", name, INSTANCE_MAX_VALUES);
+      valuesCount = count;
+      return false;
+    }
+    values[count].key = key;
+    values[count++].value = wsValue;
+    valuesCount = count;
+    return true;
+  }
+
+  //replace all values of key by newValues, returns true if changed
+  bool setValues(uint32_t key, const WSValue *newValues, uint8_t newCount) {
+    //unchanged if the same values in the same order
+    uint8_t i = 0;
+    bool changed = false;
+    for (uint8_t v = 0; v < valuesCount; v++) {
+      if (values[v].key != key) continue;
+      if (i >= newCount || !sameValue(values[v].value, newValues[i])) changed = true;
+      i++;
+    }
+    if (!changed && i == newCount) return false;
+
+    //remove the old values of key, add the new ones
+    uint8_t count = 0;
+    for (uint8_t v = 0; v < valuesCount; v++)
+      if (values[v].key != key) values[count++] = values[v];
+    for (i = 0; i < newCount && count < INSTANCE_MAX_VALUES; i++) {
+      values[count].key = key;
+      values[count++].value = newValues[i];
+    }
+    if (i < newCount) ppf("dev instance %s values full (%d)\n", name, INSTANCE_MAX_VALUES);
+    valuesCount = count;
+    return true;
+  }
+
+  static bool sameValue(const WSValue &a, const WSValue &b) {
+    return a.tag == b.tag && a.rowNr == b.rowNr && memcmp(a.value, b.value, sizeof(a.value)) == 0;
+  }
+
+  //value of a dash var into dest, an array if stored per row, null if not stored
+  void getValue(uint32_t key, JsonVariant dest) const {
+    for (uint8_t v = 0; v < valuesCount; v++) {
+      if (values[v].key != key) continue;
+      if (values[v].value.rowNr == UINT8_MAX)
+        toJson(values[v].value, dest);
+      else
+        toJson(values[v].value, dest[values[v].value.rowNr].to<JsonVariant>());
+    }
+  }
+
+  static void toJson(const WSValue &wsValue, JsonVariant dest) {
+    switch (wsValue.tag) {
+      case vt_bool: dest.set((bool)wsValue.value[0]); break;
+      case vt_uint8: case vt_uint16: case vt_int32: dest.set(wsValue.value[0]); break;
+      case vt_float: {
+        float value;
+        memcpy(&value, &wsValue.value[0], sizeof(value));
+        dest.set(value);
+        break;
+      }
+      case vt_Coord3D: dest["x"] = wsValue.value[0]; dest["y"] = wsValue.value[1]; dest["z"] = wsValue.value[2]; break;
+    }
+  }
+  uint32_t syncBootId = 0; //of the last var sync packet received, see UDPVarSyncHeader
+  uint32_t syncSeq = 0;
+  uint32_t contentHash = 0; //of the last applied compact message, 0: unknown, see UDPStarCompactHeader
+  uint16_t changedColumns = 0; //bits of instanceColumns, cells to send to the UI, see sendInstanceChanges
+  TimeSyncSample syncSamples[TIMESYNC_SAMPLES]; //ring buffer, see receiveTimeSyncUDP
+  uint8_t syncSampleCount = 0;
+  uint8_t syncSampleNext = 0;
+  int32_t syncOffset = 0; //ms the instance's now is ahead of ours, filtered
+  uint16_t syncJitter = 0; //ms, mean deviation of the samples
+  uint16_t syncRtt = 0; //ms, round trip of the best sample
 };
 
 struct UDPWLEDMessage {
@@ -72,6 +207,71 @@ struct UDPStarMessage {
   char jsonString[1460 - sizeof(UDPWLEDMessage) - sizeof(SysData)];
 };
 
+#define UDP_STAR_COMPACT_TOKEN "SC"
+#define UDP_STAR_COMPACT_VERSION 2
+#define UDP_STAR_COMPACT_FULL_REFRESH 6 //each 6th announcement (once a minute) contains all fields
+
+//compact StarBase message: UDPWLEDMessage header (WLED only interprets these 44 bytes), UDPStarCompactHeader
+//followed by records of [type:1 (see starTLVTypes)][len:1][value:len]. Sized to its content and always smaller
+//than UDPStarMessage so the packet size tells them apart
+enum starTLVTypes {
+  st_time, //StarTLVTime, changes each announcement so always sent
+  st_type, //SysData.type
+  st_dmx, //SysData.dmx
+  st_mac, //SysData.macAddress
+  st_dash, //[pid.id\0][json value] of a dash var, one record per var
+  st_count
+};
+
+enum starCompactFlags {
+  sc_full = 1 //all fields, otherwise only fields changed since the previous announcement
+};
+
+struct UDPStarCompactHeader {
+  char token[2]; //UDP_STAR_COMPACT_TOKEN
+  uint8_t version; //UDP_STAR_COMPACT_VERSION
+  uint8_t flags; //starCompactFlags
+  uint32_t baseHash; //hash of the previous announcement, a delta applies to it
+  uint32_t hash; //FNV-1a of all fields except st_time, unchanged: receivers skip the records
+} __attribute__((packed)); //12 bytes
+
+struct StarTLVTime {
+  uint32_t uptime;
+  uint32_t now;
+  uint8_t timeSource;
+  uint32_t tokiTime;
+  uint16_t tokiMs;
+} __attribute__((packed)); //15 bytes
+
+#define UDP_TIMESYNC_TOKEN "SBTS"
+
+enum timeSyncTypes {ts_request, ts_response};
+
+//NTP like timestamp exchange: the requester sends t1, the responder adds t2 (received) and t3 (send) in its now clock (millis() + timebase)
+//offset = ((t2 - t1) + (t3 - t4)) / 2, rtt = (t4 - t1) - (t3 - t2) with t4 the requester's receive time
+struct UDPTimeSyncMessage {
+  char token[4]; //UDP_TIMESYNC_TOKEN
+  uint8_t type; //timeSyncTypes
+  uint32_t seq;
+  uint32_t t1;
+  uint32_t t2;
+  uint32_t t3;
+  uint32_t tokiSec; //toki of the responder at t3
+  uint16_t tokiMs;
+  uint8_t timeSource; //toki time source of the responder
+} __attribute__((packed)); //28 bytes
+
+#define UDP_VARSYNC_TOKEN "SBVS"
+
+//binary dash var sync to the instances of the group: header followed by count records of
+//[key:4 (varIndexKey of pid.id)][tag:1 (see wsValueTags)][rowNr:1][value:1,2,4 or 12], little endian
+struct UDPVarSyncHeader {
+  char token[4]; //UDP_VARSYNC_TOKEN
+  uint32_t bootId; //random per boot of the sender, a new bootId restarts the sequence
+  uint32_t seq; //per packet, receivers discard packets which are not newer than the last received
+  uint8_t count; //nr of records
+} __attribute__((packed)); //13 bytes
+
 //WLED syncmessage 1193 bytes
 struct UDPWLEDSyncMessage { //see notify( in WLED
   byte protocol; //0
@@ -104,8 +304,11 @@ class SysModInstances:public SysModule {
 
 public:
 
-  std::vector<InstanceInfo> instances;
+  std::vector<InstanceInfo> instances; //index is the rowNr in the instances table. Stable: added at the end, a removed one is replaced by the last
   std::vector<JsonObject> changedVarsQueue;
+  bool3State batchSync = true; //dash var changes of a tick in one binary packet (otherwise one json packet per var)
+  bool3State compactInfo = true; //announce in UDPStarCompactHeader format (otherwise legacy 1460 bytes UDPStarMessage)
+  bool3State timeSync = true; //measured rtt time sync with the time reference of the group (otherwise presumed network delay)
 
   SysModInstances() :SysModule("Instances") {
   };
@@ -115,12 +318,32 @@ public:
 
     const Variable parentVar = ui->initSysMod(Variable(), name, 3000);
 
+    ui->initCheckBox(parentVar, "batchSync", &batchSync, false, [](EventArguments) { switch (eventType) {
+      case onUI:
+        variable.setComment("Dash changes per 20ms in one binary packet");
+        return true;
+      default: return false;
+    }});
+
+    ui->initCheckBox(parentVar, "compactInfo", &compactInfo, false, [](EventArguments) { switch (eventType) {
+      case onUI:
+        variable.setComment("Announce only changes, off: full 1460 bytes (older versions)");
+        return true;
+      default: return false;
+    }});
+
+    ui->initCheckBox(parentVar, "timeSync", &timeSync, false, [](EventArguments) { switch (eventType) {
+      case onUI:
+        variable.setComment("Measure offset and rtt to the group, off: presumed delay");
+        return true;
+      default: return false;
+    }});
+
     Variable tableVar = ui->initTable(parentVar, "instances", nullptr, true);
     
     ui->initText(tableVar, "name", nullptr, 32, false, [this](EventArguments) { switch (eventType) {
       case onSetValue:
-        for (size_t rowNrL = 0; rowNrL < instances.size() && (rowNr == UINT8_MAX || rowNrL == rowNr); rowNrL++)
-          variable.setValue(JsonString(instances[rowNrL].name), rowNrL);
+        setColumn<JsonString>(variable, rowNr, [](const InstanceInfo &instance) {return JsonString(instance.name);});
         return true;
       // comment this out for the time being as causes corrupted instance names
       // case onChange:
@@ -143,8 +366,7 @@ public:
 
     ui->initNumber(tableVar, "link", UINT16_MAX, 0, UINT16_MAX, true, [this](EventArguments) { switch (eventType) {
       case onSetValue:
-        for (size_t rowNrL = 0; rowNrL < instances.size() && (rowNr == UINT8_MAX || rowNrL == rowNr); rowNrL++)
-          variable.setValue(calcGroup(instances[rowNrL].name), rowNrL);
+        setColumn<uint8_t>(variable, rowNr, [this](const InstanceInfo &instance) {return calcGroup(instance.name);});
         return true;
       default: return false;
     }});
@@ -159,57 +381,68 @@ public:
 
     ui->initText(tableVar, "type", nullptr, 16, true, [this](EventArguments) { switch (eventType) {
       case onSetValue:
-        for (size_t rowNrL = 0; rowNrL < instances.size() && (rowNr == UINT8_MAX || rowNrL == rowNr); rowNrL++) {
-          byte type = instances[rowNrL].sysData.type;
-          variable.setValue((type==0)?"WLED":(type==1)?"StarBase":(type==2)?"StarLight":(type==3)?"StarLedsLive":"StarFork", rowNrL);
-        }
+        setColumn<JsonString>(variable, rowNr, [](const InstanceInfo &instance) {
+          byte type = instance.sysData.type;
+          return JsonString((type==0)?"WLED":(type==1)?"StarBase":(type==2)?"StarLight":(type==3)?"StarLedsLive":"StarFork");
+        });
         return true;
       default: return false;
     }});
 
     ui->initNumber(tableVar, "version", UINT16_MAX, 0, (unsigned long)-1, true, [this](EventArguments) { switch (eventType) {
       case onSetValue:
-        for (size_t rowNrL = 0; rowNrL < instances.size() && (rowNr == UINT8_MAX || rowNrL == rowNr); rowNrL++)
-          variable.setValue(instances[rowNrL].version, rowNrL);
+        setColumn<uint32_t>(variable, rowNr, [](const InstanceInfo &instance) {return instance.version;});
         return true;
       default: return false;
     }});
 
     ui->initNumber(tableVar, "uptime", UINT16_MAX, 0, (unsigned long)-1, true, [this](EventArguments) { switch (eventType) {
       case onSetValue:
-        for (size_t rowNrL = 0; rowNrL < instances.size() && (rowNr == UINT8_MAX || rowNrL == rowNr); rowNrL++)
-          variable.setValue(instances[rowNrL].sysData.uptime, rowNrL);
+        setColumn<uint32_t>(variable, rowNr, [](const InstanceInfo &instance) {return instance.sysData.uptime;});
         return true;
       default: return false;
     }});
     ui->initNumber(tableVar, "now", UINT16_MAX, 0, (unsigned long)-1, true, [this](EventArguments) { switch (eventType) {
       case onSetValue:
-        for (size_t rowNrL = 0; rowNrL < instances.size() && (rowNr == UINT8_MAX || rowNrL == rowNr); rowNrL++)
-          variable.setValue(instances[rowNrL].sysData.now / 1000, rowNrL);
+        setColumn<uint32_t>(variable, rowNr, [](const InstanceInfo &instance) {return instance.sysData.now / 1000;});
         return true;
       default: return false;
     }});
 
     ui->initNumber(tableVar, "timestamp", UINT16_MAX, 0, (unsigned long)-1, true, [this](EventArguments) { switch (eventType) {
       case onSetValue:
-        for (size_t rowNrL = 0; rowNrL < instances.size() && (rowNr == UINT8_MAX || rowNrL == rowNr); rowNrL++)
-          variable.setValue(instances[rowNrL].sysData.timeSource, rowNrL);
+        setColumn<uint8_t>(variable, rowNr, [](const InstanceInfo &instance) {return instance.sysData.timeSource;});
         return true;
       default: return false;
     }});
 
     ui->initNumber(tableVar, "time", UINT16_MAX, 0, (unsigned long)-1, true, [this](EventArguments) { switch (eventType) {
       case onSetValue:
-        for (size_t rowNrL = 0; rowNrL < instances.size() && (rowNr == UINT8_MAX || rowNrL == rowNr); rowNrL++)
-          variable.setValue(instances[rowNrL].sysData.tokiTime, rowNrL);
+        setColumn<uint32_t>(variable, rowNr, [](const InstanceInfo &instance) {return instance.sysData.tokiTime;});
         return true;
       default: return false;
     }});
 
     ui->initNumber(tableVar, "ms", UINT16_MAX, 0, (unsigned long)-1, true, [this](EventArguments) { switch (eventType) {
       case onSetValue:
-        for (size_t rowNrL = 0; rowNrL < instances.size() && (rowNr == UINT8_MAX || rowNrL == rowNr); rowNrL++)
-          variable.setValue(instances[rowNrL].sysData.tokiMs, rowNrL);
+        setColumn<uint16_t>(variable, rowNr, [](const InstanceInfo &instance) {return instance.sysData.tokiMs;});
+        return true;
+      default: return false;
+    }});
+
+    ui->initNumber(tableVar, "offset", UINT16_MAX, INT16_MIN, INT16_MAX, true, [this](EventArguments) { switch (eventType) {
+      case onSetValue:
+        setColumn<int32_t>(variable, rowNr, [](const InstanceInfo &instance) {return instance.syncOffset;});
+        return true;
+      case onUI:
+        variable.setComment("ms ahead of this instance");
+        return true;
+      default: return false;
+    }});
+
+    ui->initNumber(tableVar, "jitter", UINT16_MAX, 0, UINT16_MAX, true, [this](EventArguments) { switch (eventType) {
+      case onSetValue:
+        setColumn<uint16_t>(variable, rowNr, [](const InstanceInfo &instance) {return instance.syncJitter;});
         return true;
       default: return false;
     }});
@@ -218,6 +451,8 @@ public:
     mdl->findVars("dash", true, [tableVar, this](Variable variable) { //findFun
 
       ppf("dash %s.%s %s found\n", variable.pid(), variable.id(), variable.valueString().c_str());
+      dashVars.push_back(variable.var);
+      if (variable.var["h"].is<uint16_t>()) shadows.add(variable.var["h"]); //changes to the instances via ss_udp
       // dash Fixture.on 1 found
       // dash Fixture.brightness 94 found
       // dash layers.effect [30] found
@@ -237,14 +472,13 @@ public:
         switch (eventType) { //varEvent
         case onSetValue:
           //should not trigger onChange
+          if (!id) return true;
           for (size_t rowNrL = 0; rowNrL < instances.size() && (rowNr == UINT8_MAX || rowNrL == rowNr); rowNrL++) {
             // ppf("initVar dash %s[%d]\n", variable.id(), rowNrL);
             //do what setValue is doing except calling onChange
-            // insVar["value"][rowNrL] = instances[rowNrL].jsonData[variable.id()]; //only int values...
-            JsonVariant value = instances[rowNrL].jsonData[variable.id()];
-            web->addResponse(insVariable.var, "value", value, rowNrL); // error: passing 'const Variable' as 'this' argument discards qualifiers
-
-            // mdl->setValue(insVariable.var, instances[rowNrL].jsonData[variable.id()], rowNr);
+            JsonDocument value(&instanceJsonPool);
+            instances[rowNrL].getValue(mdl->varIndexKey(pid, id), value.to<JsonVariant>());
+            web->addResponse(insVariable.var, "value", value.as<JsonVariant>(), rowNrL); // error: passing 'const Variable' as 'this' argument discards qualifiers
           //send to ws?
           }
           return true;
@@ -291,7 +525,7 @@ public:
       success = false;
     }
 
-    ppf("UDP message sizes WLED:%d Star:%d WLED-Sync:%d\n", sizeof(UDPWLEDMessage), sizeof(UDPStarMessage), sizeof(UDPWLEDSyncMessage));
+    ppf("UDP message sizes WLED:%d Star:%d Compact:%d+ WLED-Sync:%d\n", sizeof(UDPWLEDMessage), sizeof(UDPStarMessage), sizeof(UDPWLEDMessage) + sizeof(UDPStarCompactHeader), sizeof(UDPWLEDSyncMessage));
   }
 
   void onOffChanged() override {
@@ -302,6 +536,8 @@ public:
       udpConnected = false;
       udp2Connected = false;
       instances.clear();
+      instanceIndex.clear();
+      for (std::vector<uint32_t> &bucket: agingWheel) bucket.clear();
 
       //not needed here as there is no connection
       // ui->processOnUI("instances");
@@ -314,14 +550,30 @@ public:
 
     handleNotifications();
 
-    while (changedVarsQueue.size()) {
-      JsonObject var = changedVarsQueue.front();
-      sendMessageUDP(IPAddress(255, 255, 255, 255), var, var["value"]); //broadcast
-      changedVarsQueue.erase(changedVarsQueue.begin());
+    slewClocks();
+
+    //changed hot dash vars
+    shadows.drain(ss_udp, [this](uint16_t handle) {
+      JsonObject var = mdl->findVarByHandle(handle);
+      if (!var.isNull() && !var["dash"].isNull()) changedVarsQueue.push_back(var);
+    });
+
+    if (changedVarsQueue.size()) {
+      if (batchSync)
+        sendVarSyncUDP();
+      else
+        for (JsonObject var: changedVarsQueue)
+          sendMessageUDP(IPAddress(255, 255, 255, 255), var, var["value"]); //broadcast
+      changedVarsQueue.clear();
     }
 
   }
 
+  void loop1s() override {
+    ageInstances();
+    if (timeSync) requestTimeSync();
+  }
+
   void loop10s() override {
     sendSysInfoUDP();  //temporary every second
   }
@@ -391,6 +643,7 @@ public:
           ppf("   %d %d p:%d\n", wledSyncMessage.bri, wledSyncMessage.mainsegMode, packetSize); //LEDs specific
 
           InstanceInfo *instance = findInstance(notifierUdp.remoteIP()); //if not exist, created
+          instance->changedColumns |= 1 << ic_uptime | 1 << ic_now | 1 << ic_timestamp | 1 << ic_time | 1 << ic_ms | 1 << ic_dash;
 
           // instance->sysData.uptime = (wledSyncMessage.now[0] * 256*256*256 + 256*256*wledSyncMessage.now[1] + 256*wledSyncMessage.now[2] + wledSyncMessage.now[3]) / 1000;
           instance->sysData.uptime = (wledSyncMessage.now[0] << 24) | (wledSyncMessage.now[1] << 16) | (wledSyncMessage.now[2] << 8) | (wledSyncMessage.now[3]);
@@ -428,9 +681,15 @@ public:
               // }
           
           //LEDs specific
-          instance->jsonData["brightness"] = wledSyncMessage.bri; 
-          instance->jsonData["effect"] = wledSyncMessage.mainsegMode; //tbd: rowNr
-          instance->jsonData["palette"] = wledSyncMessage.palette; //tbd: rowNr
+          WSValue wsValue;
+          wsValue.tag = vt_uint8;
+          wsValue.rowNr = UINT8_MAX;
+          wsValue.value[0] = wledSyncMessage.bri;
+          instance->setValue(dashKey("brightness"), wsValue);
+          wsValue.value[0] = wledSyncMessage.mainsegMode;
+          instance->setValue(dashKey("effect"), wsValue); //tbd: rowNr
+          wsValue.value[0] = wledSyncMessage.palette;
+          instance->setValue(dashKey("palette"), wsValue); //tbd: rowNr
 
           // for (size_t x = 0; x < packetSize; x++) {
           //   char xx = (char)udpIn[x];
@@ -439,8 +698,6 @@ public:
           // Serial.println();
 
           ppf("instances handleNotifications %d\n", notifierUdp.remoteIP()[3]);
-          for (JsonObject childVar: Variable("Instances", "instances").children())
-            Variable(childVar).triggerEvent(onSetValue); //set the value (WIP) ); //rowNr //instance - instances.begin()
 
           web->recvUDPCounter++;
           web->recvUDPBytes+=packetSize;
@@ -457,12 +714,37 @@ public:
       packetSize = instanceUDP.parsePacket();
 
       if (packetSize > 0) {
+        uint32_t receivedNow = millis() + sys->timebase; //as early as possible for time sync
+        Toki::Time receivedToki = sys->toki.getTime();
         // IPAddress remoteIp = instanceUDP.remoteIP();
         // ppf("handleNotifications instances ...%d %d check %d or %d\n", instanceUDP.remoteIP()[3], packetSize, sizeof(UDPWLEDMessage), sizeof(UDPStarMessage));
 
         bool found = false;
 
-        if (packetSize == sizeof(UDPWLEDMessage)) { //WLED instance
+        if (packetSize >= sizeof(UDPVarSyncHeader) && packetSize <= sizeof(UDPStarMessage) && instanceUDP.peek() == UDP_VARSYNC_TOKEN[0]) { //maybe var sync
+          byte buffer[packetSize];
+          instanceUDP.read(buffer, packetSize);
+          if (strncmp((char *)buffer, UDP_VARSYNC_TOKEN, 4) == 0)
+            receiveVarSyncUDP(buffer, packetSize);
+          else if (strncmp((char *)buffer, UDP_TIMESYNC_TOKEN, 4) == 0)
+            receiveTimeSyncUDP(buffer, packetSize, receivedNow, receivedToki);
+          else
+            ppf("handleNotifications i:%d unknown packet l:%d\n", instanceUDP.remoteIP()[3], packetSize);
+          found = true; //read
+        }
+
+        if (!found && packetSize > sizeof(UDPWLEDMessage) + sizeof(UDPStarCompactHeader) && packetSize < sizeof(UDPStarMessage)) { //maybe compact StarBase instance
+          byte buffer[packetSize];
+          instanceUDP.read(buffer, packetSize);
+          UDPStarCompactHeader *compact = (UDPStarCompactHeader *)(buffer + sizeof(UDPWLEDMessage));
+          if (buffer[0] == 255 && strncmp(compact->token, UDP_STAR_COMPACT_TOKEN, 2) == 0)
+            receiveStarCompactUDP(buffer, packetSize);
+          else
+            ppf("handleNotifications i:%d unknown packet l:%d\n", instanceUDP.remoteIP()[3], packetSize);
+          found = true; //read
+        }
+
+        if (!found && packetSize == sizeof(UDPWLEDMessage)) { //WLED instance
           UDPStarMessage starMessage;
           byte *udpIn = (byte *)&starMessage.header;
           instanceUDP.read(udpIn, packetSize);
@@ -497,7 +779,7 @@ public:
           char buffer[packetSize];
           instanceUDP.read(buffer, packetSize);
 
-          JsonDocument message;
+          JsonDocument message(&instanceJsonPool);
           DeserializationError error = deserializeJson(message, buffer);
           if (error)
             ppf("handleNotifications i:%d no json l: %d e:%s\n", instanceUDP.remoteIP()[3], strnlen(buffer, packetSize), error.c_str());
@@ -528,26 +810,7 @@ public:
       }
     } //udp2Connected
 
-    //remove inactive instances
-    bool erased = false;
-    for (std::vector<InstanceInfo>::iterator instance=instances.begin(); instance!=instances.end(); ) {
-      if (millis() - instance->timeStamp > 32000) { //assuming a ping each 30 seconds
-        instance = instances.erase(instance);
-        erased = true;
-      }
-      else
-        ++instance;
-    }
-    if (erased) {
-      ppf("instances remove inactive instances\n");
-      for (JsonObject childVar: Variable("Instances", "instances").children())
-        Variable(childVar).triggerEvent(onSetValue); //set the value (WIP)); //no rowNr so all rows updated
-
-      //tbd: pubsub mechanism
-      //LEDs specific
-      Variable("DDP", "instance").triggerEvent(onUI); //rebuild options
-      // Variable("Artnet", "artInst").triggerEvent(onUI); //rebuild options
-    }
+    sendInstanceChanges();
   }
 
   void sendSysInfoUDP()
@@ -599,6 +862,7 @@ public:
     starMessage.sysData.dmx.universe = 0;
     starMessage.sysData.dmx.start = 0;
     starMessage.sysData.dmx.count = 0;
+    esp_wifi_get_mac((wifi_interface_t)ESP_IF_WIFI_STA, starMessage.sysData.macAddress);
     #ifdef STARBASE_USERMOD_E131
       if (e131mod->isEnabled) {
         starMessage.sysData.dmx.universe = mdl->getValue("E131", "universe");
@@ -610,25 +874,24 @@ public:
     updateInstance(starMessage); //temp? to show own instance in list as instance is not catching it's own udp message...
 
     //other way around: first set instance variables, then fill starMessage
-    for (InstanceInfo &instance: instances) {
-      if (instance.ip == net->localIP()) {
-        instance.jsonData.to<JsonObject>(); //clear
-
-        //send dash values
-        mdl->findVars("dash", true, [&instance](Variable variable) { //varEvent
-          instance.jsonData[variable.id()] = variable.value();
-          // // print->printJson("setVar", var);
-          // JsonArray valArray = variable.valArray();
-          // if (valArray.isNull())
-          // else if (valArray.size())
-          //   instance.jsonData[variable.id()] = valArray;
-        });
+    InstanceInfo *instance = findInstance(net->localIP(), false);
+    if (instance) {
+      JsonDocument jsonData(&instanceJsonPool); //legacy message only
+
+      //send dash values
+      mdl->findVars("dash", true, [instance, &jsonData](Variable variable) { //varEvent
+        if (instance->setValue(mdl->varIndexKey(variable.pid(), variable.id()), variable.value()))
+          instance->changedColumns |= 1 << ic_dash;
+        jsonData[variable.id()] = variable.value();
+      });
+
+      serializeJson(jsonData, starMessage.jsonString, sizeof(starMessage.jsonString));
+      // ppf("sendSysInfoUDP ip:%d s:%s\n", instance->ip[3], starMessage.jsonString);
+    }
 
-        serializeJson(instance.jsonData, starMessage.jsonString);
-        // ppf("sendSysInfoUDP ip:%d s:%s\n", instance.ip[3], starMessage.jsonString);
-        // print->printJson(" d:", instance.jsonData);
-        // print->printJDocInfo("   info", instance.jsonData);
-      }
+    if (compactInfo) {
+      sendStarCompactUDP(starMessage);
+      return;
     }
 
     // broadcast to network
@@ -664,11 +927,307 @@ public:
     // }
   }
 
+  //broadcast starMessage as compact message: time always, other fields only if changed since the last announcement or a full refresh is due
+  void sendStarCompactUDP(UDPStarMessage &starMessage) {
+    byte buffer[sizeof(UDPStarMessage) - 1]; //one less: packet size distinguishes compact from legacy
+    memcpy(buffer, &starMessage.header, sizeof(UDPWLEDMessage));
+    UDPStarCompactHeader *compact = (UDPStarCompactHeader *)(buffer + sizeof(UDPWLEDMessage));
+    memcpy(compact->token, UDP_STAR_COMPACT_TOKEN, 2);
+    compact->version = UDP_STAR_COMPACT_VERSION;
+    bool full = fullCountdown == 0;
+    compact->flags = full?sc_full:0;
+    compact->baseHash = sentHash;
+    size_t len = sizeof(UDPWLEDMessage) + sizeof(UDPStarCompactHeader);
+
+    auto addRecord = [&buffer, &len](uint8_t type, const void *value, size_t size) -> bool {
+      if (size > UINT8_MAX || len + 2 + size > sizeof(buffer)) return false;
+      buffer[len++] = type;
+      buffer[len++] = size;
+      memcpy(buffer + len, value, size);
+      len += size;
+      return true;
+    };
+
+    StarTLVTime time;
+    time.uptime = starMessage.sysData.uptime;
+    time.now = starMessage.sysData.now;
+    time.timeSource = starMessage.sysData.timeSource;
+    time.tokiTime = starMessage.sysData.tokiTime;
+    time.tokiMs = starMessage.sysData.tokiMs;
+    addRecord(st_time, &time, sizeof(time));
+
+    uint32_t hash = 2166136261;
+    //key: type for SysData fields, varIndexKey for dash vars
+    auto addField = [this, &hash, &addRecord, full](uint32_t key, uint8_t type, const void *value, size_t size) {
+      uint32_t fieldHash = 2166136261;
+      for (size_t i = 0; i < size; i++) fieldHash = (fieldHash ^ ((const byte *)value)[i]) * 16777619;
+      hash = (hash ^ fieldHash) * 16777619;
+      auto sent = sentHashes.find(key);
+      if (!full && sent != sentHashes.end() && sent->second == fieldHash) return; //unchanged
+      if (addRecord(type, value, size))
+        sentHashes[key] = fieldHash;
+      else
+        ppf("dev sendStarCompactUDP record %d too big l:%d\n", type, size);
+    };
+
+    addField(st_type, st_type, &starMessage.sysData.type, sizeof(starMessage.sysData.type));
+    addField(st_dmx, st_dmx, &starMessage.sysData.dmx, sizeof(starMessage.sysData.dmx));
+    addField(st_mac, st_mac, starMessage.sysData.macAddress, sizeof(starMessage.sysData.macAddress));
+
+    mdl->findVars("dash", true, [&addField](Variable variable) { //varEvent
+      char record[UINT8_MAX];
+      size_t keyLen = snprintf(record, sizeof(record), "%s.%s", variable.pid(), variable.id()) + 1; //including \0
+      if (keyLen >= sizeof(record)) return;
+      size_t valueLen = serializeJson(variable.value(), record + keyLen, sizeof(record) - keyLen);
+      if (keyLen + valueLen >= sizeof(record)) {
+        ppf("dev sendStarCompactUDP %s too big\n", record);
+        return;
+      }
+      addField(mdl->varIndexKey(variable.pid(), variable.id()), st_dash, record, keyLen + valueLen);
+    });
+
+    compact->hash = hash;
+    sentHash = hash;
+    fullCountdown = full?UDP_STAR_COMPACT_FULL_REFRESH - 1:fullCountdown - 1;
+
+    if (0 != instanceUDP.beginPacket(IPAddress(255, 255, 255, 255), instanceUDPPort)) {  // WLEDMM beginPacket == 0 --> error
+      instanceUDP.write(buffer, len);
+      web->sendUDPCounter++;
+      web->sendUDPBytes+=len;
+      instanceUDP.endPacket();
+    }
+    else {
+      ppf("sendStarCompactUDP error\n");
+    }
+  }
+
+  //decode a compact message into SysData (on top of what is known of the instance) and the changed dash values, then update the instance
+  void receiveStarCompactUDP(byte *buffer, size_t packetSize) {
+    UDPStarMessage starMessage;
+    memcpy(&starMessage.header, buffer, sizeof(UDPWLEDMessage));
+    const UDPStarCompactHeader *compact = (const UDPStarCompactHeader *)(buffer + sizeof(UDPWLEDMessage));
+
+    if (compact->version != UDP_STAR_COMPACT_VERSION) {
+      ppf("receiveStarCompactUDP i:%d version %d not supported\n", starMessage.header.ip3, compact->version);
+      return;
+    }
+    if (starMessage.header.ip0 != net->localIP()[0]) return; // checksum - no other type of message
+
+    IPAddress messageIP = IPAddress(starMessage.header.ip0, starMessage.header.ip1, starMessage.header.ip2, starMessage.header.ip3);
+    const InstanceInfo *known = findInstance(messageIP, false);
+    if (known)
+      starMessage.sysData = known->sysData;
+    else {
+      memset(&starMessage.sysData, 0, sizeof(SysData));
+      starMessage.sysData.type = 1; //not a WLED message, corrected by st_type
+    }
+
+    bool unchanged = known && known->contentHash && known->contentHash == compact->hash;
+
+    JsonDocument dashData(&instanceJsonPool);
+    JsonObject dashObject = dashData.to<JsonObject>();
+
+    size_t offset = sizeof(UDPWLEDMessage) + sizeof(UDPStarCompactHeader);
+    while (offset + 2 <= packetSize) {
+      uint8_t type = buffer[offset];
+      uint8_t size = buffer[offset+1];
+      const byte *value = buffer + offset + 2;
+      offset += 2 + size;
+      if (offset > packetSize) {
+        ppf("receiveStarCompactUDP i:%d record %d truncated\n", messageIP[3], type);
+        return;
+      }
+      if (type == st_time && size == sizeof(StarTLVTime)) {
+        StarTLVTime time;
+        memcpy(&time, value, sizeof(time));
+        starMessage.sysData.uptime = time.uptime;
+        starMessage.sysData.now = time.now;
+        starMessage.sysData.timeSource = time.timeSource;
+        starMessage.sysData.tokiTime = time.tokiTime;
+        starMessage.sysData.tokiMs = time.tokiMs;
+      }
+      else if (unchanged) {} //no need to look at the other fields
+      else if (type == st_type && size == sizeof(starMessage.sysData.type))
+        memcpy(&starMessage.sysData.type, value, size);
+      else if (type == st_dmx && size == sizeof(starMessage.sysData.dmx))
+        memcpy(&starMessage.sysData.dmx, value, size);
+      else if (type == st_mac && size == sizeof(starMessage.sysData.macAddress))
+        memcpy(starMessage.sysData.macAddress, value, size);
+      else if (type == st_dash) {
+        size_t keyLen = strnlen((const char *)value, size);
+        if (keyLen < size) {
+          JsonDocument valueDoc(&instanceJsonPool);
+          if (!deserializeJson(valueDoc, (const char *)value + keyLen + 1, size - keyLen - 1))
+            dashObject[(const char *)value] = valueDoc.as<JsonVariant>();
+        }
+      }
+      //unknown types are skipped (newer versions)
+    }
+
+    updateInstance(starMessage, compact, unchanged?JsonObject():dashObject);
+  }
+
+  //time reference of the group: best toki time source, ties: lowest ip. nullptr if this instance is the reference
+  InstanceInfo * timeReference() {
+    char group1[32];
+    char group2[32];
+    if (!groupOfName(mdl->getValue("System", "name"), group1)) return nullptr;
+    InstanceInfo *reference = nullptr;
+    uint8_t bestSource = sys->toki.getTimeSource();
+    uint8_t bestIP = net->localIP()[3];
+    for (InstanceInfo &instance: instances) {
+      if (instance.sysData.type < 1 || instance.ip == net->localIP()) continue; //not a StarBase instance or self
+      if (!groupOfName(instance.name, group2) || strncmp(group1, group2, sizeof(group1)) != 0) continue;
+      if (instance.sysData.timeSource > bestSource || (instance.sysData.timeSource == bestSource && instance.ip[3] < bestIP)) {
+        reference = &instance;
+        bestSource = instance.sysData.timeSource;
+        bestIP = instance.ip[3];
+      }
+    }
+    return reference;
+  }
+
+  //each second: even seconds the time reference, odd seconds the next StarBase instance (for the offset and jitter columns)
+  void requestTimeSync() {
+    if (!udp2Connected || instances.empty()) return;
+    InstanceInfo *instance = nullptr;
+    if (timeSyncTurn++ % 2 == 0)
+      instance = timeReference();
+    else {
+      for (size_t i = 0; i < instances.size() && !instance; i++) {
+        timeSyncRow = (timeSyncRow + 1) % instances.size();
+        if (instances[timeSyncRow].sysData.type >= 1 && instances[timeSyncRow].ip != net->localIP())
+          instance = &instances[timeSyncRow];
+      }
+    }
+    if (!instance) return;
+
+    UDPTimeSyncMessage message;
+    memset(&message, 0, sizeof(message));
+    memcpy(message.token, UDP_TIMESYNC_TOKEN, 4);
+    message.type = ts_request;
+    message.seq = ++timeSyncSeq;
+    if (0 != instanceUDP.beginPacket(instance->ip, instanceUDPPort)) {
+      message.t1 = millis() + sys->timebase; //as late as possible
+      instanceUDP.write((byte *)&message, sizeof(message));
+      instanceUDP.endPacket();
+      web->sendUDPCounter++;
+      web->sendUDPBytes+=sizeof(message);
+    }
+  }
+
+  //request: answer with t2 and t3. Response: add a sample to the instance, if it is the time reference steer the clocks
+  void receiveTimeSyncUDP(byte *buffer, size_t packetSize, uint32_t receivedNow, Toki::Time receivedToki) {
+    if (packetSize != sizeof(UDPTimeSyncMessage)) {
+      ppf("dev receiveTimeSyncUDP i:%d size %d not %d\n", instanceUDP.remoteIP()[3], packetSize, sizeof(UDPTimeSyncMessage));
+      return;
+    }
+    UDPTimeSyncMessage message;
+    memcpy(&message, buffer, sizeof(message));
+
+    if (message.type == ts_request) {
+      message.type = ts_response;
+      message.t2 = receivedNow;
+      message.timeSource = sys->toki.getTimeSource();
+      if (0 != instanceUDP.beginPacket(instanceUDP.remoteIP(), instanceUDPPort)) {
+        Toki::Time tokiTime = sys->toki.getTime();
+        message.tokiSec = tokiTime.sec;
+        message.tokiMs = tokiTime.ms;
+        message.t3 = millis() + sys->timebase; //as late as possible
+        instanceUDP.write((byte *)&message, sizeof(message));
+        instanceUDP.endPacket();
+        web->sendUDPCounter++;
+        web->sendUDPBytes+=sizeof(message);
+      }
+      return;
+    }
+
+    InstanceInfo *instance = findInstance(instanceUDP.remoteIP(), false);
+    if (message.type != ts_response || !instance) return;
+
+    int32_t rtt = (int32_t)(receivedNow - message.t1) - (int32_t)(message.t3 - message.t2);
+    if (rtt < 0) rtt = 0; //clock adjusted during the exchange
+    int32_t offset = ((int32_t)(message.t2 - message.t1) + (int32_t)(message.t3 - receivedNow)) / 2;
+    int64_t tokiOffset = ((int64_t)message.tokiSec * 1000 + message.tokiMs + rtt / 2) - ((int64_t)receivedToki.sec * 1000 + receivedToki.ms);
+    tokiOffset = constrain(tokiOffset, (int64_t)INT32_MIN / 2, (int64_t)INT32_MAX / 2);
+
+    TimeSyncSample &sample = instance->syncSamples[instance->syncSampleNext];
+    sample.offset = offset + clockAdjusted;
+    sample.tokiOffset = tokiOffset + tokiAdjusted;
+    sample.rtt = min(rtt, (int32_t)UINT16_MAX);
+    instance->syncSampleNext = (instance->syncSampleNext + 1) % TIMESYNC_SAMPLES;
+    if (instance->syncSampleCount < TIMESYNC_SAMPLES) instance->syncSampleCount++;
+    instance->sysData.timeSource = message.timeSource;
+
+    //clock filter: the sample with the lowest rtt has the least queuing so the most symmetric delay
+    const TimeSyncSample *best = &instance->syncSamples[0];
+    for (uint8_t i = 1; i < instance->syncSampleCount; i++)
+      if (instance->syncSamples[i].rtt < best->rtt) best = &instance->syncSamples[i];
+    uint32_t deviation = 0;
+    for (uint8_t i = 0; i < instance->syncSampleCount; i++)
+      deviation += abs(instance->syncSamples[i].offset - best->offset);
+
+    instance->syncOffset = best->offset - clockAdjusted;
+    instance->syncJitter = min(deviation / instance->syncSampleCount, (uint32_t)UINT16_MAX);
+    instance->syncRtt = best->rtt;
+    instance->changedColumns |= 1 << ic_offset | 1 << ic_jitter;
+
+    if (instance != timeReference()) return;
+
+    //steer now: small offsets are slewed in slewClocks
+    if (abs(instance->syncOffset) > TIMESYNC_STEP_MS) {
+      ppf("timeSync step %d ms to ...%d (rtt %d)\n", instance->syncOffset, instance->ip[3], instance->syncRtt);
+      sys->timebase += instance->syncOffset;
+      clockAdjusted += instance->syncOffset;
+      instance->syncOffset = 0;
+      clockSlew = 0;
+    }
+    else
+      clockSlew = instance->syncOffset;
+
+    //steer toki if the reference has a better time source, or ours is derived from the group
+    uint8_t ownSource = sys->toki.getTimeSource();
+    bool derived = ownSource == TOKI_TS_NONE || ownSource == TOKI_TS_UDP || ownSource == TOKI_TS_UDP_SEC || ownSource == TOKI_TS_UDP_NTP;
+    if (message.timeSource > ownSource || (derived && message.timeSource != TOKI_TS_NONE)) {
+      tokiSource = TOKI_TS_UDP; //5
+      if (message.timeSource > 99) tokiSource = TOKI_TS_UDP_NTP; //110
+      else if (message.timeSource >= TOKI_TS_SEC) tokiSource = TOKI_TS_UDP_SEC; //20
+      int32_t tokiCorrection = best->tokiOffset - tokiAdjusted;
+      if (abs(tokiCorrection) > TIMESYNC_STEP_MS || ownSource == TOKI_TS_NONE) {
+        Toki::Time tm = sys->toki.getTime();
+        sys->toki.adjust(tm, tokiCorrection);
+        sys->toki.setTime(tm, tokiSource);
+        tokiAdjusted += tokiCorrection;
+        tokiSlew = 0;
+      }
+      else
+        tokiSlew = tokiCorrection;
+    }
+  }
+
+  //correct the remaining offsets to the time reference 1 ms per call (20 ms) so effects do not jump
+  void slewClocks() {
+    if (clockSlew) {
+      int8_t step = clockSlew > 0?1:-1;
+      sys->timebase += step;
+      clockAdjusted += step;
+      clockSlew -= step;
+    }
+    if (tokiSlew) {
+      int8_t step = tokiSlew > 0?1:-1;
+      Toki::Time tm = sys->toki.getTime();
+      sys->toki.adjust(tm, step);
+      sys->toki.setTime(tm, tokiSource);
+      tokiAdjusted += step;
+      tokiSlew -= step;
+    }
+  }
+
   //sends an UDP message to a specific ip. Broadcast?
   void sendMessageUDP(IPAddress ip, JsonObject var, JsonVariant value) {
     if (0 != instanceUDP.beginPacket(ip, instanceUDPPort)) {
 
-      JsonDocument message;
+      JsonDocument message(&instanceJsonPool);
       message["pid"] = var["pid"];
       message["id"] = var["id"];
       message["value"] = value;
@@ -687,186 +1246,371 @@ public:
     }
   }
 
-  void updateInstance( UDPStarMessage udpStarMessage) {
-    IPAddress messageIP = IPAddress(udpStarMessage.header.ip0, udpStarMessage.header.ip1, udpStarMessage.header.ip2, udpStarMessage.header.ip3);
-
-    bool instanceFound = false;
-    for (InstanceInfo &instance : instances) {
-      if (instance.ip == messageIP)
-        instanceFound = true;
-    }
+  //broadcast the changed dash vars in one packet (more if needed), one record per var (last value)
+  void sendVarSyncUDP() {
+    if (!udp2Connected) return;
 
-    // ppf("updateInstance Instance: ...%d n:%s found:%d\n", messageIP[3], udpStarMessage.header.name, instanceFound);
+    byte buffer[sizeof(UDPStarMessage)];
+    UDPVarSyncHeader *header = (UDPVarSyncHeader *)buffer;
+    size_t len = sizeof(UDPVarSyncHeader);
+    std::vector<uint32_t> keys; //dedupe, the queue can have a var more than once
+
+    for (size_t i = 0; i <= changedVarsQueue.size(); i++) {
+      WSValue wsValue;
+      uint32_t key = 0;
+      bool add = false;
+      if (i < changedVarsQueue.size()) {
+        JsonObject var = changedVarsQueue[i];
+        key = mdl->varIndexKey(var["pid"].as<const char *>(), var["id"].as<const char *>());
+        if (std::find(keys.begin(), keys.end(), key) != keys.end()) continue;
+        keys.push_back(key);
+        if (web->valueToWSValue(var["value"], wsValue))
+          add = true;
+        else
+          sendMessageUDP(IPAddress(255, 255, 255, 255), var, var["value"]); //e.g. strings and arrays: json
+      }
 
-    if (!instanceFound) { //new instance
-      InstanceInfo instance;
-      instance.ip = messageIP;
-      if (udpStarMessage.sysData.type == 0) {//WLED only
-        instance.sysData.type = 0; //WLED
-        //updated in udp sync message:
-        instance.sysData.uptime = 0;
-        instance.sysData.dmx.universe = 0;
-        instance.sysData.dmx.start = 0;
-        instance.sysData.dmx.count = 0;
-        //dash values default 0
-        instance.jsonData.to<JsonObject>();
+      //send if last or full
+      size_t recordSize = add?4 + 2 + web->valueSize(wsValue.tag):0;
+      if (len > sizeof(UDPVarSyncHeader) && (i == changedVarsQueue.size() || (add && (len + recordSize > sizeof(buffer) || header->count == UINT8_MAX)))) {
+        if (0 != instanceUDP.beginPacket(IPAddress(255, 255, 255, 255), instanceUDPPort)) {
+          instanceUDP.write(buffer, len);
+          web->sendUDPCounter++;
+          web->sendUDPBytes+=len;
+          instanceUDP.endPacket();
+        }
+        len = sizeof(UDPVarSyncHeader);
+      }
+      if (add && len == sizeof(UDPVarSyncHeader)) { //new packet
+        memcpy(header->token, UDP_VARSYNC_TOKEN, 4);
+        header->bootId = syncBootId;
+        header->seq = ++syncSeq;
+        header->count = 0;
       }
 
-      instances.push_back(instance);
-      std::sort(instances.begin(),instances.end(), [](InstanceInfo &a, InstanceInfo &b){ return strncmp(a.name,b.name, sizeof(a.name))<0; });
+      if (add) {
+        memcpy(buffer + len, &key, 4);
+        buffer[len + 4] = wsValue.tag;
+        buffer[len + 5] = UINT8_MAX; //rowNr: whole value
+        memcpy(buffer + len + 6, wsValue.value, web->valueSize(wsValue.tag)); //ESP32 is little endian
+        len += recordSize;
+        header->count++;
+      }
     }
+  }
 
-    //update the instance in the instances array with the message data
+  //apply a var sync packet of another instance of the same group
+  void receiveVarSyncUDP(const byte *buffer, size_t len) {
+    if (instanceUDP.remoteIP() == net->localIP()) return; //self
 
-    // uint8_t rowNr = 0;
-    for (InstanceInfo &instance: instances) {
-      if (instance.ip == messageIP) {
-        //update instance from StarMessage
-        instance.timeStamp = millis(); //update timestamp (when was the package received)
-        strlcpy(instance.name, udpStarMessage.header.name, sizeof(instance.name));
-        instance.version = udpStarMessage.header.version;
-
-        if (instance.ip == net->localIP()) {
-          esp_wifi_get_mac((wifi_interface_t)ESP_IF_WIFI_STA, instance.sysData.macAddress);
-          // ppf("macaddress %02X:%02X:%02X:%02X:%02X:%02X\n", instance.macAddress[0], instance.macAddress[1], instance.macAddress[2], instance.macAddress[3], instance.macAddress[4], instance.macAddress[5]);
-        }
+    char group1[32];
+    char group2[32];
+    if (!groupOfName(mdl->getValue("System", "name"), group2)) return; //not in a group: nothing to sync
 
-        if (udpStarMessage.sysData.type >= 1) {//StarBase, StarLight and forks only
-          instance.sysData = udpStarMessage.sysData;
-
-          if (instance.ip != net->localIP()) { //send from localIP will be done after updateInstance
-            char group1[32];
-            char group2[32];
-            if (groupOfName(instance.name, group1) && groupOfName(mdl->getValue("System", "name"), group2) && strncmp(group1, group2, sizeof(group1)) == 0) {
-
-              uint32_t t = instance.sysData.now;
-              t += PRESUMED_NETWORK_DELAY; //adjust trivially for network delay
-              t -= millis();
-              sys->timebase = t;
-              // timebaseUpdated = true;
-
-              Toki::Time tm;
-              tm.sec = instance.sysData.tokiTime;
-              tm.ms = instance.sysData.tokiMs;
-              if (instance.sysData.timeSource > sys->toki.getTimeSource() || sys->toki.getTimeSource() == TOKI_TS_NONE) { //if sender's time source is more accurate
-                sys->toki.adjust(tm, PRESUMED_NETWORK_DELAY); //adjust trivially for network delay
-                uint8_t ts = TOKI_TS_UDP; //5
-                if (instance.sysData.timeSource > 99) ts = TOKI_TS_UDP_NTP; //110
-                else if (instance.sysData.timeSource >= TOKI_TS_SEC) ts = TOKI_TS_UDP_SEC; //20
-                sys->toki.setTime(tm, ts);
-              } else if (/*timebaseUpdated && */ sys->toki.getTimeSource() > 99) { //if we both have good times, get a more accurate timebase
-                Toki::Time myTime = sys->toki.getTime();
-                uint32_t diff = sys->toki.msDifference(tm, myTime);
-                sys->timebase -= PRESUMED_NETWORK_DELAY; //no need to presume, use difference between NTP times at send and receive points
-                if (sys->toki.isLater(tm, myTime)) {
-                  sys->timebase += diff;
-                } else {
-                  sys->timebase -= diff;
-                }
-              }
+    UDPVarSyncHeader header;
+    memcpy(&header, buffer, sizeof(header));
+    if (sizeof(UDPVarSyncHeader) + header.count * 7 > len) return; //records do not fit (smallest record is 7 bytes)
 
-              //set instance.jsonData from new string
-              JsonDocument newData;
-              DeserializationError error = deserializeJson(newData, udpStarMessage.jsonString);
-              if (error || !newData.is<JsonObject>()) {
-                // ppf("dev updateInstance json failed ip:%d e:%s\n", instance.ip[3], error.c_str(), udpStarMessage.jsonString);
-                //failed because some instances not on latest firmware, so turned off temporarily (tbd/wip)
-              }
-              else {
-                //check if instance belongs to the same group
-
-                for (JsonPair pair: newData.as<JsonObject>()) {
-                  // ppf("updateInstance sync from i:%s k:%s v:%s\n", instance.name, pair.key().c_str(), pair.value().as<String>().c_str());
-
-                  char pid[32];
-                  strlcpy(pid, pair.key().c_str(), sizeof(pid));
-                  char * id = strtok(pid, ".");
-                  if (id != nullptr ) {
-                    strlcpy(pid, id, sizeof(pid)); //copy the id part
-                    id = strtok(nullptr, "."); //the rest after .
-                  }
+    //only instances already announced (UDPStarMessage) are known by name, a var sync packet never adds one
+    InstanceInfo *instance = findInstance(instanceUDP.remoteIP(), false);
+    if (!instance || !groupOfName(instance->name, group1) || strncmp(group1, group2, sizeof(group1)) != 0)
+      return; //unknown sender or not the same group
 
-                  Variable(pid, id).setValueJV(pair.value());
-                }
-                instance.jsonData = newData; // deepcopy: https://github.com/bblanchon/ArduinoJson/issues/1023
-                // ppf("updateInstance json ip:%d", instance.ip[3]);
-                // print->printJson(" d:", instance.jsonData);
-              }
-            }
-          } //same group
-        }
+    if (header.bootId == instance->syncBootId && (int32_t)(header.seq - instance->syncSeq) <= 0) {
+      ppf("receiveVarSyncUDP i:%d stale packet %d <= %d\n", instance->ip[3], header.seq, instance->syncSeq);
+      return;
+    }
+    instance->syncBootId = header.bootId;
+    instance->syncSeq = header.seq;
+
+    size_t offset = sizeof(UDPVarSyncHeader);
+    for (uint8_t i = 0; i < header.count && offset + 6 <= len; i++) {
+      uint32_t key;
+      memcpy(&key, buffer + offset, 4);
+      WSValue wsValue;
+      wsValue.tag = buffer[offset + 4];
+      wsValue.rowNr = buffer[offset + 5];
+      size_t size = web->valueSize(wsValue.tag);
+      if (size == 0 || offset + 6 + size > len) break;
+      memcpy(wsValue.value, buffer + offset + 6, size);
+      offset += 6 + size;
+
+      JsonObject var = mdl->findVarByKey(key);
+      if (!var.isNull() && !var["dash"].isNull()) //only dash vars are synced
+        web->setWSValue(Variable(var), wsValue);
+    }
+  }
 
-        //only update cell in instbl!
-        //create a json string
-        //send the json
-        //ui to parse the json
+  //compact: dashData contains the dash values changed since compact->baseHash, null if nothing changed
+  void updateInstance(UDPStarMessage &udpStarMessage, const UDPStarCompactHeader *compact = nullptr, JsonObject dashData = JsonObject()) {
+    IPAddress messageIP = IPAddress(udpStarMessage.header.ip0, udpStarMessage.header.ip1, udpStarMessage.header.ip2, udpStarMessage.header.ip3);
 
-        if (instanceFound) {
-          // JsonObject responseObject = web->getResponseObject();
+    bool instanceFound = findInstance(messageIP, false) != nullptr;
 
-          // responseObject["updRow"]["id"] = "instances";
-          // responseObject["updRow"]["rowNr"] = rowNr;
-          // responseObject["updRow"]["value"].to<JsonArray>();
-          // addTblRow(responseObject["updRow"]["value"], instance);
+    // ppf("updateInstance Instance: ...%d n:%s found:%d\n", messageIP[3], udpStarMessage.header.name, instanceFound);
 
-          // web->sendResponseObject();
+    InstanceInfo &instance = *findInstance(messageIP); //created if new
+    if (!instanceFound && udpStarMessage.sysData.type == 0) {//WLED only
+      instance.sysData.type = 0; //WLED
+      //updated in udp sync message:
+      instance.sysData.uptime = 0;
+      instance.sysData.dmx.universe = 0;
+      instance.sysData.dmx.start = 0;
+      instance.sysData.dmx.count = 0;
+      //dash values default 0
+    }
 
-          // ppf("updateInstance updRow\n");
+    //update the instance with the message data
+    touchInstance(instance);
+    if (strncmp(instance.name, udpStarMessage.header.name, sizeof(instance.name)) != 0) instance.changedColumns |= 1 << ic_name | 1 << ic_link;
+    strlcpy(instance.name, udpStarMessage.header.name, sizeof(instance.name));
+    if (instance.version != udpStarMessage.header.version) instance.changedColumns |= 1 << ic_version;
+    instance.version = udpStarMessage.header.version;
 
-          for (JsonObject childVar: Variable("Instances", "instances").children())
-            Variable(childVar).triggerEvent(onSetValue); //set the value (WIP)); //rowNr instance - instances.begin()
+    if (instance.ip == net->localIP()) {
+      esp_wifi_get_mac((wifi_interface_t)ESP_IF_WIFI_STA, instance.sysData.macAddress);
+      // ppf("macaddress %02X:%02X:%02X:%02X:%02X:%02X\n", instance.macAddress[0], instance.macAddress[1], instance.macAddress[2], instance.macAddress[3], instance.macAddress[4], instance.macAddress[5]);
+    }
 
-          //tbd: now done for all rows, should be done only for updated rows!
+    if (udpStarMessage.sysData.type >= 1) {//StarBase, StarLight and forks only
+      const SysData &sysData = udpStarMessage.sysData;
+      if (instance.sysData.type != sysData.type) instance.changedColumns |= 1 << ic_type;
+      if (instance.sysData.uptime != sysData.uptime) instance.changedColumns |= 1 << ic_uptime;
+      if (instance.sysData.now / 1000 != sysData.now / 1000) instance.changedColumns |= 1 << ic_now; //shown in seconds
+      if (instance.sysData.timeSource != sysData.timeSource) instance.changedColumns |= 1 << ic_timestamp;
+      if (instance.sysData.tokiTime != sysData.tokiTime) instance.changedColumns |= 1 << ic_time;
+      if (instance.sysData.tokiMs != sysData.tokiMs) instance.changedColumns |= 1 << ic_ms;
+      instance.sysData = udpStarMessage.sysData;
+
+      if (instance.ip != net->localIP()) { //send from localIP will be done after updateInstance
+        char group1[32];
+        char group2[32];
+        if (groupOfName(instance.name, group1) && groupOfName(mdl->getValue("System", "name"), group2) && strncmp(group1, group2, sizeof(group1)) == 0) {
+
+          if (!timeSync) { //otherwise see receiveTimeSyncUDP
+            uint32_t t = instance.sysData.now;
+            t += PRESUMED_NETWORK_DELAY; //adjust trivially for network delay
+            t -= millis();
+            sys->timebase = t;
+            // timebaseUpdated = true;
+
+            Toki::Time tm;
+            tm.sec = instance.sysData.tokiTime;
+            tm.ms = instance.sysData.tokiMs;
+            if (instance.sysData.timeSource > sys->toki.getTimeSource() || sys->toki.getTimeSource() == TOKI_TS_NONE) { //if sender's time source is more accurate
+              sys->toki.adjust(tm, PRESUMED_NETWORK_DELAY); //adjust trivially for network delay
+              uint8_t ts = TOKI_TS_UDP; //5
+              if (instance.sysData.timeSource > 99) ts = TOKI_TS_UDP_NTP; //110
+              else if (instance.sysData.timeSource >= TOKI_TS_SEC) ts = TOKI_TS_UDP_SEC; //20
+              sys->toki.setTime(tm, ts);
+            } else if (/*timebaseUpdated && */ sys->toki.getTimeSource() > 99) { //if we both have good times, get a more accurate timebase
+              Toki::Time myTime = sys->toki.getTime();
+              uint32_t diff = sys->toki.msDifference(tm, myTime);
+              sys->timebase -= PRESUMED_NETWORK_DELAY; //no need to presume, use difference between NTP times at send and receive points
+              if (sys->toki.isLater(tm, myTime)) {
+                sys->timebase += diff;
+              } else {
+                sys->timebase -= diff;
+              }
+            }
+          }
+
+          if (compact) {
+            for (JsonPair pair: dashData) {
+              char pid[32];
+              strlcpy(pid, pair.key().c_str(), sizeof(pid));
+              char * id = strchr(pid, '.');
+              if (id == nullptr) continue;
+              *id++ = '\0';
+
+              Variable(pid, id).setValueJV(pair.value());
+              if (instance.setValue(mdl->varIndexKey(pid, id), pair.value())) instance.changedColumns |= 1 << ic_dash;
+            }
+          }
+          else { //legacy
+            //set instance values from new string
+            JsonDocument newData(&instanceJsonPool);
+            DeserializationError error = deserializeJson(newData, udpStarMessage.jsonString);
+            if (error || !newData.is<JsonObject>()) {
+              // ppf("dev updateInstance json failed ip:%d e:%s\n", instance.ip[3], error.c_str(), udpStarMessage.jsonString);
+              //failed because some instances not on latest firmware, so turned off temporarily (tbd/wip)
+            }
+            else {
+              //check if instance belongs to the same group
+
+              for (JsonPair pair: newData.as<JsonObject>()) {
+                // ppf("updateInstance sync from i:%s k:%s v:%s\n", instance.name, pair.key().c_str(), pair.value().as<String>().c_str());
+
+                char pid[32];
+                strlcpy(pid, pair.key().c_str(), sizeof(pid));
+                char * id = strtok(pid, ".");
+                if (id != nullptr ) {
+                  strlcpy(pid, id, sizeof(pid)); //copy the id part
+                  id = strtok(nullptr, "."); //the rest after .
+                }
+
+                Variable(pid, id).setValueJV(pair.value());
+                if (instance.setValue(dashKey(pair.key().c_str()), pair.value())) instance.changedColumns |= 1 << ic_dash;
+              }
+              // ppf("updateInstance json ip:%d", instance.ip[3]);
+            }
+          }
         }
+      } //same group
 
-      } //ip
-      // rowNr++;
-    } // for instances
+      if (compact) { //only a delta on top of the known content keeps the hash valid, else parse until the next full refresh
+        if (!dashData.isNull())
+          instance.contentHash = ((compact->flags & sc_full) || compact->baseHash == instance.contentHash)?compact->hash:0;
+      }
+    }
+
+    //changed cells are send in sendInstanceChanges
 
     if (!instanceFound) {
       ppf("instances new instance %s\n", messageIP.toString().c_str());
 
+      fullCountdown = 0; //next announcement contains all fields for the new instance
+
       //tbd: pubsub mechanism
       //LEDs specific
       Variable("DDP", "instance").triggerEvent(onUI); //rebuild options
       // Variable(Artnet", "artInst").triggerEvent(onUI); //rebuild options
-
-      // ui->processOnUI("instances");
-      //run though it sorted to find the right rowNr
-      // for (std::vector<InstanceInfo>::iterator instance=instances.begin(); instance!=instances.end(); ++instance) {
-      //   if (instance->ip == messageIP) {
-          for (JsonObject childVar: Variable("Instances", "instances").children()) {
-            Variable(childVar).triggerEvent(onSetValue); //set the value (WIP)); //no rowNr, update all
-          }
-      //   }
-      // }
     }
   }
 
-  InstanceInfo * findInstance(IPAddress ip) {
+  //send the changed cells (row, column) of the instances table
+  void sendInstanceChanges() {
+    if (std::none_of(instances.begin(), instances.end(), [](const InstanceInfo &instance) {return instance.changedColumns != 0;})) return;
+
+    for (JsonObject childVar: Variable("Instances", "instances").children()) {
+      Variable column = Variable(childVar);
+      uint8_t columnNr = ic_dash; //ins<pid>_<id>
+      for (uint8_t i = 0; i < ic_dash; i++) {
+        if (strcmp(column.id(), instanceColumnIds[i]) == 0) {columnNr = i; break;}
+      }
 
-    bool instanceFound = false;
-    for (InstanceInfo &instance : instances) {
-      if (instance.ip == ip)
-        instanceFound = true;
+      for (size_t rowNr = 0; rowNr < instances.size(); rowNr++)
+        if (instances[rowNr].changedColumns & (1 << columnNr))
+          column.triggerEvent(onSetValue, rowNr);
     }
 
-    if (!instanceFound) { //instance always found
-      InstanceInfo instance;
-      instance.ip = ip;
-      instances.push_back(instance);
-      std::sort(instances.begin(),instances.end(), [](InstanceInfo &a, InstanceInfo &b){ return strncmp(a.name,b.name, sizeof(a.name))<0; });
+    for (InstanceInfo &instance: instances)
+      instance.changedColumns = 0;
+  }
+
+  //instance by ip, created (added as last row) if not found and create
+  InstanceInfo * findInstance(IPAddress ip, bool create = true) {
+    auto it = instanceIndex.find((uint32_t)ip);
+    if (it != instanceIndex.end()) return &instances[it->second];
+    if (!create) return nullptr;
+
+    uint8_t rowNr = instances.size();
+    instances.emplace_back();
+    InstanceInfo &instance = instances.back();
+    instance.ip = ip;
+    instance.changedColumns = (1 << ic_count) - 1; //all cells of the new row
+    instanceIndex[(uint32_t)ip] = rowNr;
+    touchInstance(instance);
+
+    //add the row on the client(s), the cells follow in sendInstanceChanges
+    Variable tableVar = Variable("Instances", "instances");
+    if (tableVar.var) {
+      JsonObject responseObject = web->getResponseObject();
+      responseObject["onAdd"]["pid"] = tableVar.pid();
+      responseObject["onAdd"]["id"] = tableVar.id();
+      responseObject["onAdd"]["rowNr"] = rowNr;
+      web->sendResponseObject();
     }
+    return &instance;
+  }
+
+  //received from the instance: reschedule its expiry on the aging wheel (only if the expiry second changes)
+  void touchInstance(InstanceInfo &instance) {
+    instance.timeStamp = millis();
+    uint32_t expirySecond = millis() / 1000 + INSTANCE_TIMEOUT;
+    if (expirySecond == instance.expirySecond) return;
+    instance.expirySecond = expirySecond;
+    agingWheel[expirySecond % INSTANCE_WHEEL_SIZE].push_back((uint32_t)instance.ip);
+  }
 
-    // InstanceInfo foundInstance;
-    //iterate vector pointers so we can update the instances
-    for (InstanceInfo &instance : instances) {
-      if (instance.ip == ip) {
-        return &instance;
+  //remove the instances which expire in the seconds passed since the last call. Wheel entries of touched instances are outdated and skipped
+  void ageInstances() {
+    uint32_t second = millis() / 1000;
+    bool removed = false;
+    if (agingSecond == 0) agingSecond = second - 1; //first call: touched instances expire in the future
+    else if (second - agingSecond > INSTANCE_WHEEL_SIZE) {
+      //stalled longer than the wheel: buckets have wrapped, so age all instances linearly and rebuild the wheel
+      for (int rowNr = instances.size() - 1; rowNr >= 0; rowNr--) { //backwards as removeInstance moves the last row
+        if ((int32_t)(instances[rowNr].expirySecond - second) <= 0) {
+          removeInstance(rowNr);
+          removed = true;
+        }
       }
+      for (std::vector<uint32_t> &bucket: agingWheel) bucket.clear();
+      for (const InstanceInfo &instance: instances) agingWheel[instance.expirySecond % INSTANCE_WHEEL_SIZE].push_back((uint32_t)instance.ip);
+      agingSecond = second;
+    }
+    while (agingSecond != second) {
+      agingSecond++;
+      std::vector<uint32_t> &bucket = agingWheel[agingSecond % INSTANCE_WHEEL_SIZE];
+      for (uint32_t ip: bucket) {
+        auto it = instanceIndex.find(ip);
+        if (it != instanceIndex.end() && instances[it->second].expirySecond == agingSecond) {
+          removeInstance(it->second);
+          removed = true;
+        }
+      }
+      bucket.clear();
+    }
+
+    if (removed) {
+      //tbd: pubsub mechanism
+      //LEDs specific
+      Variable("DDP", "instance").triggerEvent(onUI); //rebuild options
+      // Variable("Artnet", "artInst").triggerEvent(onUI); //rebuild options
+    }
+  }
+
+  //a column of the instances table: the value of one row (rowNr) or of all rows in one setValues
+  template <typename Type, typename Fun>
+  void setColumn(Variable variable, uint8_t rowNr, Fun fun) {
+    if (rowNr != UINT8_MAX) {
+      if (rowNr < instances.size()) variable.setValue((Type)fun(instances[rowNr]), rowNr);
+      return;
     }
+    std::vector<Type> values;
+    for (const InstanceInfo &instance: instances) values.push_back(fun(instance));
+    variable.setValues(values);
+  }
+
+  //the last instance takes the place of the removed one so only these two rows change
+  void removeInstance(uint8_t rowNr) {
+    uint8_t lastRowNr = instances.size() - 1;
+    ppf("instances remove inactive instance %s [%d]\n", instances[rowNr].ip.toString().c_str(), rowNr);
+    instanceIndex.erase((uint32_t)instances[rowNr].ip);
+    if (rowNr != lastRowNr) {
+      instances[rowNr] = instances[lastRowNr];
+      instances[rowNr].changedColumns = (1 << ic_count) - 1;
+      instanceIndex[(uint32_t)instances[rowNr].ip] = rowNr;
+    }
+    instances.pop_back();
 
-    return nullptr;
+    //remove the last row on server and client(s)
+    Variable tableVar = Variable("Instances", "instances");
+    if (tableVar.var) tableVar.deleteRow(lastRowNr);
+  }
+
+  //varIndexKey of a dash value key: pid.id or only id (legacy messages and WLED)
+  uint32_t dashKey(const char * key) {
+    const char * dot = strchr(key, '.');
+    if (dot) {
+      char pid[32];
+      strlcpy(pid, key, min((size_t)(dot - key + 1), sizeof(pid)));
+      return mdl->varIndexKey(pid, dot + 1);
+    }
+    for (JsonObject var: dashVars)
+      if (var["id"] == key) return mdl->varIndexKey(var["pid"], key);
+    return 0;
   }
 
   private:
@@ -875,6 +1619,31 @@ public:
     uint16_t notifierUDPPort = 21324;
     bool udpConnected = false;
 
+    //var sync
+    uint32_t syncBootId = esp_random();
+    uint32_t syncSeq = 0;
+
+    //time sync
+    uint8_t timeSyncTurn = 0;
+    size_t timeSyncRow = 0;
+    uint32_t timeSyncSeq = 0;
+    int32_t clockAdjusted = 0; //ms added to sys->timebase by time sync since boot
+    int32_t tokiAdjusted = 0; //ms added to sys->toki by time sync since boot
+    int32_t clockSlew = 0; //ms still to add to sys->timebase, see slewClocks
+    int32_t tokiSlew = 0;
+    uint8_t tokiSource = TOKI_TS_UDP; //set on sys->toki while slewing
+
+    //registry
+    std::unordered_map<uint32_t, uint8_t> instanceIndex; //ip -> rowNr in instances
+    std::vector<uint32_t> agingWheel[INSTANCE_WHEEL_SIZE]; //ips per expiry second (modulo), see touchInstance
+    uint32_t agingSecond = 0; //last second processed by ageInstances
+    std::vector<JsonObject> dashVars; //found in setup, see dashKey
+
+    //compact sysInfo
+    uint8_t fullCountdown = 0; //announcements until the next full refresh
+    uint32_t sentHash = 0; //of the previous announcement
+    std::unordered_map<uint32_t, uint32_t> sentHashes; //field key (see sendStarCompactUDP) -> hash of the sent value
+
     //instances (WLED and StarBase)
     WiFiUDP instanceUDP;
     uint16_t instanceUDPPort = 65506;
@@ -39,15 +39,42 @@
     return var["n"];
   }
 
-  void Variable::removeValuesForRow(uint8_t rowNr) {
+  void Variable::insertRow(uint8_t rowNr) {
+    JsonObject responseObject = web->getResponseObject();
+    responseObject["onAdd"]["pid"] = pid();
+    responseObject["onAdd"]["id"] = id();
+    responseObject["onAdd"]["rowNr"] = rowNr;
+    web->sendResponseObject(); //the client appends a row
+
+    //columns with values after rowNr: shift them one row, the whole column to the client(s)
     for (JsonObject childVar: children()) {
-      Variable childVariable = Variable(childVar);
-      JsonArray valArray = childVariable.valArray();
-      if (!valArray.isNull()) {
-        valArray.remove(rowNr);
-        //recursive
-        childVariable.removeValuesForRow(rowNr);
-      }
+      JsonArray valArray = Variable(childVar).valArray();
+      if (rowNr >= valArray.size()) continue; //nothing to shift
+      valArray.add(valArray[valArray.size() - 1]);
+      for (size_t index = valArray.size() - 2; index > rowNr; index--) valArray[index] = valArray[index - 1];
+      valArray[rowNr] = nullptr;
+      web->addResponseValue(childVar); //an array: json
+    }
+  }
+
+  void Variable::deleteRow(uint8_t rowNr, bool notify) {
+    //columns and their details (children per row): one list, no recursion
+    std::vector<JsonObject> rowVars;
+    for (JsonObject childVar: children()) rowVars.push_back(childVar);
+    for (size_t index = 0; index < rowVars.size(); index++) {
+      Variable rowVariable = Variable(rowVars[index]);
+      JsonArray valArray = rowVariable.valArray();
+      if (valArray.isNull()) continue; //no values, no details with values
+      if (rowNr < valArray.size()) valArray.remove(rowNr);
+      for (JsonObject childVar: rowVariable.children()) rowVars.push_back(childVar);
+    }
+
+    if (notify) {
+      JsonObject responseObject = web->getResponseObject();
+      responseObject["onDelete"]["pid"] = pid();
+      responseObject["onDelete"]["id"] = id();
+      responseObject["onDelete"]["rowNr"] = rowNr;
+      web->sendResponseObject(); //one per row as a response can carry only one onDelete
     }
   }
 
@@ -80,6 +107,7 @@
         varChild.remove("o");
       }
     else {
+      for (JsonObject varChild: children()) mdl->unIndexVar(varChild); //before delete, as children are freed
       var["n"].to<JsonArray>(); //delete old values
     }
 
@@ -117,6 +145,7 @@
             }
             if (allNull) {
               ppf("remove allnulls %s\n", childVariable.id());
+              mdl->unIndexVar(childVar);
               children().remove(childVarIt);
             }
           }
@@ -127,6 +156,7 @@
           if (childVar["o"].isNull()) { //if not updated
             ppf("varPostDetails %s.%s <- null\n", id(), childVariable.id());
             print->printJson("remove", childVar);
+            mdl->unIndexVar(childVar);
             children().remove(childVarIt);
           }
         }
@@ -143,16 +173,17 @@
     web->getResponseObject()["details"]["var"] = var;
   }
 
-  bool Variable::triggerEvent(uint8_t eventType, uint8_t rowNr, bool init) {
+  bool Variable::triggerEvent(uint8_t eventType, uint8_t rowNr, bool init, bool shadowed) {
 
     if (eventType == onChange) {
-      if (!init) {
+      if (!init && !shadowed) {
         if (!var["dash"].isNull())
           instances->changedVarsQueue.push_back(var); //tbd: check value arrays / rowNr is working
       }
 
       //if var is bound by pointer, set the pointer value before calling onChange
-      if (!var["p"].isNull()) {
+      const VarBinding *binding = mdl->varBinding(var);
+      if (binding) {
         JsonVariant value;
         if (rowNr == UINT8_MAX) {
           value = this->value(); 
@@ -160,92 +191,92 @@
           value = this->value(rowNr);
         }
 
-        //pointer is an array if set by setValueRowNr, used for controls as each control has a seperate variable
-        bool isPointerArray = var["p"].is<JsonArray>();
-        int pointer;
-        if (isPointerArray)
-          pointer = var["p"][rowNr];
-        else
-          pointer = var["p"];
+        int pointer = binding->getPointer(rowNr);
 
         if (pointer != 0) {
 
-          if (this->value().is<JsonArray>() && !isPointerArray) { //vector if val array but not if control (each var in array stored in seperate variable)
-            if (rowNr != UINT8_MAX) {
-              //pointer checks
-              if (var["type"] == "select" || var["type"] == "range" || var["type"] == "pin") {
-                std::vector<uint8_t> *valuePointer = (std::vector<uint8_t> *)pointer;
-                while (rowNr >= (*valuePointer).size()) (*valuePointer).push_back(UINT8_MAX); //create vector space if needed...
-                ppf("%s.%s[%d]:%s (%d - %d - %s)\n", pid(), id(), rowNr, valueString().c_str(), pointer, (*valuePointer).size(), var["p"].as<String>().c_str());
-                (*valuePointer)[rowNr] = value;
+          if (binding->isVector) { //vector if val array but not if control (each var in array stored in seperate variable)
+            //one row, or all rows if bulk set (setValues)
+            bool allRows = rowNr == UINT8_MAX && value.is<JsonArray>();
+            if (rowNr != UINT8_MAX || allRows) {
+              size_t rowCount = allRows?value.size():1;
+              if (allRows) { //bulk: the vector gets exactly the rows of value, also if rows are removed
+                switch (binding->pointerType) {
+                case pt_uint8: ((std::vector<uint8_t> *)pointer)->resize(rowCount, UINT8_MAX); break;
+                case pt_uint16: ((std::vector<uint16_t> *)pointer)->resize(rowCount, UINT16_MAX); break;
+                case pt_bool3State: ((std::vector<bool3State> *)pointer)->resize(rowCount, UINT8_MAX); break;
+                case pt_VectorString: ((std::vector<VectorString> *)pointer)->resize(rowCount, VectorString()); break;
+                case pt_Coord3D: ((std::vector<Coord3D> *)pointer)->resize(rowCount, {-1,-1,-1}); break;
+                default: break;
+                }
               }
-              else if (var["type"] == "number") {
-                std::vector<uint16_t> *valuePointer = (std::vector<uint16_t> *)pointer;
-                while (rowNr >= (*valuePointer).size()) (*valuePointer).push_back(UINT16_MAX); //create vector space if needed...
-                (*valuePointer)[rowNr] = value;
+              for (size_t index = 0; index < rowCount; index++) {
+                uint8_t valueRowNr = allRows?index:rowNr;
+                JsonVariant rowValue = allRows?value[index]:value;
+                switch (binding->pointerType) {
+                case pt_uint8: {
+                  std::vector<uint8_t> *valuePointer = (std::vector<uint8_t> *)pointer;
+                  while (valueRowNr >= (*valuePointer).size()) (*valuePointer).push_back(UINT8_MAX); //create vector space if needed...
+                  (*valuePointer)[valueRowNr] = rowValue;
+                  break; }
+                case pt_uint16: {
+                  std::vector<uint16_t> *valuePointer = (std::vector<uint16_t> *)pointer;
+                  while (valueRowNr >= (*valuePointer).size()) (*valuePointer).push_back(UINT16_MAX); //create vector space if needed...
+                  (*valuePointer)[valueRowNr] = rowValue;
+                  break; }
+                case pt_bool3State: {
+                  std::vector<bool3State> *valuePointer = (std::vector<bool3State> *)pointer;
+                  while (valueRowNr >= (*valuePointer).size()) (*valuePointer).push_back(UINT8_MAX); //create vector space if needed...
+                  (*valuePointer)[valueRowNr] = rowValue;
+                  break; }
+                case pt_VectorString: {
+                  std::vector<VectorString> *valuePointer = (std::vector<VectorString> *)pointer;
+                  while (valueRowNr >= (*valuePointer).size()) (*valuePointer).push_back(VectorString()); //create vector space if needed...
+                  strlcpy((*valuePointer)[valueRowNr].s, rowValue.as<const char *>(), sizeof(VectorString().s));
+                  break; }
+                case pt_Coord3D: {
+                  std::vector<Coord3D> *valuePointer = (std::vector<Coord3D> *)pointer;
+                  while (valueRowNr >= (*valuePointer).size()) (*valuePointer).push_back({-1,-1,-1}); //create vector space if needed...
+                  (*valuePointer)[valueRowNr] = rowValue;
+                  break; }
+                default:
+                  print->printJson("dev triggerChange type not supported yet (arrays)", var);
+                }
               }
-              else if (var["type"] == "checkbox") {
-                std::vector<bool3State> *valuePointer = (std::vector<bool3State> *)pointer;
-                while (rowNr >= (*valuePointer).size()) (*valuePointer).push_back(UINT8_MAX); //create vector space if needed...
-                (*valuePointer)[rowNr] = value;
-              }
-              else if (var["type"] == "text" || var["type"] == "fileEdit") {
-                std::vector<VectorString> *valuePointer = (std::vector<VectorString> *)pointer;
-                while (rowNr >= (*valuePointer).size()) (*valuePointer).push_back(VectorString()); //create vector space if needed...
-                strlcpy((*valuePointer)[rowNr].s, value.as<const char *>(), sizeof(VectorString().s));
-              }
-              else if (var["type"] == "coord3D") {
-                std::vector<Coord3D> *valuePointer = (std::vector<Coord3D> *)pointer;
-                while (rowNr >= (*valuePointer).size()) (*valuePointer).push_back({-1,-1,-1}); //create vector space if needed...
-                (*valuePointer)[rowNr] = value;
-              }
-              else
-                print->printJson("dev triggerChange type not supported yet (arrays)", var);
 
               // ppf("triggerChange set pointer to vector %s[%d]: v:%s p:%d\n", id(), rowNr, value.as<String>().c_str(), pointer);
             } else 
               print->printJson("dev value is array but no rowNr\n", var);
           } else { //no array
-            //pointer checks
-            if (var["type"] == "select" || var["type"] == "range" || var["type"] == "pin") {
-              uint8_t *valuePointer = (uint8_t *)pointer;
-              *valuePointer = value;
-            }
-            else if (var["type"] == "number") {
-              uint16_t *valuePointer = (uint16_t *)pointer;
-              *valuePointer = value;
-            }
-            else if (var["type"] == "checkbox") {
-              bool3State *valuePointer = (bool3State *)pointer;
-              *valuePointer = value;
-            }
-            else if (var["type"] == "coord3D") {
-              Coord3D *valuePointer = (Coord3D *)pointer;
-              *valuePointer = value;
-            }
-            else
+            switch (binding->pointerType) {
+            case pt_uint8:
+              *(uint8_t *)pointer = value;
+              break;
+            case pt_uint16:
+              *(uint16_t *)pointer = value;
+              break;
+            case pt_bool3State:
+              *(bool3State *)pointer = value;
+              break;
+            case pt_Coord3D:
+              *(Coord3D *)pointer = value;
+              break;
+            default:
               print->printJson("dev triggerChange type not supported yet", var);
+            }
 
             // ppf("triggerChange set pointer %s[%d]: v:%s p:%d\n", id(), rowNr, valueString().c_str(), pointer);
           }
-
-          // else if (var["type"] == "text") {
-          //   const char *valuePointer = (const char *)pointer;
-          //   if (valuePointer != nullptr) {
-          //     *valuePointer = value;
-          //     ppf("pointer set16 %s: v:%d (p:%p) (r:%d v:%s p:%d)\n", id(), *valuePointer, valuePointer, rowNr, valueString().c_str(), pointer);
-          //   }
-          //   else
-          //     ppf("dev pointer set16 %s: v:%d (p:%p) (r:%d v:%s p:%d)\n", id(), *valuePointer, valuePointer, rowNr, valueString().c_str(), pointer);
-          // }
         }
         else
           // ppf("dev pointer of type %s is 0\n", var["type"].as<String>().c_str());
           print->printJson("dev pointer is 0", var);
       } //pointer
 
+      if (!init && !shadowed && !readOnly()) mdl->setDirty(var);
+
       //reset presets if not using presets controls and if updated by UI, except if updated by ui via presets
-      if (var["id"] != "preset" && var["id"] != "assignPreset" && var["id"] != "clearPreset" && mdl->resetPresetThreshold > 1) {
+      if (var["id"] != "preset" && var["id"] != "assignPreset" && var["id"] != "clearPreset" && var["id"] != "crossfade" && mdl->resetPresetThreshold > 1) {
         JsonObject moduleVar = mdl->findModule(pid(), id());
         JsonObject presetVar = mdl->findVar(moduleVar["id"], "preset");
         if (!presetVar.isNull()) {
@@ -298,40 +329,44 @@
       //find the columns of the table
       if (eventType == onDelete) {
         for (JsonObject childVar: children()) {
-          int pointer;
-          if (childVar["p"].is<JsonArray>())
-            pointer = childVar["p"][rowNr];
-          else
-            pointer = childVar["p"];
+          const VarBinding *binding = mdl->varBinding(childVar);
+          if (!binding) continue; //no pointer, no vector to delete from
+
+          int pointer = binding->getPointer(rowNr);
 
           ppf("  delete vector %s[%d] %d\n", Variable(childVar).id(), rowNr, pointer);
 
           if (pointer != 0) {
-            //pointer checks
             // check rowNr as it can be 255 
-            if (childVar["type"] == "select" || childVar["type"] == "range" || childVar["type"] == "pin") {
+            switch (binding->pointerType) {
+            case pt_uint8: {
               std::vector<uint8_t> *valuePointer = (std::vector<uint8_t> *)pointer;
               if (rowNr < (*valuePointer).size())
                 (*valuePointer).erase((*valuePointer).begin() + rowNr);
-            } else if (childVar["type"] == "number") {
+              break; }
+            case pt_uint16: {
               std::vector<uint16_t> *valuePointer = (std::vector<uint16_t> *)pointer;
               if (rowNr < (*valuePointer).size())
                 (*valuePointer).erase((*valuePointer).begin() + rowNr);
-            } else if (childVar["type"] == "checkbox") {
+              break; }
+            case pt_bool3State: {
               std::vector<bool3State> *valuePointer = (std::vector<bool3State> *)pointer;
               if (rowNr < (*valuePointer).size())
                 (*valuePointer).erase((*valuePointer).begin() + rowNr);
-            } else if (childVar["type"] == "text" || childVar["type"] == "fileEdit") {
+              break; }
+            case pt_VectorString: {
               std::vector<VectorString> *valuePointer = (std::vector<VectorString> *)pointer;
               if (rowNr < (*valuePointer).size())
                 (*valuePointer).erase((*valuePointer).begin() + rowNr);
-            } else if (childVar["type"] == "coord3D") {
+              break; }
+            case pt_Coord3D: {
               std::vector<Coord3D> *valuePointer = (std::vector<Coord3D> *)pointer;
               if (rowNr < (*valuePointer).size())
                 (*valuePointer).erase((*valuePointer).begin() + rowNr);
-            }
-            else
+              break; }
+            default:
               print->printJson("dev triggerEvent onDelete type not supported yet", childVar);
+            }
           }
         }
       } //onDelete
@@ -470,14 +505,21 @@
       return var["value"];
   }
 
-  bool Variable::initValue(int min, int max, int pointer) {
+  bool Variable::initValue(int min, int max, int pointer, bool isVector) {
 
     if (pointer != 0) {
+      if (!isVector && mdl->setValueRowNr == UINT8_MAX && var["h"].is<uint16_t>())
+        shadows.add(var["h"]); //pointer bound: hot
+      VarBinding *binding = mdl->varBinding(var, true);
+      binding->pointerType = mdl->typeToPointerType(type()); //resolve once, type can change in initVar
+      binding->isVector = isVector;
       if (mdl->setValueRowNr == UINT8_MAX)
-        var["p"] = pointer; //store pointer!
-      else
-        var["p"][mdl->setValueRowNr] = pointer; //store pointer in array!
-      // ppf("initValue pointer stored %s: %s\n", id(), (void *)(var["p"].as<String>().c_str()));
+        binding->pointer = pointer; //store pointer!
+      else {
+        while (mdl->setValueRowNr >= binding->rowPointers.size()) binding->rowPointers.push_back(0);
+        binding->rowPointers[mdl->setValueRowNr] = pointer; //store pointer per row!
+      }
+      // ppf("initValue pointer stored %s: %d\n", id(), pointer);
     }
 
     if (min) var["min"] = min;
@@ -517,11 +559,11 @@
         if (var["value"].is<JsonArray>()) {
           //refill the vector
           for (uint8_t rowNr = 0; rowNr < valArray().size(); rowNr++) {
-            onChangeExists |= triggerEvent(onChange, rowNr, true); //init, also set var["p"]
+            onChangeExists |= triggerEvent(onChange, rowNr, true); //init, also set the bound pointer
           }
         }
         else {
-          onChangeExists = triggerEvent(onChange, mdl->setValueRowNr, true); //init, also set var["p"] 
+          onChangeExists = triggerEvent(onChange, mdl->setValueRowNr, true); //init, also set the bound pointer
         }
 
         if (onChangeExists)
@@ -531,22 +573,119 @@
     return false;
   }
 
+ShadowStore shadows;
+
+void ShadowStore::add(uint16_t handle) {
+  if (handle == UINT16_MAX || slotOf(handle) != UINT16_MAX) return;
+  if (handle >= slots.size()) slots.resize(handle + 1, UINT16_MAX);
+  uint16_t slot = handles.size();
+  slots[handle] = slot;
+  handles.push_back(handle);
+  kinds.push_back(sk_none);
+  tags.push_back(0);
+  indexes.push_back(0);
+  valid.push_back(false);
+  for (uint8_t stage = 0; stage < ss_count; stage++)
+    if (slot / 32 >= dirty[stage].size()) dirty[stage].push_back(0);
+}
+
+void ShadowStore::remove(uint16_t handle) {
+  uint16_t slot = slotOf(handle);
+  if (slot == UINT16_MAX) return;
+  slots[handle] = UINT16_MAX;
+  handles[slot] = UINT16_MAX; //slot not reused (as handles), not drained
+  valid[slot] = false;
+}
+
+void ShadowStore::assign(uint16_t slot, uint8_t kind) {
+  kinds[slot] = kind;
+  switch (kind) {
+  case sk_int: indexes[slot] = ints.size(); ints.push_back(0); break;
+  case sk_float: indexes[slot] = floats.size(); floats.push_back(0); break;
+  case sk_coord: indexes[slot] = coords.size(); coords.push_back({0, 0, 0}); break;
+  }
+}
+
+bool ShadowStore::get(uint16_t handle, WSValue &wsValue) const {
+  uint16_t slot = slotOf(handle);
+  if (slot == UINT16_MAX || !valid[slot]) return false;
+  wsValue.handle = handle;
+  switch (kinds[slot]) {
+  case sk_int:
+    wsValue.value[0] = ints[indexes[slot]];
+    //as SysModWeb::valueToWSValue
+    wsValue.tag = tags[slot] == vt_bool?vt_bool:(wsValue.value[0] >= 0 && wsValue.value[0] <= UINT8_MAX)?vt_uint8:(wsValue.value[0] >= 0 && wsValue.value[0] <= UINT16_MAX)?vt_uint16:vt_int32;
+    return true;
+  case sk_float:
+    wsValue.tag = vt_float;
+    memcpy(&wsValue.value[0], &floats[indexes[slot]], sizeof(float));
+    return true;
+  case sk_coord:
+    wsValue.tag = vt_Coord3D;
+    wsValue.value[0] = coords[indexes[slot]].x;
+    wsValue.value[1] = coords[indexes[slot]].y;
+    wsValue.value[2] = coords[indexes[slot]].z;
+    return true;
+  default: return false;
+  }
+}
+
+void ShadowStore::drain(uint8_t stage, std::function<void(uint16_t)> fun) {
+  for (size_t word = 0; word < dirty[stage].size(); word++) {
+    uint32_t bits = __atomic_exchange_n(&dirty[stage][word], 0, __ATOMIC_RELAXED);
+    while (bits) {
+      size_t slot = word * 32 + __builtin_ctz(bits);
+      bits &= bits - 1;
+      if (handles[slot] != UINT16_MAX) fun(handles[slot]);
+    }
+  }
+}
+
 SysModModel::SysModModel() :SysModule("Model") {
   model = new JsonDocument(&allocator);
   presets = new JsonDocument(&allocator);
 
   JsonArray root = model->to<JsonArray>(); //create
 
-  ppf("Reading model from /model.json... (deserializeConfigFromFS)\n");
-  if (files->readObjectFromFile("/model.json", model)) {//not part of success...
-    // print->printJson("Read model", *model);
-    // web->sendDataWs(*model);
+  unsigned long startMicros = micros();
+  uint32_t startHeap = ESP.getFreeHeap();
+
+  //all model files, their content hash is used to check if the snapshot is still valid
+  uint32_t modelFilesHash = scanModelFiles();
+
+  ppf("Reading model from /model.mpk... (snapshot)\n");
+  if (files->readSnapshot("/model.json", model, modelFilesHash, &bootJsonMicros)) {
+    bootFromSnapshot = true;
   } else {
-    root = model->to<JsonArray>(); //re create the model as it is corrupted by readFromFile
+    root = model->to<JsonArray>(); //re create the model as it can be corrupted by readSnapshot
+
+    ppf("Reading model from /model.json... (deserializeConfigFromFS)\n");
+    if (files->readObjectFromFile("/model.json", model)) {//not part of success...
+      // print->printJson("Read model", *model);
+      // web->sendDataWs(*model);
+    } else {
+      root = model->to<JsonArray>(); //re create the model as it is corrupted by readFromFile
+    }
+
+    readModuleFiles(); //newer than model.json
+
+    bootJsonMicros = micros() - startMicros;
+    //next boot can use the snapshot (model contains only what is in the files here, no transient values yet)
+    if (model->as<JsonArray>().size()) files->writeSnapshot("/model.json", model, modelFilesHash, bootJsonMicros);
   }
 
-  files->readObjectFromFile("/presets.json", presets); //do not create if not exists
+  bootMicros = micros() - startMicros;
+  bootHeap = startHeap - ESP.getFreeHeap();
+
+  uint32_t presetsHash = files->fileSize("/presets.json")?files->contentHash("/presets.json"):0;
+  if (presetsHash && !files->readSnapshot("/presets.json", presets, presetsHash)) {
+    presets->clear();
+    unsigned long presetsMicros = micros();
+    if (files->readObjectFromFile("/presets.json", presets)) //do not create if not exists
+      files->writeSnapshot("/presets.json", presets, presetsHash, micros() - presetsMicros);
+  }
 
+  buildVarIndex(); //vars from model.json, new vars are added in initVar
 }
 
 void SysModModel::setup() {
@@ -565,6 +704,33 @@ void SysModModel::setup() {
     default: return false;
   }});
 
+  ui->initText(parentVar, "bootLoad", nullptr, 64, true, [this](EventArguments) { switch (eventType) {
+    case onSetValue:
+      if (bootFromSnapshot)
+        variable.setValueF("snapshot %d ms (json %d ms) heap %d", bootMicros/1000, bootJsonMicros/1000, bootHeap);
+      else
+        variable.setValueF("json %d ms heap %d", bootMicros/1000, bootHeap);
+      return true;
+    case onUI:
+      variable.setComment("Model load time at boot");
+      return true;
+    default: return false;
+  }});
+
+  ui->initCheckBox(parentVar, "autoSave", &autoSave, false, [](EventArguments) { switch (eventType) {
+    case onUI:
+      variable.setComment("Save changed modules after quiet period");
+      return true;
+    default: return false;
+  }});
+
+  ui->initNumber(parentVar, "quietPeriod", &quietPeriod, 0, UINT16_MAX, false, [](EventArguments) { switch (eventType) {
+    case onUI:
+      variable.setComment("ms without changes");
+      return true;
+    default: return false;
+  }});
+
   #ifdef STARBASE_DEVMODE
 
   ui->initButton(parentVar, "deleteObsolete", false, [this](EventArguments) { switch (eventType) {
@@ -582,7 +748,7 @@ void SysModModel::setup() {
         if (var["o"].isNull()) { //!variable.var.isNull() &&  || variable.order() <= 0
           ppf("deleteObsolete remove var %s.%s (no order)\n", variable.pid()?variable.pid():"-", variable.id());          
             // vars.remove(var); //remove the obsolete var (no o or )
-          for (JsonArray::iterator it=vars.begin(); it!=vars.end(); ++it) if ((*it)["id"] == var["id"]) vars.remove(it); //use iterator to make .remove work!!!
+          for (JsonArray::iterator it=vars.begin(); it!=vars.end(); ++it) if ((*it)["id"] == var["id"]) {unIndexVar(*it); vars.remove(it);} //use iterator to make .remove work!!!
         }
         return JsonObject(); //don't stop
       });
@@ -599,48 +765,270 @@ void SysModModel::setup() {
   currentVar.subscribe(onLoop1s, [this](EventArguments) {
     variable.setValueF("%d x %d = %d (%d + %d + %d)", varEventsPS.size(), sizeof(VarEventPS), varEventsPS.size() * sizeof(VarEventPS), sizeof(Variable), sizeof(VarFunction), sizeof(uint8_t));
   });
+  currentVar = ui->initText(parentVar, "dispatches", nullptr, 16, true);
+  currentVar.subscribe(onLoop1s, [this](EventArguments) {
+    variable.setValueF("%d /s (%d vars)", dispatchesPS, varSubscriptions.size());
+  });
 
   #endif //STARBASE_DEVMODE
 }
 
 void SysModModel::loop20ms() {
+  trackChanges = true;
 
-  if (doWriteModel) {
-    ppf("Writing model to /model.json... (serializeConfig)\n");
+  //changed hot vars: their modules are dirty
+  shadows.drain(ss_persist, [this](uint16_t handle) {
+    JsonObject var = findVarByHandle(handle);
+    if (!var.isNull() && !Variable(var).readOnly()) setDirty(var);
+  });
 
-    // files->writeObjectToFile("/model.json", model);
+  if (compactState >= cs_written) compactDone();
 
-    walkThroughModel([](JsonObject parentVar, JsonObject var) {
+  if (doWriteModel && compactState == cs_idle) { //not while the compact task writes model.json
+    writeModel();
+    doWriteModel = false;
+  }
+  else if (autoSave && dirtyModules.size() && millis() - lastChangeMillis >= quietPeriod) {
+    //one module per loop20ms to keep the loop going
+    JsonObject moduleVar = dirtyModules.back();
+    dirtyModules.pop_back();
+    writeModule(moduleVar);
+  }
+}
 
-      Variable variable = Variable(var);
+void SysModModel::loop10s() {
+  //compact: merge module files in model.json if no changes for a while 
+  if (moduleFiles.size() && dirtyModules.empty() && millis() - lastChangeMillis >= compactPeriod) {
+    if (compactState == cs_idle) compactModel();
+  }
+}
 
-      //remove ro values (ro vars cannot be deleted as SM uses these vars)
-      // remove if var is ro or table is instance table (exception here, values don't need to be saved)
-      if (parentVar["id"] == "instances" || variable.readOnly()) {// && !value().isNull())
-        // ppf("remove ro value %s.%s\n", variable.pid(), variable.id());          
-        var.remove("value");
-      }
+//grows a heap buffer, a write fails (0) if out of memory, see compactModel
+class HeapPrint: public Print {
+public:
+  ~HeapPrint() {free(data);}
+  size_t write(uint8_t c) override {return write(&c, 1);}
+  size_t write(const uint8_t *buffer, size_t size) override {
+    if (length + size > capacity) {
+      size_t newCapacity = max(capacity * 2, length + size + 1024);
+      uint8_t *newData = (uint8_t *)realloc(data, newCapacity);
+      if (!newData) return 0;
+      data = newData;
+      capacity = newCapacity;
+    }
+    memcpy(data + length, buffer, size);
+    length += size;
+    return size;
+  }
+  uint8_t *data = nullptr;
+  size_t length = 0;
+  size_t capacity = 0;
+};
+
+void SysModModel::compactModel() {
+  //serializing in memory takes ms, writing flash can take seconds: that is done by a low priority task, off the render loop
+  HeapPrint *json = new HeapPrint();
+  bool result;
+  {
+    StarJson starJson;
+    addFileExclusions(starJson);
+    result = starJson.writeJsonVarTo(*json, model->as<JsonVariant>());
+  }
+  if (!result) {
+    ppf("dev compactModel out of memory (%d bytes), try again later\n", json->length);
+    delete json;
+    return;
+  }
 
-      return JsonObject(); //don't stop
-    });
+  ppf("Compacting %d module files into /model.json (%d bytes)\n", moduleFiles.size(), json->length);
+  compactChangeMillis = lastChangeMillis;
+  compactState = cs_writing;
+  if (xTaskCreatePinnedToCore([](void *parameter) {
+    HeapPrint *json = (HeapPrint *)parameter;
+    File f = files->open("/model.json.tmp", FILE_WRITE);
+    bool result = f && f.write(json->data, json->length) == json->length;
+    if (f) f.close();
+    delete json;
+    //replace model.json only if completely written
+    if (result) result = files->rename("/model.json.tmp", "/model.json");
+    if (result) files->removeSnapshot("/model.json");
+    mdl->compactState = result?cs_written:cs_failed;
+    vTaskDelete(nullptr);
+  }, "compact", 4096, json, tskIDLE_PRIORITY, nullptr, tskNO_AFFINITY) != pdPASS) {
+    delete json;
+    compactState = cs_idle;
+  }
+}
 
-    StarJson starJson("/model.json", FILE_WRITE); //open fileName for deserialize
-    //comment exclusions out in case of generating model.json for github
-    starJson.addExclusion("fun");
-    starJson.addExclusion("dash");
-    starJson.addExclusion("o"); //order: this must be deleted as it will be used to check on reboot 
-    starJson.addExclusion("p"); //pointer
-    starJson.addExclusion("oldValue");
-    starJson.writeJsonDocToFile(model);
+void SysModModel::compactDone() {
+  if (compactState == cs_failed)
+    ppf("dev compactModel write /model.json failed\n");
+  else if (lastChangeMillis != compactChangeMillis) //module files written after the copy are newer than model.json, keep them till the next compaction
+    ppf("compactModel: changes during compaction, module files kept\n");
+  else {
+    //all in model.json now
+    for (VectorString &moduleFile: moduleFiles) {
+      char path[40];
+      print->fFormat(path, sizeof(path), "/mdl.%s.json", moduleFile.s);
+      files->remove(path);
+    }
+    moduleFiles.clear();
+  }
+  compactState = cs_idle;
+}
 
-    // print->printJson("Write model", *model); //this shows the model before exclusion
+void SysModModel::setDirty(JsonObject var) {
+  if (!trackChanges) return;
+  lastChangeMillis = millis();
 
-    if (!presets->isNull())
-      files->writeObjectToFile("/presets.json", presets);
+  if (batchDepth) {
+    batchChanged = true;
+    return;
+  }
 
+  setModuleDirty(findModule(var["pid"], var["id"]));
+}
 
-    doWriteModel = false;
+void SysModModel::setModuleDirty(JsonObject moduleVar) {
+  if (moduleVar.isNull()) return;
+  for (JsonObject dirtyModule: dirtyModules)
+    if (dirtyModule["id"] == moduleVar["id"]) return; //already dirty
+  dirtyModules.push_back(moduleVar);
+}
+
+void SysModModel::endBatch(JsonObject moduleVar) {
+  if (!batchDepth || --batchDepth) return; //nested
+  if (batchChanged) setModuleDirty(moduleVar);
+  batchChanged = false;
+}
+
+void SysModModel::addFileExclusions(StarJson &starJson) {
+  //comment exclusions out in case of generating model.json for github
+  starJson.addExclusion("fun");
+  starJson.addExclusion("dash");
+  starJson.addExclusion("o"); //order: this must be deleted as it will be used to check on reboot 
+  starJson.addExclusion("p"); //pointer
+  starJson.addExclusion("b"); //pointer binding
+  starJson.addExclusion("ps"); //subscriptions
+  starJson.addExclusion("h"); //handle
+  starJson.addExclusion("oldValue");
+  //values of ro vars and of the instances table are not saved, they stay in the model (ro vars cannot be deleted as SM uses these vars)
+  starJson.addExclusion([](JsonObject object, const char * key) {
+    return strcmp(key, "value") == 0 && (object["ro"].as<bool>() || object["pid"] == "instances");
+  });
+}
+
+bool SysModModel::writeVarToFile(const char * path, JsonVariant variant) {
+  char tmpPath[40];
+  print->fFormat(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+
+  bool result;
+  {
+    StarJson starJson(tmpPath, FILE_WRITE); //open fileName for deserialize
+    addFileExclusions(starJson);
+    result = starJson.writeJsonVarToFile(variant);
+  } //close the file before rename
+
+  //replace path only if completely written, a power cut before this leaves the old file intact
+  if (result) result = files->rename(tmpPath, path);
+  if (result) files->removeSnapshot("/model.json"); //model.json or module file is newer
+  if (!result) ppf("dev writeVarToFile %s failed\n", path);
+  return result;
+}
+
+void SysModModel::writeModel() {
+  ppf("Writing model to /model.json... (serializeConfig)\n");
+
+  if (writeVarToFile("/model.json", model->as<JsonVariant>())) {
+    //all in model.json now
+    for (VectorString &moduleFile: moduleFiles) {
+      char path[40];
+      print->fFormat(path, sizeof(path), "/mdl.%s.json", moduleFile.s);
+      files->remove(path);
+    }
+    moduleFiles.clear();
+    dirtyModules.clear();
+  }
+
+  // print->printJson("Write model", *model); //this shows the model before exclusion
+
+  if (!presets->isNull()) {
+    files->writeObjectToFile("/presets.json", presets);
+    files->removeSnapshot("/presets.json");
+  }
+}
+
+void SysModModel::writeModule(JsonObject moduleVar) {
+  const char *moduleId = moduleVar["id"];
+  if (!moduleId) return;
+
+  char path[40];
+  print->fFormat(path, sizeof(path), "/mdl.%s.json", moduleId);
+  ppf("Writing module to %s\n", path);
+
+  if (writeVarToFile(path, moduleVar)) {
+    for (VectorString &moduleFile: moduleFiles)
+      if (strncmp(moduleFile.s, moduleId, sizeof(moduleFile.s)) == 0) return; //already known
+    VectorString moduleFile;
+    strlcpy(moduleFile.s, moduleId, sizeof(moduleFile.s));
+    moduleFiles.push_back(moduleFile);
+  }
+}
+
+uint32_t SysModModel::scanModelFiles() {
+  uint32_t hash = 2166136261;
+  moduleFiles.clear();
+
+  File root = LittleFS.open("/");
+  File file = root.openNextFile();
+
+  while (file) {
+    char fileName[32] = "/";
+    strlcat(fileName, file.name(), sizeof(fileName));
+    file.close();
+
+    size_t len = strnlen(fileName, sizeof(fileName));
+    if (len > 4 && strcmp(fileName + len - 4, ".tmp") == 0) {
+      ppf("scanModelFiles remove unfinished %s\n", fileName); //power cut during write
+      files->remove(fileName);
+    }
+    else if (strcmp(fileName, "/model.json") == 0)
+      hash = files->contentHash(fileName, hash);
+    else if (strncmp(fileName, "/mdl.", 5) == 0 && len > 10 && strcmp(fileName + len - 5, ".json") == 0) {
+      VectorString moduleFile;
+      strlcpy(moduleFile.s, fileName + 5, min(sizeof(moduleFile.s), len - 5 - 5 + 1)); //strip /mdl. and .json
+      moduleFiles.push_back(moduleFile);
+      hash = files->contentHash(fileName, hash);
+    }
+
+    file = root.openNextFile();
+  }
+  root.close();
+
+  return hash;
+}
+
+void SysModModel::readModuleFiles() {
+  for (VectorString &moduleFile: moduleFiles) {
+    char path[40];
+    print->fFormat(path, sizeof(path), "/mdl.%s.json", moduleFile.s);
+
+    JsonDocument moduleDoc;
+    if (files->readObjectFromFile(path, &moduleDoc) && moduleDoc["id"].is<const char *>()) {
+      //replace the module in the model or add it if not in model.json
+      bool found = false;
+      for (JsonObject moduleVar: model->as<JsonArray>()) {
+        if (moduleVar["id"] == moduleDoc["id"]) {
+          moduleVar.set(moduleDoc.as<JsonObject>());
+          found = true;
+          break;
+        }
+      }
+      if (!found) model->as<JsonArray>().add(moduleDoc.as<JsonObject>());
+    }
   }
+
+  if (moduleFiles.size()) ppf("readModuleFiles %d modules merged\n", moduleFiles.size());
 }
 
 void SysModModel::loop1s() {
@@ -648,6 +1036,9 @@ void SysModModel::loop1s() {
     Variable(var).triggerEvent(onLoop1s);
     return JsonObject(); //don't stop
   });
+
+  dispatchesPS = dispatchCounter;
+  dispatchCounter = 0;
 }
 
 Variable SysModModel::initVar(Variable parent, const char * id, const char * type, bool readOnly, const VarEvent &varEvent) {
@@ -655,9 +1046,10 @@ Variable SysModModel::initVar(Variable parent, const char * id, const char * typ
   if (!parentId) parentId = "m"; //m=module
   JsonObject var = findVar(parentId, id);
   Variable variable = Variable(var);
+  bool isNew = var.isNull();
 
   //create new var
-  if (var.isNull()) {
+  if (isNew) {
     // ppf("initVar new %s: %s.%s\n", type, parentId, id); //parentId not null otherwise crash
     if (parent.var.isNull()) {
       JsonArray vars = model->as<JsonArray>();
@@ -683,6 +1075,18 @@ Variable SysModModel::initVar(Variable parent, const char * id, const char * typ
 
     var["pid"] = parentId;
 
+    if (isNew) {
+      //module of the new var: the var itself if top level, otherwise the module of the parent
+      JsonObject moduleVar = parent.var.isNull()?var:findModule(parent.pid(), parent.id());
+      indexVar(var, moduleVar);
+    }
+
+    //handle for the binary ws value channel, not saved in files so given again after reboot
+    if (var["h"].isNull() && varHandles.size() < UINT16_MAX) {
+      var["h"] = varHandles.size();
+      varHandles.push_back(var);
+    }
+
     if (var["ro"].isNull() || variable.readOnly() != readOnly) variable.readOnly(readOnly);
 
     //set order
@@ -704,14 +1108,7 @@ Variable SysModModel::initVar(Variable parent, const char * id, const char * typ
       // }
       
       if (varEvent(variable, UINT8_MAX, onLoop)) { //test run if it supports loop
-        //no need to check if already in...
-        VarLoop loop;
-        loop.loopFun = varEvent;
-        loop.variable = variable;
-
-        ui->loopFunctions.push_back(loop);
-        var["loopFun"] = ui->loopFunctions.size()-1;
-        // ppf("iObject loopFun %s %u %u %d %d\n", variable.id());
+        ui->addLoop(variable, varEvent);
       }
     }
   }
@@ -723,19 +1120,44 @@ Variable SysModModel::initVar(Variable parent, const char * id, const char * typ
 
 void Variable::subscribe(uint8_t eventType, const VarFunction &varFunction) {
   ppf("subscribe %d %s.%s\n", eventType, pid(), id());
-  mdl->varEventsPS.push_back({*this, eventType, varFunction}); //add new function
+  if (eventType >= f_count || mdl->varEventsPS.size() >= UINT16_MAX) {
+    ppf("dev subscribe %s.%s not possible %d %d\n", pid(), id(), eventType, mdl->varEventsPS.size());
+    return;
+  }
+
+  if (var["ps"].isNull()) {
+    mdl->varSubscriptions.push_back(VarSubscriptions());
+    var["ps"] = mdl->varSubscriptions.size()-1;
+  }
+  VarSubscriptions &subscriptions = mdl->varSubscriptions[var["ps"].as<size_t>()];
+
+  uint16_t index = mdl->varEventsPS.size();
+  mdl->varEventsPS.push_back({*this, eventType, UINT16_MAX, varFunction}); //add new function
+  //append to the list of this eventType, so publish calls them in order of subscription
+  if (subscriptions.last[eventType] == UINT16_MAX)
+    subscriptions.first[eventType] = index;
+  else
+    mdl->varEventsPS[subscriptions.last[eventType]].next = index;
+  subscriptions.last[eventType] = index;
+
   var["fun"] = UINT8_MAX; //to trigger response from ui
 }
 
 bool Variable::publish(uint8_t eventType, uint8_t rowNr) {
+  if (var["ps"].isNull() || eventType >= f_count) return false;
+  size_t subscriptionsNr = var["ps"];
+  if (subscriptionsNr >= mdl->varSubscriptions.size()) return false;
+
   bool found = false;
-  for (VarEventPS &varEventPS: mdl->varEventsPS) {
-    if (eventType == varEventPS.eventType && strncmp(pid(), varEventPS.variable.pid(), 32) == 0 && strncmp(id(), varEventPS.variable.id(), 32) == 0) {
-      if (strcmp(id(), "effect") == 0 && eventType!= onLoop1s)
-        ppf("publish %s.%s[%d] %d=%d %s.%s\n", pid(), id(), rowNr, eventType, varEventPS.eventType , varEventPS.variable.pid(), varEventPS.variable.id());
-      varEventPS.varFunction(*this, rowNr, eventType);
-      found = true;
-    }
+  uint16_t index = mdl->varSubscriptions[subscriptionsNr].first[eventType];
+  while (index != UINT16_MAX) {
+    uint16_t next = mdl->varEventsPS[index].next; //before calling, varFunction can subscribe (push_back)
+    if (strcmp(id(), "effect") == 0 && eventType!= onLoop1s)
+      ppf("publish %s.%s[%d] %d\n", pid(), id(), rowNr, eventType);
+    mdl->varEventsPS[index].varFunction(*this, rowNr, eventType);
+    mdl->dispatchCounter++;
+    found = true;
+    index = next;
   }
   return found;
 }
@@ -755,14 +1177,46 @@ JsonObject SysModModel::walkThroughModel(std::function<JsonObject(JsonObject, Js
   return JsonObject(); //don't stop
 }
 
+VarBinding *SysModModel::varBinding(JsonObject var, bool create) {
+  if (!var["b"].isNull()) { //isNull needed here!
+    size_t bindingNr = var["b"];
+    if (bindingNr < varBindings.size()) return &varBindings[bindingNr];
+    ppf("dev varBinding nr %s.%s outside bounds %d >= %d\n", var["pid"].as<const char *>(), var["id"].as<const char *>(), bindingNr, varBindings.size());
+  }
+  if (!create) return nullptr;
+
+  varBindings.push_back(VarBinding());
+  var["b"] = varBindings.size()-1;
+  return &varBindings.back();
+}
+
+uint8_t SysModModel::typeToPointerType(const char * type) {
+  if (!type) return pt_none;
+  if (strcmp(type, "select") == 0 || strcmp(type, "range") == 0 || strcmp(type, "pin") == 0) return pt_uint8;
+  if (strcmp(type, "number") == 0) return pt_uint16;
+  if (strcmp(type, "checkbox") == 0) return pt_bool3State;
+  if (strcmp(type, "text") == 0 || strcmp(type, "fileEdit") == 0) return pt_VectorString;
+  if (strcmp(type, "coord3D") == 0) return pt_Coord3D;
+  return pt_none;
+}
+
 JsonObject SysModModel::findVar(const char * pid, const char * id, JsonObject parentVar) {
+  if (!parentVar.isNull()) return findVarWalk(pid, id, parentVar); //only search within parentVar
+  if (!pid || !id) return JsonObject();
+
+  bool walk = false;
+  JsonObject var = varIndex.find(pid, id, &walk);
+  return walk?findVarWalk(pid, id):var; //hash collision: the other var is indexed, this one can only be found by walking
+}
+
+JsonObject SysModModel::findVarWalk(const char * pid, const char * id, JsonObject parentVar) {
   for (JsonObject var : parentVar.isNull()?model->as<JsonArray>():parentVar["n"]) {
     if (var["pid"] == pid && var["id"] == id) { //(!pid && var["pid"] == pid) && 
       // Serial.printf("findVar found %s.%s!!\n", pid, id);
       return var;
     }
     else if (!var["n"].isNull()) {
-      JsonObject foundVar = findVar(pid, id, var);
+      JsonObject foundVar = findVarWalk(pid, id, var);
       if (!foundVar.isNull()) {
         return foundVar;
       }
@@ -774,8 +1228,12 @@ JsonObject SysModModel::findVar(const char * pid, const char * id, JsonObject pa
 }
 
 JsonObject SysModModel::findModule(const char * pid, const char * id) {
-  // if (model->isNull()) return JsonObject();
+  if (!pid || !id) return JsonObject();
+
+  JsonObject indexedModuleVar = varIndex.findModule(pid, id);
+  if (!indexedModuleVar.isNull()) return indexedModuleVar;
 
+  //not indexed (or hash collision): walk through the modules
   for (JsonObject moduleVar : model->as<JsonArray>()) {
     bool pididFound = false;
     walkThroughModel([&pididFound, pid, id](JsonObject parentVar, JsonObject var) {
@@ -788,6 +1246,28 @@ JsonObject SysModModel::findModule(const char * pid, const char * id) {
   return JsonObject();
 }
 
+void SysModModel::indexVar(JsonObject var, JsonObject moduleVar) {
+  if (!varIndex.add(var, moduleVar))
+    ppf("dev indexVar %s.%s hash collision\n", var["pid"].as<const char *>(), var["id"].as<const char *>()); //findVar walks for it
+}
+
+void SysModModel::unIndexVar(JsonObject var) {
+  for (JsonObject childVar: var["n"].as<JsonArray>())
+    unIndexVar(childVar);
+
+  if (!var["h"].isNull() && var["h"].as<size_t>() < varHandles.size()) {
+    varHandles[var["h"].as<size_t>()] = JsonObject(); //handle not reused, binary values for it are ignored
+    shadows.remove(var["h"]);
+  }
+
+  varIndex.remove(var);
+}
+
+void SysModModel::buildVarIndex() {
+  uint16_t collisions = varIndex.build(model->as<JsonArray>());
+  ppf("buildVarIndex %d vars, %d hash collisions\n", varIndex.size(), collisions);
+}
+
 void SysModModel::findVars(const char * property, bool value, FindFun fun, JsonObject parentVar) {
   // print ->print("findVar %s %s\n", id, parent.isNull()?"root":"n");
 
@@ -13,8 +13,15 @@
 // #include "SysModule.h"
 #include "SysModPrint.h"
 #include "SysModWeb.h"
+#include "SysJsonAllocators.h"
+#include "SysVarIndex.h"
 // #include "SysModules.h" //isConnected
 
+#include <unordered_map>
+#include <atomic>
+
+class StarJson;
+
 struct Coord3D {
   int x;
   int y;
@@ -181,24 +188,6 @@ namespace ArduinoJson {
   };
 }
 
-// https://arduinojson.org/v7/api/jsondocument/
-struct RAM_Allocator: ArduinoJson::Allocator {
-  void* allocate(size_t size) override {
-    if (psramFound()) return ps_malloc(size); // use PSRAM if it exists
-    else              return malloc(size);    // fallback
-    // return heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
-  }
-  void deallocate(void* pointer) override {
-    free(pointer);
-    // heap_caps_free(pointer);
-  }
-  void* reallocate(void* ptr, size_t new_size) override {
-    if (psramFound()) return ps_realloc(ptr, new_size); // use PSRAM if it exists
-    else              return realloc(ptr, new_size);    // fallback
-    // return heap_caps_realloc(ptr, new_size, MALLOC_CAP_SPIRAM);
-  }
-};
-
 enum eventTypes
 {
   onSetValue,
@@ -211,6 +200,118 @@ enum eventTypes
   f_count
 };
 
+//C++ type the bound pointer points to, resolved once from var["type"] when the pointer is bound (see VarBinding)
+enum pointerTypes
+{
+  pt_none, //type not supported for pointers
+  pt_uint8, //select, range, pin
+  pt_uint16, //number
+  pt_bool3State, //checkbox
+  pt_VectorString, //text, fileEdit (vector only)
+  pt_Coord3D, //coord3D
+  pt_count
+};
+
+//stages driven by the dirty bits of the ShadowStore
+enum shadowStages
+{
+  ss_web, //binary value to the clients, see SysModWeb::flushResponses
+  ss_udp, //dash var to the instances, see SysModInstances::loop20ms
+  ss_persist, //module dirty, see SysModModel::loop20ms
+  ss_count
+};
+
+//typed values of hot variables (pointer bound, dash, patched by DMX), indexed by handle (var["h"]), see Variable::setValue
+//structure of arrays per type: change detection is a memcmp of the shadow, the stages get the changes from the dirty bits
+//the json value is still written on change: onChange and value() read it in the same call
+class ShadowStore {
+public:
+  //make the var of handle hot, its shadow is made at the next setValue
+  void add(uint16_t handle);
+  void remove(uint16_t handle);
+  //json value removed outside setValue (e.g. transient values): the next setValue compares with the json again
+  void invalidate(uint16_t handle) {
+    uint16_t slot = slotOf(handle);
+    if (slot != UINT16_MAX) valid[slot] = false;
+  }
+
+  //1: changed (stages are dirty), 0: unchanged, 2: no shadow yet (compare with the json), -1: not hot or not a shadow type (json)
+  template <typename Type>
+  int8_t set(uint16_t handle, Type value) {
+    uint16_t slot = slotOf(handle);
+    if (slot == UINT16_MAX) return -1;
+    uint8_t kind, tag; int32_t bits[3];
+    if (!toShadow(value, kind, tag, bits) || (kinds[slot] != sk_none && kinds[slot] != kind)) {
+      valid[slot] = false;
+      return -1;
+    }
+    if (kinds[slot] == sk_none) assign(slot, kind);
+    void *stored = kind == sk_int?(void *)&ints[indexes[slot]]:kind == sk_float?(void *)&floats[indexes[slot]]:(void *)&coords[indexes[slot]];
+    size_t size = kind == sk_coord?sizeof(Coord3D):sizeof(int32_t);
+    if (valid[slot] && tags[slot] == tag && memcmp(stored, bits, size) == 0) return 0;
+    bool wasValid = valid[slot];
+    memcpy(stored, bits, size);
+    tags[slot] = tag;
+    valid[slot] = true;
+    if (!wasValid) return 2;
+    for (uint8_t stage = 0; stage < ss_count; stage++)
+      __atomic_fetch_or(&dirty[stage][slot / 32], 1UL << (slot % 32), __ATOMIC_RELAXED); //set from any task
+    return 1;
+  }
+
+  //value of a hot var as binary ws value (rowNr not set), false if no shadow
+  bool get(uint16_t handle, WSValue &wsValue) const;
+
+  //fun for each hot var changed since the last drain of stage
+  void drain(uint8_t stage, std::function<void(uint16_t)> fun);
+
+private:
+  enum shadowKinds {sk_none, sk_int, sk_float, sk_coord};
+
+  std::vector<uint16_t> slots; //slot per handle, UINT16_MAX: not hot
+  //per slot
+  std::vector<uint16_t> handles;
+  std::vector<uint8_t> kinds; //shadowKinds, set at the first setValue
+  std::vector<uint8_t> tags; //wsValueTags of the last setValue (bool or number)
+  std::vector<uint16_t> indexes; //in the array of kind
+  std::vector<uint8_t> valid;
+  std::vector<uint32_t> dirty[ss_count]; //bit per slot
+  //per kind
+  std::vector<int32_t> ints; //bool, uint8, uint16, int32
+  std::vector<float> floats;
+  std::vector<Coord3D> coords;
+
+  uint16_t slotOf(uint16_t handle) const {return handle < slots.size()?slots[handle]:UINT16_MAX;}
+  void assign(uint16_t slot, uint8_t kind);
+
+  static bool toShadow(bool value, uint8_t &kind, uint8_t &tag, int32_t bits[3]) {
+    kind = sk_int; tag = vt_bool; bits[0] = value;
+    return true;
+  }
+  template <typename Type>
+  static typename std::enable_if<std::is_integral<Type>::value, bool>::type toShadow(Type value, uint8_t &kind, uint8_t &tag, int32_t bits[3]) {
+    if ((int64_t)value != (int32_t)value) return false; //not an int32
+    kind = sk_int; tag = vt_int32; bits[0] = value;
+    return true;
+  }
+  template <typename Type>
+  static typename std::enable_if<std::is_floating_point<Type>::value, bool>::type toShadow(Type value, uint8_t &kind, uint8_t &tag, int32_t bits[3]) {
+    float f = value;
+    kind = sk_float; tag = vt_float; memcpy(bits, &f, sizeof(f));
+    return true;
+  }
+  static bool toShadow(const Coord3D &value, uint8_t &kind, uint8_t &tag, int32_t bits[3]) {
+    kind = sk_coord; tag = vt_Coord3D; bits[0] = value.x; bits[1] = value.y; bits[2] = value.z;
+    return true;
+  }
+  template <typename Type>
+  static typename std::enable_if<!std::is_arithmetic<Type>::value, bool>::type toShadow(const Type &value, uint8_t &kind, uint8_t &tag, int32_t bits[3]) {
+    return false; //strings, json: not shadowed
+  }
+};
+
+extern ShadowStore shadows;
+
 class Variable; //forward
 
 typedef std::function<void(Variable)> FindFun;
@@ -252,9 +353,6 @@ class Variable {
 
   // void defaultOrder(int value) const {order(value); } //set default order (in range >=1000). Don't use auto generated order as order can be changed in the ui (WIP)
 
-  //recursively remove all value[rowNr] from children of var
-  void removeValuesForRow(uint8_t rowNr);
-
   bool valIsArray() const {return var["value"].is<JsonArray>();}
   JsonArray valArray() const {if (var["value"].is<JsonArray>()) return var["value"]; else return JsonArray(); }
 
@@ -268,7 +366,8 @@ class Variable {
 
   //checks if var has fun of type eventType implemented by calling it and checking result (for onUI on RO var, also onSetValue is called)
   //onChange: sends dash var change to udp (if init),  sets pointer if pointer var and run onChange
-  bool triggerEvent(uint8_t eventType = onSetValue, uint8_t rowNr = UINT8_MAX, bool init = false);
+  //shadowed: changed hot var, udp and persistence are done by the ShadowStore stages
+  bool triggerEvent(uint8_t eventType = onSetValue, uint8_t rowNr = UINT8_MAX, bool init = false, bool shadowed = false);
 
   void setLabel(const char * text);
   void setComment(const char * text);
@@ -290,7 +389,15 @@ class Variable {
   template <typename Type>
   void setValue(Type newValue, uint8_t rowNr = UINT8_MAX) {
 
-    if (value(rowNr).isNull() || value(rowNr).as<Type>() != newValue) { //new or changed
+    //hot var: compared with its shadow, not the json value
+    int8_t shadowed = -1;
+    if (rowNr == UINT8_MAX) {
+      JsonVariant handle = var["h"];
+      if (handle.is<uint16_t>()) shadowed = shadows.set(handle.as<uint16_t>(), newValue);
+      if (shadowed == 0) return; //unchanged
+    }
+
+    if (shadowed == 1 || value(rowNr).isNull() || value(rowNr).as<Type>() != newValue) { //new or changed
 
       if (!value().isNull() && !readOnly()) var["oldValue"] = value(); //save oldValue
 
@@ -319,19 +426,71 @@ class Variable {
         }
       }
 
-      web->addResponse(var, "value", value());
-      triggerEvent(onChange, rowNr);
+      if (shadowed != 1) web->addResponseValue(var, rowNr); //binary if possible, otherwise json. Hot: ss_web
+      triggerEvent(onChange, rowNr, false, shadowed == 1);
     }
 
   }
 
+  //bulk setValue of a table column: row rowNr gets values[rowNr], rows from count are removed
+  //one pass over the value array, one response with only the changed rows (rows, see SysModWeb::addResponseRows) and one onChange (rowNr UINT8_MAX)
+  //strings as JsonString (compared by content)
+  template <typename Type>
+  void setValues(const Type *values, size_t count) {
+    if (count > UINT8_MAX) count = UINT8_MAX; //UINT8_MAX is no rowNr
+
+    JsonArray valueArray = valArray();
+    size_t oldCount = valueArray.size();
+    uint8_t changedRows[UINT8_MAX];
+    uint8_t changedCount = 0;
+
+    for (size_t rowNr = 0; rowNr < count; rowNr++) {
+      if (rowNr < oldCount && !valueArray[rowNr].isNull() && valueArray[rowNr].as<Type>() == values[rowNr]) continue; //unchanged
+
+      if (changedCount == 0) { //first change: save oldValue once, make value an array
+        if (!value().isNull() && !readOnly()) var["oldValue"] = value();
+        if (valueArray.isNull()) valueArray = var["value"].to<JsonArray>();
+      }
+      valueArray[rowNr] = values[rowNr];
+      changedRows[changedCount++] = rowNr;
+    }
+
+    bool removed = oldCount > count;
+    if (removed && changedCount == 0 && !readOnly()) var["oldValue"] = value();
+    while (valueArray.size() > count) valueArray.remove(valueArray.size() - 1);
+
+    if (changedCount == 0 && !removed) return;
+
+    //cleanup Array (as setValue)
+    size_t size = valueArray.size();
+    while (size > 0 && (valueArray[size-1].isNull() || valueArray[size-1].as<uint16_t>() == UINT16_MAX)) {
+      valueArray.remove(size-1);
+      size = valueArray.size();
+    }
+    while (changedCount > 0 && changedRows[changedCount-1] >= size) changedCount--; //removed by the cleanup, covered by length
+    if (size == 0) var.remove("value");
+
+    web->addResponseRows(var, changedRows, changedCount);
+    triggerEvent(onChange, UINT8_MAX);
+  }
+
+  template <typename Type>
+  void setValues(const std::vector<Type> &values) {setValues(values.data(), values.size());}
+
+  //table rows: the values of all columns (and their details) in one pass and the clients notified (onAdd / onDelete)
+  //new row before rowNr (after the last row if rowNr is the number of rows): values of the next rows are shifted and resent, the new cells follow by setValue(s)
+  void insertRow(uint8_t rowNr);
+  //notify: false if the clients get the onDelete already (processJson echoes it)
+  void deleteRow(uint8_t rowNr, bool notify = true);
+
   //Set value with argument list
   void setValueF(const char * format = nullptr, ...);
 
   JsonVariant getValue(uint8_t rowNr = UINT8_MAX);
 
   //gives a variable an initital value returns true if setValue must be called 
-  bool initValue(int min = 0, int max = 255, int pointer = 0);
+  //isVector: pointer points to a std::vector of the type of the variable
+  bool initValue(int min = 0, int max = 255, int pointer = 0, bool isVector = false);
 
   void subscribe(uint8_t eventType, const VarFunction &varFunction = nullptr);
   bool publish(uint8_t eventType, uint8_t rowNr = UINT8_MAX);
@@ -342,19 +501,51 @@ class Variable {
 struct VarEventPS {
   Variable variable; //8 bytes: cannot be a pointer as Variable is volatile, the var inside variable is not volatile
   uint8_t eventType; //1 byte but rounded to 4 bytes (room for more variables, e.g. rowNr?)
+  uint16_t next; //next varEventsPS entry of the same variable and eventType, UINT16_MAX if last (shares the 4 bytes with eventType)
   VarFunction varFunction; //function: 16 bytes
 }; //total 28 bytes
 
+//subscriptions of one variable: per eventType first and last entry in varEventsPS, stored in mdl->varSubscriptions, indexed by var["ps"]
+struct VarSubscriptions {
+  uint16_t first[f_count];
+  uint16_t last[f_count];
+
+  VarSubscriptions() {
+    for (uint8_t eventType = 0; eventType < f_count; eventType++) first[eventType] = last[eventType] = UINT16_MAX;
+  }
+};
+
+//pointer binding of a variable, stored in mdl->varBindings, indexed by var["b"] (like var["fun"] for varEvents)
+struct VarBinding {
+  uint8_t pointerType = pt_none; //see pointerTypes
+  bool isVector = false; //pointer to a std::vector, one element per rowNr
+  int pointer = 0;
+  std::vector<int> rowPointers; //pointer per rowNr if bound with setValueRowNr (e.g. controls, each row a separate variable)
+
+  int getPointer(uint8_t rowNr) const {
+    if (rowPointers.empty()) return pointer;
+    return rowNr < rowPointers.size()?rowPointers[rowNr]:0;
+  }
+};
+
 
 class SysModModel: public SysModule {
 
 public:
 
-  RAM_Allocator allocator;
+  JsonArena allocator{"model"}; //model and presets, see SysJsonAllocators
   JsonDocument *model = nullptr;
   JsonDocument *presets = nullptr;
 
-  bool doWriteModel = false;
+  bool doWriteModel = false; //write the whole model to model.json (and remove the module files)
+
+  //persistence of changes: changed modules are written to /mdl.<module>.json after quietPeriod without changes
+  bool3State autoSave = false; //off: saved by the Save button (writeModel), on: also rewrites flash on the loopTask during use
+  uint16_t quietPeriod = 3000; //ms
+  unsigned long lastChangeMillis = 0;
+  unsigned long compactPeriod = 300000; //ms without changes before module files are merged in model.json
+  std::vector<JsonObject> dirtyModules; //modules changed since last write
+  std::vector<VectorString> moduleFiles; //modules with a /mdl.<module>.json file, merged in model.json by saveModel or after compactPeriod
 
   uint8_t setValueRowNr = UINT8_MAX;
   uint8_t getValueRowNr = UINT8_MAX;
@@ -362,6 +553,11 @@ public:
 
   std::vector<VarEvent> varEvents;
   std::vector<VarEventPS> varEventsPS;
+  std::vector<VarSubscriptions> varSubscriptions;
+  unsigned dispatchCounter = 0; //number of varEventsPS functions called by publish
+  unsigned dispatchesPS = 0; //dispatchCounter of last second
+  std::vector<VarBinding> varBindings;
+  std::vector<JsonObject> varHandles; //var per handle, indexed by var["h"], used by the binary ws value channel (see WS_BIN_VALUES)
 
   uint8_t resetPresetThreshold = 1; //can be lowered by preset.onchange and highered by processJson, if > 1 (not lowered but highered) then reset is allowed
 
@@ -369,6 +565,7 @@ public:
   void setup() override;
   void loop20ms() override;
   void loop1s() override;
+  void loop10s() override;
 
   //adds a variable to the model
   Variable initVar(Variable parent, const char * id, const char * type, bool readOnly = true, const VarEvent &varEvent = nullptr);
@@ -398,10 +595,27 @@ public:
 
   //returns the var defined by id (parent to recursively call findVar)
   JsonObject walkThroughModel(std::function<JsonObject(JsonObject, JsonObject)> fun, JsonObject parentVar = JsonObject());
+  //uses varIndex, if parentVar given: findVarWalk within parentVar
   JsonObject findVar(const char * pid, const char * id, JsonObject parentVar = JsonObject());
+  //recursive walk through the model, not using varIndex (fallback and debugging)
+  JsonObject findVarWalk(const char * pid, const char * id, JsonObject parentVar = JsonObject());
   JsonObject findModule(const char * pid, const char * id);
+  //var of a handle (var["h"]), null if deleted or not existing
+  JsonObject findVarByHandle(uint16_t handle) {
+    return handle < varHandles.size()?varHandles[handle]:JsonObject();
+  }
+
+  //FNV-1a hash of pid.id, same on all instances (used as var key in the instances sync)
+  uint32_t varIndexKey(const char * pid, const char * id) {return ::varIndexKey(pid, id);}
+  //var of a varIndexKey, null if not indexed or if the key is of more than one var (hash collision)
+  JsonObject findVarByKey(uint32_t key) {return varIndex.findByKey(key);}
   void findVars(const char * id, bool value, FindFun fun, JsonObject parentVar = JsonObject());
 
+  //returns the pointer binding of var or nullptr if not bound (create: add one if not exists). Do not keep the returned pointer, varBindings can grow
+  VarBinding *varBinding(JsonObject var, bool create = false);
+  //pointerType of a var type, only called when binding a pointer
+  uint8_t typeToPointerType(const char * type);
+
   uint8_t linearToLogarithm(uint8_t value, uint8_t minp = 0, uint8_t maxp = UINT8_MAX) {
     if (value == 0) return 0;
 
@@ -418,6 +632,52 @@ public:
     return round(exp(minv + scale*((float)value-minp)));
   }
 
+  //mark the module of var as changed, to be written after quietPeriod
+  void setDirty(JsonObject var);
+  void setModuleDirty(JsonObject moduleVar);
+  //changes of one module in a batch (e.g. a preset): setDirty per var is skipped, endBatch makes moduleVar dirty once
+  void beginBatch() {batchDepth++;}
+  void endBatch(JsonObject moduleVar);
+
+  //pid.id index: add var (moduleVar is the top level var var belongs to)
+  void indexVar(JsonObject var, JsonObject moduleVar);
+  //pid.id index: remove var and all its children, call before var or its children are removed from the model
+  void unIndexVar(JsonObject var);
+  //pid.id index: (re)create from the model, e.g. after reading model.json
+  void buildVarIndex();
+
+private:
+  bool trackChanges = false; //set in first loop20ms: changes during boot do not make modules dirty
+  uint8_t batchDepth = 0; //see beginBatch
+  bool batchChanged = false; //setDirty called during the batch
+
+  //exclusions of the keys not saved (transient, pointers, values of ro vars)
+  void addFileExclusions(StarJson &starJson);
+  //write var without transient values to tmp file and rename to path (so path is never half written)
+  bool writeVarToFile(const char * path, JsonVariant variant);
+  //serialize the model in memory (loopTask) and write it to model.json in the compact task, module files removed when done (compactDone)
+  void compactModel();
+  void compactDone();
+
+  enum compactStates {cs_idle, cs_writing, cs_written, cs_failed};
+  std::atomic<uint8_t> compactState = {cs_idle}; //written by the compact task when done
+  unsigned long compactChangeMillis = 0; //lastChangeMillis at the start of the compaction
+  //write the whole model to model.json and remove the module files
+  void writeModel();
+  //write one module to /mdl.<module>.json
+  void writeModule(JsonObject moduleVar);
+  //list the module files in moduleFiles, remove unfinished writes, returns the content hash of model.json and module files
+  uint32_t scanModelFiles();
+  //merge the moduleFiles into the model, called after reading model.json
+  void readModuleFiles();
+
+  bool bootFromSnapshot = false;
+  unsigned long bootMicros = 0; //time to load the model at boot
+  unsigned long bootJsonMicros = 0; //time to load the model from json (measured when snapshot was made)
+  uint32_t bootHeap = 0; //heap used by loading the model
+
+  VarIndex varIndex; //pid.id -> var, see findVar
+
 };
 
 extern SysModModel *mdl;
\ No newline at end of file
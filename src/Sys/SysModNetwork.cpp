@@ -28,6 +28,30 @@ SysModNetwork::SysModNetwork() :SysModule("Network") {};
 void SysModNetwork::setup() {
   SysModule::setup();
 
+  //before the vars: the wiFi onChange connects
+  preferences.begin("network");
+  if (preferences.getBytes("wiFiCache", &wiFiCache, sizeof(wiFiCache)) != sizeof(wiFiCache))
+    wiFiCache = WiFiCache();
+
+  //WiFi event task: only flags, handled in loop1s
+  WiFi.onEvent([this](arduino_event_id_t event, arduino_event_info_t info) {
+    switch (event) {
+      case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+        if (connectStart) connectTime = millis() - connectStart;
+        gotIP = true;
+        break;
+      case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+        if (info.wifi_sta_disconnected.reason != WIFI_REASON_ASSOC_LEAVE) staLost = true; //not by our WiFi.disconnect
+        break;
+      #ifdef STARBASE_ETHERNET
+        case ARDUINO_EVENT_ETH_DISCONNECTED:
+          ethLost = true;
+          break;
+      #endif
+      default: break;
+    }
+  });
+
   const Variable parentVar = ui->initSysMod(Variable(), name, 3502);
   parentVar.var["s"] = true; //setup
 
@@ -65,6 +89,33 @@ void SysModNetwork::setup() {
     default: return false;
   }});
 
+  ui->initCheckBox(currentVar, "fastConnect", (bool3State)true, false, [](EventArguments) { switch (eventType) {
+    case onUI:
+      variable.setComment("Connect to the channel and access point of the last connection, scan if that fails");
+      return true;
+    default: return false;
+  }});
+
+  ui->initCheckBox(currentVar, "reuseLease", (bool3State)false, false, [](EventArguments) { switch (eventType) {
+    case onUI:
+      variable.setComment("Fast connect with the IP of the last DHCP lease (static), only if the router keeps leases");
+      return true;
+    default: return false;
+  }});
+
+  ui->initText(currentVar, "connectTime", nullptr, 32, true, [this](EventArguments) { switch (eventType) {
+    case onUI:
+      variable.setComment("Time to connect (IP) of the last connect");
+      return true;
+    case onLoop1s:
+      if (connectStart)
+        variable.setValueF("connecting %lu ms", millis() - connectStart);
+      else if (connectTime)
+        variable.setValueF("%lu ms %s", connectTime, fellBack?"scan (direct failed)":fastAttempt?"direct":"scan");
+      return true;
+    default: return false;
+  }});
+
   ui->initText(currentVar, "rssi", nullptr, 32, true, [](EventArguments) { switch (eventType) {
     case onLoop1s:
       variable.setValueF("%d dBm", WiFi.RSSI(), 0); //0 is to force format overload used
@@ -223,6 +274,38 @@ void SysModNetwork::loop1s() {
 
   if (apActive)
     handleAP();
+
+  if (gotIP) {
+    gotIP = false;
+    if (connectStart) {
+      ppf("initWiFiConnection connected in %lu ms (%s) %s\n", connectTime, fastAttempt?"direct":"scan", WiFi.localIP().toString().c_str());
+      connectStart = 0;
+      saveWiFiCache();
+    }
+  }
+
+  //direct association failed (disconnected or no IP in time): forget the cache and scan
+  if (connectStart && fastAttempt && (staLost || millis() - connectStart > WIFI_FAST_TIMEOUT)) {
+    ppf("initWiFiConnection direct association failed after %lu ms, scan\n", millis() - connectStart);
+    wiFiCache.channel = 0;
+    fellBack = true;
+    unsigned long fastStart = connectStart;
+    beginWiFi(mdl->getValue("wiFi", "ssid") | "", mdl->getValue("wiFi", "password") | "", false);
+    connectStart = fastStart; //connectTime includes the failed attempt
+  }
+  staLost = false;
+
+  #ifdef STARBASE_ETHERNET
+    //ethernet gone: WiFi now (direct if cached) instead of waiting for the no IP check of loop10s
+    if (ethLost) {
+      ethLost = false;
+      if (mdl->getValue("Network", "wiFi").as<bool>() && !WiFi.isConnected()) {
+        ppf("Ethernet disconnected -> WiFi\n");
+        stopWiFiConnection();
+        initWiFiConnection();
+      }
+    }
+  #endif
 }
 
 void SysModNetwork::loop10s() {
@@ -283,8 +366,10 @@ void SysModNetwork::initWiFiConnection() {
   if (ssid && strnlen(ssid, 128) > 0 && password && strnlen(password, 64) > 0) {
     char passXXX [64] = "";
     for (int i = 0; i < strnlen(password, 128); i++) strlcat(passXXX, "*", sizeof(passXXX));
-    WiFi.begin(ssid, password);
-    ppf("initWiFiConnection success %s / %s s:%d\n", ssid, passXXX, WiFi.status()); //6 is disconnected
+    fellBack = false;
+    JsonVariant fastConnect = mdl->getValue("wiFi", "fastConnect"); //model value: also before the var is made (wiFi onChange at boot)
+    beginWiFi(ssid, password, fastConnect.isNull() || fastConnect.as<bool>());
+    ppf("initWiFiConnection success %s / %s %s s:%d\n", ssid, passXXX, fastAttempt?"direct":"scan", WiFi.status()); //6 is disconnected
     #if defined(STARBASE_LOLIN_WIFI_FIX )
       WiFi.setTxPower(WIFI_POWER_8_5dBm );
     #endif
@@ -303,6 +388,44 @@ void SysModNetwork::initWiFiConnection() {
     ppf("initWiFiConnection not successful ssid:%s pw:%s s:%d\n", ssid?ssid:"No SSID", password?password:"No Password", WiFi.status());
 }
 
+uint32_t SysModNetwork::credentialsHash(const char * ssid, const char * password) {
+  uint32_t hash = 2166136261; //fnv1a
+  for (const char *c = ssid; *c; c++) hash = (hash ^ (uint8_t)*c) * 16777619;
+  hash = (hash ^ 0) * 16777619; //separator
+  for (const char *c = password; *c; c++) hash = (hash ^ (uint8_t)*c) * 16777619;
+  return hash;
+}
+
+void SysModNetwork::beginWiFi(const char * ssid, const char * password, bool fast) {
+  fastAttempt = fast && wiFiCache.channel && wiFiCache.credentialsHash == credentialsHash(ssid, password);
+  if (fastAttempt && mdl->getValue("wiFi", "reuseLease").as<bool>() && wiFiCache.ip)
+    WiFi.config(IPAddress(wiFiCache.ip), IPAddress(wiFiCache.gateway), IPAddress(wiFiCache.subnet), IPAddress(wiFiCache.dns));
+  else
+    WiFi.config(IPAddress(), IPAddress(), IPAddress()); //DHCP
+  staLost = false;
+  gotIP = false;
+  connectStart = millis();
+  if (fastAttempt)
+    WiFi.begin(ssid, password, wiFiCache.channel, wiFiCache.bssid);
+  else
+    WiFi.begin(ssid, password);
+}
+
+void SysModNetwork::saveWiFiCache() {
+  WiFiCache cache;
+  cache.credentialsHash = credentialsHash(mdl->getValue("wiFi", "ssid") | "", mdl->getValue("wiFi", "password") | "");
+  cache.channel = WiFi.channel();
+  memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+  cache.ip = WiFi.localIP();
+  cache.gateway = WiFi.gatewayIP();
+  cache.subnet = WiFi.subnetMask();
+  cache.dns = WiFi.dnsIP();
+  if (memcmp(&cache, &wiFiCache, sizeof(cache)) == 0) return; //same AP and lease: no flash write
+  wiFiCache = cache;
+  preferences.putBytes("wiFiCache", &wiFiCache, sizeof(wiFiCache));
+  ppf("saveWiFiCache channel:%d %s\n", wiFiCache.channel, WiFi.BSSIDstr().c_str());
+}
+
 void SysModNetwork::stopWiFiConnection() {
   if (!wfActive) return;
 
@@ -478,6 +601,11 @@ bool SysModNetwork::initEthernet() {
   }
   else {
     ppf("initEthernet not successful s:%d\n", WiFi.status());
+    //no ethernet: WiFi now instead of after the no IP check of loop10s
+    if (mdl->getValue("Network", "wiFi").as<bool>() && !WiFi.isConnected()) {
+      stopWiFiConnection();
+      initWiFiConnection();
+    }
     // de-allocate the allocated pins
     // for (managed_pin_type mpt : pinsToAllocate) {
     //   pinManager.deallocatePin(mpt.pin, PinOwner::Ethernet);
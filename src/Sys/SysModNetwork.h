@@ -13,6 +13,20 @@
 #include "SysModule.h"
 
 #include <DNSServer.h>
+#include <Preferences.h>
+
+#define WIFI_FAST_TIMEOUT 3000 //ms a direct association may take before falling back to a scan
+
+//channel, BSSID and lease of the last successful connection (NVS, not the model: changes with the AP, not a setting)
+struct WiFiCache {
+  uint32_t credentialsHash = 0; //of ssid and password: other credentials, cache not used
+  uint8_t channel = 0; //0: no cache
+  uint8_t bssid[6] = {};
+  uint32_t ip = 0;
+  uint32_t gateway = 0;
+  uint32_t subnet = 0;
+  uint32_t dns = 0;
+};
 
 class SysModNetwork:public SysModule {
 
@@ -23,7 +37,7 @@ public:
   //setup wifi an async webserver
   void setup() override;
 
-  void loop1s() override;
+  void loop1s() override; //also finishes connects started by initWiFiConnection (cache, fallback)
   void loop10s() override;
 
   // void handleConnections();
@@ -53,6 +67,25 @@ private:
   byte stationCount = 0;
 
   bool connected = false;
+
+  //fast connect: direct association to the cached channel and BSSID (and optionally the cached lease), else or if it fails a full scan
+  //wiFi.fastConnect and wiFi.reuseLease (static IP of the last DHCP lease: no DHCP wait)
+  WiFiCache wiFiCache;
+  Preferences preferences;
+  unsigned long connectStart = 0; //millis of WiFi.begin, 0: not connecting
+  unsigned long connectTime = 0; //ms of the last connect
+  bool fastAttempt = false; //connecting without scan
+  bool fellBack = false; //last connect needed the scan after a failed direct association
+  volatile bool gotIP = false; //set by the WiFi event task, handled in loop1s
+  volatile bool staLost = false;
+  #ifdef STARBASE_ETHERNET
+    volatile bool ethLost = false;
+  #endif
+
+  uint32_t credentialsHash(const char * ssid, const char * password);
+  //WiFi.begin, direct if fast and the cache is of these credentials
+  void beginWiFi(const char * ssid, const char * password, bool fast);
+  void saveWiFiCache();
 };
   
 extern SysModNetwork *net;
\ No newline at end of file
@@ -35,29 +35,35 @@ void SysModPins::setup() {
 
   ui->initPin(tableVar, "pin", UINT8_MAX, true, [this](EventArguments) { switch (eventType) {
     case onSetValue:
-      variable.var.remove("value");
-      ppf("pin onSetValue %s %d\n", variable.valueString().c_str(), getNrOfAllocatedPins());
-      for (uint8_t rowNr = 0; rowNr < getNrOfAllocatedPins(); rowNr++)
-        variable.setValue(getPinNr(rowNr), rowNr);
+      {
+        std::vector<uint8_t> values;
+        for (uint8_t pin = 0; pin < NUM_DIGITAL_PINS; pin++)
+          if (strnlen(pinObjects[pin].owner, sizeof(PinObject::owner)) > 0) values.push_back(pin);
+        variable.setValues(values);
+      }
       return true;
     default: return false;
   }});
 
   ui->initText(tableVar, "owner", nullptr, 32, true, [this](EventArguments) { switch (eventType) {
     case onSetValue:
-      variable.var.remove("value");
-      for (uint8_t rowNr = 0; rowNr < getNrOfAllocatedPins(); rowNr++)
-        variable.setValue(JsonString(getNthAllocatedPinObject(rowNr).owner), rowNr);
+      {
+        std::vector<JsonString> values;
+        for (PinObject &pinObject: pinObjects)
+          if (strnlen(pinObject.owner, sizeof(PinObject::owner)) > 0) values.push_back(JsonString(pinObject.owner));
+        variable.setValues(values);
+      }
       return true;
     default: return false;
   }});
 
   ui->initText(tableVar, "details", nullptr, 256, true, [this](EventArguments) { switch (eventType) {
     case onSetValue:
-      variable.var.remove("value");
-      for (uint8_t rowNr = 0; rowNr < getNrOfAllocatedPins(); rowNr++) {
-        // ppf("details[%d] d:%s\n", rowNr, getNthAllocatedPinObject(rowNr).details);
-        variable.setValue(JsonString(getNthAllocatedPinObject(rowNr).details), rowNr);
+      {
+        std::vector<JsonString> values;
+        for (PinObject &pinObject: pinObjects)
+          if (strnlen(pinObject.owner, sizeof(PinObject::owner)) > 0) values.push_back(JsonString(pinObject.details));
+        variable.setValues(values);
       }
       return true;
     default: return false;
@@ -69,7 +75,7 @@ void SysModPins::setup() {
       return true;
     case onLoop:
       if (!web->isBusy && web->ws.getClients().length()) {
-        variable.var["interval"] = 100; //every 100 ms
+        ui->setLoopInterval(variable, 100); //every 100 ms
 
         size_t len = NUM_DIGITAL_PINS + 5;
         AsyncWebSocketMessageBuffer *wsBuf= web->ws.makeBuffer(len); //global wsBuf causes crash in audio sync module!!!
@@ -52,13 +52,16 @@ SysModPrint::SysModPrint() :SysModule("Print") {
   if (Serial) Serial.flush(); // drain output buffer
 };
 
+#define PRINT_OTHER_TASK 1 //not loopTask, marked with α
+#define PRINT_SAFE_MODE 2 //marked with 🚑
+
 void SysModPrint::setup() {
   SysModule::setup();
 
   const Variable parentVar = ui->initSysMod(Variable(), name, 2302);
 
   //default to Serial
-  ui->initSelect(parentVar, "output", 1, false, [](EventArguments) { switch (eventType) {
+  ui->initSelect(parentVar, "output", &output, false, [this](EventArguments) { switch (eventType) {
     case onUI:
     {
       JsonArray options = variable.setOptions();
@@ -69,56 +72,164 @@ void SysModPrint::setup() {
       web->clientsToJson(options, true); //ip only
       return true;
     }
+    case onChange:
+      if (output >= 3) { //an ip
+        JsonArray options = variable.getOptions();
+        if (output < options.size()) udpIP.fromString(options[output].as<const char *>());
+        ppf("Print output to %s:%d\n", udpIP.toString().c_str(), PRINT_UDP_PORT);
+      }
+      return true;
+    default: return false;
+  }});
+
+  ui->initSelect(parentVar, "level", &level, false, [](EventArguments) { switch (eventType) {
+    case onUI:
+    {
+      variable.setComment("Up to the compile time level (STARBASE_PRINT_LEVEL)");
+      JsonArray options = variable.setOptions();
+      options.add("Error");
+      options.add("Warning");
+      options.add("Info");
+      options.add("Dev");
+      return true;
+    }
+    default: return false;
+  }});
+
+  ui->initNumber(parentVar, "dropped", UINT16_MAX, 0, UINT16_MAX, true, [this](EventArguments) { switch (eventType) {
+    case onUI:
+      variable.setComment("Messages dropped as output could not keep up");
+      return true;
+    case onLoop1s:
+      variable.setValue(dropped);
+      return true;
     default: return false;
   }});
 
   ui->initTextArea(parentVar, "log");
+
+  //low priority, the same as loopTask: printing waits on Serial or the network, the producers not
+  xTaskCreatePinnedToCore(printTaskLoop, "print", 3072, this, tskIDLE_PRIORITY + 1, &printTask, tskNO_AFFINITY);
 }
 
 void SysModPrint::loop20ms() {
   if (!setupsDone) setupsDone = true;
+
+  if (!uiLogLength) return;
+  char text[sizeof(uiLog) + 1];
+  portENTER_CRITICAL(&printMux);
+  memcpy(text, uiLog, uiLogLength);
+  text[uiLogLength] = '\0';
+  uiLogLength = 0;
+  portEXIT_CRITICAL(&printMux);
+
+  JsonObject responseObject = web->getResponseObject();
+  if (responseObject["Print.log"]["value"].isNull())
+    responseObject["Print.log"]["value"] = text;
+  else
+    responseObject["Print.log"]["value"] = responseObject["Print.log"]["value"].as<String>() + String(text);
 }
 
 void SysModPrint::printf(const char * format, ...) {
   va_list args;
+  va_start(args, format);
+  vprintfLevel(strncmp(format, "dev ", 4) == 0?PRINT_DEV:PRINT_INFO, format, args);
+  va_end(args);
+}
 
+void SysModPrint::printfLevel(uint8_t level, const char * format, ...) {
+  va_list args;
   va_start(args, format);
+  vprintfLevel(level, format, args);
+  va_end(args);
+}
+
+void SysModPrint::vprintfLevel(uint8_t level, const char * format, va_list args) {
+  if (level > this->level) return;
+
+  PrintEntry entry;
+  entry.output = mdls->isConnected?output:1;
+  if (entry.output == 0) return; //not formatted
 
   char buffer[512]; //this is a lot for the stack - move to heap?
-  vsnprintf(buffer, sizeof(buffer), format, args);
-  bool toSerial = false;
-  
-  if (mdls->isConnected) {
-    uint8_t output = 1;
-    if (mdl->model)
-      output = mdl->getValue("Print", "output"); //"Print", 
-
-    if (output == 1) {
-      toSerial = true;
-    }
-    else if (output == 2) {
-      JsonObject responseObject = web->getResponseObject();
-      if (responseObject["Print.log"]["value"].isNull())
-        responseObject["Print.log"]["value"] = buffer;
-      else
-        responseObject["Print.log"]["value"] = responseObject["Print.log"]["value"].as<String>() + String(buffer);
-      // web->addResponse(variable.var, "value", JsonString(buffer)); //setValue not necessary
-      // variable.setValueF("%s", buffer);
-    }
-    else if (output == 3) {
-      //tbd
+  int length = vsnprintf(buffer, sizeof(buffer), format, args);
+  if (length <= 0) return;
+  entry.length = min((size_t)length, sizeof(buffer) - 1);
+  entry.flags = (xTaskGetCurrentTaskHandle() == loopTask?0:PRINT_OTHER_TASK) | (sys && sys->safeMode?PRINT_SAFE_MODE:0); //print declared before sys
+
+  if (!printTask)
+    deliver(entry, buffer); //before setup
+  else if (!push(entry, buffer))
+    dropped++; //not atomic, a stat
+}
+
+bool SysModPrint::push(const PrintEntry &entry, const char * text) {
+  size_t size = sizeof(PrintEntry) + entry.length;
+  portENTER_CRITICAL(&printMux);
+  size_t head = ringHead.load(std::memory_order_relaxed);
+  bool fits = size <= PRINT_RING_SIZE - (head - ringTail.load(std::memory_order_acquire));
+  if (fits) {
+    copyIn(head, &entry, sizeof(PrintEntry));
+    copyIn(head + sizeof(PrintEntry), text, entry.length);
+    ringHead.store(head + size, std::memory_order_release);
+  }
+  portEXIT_CRITICAL(&printMux);
+  return fits;
+}
+
+void SysModPrint::copyIn(size_t position, const void * data, size_t length) {
+  size_t at = position & (PRINT_RING_SIZE - 1);
+  size_t first = min(length, PRINT_RING_SIZE - at);
+  memcpy(ring + at, data, first);
+  memcpy(ring, (const uint8_t *)data + first, length - first);
+}
+
+void SysModPrint::copyOut(size_t position, void * data, size_t length) {
+  size_t at = position & (PRINT_RING_SIZE - 1);
+  size_t first = min(length, PRINT_RING_SIZE - at);
+  memcpy(data, ring + at, first);
+  memcpy((uint8_t *)data + first, ring, length - first);
+}
+
+void SysModPrint::printTaskLoop(void * parameter) {
+  SysModPrint *self = (SysModPrint *)parameter;
+  char text[512];
+  for (;;) {
+    size_t tail = self->ringTail.load(std::memory_order_relaxed);
+    while (tail != self->ringHead.load(std::memory_order_acquire)) {
+      PrintEntry entry;
+      self->copyOut(tail, &entry, sizeof(PrintEntry));
+      self->copyOut(tail + sizeof(PrintEntry), text, entry.length);
+      text[entry.length] = '\0';
+      tail += sizeof(PrintEntry) + entry.length;
+      self->ringTail.store(tail, std::memory_order_release); //room for the producers before the (slow) output
+      self->deliver(entry, text);
     }
+    vTaskDelay(pdMS_TO_TICKS(10));
   }
-  else
-    toSerial = true;
+}
 
-  if (toSerial) {
-    if (sys && sys->safeMode) Serial.print("🚑"); //print declared before sys
-    Serial.print(strncmp(pcTaskGetTaskName(nullptr), "loopTask", 8) == 0?"":"α"); //looptask λ/ asyncTCP task α
-    Serial.print(buffer);
+void SysModPrint::deliver(const PrintEntry &entry, const char * text) {
+  if (entry.output == 1 || !printTask)
+    outputSerial(entry.flags, text);
+  else if (entry.output == 2) {
+    portENTER_CRITICAL(&printMux);
+    if (uiLogLength + entry.length < sizeof(uiLog)) {
+      memcpy(uiLog + uiLogLength, text, entry.length);
+      uiLogLength += entry.length;
+    }
+    else
+      dropped++;
+    portEXIT_CRITICAL(&printMux);
   }
+  else if (entry.output >= 3 && udpIP != INADDR_NONE)
+    udp.writeTo((const uint8_t *)text, entry.length, udpIP, PRINT_UDP_PORT);
+}
 
-  va_end(args);
+void SysModPrint::outputSerial(uint8_t flags, const char * text) {
+  if (flags & PRINT_SAFE_MODE) Serial.print("🚑");
+  Serial.print((flags & PRINT_OTHER_TASK)?"α":""); //looptask λ/ other tasks (e.g. asyncTCP) α
+  Serial.print(text);
 }
 
 void SysModPrint::println(const __FlashStringHelper * x) {
@@ -11,22 +11,53 @@
 
 #pragma once
 #include "SysModule.h"
+#include <AsyncUDP.h>
+#include <atomic>
 
-#define ppf(x...) print->printf(x)
-// #define ppf(x...) //to have no print code compiled, difference is only 6308 bytes 
-// Flash: [======    ]  62.8% (used 1194250 bytes from 1900544 bytes)
-// Flash: [======    ]  63.2% (used 1200558 bytes from 1900544 bytes)
+//levels, messages above the level are not printed. ppf is info, or dev if the format starts with "dev "
+#define PRINT_ERROR 0
+#define PRINT_WARNING 1
+#define PRINT_INFO 2
+#define PRINT_DEV 3
+
+//compile time level: e.g. -D STARBASE_PRINT_LEVEL=PRINT_WARNING to have no info and dev print code compiled (ppf), difference is only 6308 bytes
+#ifndef STARBASE_PRINT_LEVEL
+  #define STARBASE_PRINT_LEVEL PRINT_DEV
+#endif
+
+#if STARBASE_PRINT_LEVEL >= PRINT_INFO
+  #define ppf(x...) print->printf(x)
+#else
+  #define ppf(x...)
+#endif
+#if STARBASE_PRINT_LEVEL >= PRINT_WARNING
+  #define ppfWarning(x...) print->printfLevel(PRINT_WARNING, x)
+#else
+  #define ppfWarning(x...)
+#endif
+#define ppfError(x...) print->printfLevel(PRINT_ERROR, x)
+
+#define PRINT_RING_SIZE 4096 //formatted messages waiting for the print task, power of 2
+#define PRINT_UDP_PORT 514 //output to an ip: raw text to the syslog port, e.g. nc -ul 514
 
 class SysModPrint:public SysModule {
 
 public:
 
+  TaskHandle_t loopTask = xTaskGetCurrentTaskHandle(); //print is created in setup, prints of other tasks are marked with α
+
+  uint8_t output = 1; //No, Serial, UI, ip of a client. Cached, not looked up for each print
+  uint8_t level = PRINT_DEV; //runtime level, up to STARBASE_PRINT_LEVEL
+  uint16_t dropped = 0; //messages dropped as the ring buffer (or the UI log) was full
+
   SysModPrint();
   void setup() override;
   void loop20ms() override;
 
-  //generic print function
+  //generic print function: formatted in the calling task, output by the print task (no waiting on Serial or the network)
   void printf(const char * format, ...);
+  void printfLevel(uint8_t level, const char * format, ...);
+  void vprintfLevel(uint8_t level, const char * format, va_list args);
 
   //not used yet
   void println(const __FlashStringHelper * x);
@@ -42,6 +73,33 @@ public:
 
 private:
   bool setupsDone = false;
+
+  //header of a message in the ring buffer, followed by the text
+  struct PrintEntry {
+    uint16_t length; //of the text
+    uint8_t output;
+    uint8_t flags; //PRINT_OTHER_TASK, PRINT_SAFE_MODE
+  };
+
+  //multiple producers (loopTask, AsyncTCP, module and script tasks) reserve and copy under printMux (no waiting, no allocation), the print task is the only consumer
+  uint8_t ring[PRINT_RING_SIZE];
+  std::atomic<size_t> ringHead{0}; //free running, written by the producers
+  std::atomic<size_t> ringTail{0}; //free running, written by the print task
+  portMUX_TYPE printMux = portMUX_INITIALIZER_UNLOCKED;
+  TaskHandle_t printTask = nullptr; //nullptr: print synchronously (before setup)
+
+  char uiLog[1024]; //text for Print.log, sent by loop20ms (the UI needs the response of loopTask)
+  size_t uiLogLength = 0; //protected by printMux
+
+  AsyncUDP udp;
+  IPAddress udpIP;
+
+  bool push(const PrintEntry &entry, const char * text);
+  void copyIn(size_t position, const void * data, size_t length);
+  void copyOut(size_t position, void * data, size_t length);
+  void deliver(const PrintEntry &entry, const char * text);
+  void outputSerial(uint8_t flags, const char * text);
+  static void printTaskLoop(void * parameter);
 };
 
 extern SysModPrint *print;
\ No newline at end of file
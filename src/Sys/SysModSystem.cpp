@@ -143,6 +143,71 @@ void SysModSystem::setup() {
     }});
   }
 
+  //allocators of the JsonDocuments (model, responses, instances), see SysJsonAllocators
+  Variable tableVar = ui->initTable(parentVar, "arenas", nullptr, true, [](EventArguments) { switch (eventType) {
+    case onUI:
+      variable.setComment("JsonDocument allocators, used and largest free in B");
+      return true;
+    case onLoop1s:
+      for (JsonObject childVar: variable.children())
+        Variable(childVar).triggerEvent(onSetValue);
+    default: return false;
+  }});
+
+  ui->initText(tableVar, "arena", nullptr, 16, true, [](EventArguments) { switch (eventType) {
+    case onSetValue: {
+      std::vector<JsonString> values; for (JsonAllocator *allocator: JsonAllocator::all()) values.push_back(JsonString(allocator->name));
+      variable.setValues(values);
+      return true; }
+    default: return false;
+  }});
+
+  ui->initNumber(tableVar, "used", UINT16_MAX, 0, (unsigned long)-1, true, [](EventArguments) { switch (eventType) {
+    case onSetValue: {
+      std::vector<uint32_t> values; for (JsonAllocator *allocator: JsonAllocator::all()) values.push_back(allocator->used);
+      variable.setValues(values);
+      return true; }
+    default: return false;
+  }});
+
+  ui->initNumber(tableVar, "highWater", UINT16_MAX, 0, (unsigned long)-1, true, [](EventArguments) { switch (eventType) {
+    case onSetValue: {
+      std::vector<uint32_t> values; for (JsonAllocator *allocator: JsonAllocator::all()) values.push_back(allocator->highWater);
+      variable.setValues(values);
+      return true; }
+    default: return false;
+  }});
+
+  ui->initNumber(tableVar, "reserved", UINT16_MAX, 0, (unsigned long)-1, true, [](EventArguments) { switch (eventType) {
+    case onSetValue: {
+      std::vector<uint32_t> values; for (JsonAllocator *allocator: JsonAllocator::all()) values.push_back(allocator->reserved);
+      variable.setValues(values);
+      return true; }
+    case onUI:
+      variable.setComment("Chunks / blocks taken from the heap");
+      return true;
+    default: return false;
+  }});
+
+  ui->initNumber(tableVar, "largestFree", UINT16_MAX, 0, (unsigned long)-1, true, [](EventArguments) { switch (eventType) {
+    case onSetValue: {
+      std::vector<uint32_t> values; for (JsonAllocator *allocator: JsonAllocator::all()) values.push_back(allocator->largestFree());
+      variable.setValues(values);
+      return true; }
+    default: return false;
+  }});
+
+  ui->initNumber(tableVar, "fallbacks", UINT16_MAX, 0, (unsigned long)-1, true, [](EventArguments) { switch (eventType) {
+    case onSetValue: {
+      std::vector<uint32_t> values; for (JsonAllocator *allocator: JsonAllocator::all()) values.push_back(allocator->fallbacks + allocator->failures);
+      variable.setValues(values);
+      return true; }
+    case onUI:
+      variable.setComment("Served by the heap (+ failed)");
+      return true;
+    default: return false;
+  }});
+
   ui->initProgress(parentVar, "mainStack", 0, 0, getArduinoLoopTaskStackSize(), true, [this](EventArguments) { switch (eventType) {
     case onChange:
       variable.var["max"] = getArduinoLoopTaskStackSize(); //makes sense?
@@ -219,6 +284,13 @@ void SysModSystem::setup() {
     default: return false;
   }});
 
+  ui->initProgress(parentVar, "otaProgress", 0, 0, 100, true, [](EventArguments) { switch (eventType) {
+    case onUI:
+      variable.setComment("% of the update, KB/s"); //during the update set by SysModWeb::otaProgress
+      return true;
+    default: return false;
+  }});
+
   // char msgbuf[32];
   // snprintf(msgbuf, sizeof(msgbuf)-1, "%s rev.%d", ESP.getChipModel(), ESP.getChipRevision());
   // ui->initText(parentVar, "e32model")] = msgbuf;
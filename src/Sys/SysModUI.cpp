@@ -30,41 +30,126 @@ void SysModUI::setup() {
   }});
 
   initText(tableVar, "variable", nullptr, 32, true, [this](EventArguments) { switch (eventType) {
-    case onSetValue:
-      for (size_t rowNr = 0; rowNr < loopFunctions.size(); rowNr++)
-        variable.setValue(JsonString(loopFunctions[rowNr].variable.id()), rowNr);
-      return true;
+    case onSetValue: {
+      std::vector<JsonString> values; for (VarLoop &varLoop: loopFunctions) values.push_back(JsonString(varLoop.variable.id()));
+      variable.setValues(values);
+      return true; }
     default: return false;
   }});
 
   initNumber(tableVar, "#loops", UINT16_MAX, 0, 999, true, [this](EventArguments) { switch (eventType) {
-    case onSetValue:
-      for (size_t rowNr = 0; rowNr < loopFunctions.size(); rowNr++)
-        variable.setValue(loopFunctions[rowNr].counter, rowNr);
-      return true;
+    case onSetValue: {
+      std::vector<uint16_t> values; for (VarLoop &varLoop: loopFunctions) values.push_back(varLoop.counter);
+      variable.setValues(values);
+      return true; }
     case onLoop1s:
       variable.triggerEvent(onSetValue); //set the value (WIP)
+      Variable(variable.pid(), "requested").triggerEvent(onSetValue);
       for (VarLoop &varLoop : loopFunctions)
         varLoop.counter = 0;
       return true;
+    case onUI:
+      variable.setComment("Loops last second");
+      return true;
+    default: return false;
+  }});
+
+  initNumber(tableVar, "requested", UINT16_MAX, 0, UINT16_MAX, true, [this](EventArguments) { switch (eventType) {
+    case onSetValue: {
+      std::vector<uint16_t> values; for (VarLoop &varLoop: loopFunctions) values.push_back(varLoop.interval?1000000 / varLoop.interval:0);
+      variable.setValues(values);
+      return true; }
+    case onUI:
+      variable.setComment("Loops per second of the interval, 0: idle");
+      return true;
     default: return false;
   }});
 }
 
-void SysModUI::loop20ms() { //never more then 50 times a second!
+//heap compare: later due is lower priority (micros wrap safe), as ModuleScheduler
+static bool loopDueLater(uint16_t a, uint16_t b) {
+  return (long)(ui->loopFunctions[a].due - ui->loopFunctions[b].due) > 0;
+}
 
-  for (VarLoop &varLoop : loopFunctions) {
-    if (millis() - varLoop.lastMillis >= varLoop.variable.var["interval"].as<int>()) {
-      varLoop.lastMillis = millis();
+void SysModUI::loop() {
+  //nothing due: one compare
+  unsigned long now = micros();
+  while (!loopQueue.empty() && (long)(now - loopFunctions[loopQueue.front()].due) >= 0) {
+    std::pop_heap(loopQueue.begin(), loopQueue.end(), loopDueLater);
+    runningLoop = loopQueue.back();
+    loopQueue.pop_back();
 
-      varLoop.loopFun(varLoop.variable, 1, onLoop); //rowNr..
+    VarLoop &varLoop = loopFunctions[runningLoop];
+    varLoop.loopFun(varLoop.variable, 1, onLoop); //rowNr..
+    varLoop.counter++;
 
-      varLoop.counter++;
-      // ppf("%s %u %u %d %d\n", varLoop->Variable(var).id(), varLoop->lastMillis, millis(), varLoop->interval, varLoop->counter);
+    uint16_t loopNr = runningLoop;
+    runningLoop = UINT16_MAX;
+    VarLoop &ranLoop = loopFunctions[loopNr]; //loopFun may have added loops
+    if (ranLoop.interval) {
+      //next due on the grid of the interval, if already passed now + interval (no catch up bursts)
+      ranLoop.due += ranLoop.interval;
+      if ((long)(micros() - ranLoop.due) >= 0) ranLoop.due = micros() + ranLoop.interval;
+      loopQueue.push_back(loopNr);
+      std::push_heap(loopQueue.begin(), loopQueue.end(), loopDueLater);
     }
+    else
+      ranLoop.queued = false; //idle
   }
 }
 
+void SysModUI::addLoop(Variable variable, const VarEvent &loopFun) {
+  //initVar again (e.g. details rebuilt): replace the function
+  if (variable.var["loopFun"].is<uint16_t>()) {
+    uint16_t loopNr = variable.var["loopFun"];
+    if (loopNr < loopFunctions.size() && loopFunctions[loopNr].variable.var == variable.var) {
+      loopFunctions[loopNr].loopFun = loopFun;
+      return;
+    }
+  }
+
+  VarLoop varLoop;
+  varLoop.loopFun = loopFun;
+  varLoop.variable = variable;
+  varLoop.interval = (variable.var["interval"].is<unsigned long>()?variable.var["interval"].as<unsigned long>():VARLOOP_INTERVAL) * 1000;
+  loopFunctions.push_back(varLoop);
+  variable.var["loopFun"] = loopFunctions.size()-1;
+  queueLoop(loopFunctions.size()-1);
+}
+
+void SysModUI::setLoopInterval(Variable variable, unsigned long interval) {
+  if (!variable.var["loopFun"].is<uint16_t>()) return;
+  uint16_t loopNr = variable.var["loopFun"];
+  if (loopNr >= loopFunctions.size()) return;
+  VarLoop &varLoop = loopFunctions[loopNr];
+  if (varLoop.interval == interval * 1000) return; //e.g. set in each onLoop
+
+  varLoop.interval = interval * 1000;
+  variable.var["interval"] = interval; //the model as before, read by addLoop
+  if (loopNr == runningLoop) return; //rescheduled by loop with the new interval
+
+  if (varLoop.queued) {
+    if (varLoop.interval)
+      varLoop.due = micros() + varLoop.interval;
+    else { //idle: out of the queue
+      loopQueue.erase(std::find(loopQueue.begin(), loopQueue.end(), loopNr));
+      varLoop.queued = false;
+    }
+    std::make_heap(loopQueue.begin(), loopQueue.end(), loopDueLater); //rare, not per loop
+  }
+  else
+    queueLoop(loopNr);
+}
+
+void SysModUI::queueLoop(uint16_t loopNr) {
+  VarLoop &varLoop = loopFunctions[loopNr];
+  if (!varLoop.interval || varLoop.queued) return;
+  varLoop.due = micros() + varLoop.interval;
+  varLoop.queued = true;
+  loopQueue.push_back(loopNr);
+  std::push_heap(loopQueue.begin(), loopQueue.end(), loopDueLater);
+}
+
 void SysModUI::processJson(JsonVariant json) {
   if (json.is<JsonObject>()) //should be
   {
@@ -100,8 +185,8 @@ void SysModUI::processJson(JsonVariant json) {
 
           //first remove the deleted row both on server and on client(s)
           if (pair.key() == "onDelete") {
-            ppf("onDelete remove removeValuesForRow\n");
-            Variable(var).removeValuesForRow(rowNr);
+            ppf("onDelete deleteRow\n");
+            Variable(var).deleteRow(rowNr, false); //the clients get the onDelete key of json
           }
         }
         // we need to send back the key so UI can add or delete the value
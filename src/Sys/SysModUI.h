@@ -14,25 +14,35 @@
 #include "SysModPrint.h"
 #include "SysModModel.h"
 
+#define VARLOOP_INTERVAL 20 //ms if the var has no interval
+
 struct VarLoop {
   Variable variable;
   VarEvent loopFun;
-  unsigned long lastMillis = 0;
-  unsigned long counter = 0;
+  unsigned long interval = 0; //micros, cached: var["interval"] at registration, then setLoopInterval. 0: idle, not in the queue
+  unsigned long due = 0; //micros
+  unsigned long counter = 0; //this second
+  bool queued = false; //in loopQueue (or running)
 };
 
 class SysModUI: public SysModule {
 
 public:
 
-  std::vector<VarLoop> loopFunctions;
+  std::vector<VarLoop> loopFunctions; //index is var["loopFun"]
 
   SysModUI();
 
   //serve index.htm
   void setup() override;
 
-  void loop20ms() override;
+  //runs the due var loops: each pass of the loopTask, so intervals below 20ms are possible
+  void loop() override;
+
+  //onLoop of variable run every interval ms (interval from var["interval"] or VARLOOP_INTERVAL)
+  void addLoop(Variable variable, const VarEvent &loopFun);
+  //0: idle, the loop is not run (no cost) until an interval is set again
+  void setLoopInterval(Variable variable, unsigned long interval);
 
   //order: order%4 determines the column (WIP)
   Variable initAppMod(Variable parent, const char * id, int order = 0) {
@@ -205,7 +215,7 @@ public:
       (*values).clear(); // if values already then rebuild the vector with it
     }
 
-    if (variable.initValue(min, max, (int)values)) {
+    if (variable.initValue(min, max, (int)values, true)) {
       uint8_t rowNrL = 0;
       for (Type value: *values) { //loop over vector
         variable.setValue(value, rowNrL); //does onChange if needed, if var in table, update the table row
@@ -225,7 +235,7 @@ public:
       (*values).clear(); // if values already then rebuild the vector with it
     }
 
-    if (variable.initValue(min, max, (int)values)) {
+    if (variable.initValue(min, max, (int)values, true)) {
       uint8_t rowNrL = 0;
       for (VectorString value: *values) { //loop over vector
         variable.setValue(JsonString(value.s), rowNrL); //does onChange if needed, if var in table, update the table row
@@ -258,7 +268,10 @@ public:
 
 
 private:
+  std::vector<uint16_t> loopQueue; //min heap of loopFunctions indexes on due, idle loops are not in it
+  uint16_t runningLoop = UINT16_MAX; //popped from loopQueue while its loopFun runs
 
+  void queueLoop(uint16_t loopNr);
 };
 
 extern SysModUI *ui;
\ No newline at end of file
@@ -30,6 +30,8 @@
 #include "AsyncJson.h"
 
 #include <ArduinoOTA.h>
+#include "esp_image_format.h" //esp_image_header_t
+#include <memory> //shared_ptr
 
 //https://techtutorialsx.com/2018/08/24/esp32-web-server-serving-html-from-file-system/
 //https://randomnerdtutorials.com/esp32-async-web-server-espasyncwebserver-library/
@@ -40,8 +42,7 @@ SysModWeb::SysModWeb() :SysModule("Web") {
   DefaultHeaders::Instance().addHeader(F("Access-Control-Allow-Methods"), "*");
   DefaultHeaders::Instance().addHeader(F("Access-Control-Allow-Headers"), "*");
 
-  responseDocLoopTask = new JsonDocument; responseDocLoopTask->to<JsonObject>();
-  responseDocAsyncTCP = new JsonDocument; responseDocAsyncTCP->to<JsonObject>();
+  addResponseContext(); //constructed in loopTask
 };
 
 void SysModWeb::setup() {
@@ -57,16 +58,17 @@ void SysModWeb::setup() {
 
   ui->initNumber(tableVar, "nr", UINT16_MAX, 0, 999, true, [this](EventArguments) { switch (eventType) {
     case onSetValue: {
-      uint8_t rowNr = 0; for (auto &client:ws.getClients())
-        variable.setValue(client->id(), rowNr++);
+      std::vector<uint32_t> values; for (auto &client:ws.getClients()) values.push_back(client->id());
+      variable.setValues(values);
       return true; }
     default: return false;
   }});
 
   ui->initText(tableVar, "ip", nullptr, 16, true, [this](EventArguments) { switch (eventType) {
     case onSetValue: {
-      uint8_t rowNr = 0; for (auto &client:ws.getClients())
-        variable.setValue(JsonString(client->remoteIP().toString().c_str()), rowNr++);
+      std::vector<String> ips; for (auto &client:ws.getClients()) ips.push_back(client->remoteIP().toString());
+      std::vector<JsonString> values; for (const String &ip: ips) values.push_back(JsonString(ip.c_str()));
+      variable.setValues(values);
       return true; }
     default: return false;
   }});
@@ -74,16 +76,17 @@ void SysModWeb::setup() {
   //UINT8_MAX: tri state boolean: not true not false
   ui->initCheckBox(tableVar, "full", UINT8_MAX, true, [this](EventArguments) { switch (eventType) {
     case onSetValue: {
-      uint8_t rowNr = 0; for (auto &client:ws.getClients())
-        variable.setValue(client->queueIsFull(), rowNr++);
+      bool values[UINT8_MAX]; uint8_t count = 0; //no vector<bool>
+      for (auto &client:ws.getClients()) if (count < UINT8_MAX) values[count++] = client->queueIsFull();
+      variable.setValues(values, count);
       return true; }
     default: return false;
   }});
 
   ui->initSelect(tableVar, "status", UINT8_MAX, true, [this](EventArguments) { switch (eventType) {
     case onSetValue: {
-      uint8_t rowNr = 0; for (auto &client:ws.getClients())
-        variable.setValue(client->status(), rowNr++);
+      std::vector<uint8_t> values; for (auto &client:ws.getClients()) values.push_back(client->status());
+      variable.setValues(values);
       return true; }
     case onUI:
     {
@@ -99,28 +102,46 @@ void SysModWeb::setup() {
 
   ui->initNumber(tableVar, "length", UINT16_MAX, 0, WS_MAX_QUEUED_MESSAGES, true, [this](EventArguments) { switch (eventType) {
     case onSetValue: {
-      uint8_t rowNr = 0; for (auto &client:ws.getClients())
-        variable.setValue(client->queueLen(), rowNr++);
+      std::vector<uint16_t> values; for (auto &client:ws.getClients()) values.push_back(client->queueLen());
+      variable.setValues(values);
       return true; }
     default: return false;
   }});
 
   ui->initNumber(parentVar, "maxQueue", WS_MAX_QUEUED_MESSAGES, 0, WS_MAX_QUEUED_MESSAGES, true);
 
+  ui->initNumber(parentVar, "maxRate", &maxRate, 1, 50, false, [](EventArguments) { switch (eventType) {
+    case onUI:
+      variable.setComment("Max updates per second per client");
+      return true;
+    default: return false;
+  }});
+
+  ui->initNumber(parentVar, "maxMessage", &maxMessageSize, 1024, UINT16_MAX, false, [](EventArguments) { switch (eventType) {
+    case onUI:
+      variable.setComment("Max size of received messages (B)");
+      return true;
+    default: return false;
+  }});
+
   ui->initText(parentVar, "WSSend", nullptr, 16, true, [this](EventArguments) { switch (eventType) {
     case onLoop1s:
-      variable.setValueF("#: %d /s T: %d B/s B:%d B/s", sendWsCounter, sendWsTBytes, sendWsBBytes);
+      variable.setValueF("#: %d /s T: %d B/s B:%d B/s C:%d D:%d", sendWsCounter, sendWsTBytes, sendWsBBytes, sendWsCoalesced, sendWsDropped);
       sendWsCounter = 0;
       sendWsTBytes = 0;
       sendWsBBytes = 0;
+      sendWsCoalesced = 0;
+      sendWsDropped = 0;
     default: return false;
   }});
 
   ui->initText(parentVar, "WSRecv", nullptr, 16, true, [this](EventArguments) { switch (eventType) {
     case onLoop1s:
-      variable.setValueF("#: %d /s %d B/s", recvWsCounter, recvWsBytes);
+      variable.setValueF("#: %d /s %d B/s C:%d D:%d", recvWsCounter, recvWsBytes, commandsProcessed, commandsDropped);
       recvWsCounter = 0;
       recvWsBytes = 0;
+      commandsProcessed = 0;
+      commandsDropped = 0;
       return true;
     default: return false;
   }});
@@ -162,10 +183,24 @@ void SysModWeb::loop20ms() {
       Variable(childVar).triggerEvent(onSetValue); //set the value (WIP)
   }
 
+  updateJsonSnapshot();
+  streamModel();
+  serializeModelPieces();
+
+  sendPending();
+
+  flushResponses(); //this sends all the loopTask responses
 }
 
 void SysModWeb::loop1s() {
-  sendResponseObject(); //this sends all the loopTask responses once per second !!!
+  if (ota.reportPending) otaReport();
+
+  //an interrupted update which is not resumed: free the buffers and the ota partition
+  if (ota.active && millis() - ota.lastData > OTA_RESUME_TIMEOUT) {
+    ppf("OTA Update not resumed at %d, aborted\n", ota.received);
+    print->fFormat(ota.message, sizeof(ota.message), "Update not resumed at %d", ota.received);
+    otaStop();
+  }
 }
 
 void SysModWeb::reboot() {
@@ -202,13 +237,16 @@ void SysModWeb::connectedChanged() {
       WWWData::registerRoutes(
           [this](const String &uri, const String &contentType, const uint8_t *content, size_t len)
           {
-              server.on(uri.c_str(), HTTP_GET, [this, content, len, contentType](WebRequest *request) {
-                WebResponse *response;
-                response = request->beginResponse_P(200, contentType.c_str(), content, len);
-                response->addHeader("Content-Encoding","gzip");
-                // response.addHeader("Cache-Control", "public, immutable, max-age=31536000"); //from svelte
-                // setStaticContentCacheHeaders(response);
-                request->send(response);
+              //strong ETag: FNV-1a of the content (embedded, so fixed for the build)
+              //sveltekit puts hashed file names under _app/immutable: cached forever
+              uint32_t hash = 2166136261;
+              for (size_t i = 0; i < len; i++) hash = (hash ^ pgm_read_byte(content + i)) * 16777619;
+              char etagBuf[12];
+              snprintf(etagBuf, sizeof(etagBuf), "\"%08x\"", hash);
+              String etag = etagBuf;
+              bool immutable = uri.indexOf("/immutable/") >= 0;
+              server.on(uri.c_str(), HTTP_GET, [this, content, len, contentType, immutable, etag](WebRequest *request) {
+                sendStatic(request, contentType.c_str(), content, len, etag.c_str(), immutable);
               });
 
               // Set default end-point for all non matching requests
@@ -226,6 +264,7 @@ void SysModWeb::connectedChanged() {
 
     server.addHandler(new AsyncCallbackJsonWebHandler("/json", [this](WebRequest *request, JsonVariant &json){jsonHandler(request, json);}));
 
+    server.on("/update", HTTP_GET, [this](WebRequest *request) {serveUpdateState(request);});
     server.on("/update", HTTP_POST, [](WebRequest *) {}, [this](WebRequest *request, const String& fileName, size_t index, byte *data, size_t len, bool final) {serveUpdate(request, fileName, index, data, len, final);});
     server.on("/file", HTTP_GET, [this](WebRequest *request) {serveFiles(request);});
     server.on("/upload", HTTP_POST, [](WebRequest *) {}, [this](WebRequest *request, const String& fileName, size_t index, byte *data, size_t len, bool final) {serveUpload(request, fileName, index, data, len, final);});
@@ -254,140 +293,85 @@ void SysModWeb::wsEvent(WebSocket * ws, WebClient * client, AwsEventType type, v
   if (type == WS_EVT_CONNECT) {
     printClient("WS client connected", client);
 
-    //send system constants
-    getResponseObject()["sysInfo"]["board"] = CONFIG_IDF_TARGET;
-    getResponseObject()["sysInfo"]["nrOfPins"] = NUM_DIGITAL_PINS;
-    getResponseObject()["sysInfo"]["pinTypes"].to<JsonArray>();
-    JsonArray pinTypes = getResponseObject()["sysInfo"]["pinTypes"];
-    for (int i=0; i<NUM_DIGITAL_PINS; i++) {
-      pinTypes.add(pinsM->getPinType(i));
-    }
-
-    sendResponseObject(client);
-
-    JsonArray model = mdl->model->as<JsonArray>();
-
-    //inspired by https://github.com/bblanchon/ArduinoJson/issues/1280
-    //store arrayindex and sort order in vector
-    std::vector<ArrayIndexSortValue> aisvs;
-    size_t index = 0;
-    for (JsonObject moduleVar: model) {
-      ArrayIndexSortValue aisv;
-      aisv.index = index++;
-      aisv.value = Variable(moduleVar).order();
-      aisvs.push_back(aisv);
-    }
-    //sort the vector by the order
-    std::sort(aisvs.begin(), aisvs.end(), [](const ArrayIndexSortValue &a, const ArrayIndexSortValue &b) {return a.value < b.value;});
-
-    //send model per module to stay under websocket size limit of 8192
-    for (const ArrayIndexSortValue &aisv : aisvs) {
-      sendDataWs(model[aisv.index], client); //send definition to client
-    }
+    //sysInfo and model are send by loopTask
+    WSCommand *command = new WSCommand();
+    command->kind = ck_connect;
+    command->clientId = client->id();
+    pushCommand(command);
 
     clientsChanged = true;
   } else if (type == WS_EVT_DISCONNECT) {
     printClient("WS Client disconnected", client);
+    for (WSFrameBuffer &fb: wsFrameBuffers) if (fb.clientId == client->id()) fb.clientId = 0; //message not completed
     clientsChanged = true;
   } else if (type == WS_EVT_DATA) {
     AwsFrameInfo * info = (AwsFrameInfo*)arg;
-    String msg = "";
     // ppf("  info %d %d %d=%d? %d %d\n", info->final, info->index, info->len, len, info->opcode, data[0]);
-    if (info->final && info->index == 0 && info->len == len) { //not multipart
-      recvWsCounter++;
-      recvWsBytes+=len;
+    recvWsCounter++;
+    recvWsBytes+=len;
+    if (info->final && info->num == 0 && info->index == 0 && info->len == len) { //not multipart
       // printClient("WS event data", client);
       // the whole message is in a single frame and we got all of its data (max. 1450 bytes)
       if (info->opcode == WS_TEXT)
-      {
-        if (len > 0 && len < 10 && data[0] == 'p') {
-          // application layer ping/pong heartbeat.
-          // client-side socket layer ping packets are unresponded (investigate)
-          // printClient("WS client pong", client); //crash?
-          ppf("pong\n");
-          client->text("pong");
-        } else {
-          JsonDocument *responseDoc = getResponseDoc(); //we need the doc for deserializeJson
-          JsonObject responseObject = getResponseObject();
-
-          DeserializationError error = deserializeJson(*responseDoc, data, len); //data to responseDoc
-
-          if (error || responseObject.isNull()) {
-            ppf("wsEvent deserializeJson failed with code %s\n", error.c_str());
-            client->text("{\"success\":true}"); // we have to send something back otherwise WS connection closes
-          } else {
-            bool isOnUI = !responseObject["onUI"].isNull();
-            ui->processJson(responseObject); //adds to responseDoc / responseObject
-
-            if (responseObject.size()) {
-              sendResponseObject(isOnUI?client:nullptr); //onUI only send to requesting client async response
-            }
-            else {
-              if (!isOnUI) //for onui we know json.remove(key) is done
-                ppf("wsEvent no responseDoc ui:%d\n", isOnUI);
-              client->text("{\"success\":true}"); // we have to send something back otherwise WS connection closes
-            }
-          }
-        }
+        wsTextMessage(client, data, len);
+      else if (info->opcode == WS_BINARY && len > 0 && data[0] == WS_BIN_VALUES) {
+        WSCommand *command = new WSCommand();
+        command->kind = ck_values;
+        command->clientId = client->id();
+        command->data.assign(data, data + len);
+        pushCommand(command);
       }
     } else {
-      //message is comprised of multiple frames or the frame is split into multiple packets
-      if(info->index == 0){
-        // if(info->num == 0)
-        //   ppf("ws[%s][%u] %s-message start\n", ws.url(), client->id(), (info->message_opcode == WS_TEXT)?"text":"binary");
-        // ppf("ws[%s][%u] frame[%u] start[%llu]\n", ws.url(), client->id(), info->num, info->len);
-        ppf("💀");
+      //message is comprised of multiple frames or the frame is split into multiple packets: reassemble
+      WSFrameBuffer *frameBuffer = nullptr;
+      for (WSFrameBuffer &fb: wsFrameBuffers) if (fb.clientId == client->id()) frameBuffer = &fb;
+
+      if (info->num == 0 && info->index == 0) { //start of message
+        if (!frameBuffer) for (WSFrameBuffer &fb: wsFrameBuffers) if (!frameBuffer && fb.clientId == 0) frameBuffer = &fb;
+        if (frameBuffer) {
+          frameBuffer->clientId = client->id();
+          frameBuffer->opcode = info->message_opcode;
+          frameBuffer->len = 0;
+        }
+        else
+          ppf("dev wsEvent no frame buffer free for client %d\n", client->id());
       }
 
-      // ppf("ws[%s][%u] frame[%u] %s[%llu - %llu]: ", ws.url(), client->id(), info->num, (info->message_opcode == WS_TEXT)?"text":"binary", info->index, info->index + len);
-      ppf("💀");
+      if (frameBuffer) {
+        //allocate once, reuse for next messages
+        if (frameBuffer->len + len > frameBuffer->size && frameBuffer->len + len <= maxMessageSize) {
+          byte *newData = (byte *)realloc(frameBuffer->data, maxMessageSize);
+          if (newData) {
+            frameBuffer->data = newData;
+            frameBuffer->size = maxMessageSize;
+          }
+        }
 
-      if(info->opcode == WS_TEXT){
-        for (size_t i=0; i < len; i++) {
-          msg += (char) data[i];
+        if (frameBuffer->len + len > frameBuffer->size) {
+          ppf("wsEvent message of client %d too big (> %d), dropped\n", client->id(), frameBuffer->size);
+          frameBuffer->clientId = 0;
+          client->text("{\"success\":false}");
         }
-      }
-      // else {
-      //   char buff[3];
-      //   for (size_t i=0; i < len; i++) {
-      //     snprintf(buff, sizeof(buf), "%02x ", (uint8_t) data[i]);
-      //     msg += buff ;
-      //   }
-      // }
-      ppf("%s\n",msg.c_str());
-
-      if ((info->index + len) == info->len) {
-        // ppf("ws[%s][%u] frame[%u] end[%llu]\n", ws.url(), client->id(), info->num, info->len);
-        ppf("👻");
-        if(info->final){
-          // ppf("ws[%s][%u] %s-message end\n", ws.url(), client->id(), (info->message_opcode == WS_TEXT)?"text":"binary");
-          ppf("☠️");
-          if(info->message_opcode == WS_TEXT)
-            client->text("I got your text message");
-          else
-            client->binary("I got your binary message");
+        else {
+          memcpy(frameBuffer->data + frameBuffer->len, data, len);
+          frameBuffer->len += len;
+
+          if (info->final && info->index + len == info->len) { //last packet of last frame
+            frameBuffer->clientId = 0; //free for next (data stays allocated)
+            if (frameBuffer->opcode == WS_TEXT)
+              wsTextMessage(client, frameBuffer->data, frameBuffer->len);
+            else if (frameBuffer->opcode == WS_BINARY && frameBuffer->data[0] == WS_BIN_VALUES) {
+              WSCommand *command = new WSCommand();
+              command->kind = ck_values;
+              command->clientId = client->id();
+              command->data.assign(frameBuffer->data, frameBuffer->data + frameBuffer->len);
+              pushCommand(command);
+            }
+            else
+              ppf("dev wsEvent binary multi frame message not supported (%d bytes)\n", frameBuffer->len);
+          }
         }
       }
-
-      //message is comprised of multiple frames or the frame is split into multiple packets
-      //if(info->index == 0){
-        //if (!wsFrameBuffer && len < 4096) wsFrameBuffer = new uint8_t[4096];
-      //}
-
-      //if (wsFrameBuffer && len < 4096 && info->index + info->)
-      //{
-
-      //}
-
-      // if((info->index + len) == info->len){
-      //   if(info->final){
-      //     if(info->message_opcode == WS_TEXT) {
-      //       client->text("{\"error\":9}"); //we do not handle split packets right now
-      //       ppf("WS multipart message: we do not handle split packets right now\n");
-      //     }
-      //   }
-      // }
-      // ppf("WS multipart message f:%d i:%d len:%d == %d\n", info->final, info->index, info->len, len);
     }
   } else if (type == WS_EVT_ERROR){
     //error was received from the other end
@@ -403,6 +387,226 @@ void SysModWeb::wsEvent(WebSocket * ws, WebClient * client, AwsEventType type, v
   }
 }
 
+void SysModWeb::wsTextMessage(WebClient * client, byte *data, size_t len) {
+  if (len > 0 && len < 10 && data[0] == 'p') {
+    // application layer ping/pong heartbeat.
+    // client-side socket layer ping packets are unresponded (investigate)
+    // printClient("WS client pong", client); //crash?
+    ppf("pong\n");
+    client->text("pong");
+  } else {
+    WSCommand *command = new WSCommand();
+    command->kind = ck_json;
+    command->clientId = client->id();
+
+    DeserializationError error = deserializeJson(command->doc, data, len); //parsed here, applied in loopTask
+
+    if (error || !command->doc.is<JsonObject>()) {
+      ppf("wsEvent deserializeJson failed with code %s\n", error.c_str());
+      delete command;
+      client->text("{\"success\":true}"); // we have to send something back otherwise WS connection closes
+    }
+    else if (!pushCommand(command))
+      client->text("{\"success\":false}");
+  }
+}
+
+bool SysModWeb::pushCommand(WSCommand *command) {
+  if (commands.push(command)) return true;
+  ppf("dev pushCommand queue full, command %d of client %d dropped\n", command->kind, command->clientId);
+  commandsDropped++;
+  delete command;
+  return false;
+}
+
+void SysModWeb::queueValue(const char * pid, const char * id, int value) {
+  char pidid[32];
+  print->fFormat(pidid, sizeof(pidid), "%s.%s", pid, id);
+
+  //coalesce here, the model is owned by loopTask
+  QueuedValue *queued = nullptr;
+  for (QueuedValue &queuedValue: queuedValues)
+    if (strncmp(queuedValue.pidid, pidid, sizeof(pidid)) == 0) queued = &queuedValue;
+  if (queued && queued->value == value) return; //not changed since last queued
+
+  WSCommand *command = new WSCommand();
+  command->kind = ck_http;
+  command->doc[pidid]["value"] = value;
+  if (!pushCommand(command)) return; //try again next call
+
+  if (!queued) {
+    queuedValues.push_back(QueuedValue());
+    queued = &queuedValues.back();
+    strlcpy(queued->pidid, pidid, sizeof(queued->pidid));
+  }
+  queued->value = value;
+}
+
+void SysModWeb::processCommands() {
+  WSCommand *command;
+  bool first = true;
+  while (commands.pop(command)) {
+    //changes made by loopTask before these commands are send first
+    if (first) {
+      sendResponseObject();
+      sendValues();
+      first = false;
+    }
+
+    WebClient *client = command->clientId?ws.client(command->clientId):nullptr;
+
+    if (command->kind == ck_connect) {
+      if (client) clientConnected(client);
+    }
+    else if (command->kind == ck_values) {
+      wsBinaryValues(command->clientId, command->data.data(), command->data.size());
+    }
+    else if (command->kind == ck_upload) {
+      #ifdef STARBASE_USERMOD_LIVE
+        const char *fileName = (const char *)command->data.data();
+        files->refreshIndex(); //the uploaded file is marked changed, index it now
+        ppf("sc file added %s\n", fileName);
+        size_t seqNr = UINT8_MAX;
+        files->nameToSeqNr(fileName, &seqNr, ".sc");
+
+        if (seqNr != UINT8_MAX) {
+          //now only working for rowNr 0 !!! TBD!
+          mdl->setValue("effect", "script", 0, 0); //kill the old 
+          mdl->setValue("effect", "script", seqNr + 1, 0); //+1 as None is in dropdown
+        }
+      #endif
+    }
+    else //ck_json, ck_http
+      applyJson(command->doc, client);
+
+    commandsProcessed++;
+    if (command->done) {
+      updateJsonSnapshot(); //the waiting request reads the snapshot
+      xSemaphoreGive(command->done->semaphore); //the waiting request answers with the state after the command
+    }
+    delete command;
+  }
+}
+
+void SysModWeb::applyJson(JsonDocument &doc, WebClient * client) {
+  if (getResponseObject().size()) { //changes made before: not part of this response (processCommands did already)
+    sendResponseObject();
+    sendValues();
+  }
+  getResponseDoc()->set(doc); //the command is the start of the response. Copied: a move would swap in the allocator of doc, the response doc keeps its JsonBumpArena
+  JsonObject responseObject = getResponseObject();
+
+  bool isOnUI = !responseObject["onUI"].isNull();
+  ui->processJson(responseObject); //adds to responseDoc / responseObject
+
+  if (responseObject.size() && isOnUI) {
+    if (client)
+      sendResponseObject(client); //onUI only send to requesting client
+    else
+      getResponseDoc()->to<JsonObject>(); //requester gone or http: nobody to send to
+  }
+  else if (responseObject.size()) {
+    sendResponseObject(); //to all clients
+    sendValues();
+  }
+  else if (client && !isOnUI) { //for onui we know json.remove(key) is done
+    ppf("wsEvent no responseDoc\n");
+    xSemaphoreTake(wsMutex, portMAX_DELAY);
+    client->text("{\"success\":true}"); // we have to send something back otherwise WS connection closes
+    xSemaphoreGive(wsMutex);
+  }
+}
+
+void SysModWeb::clientConnected(WebClient * client) {
+  //send system constants
+  getResponseObject()["sysInfo"]["board"] = CONFIG_IDF_TARGET;
+  getResponseObject()["sysInfo"]["nrOfPins"] = NUM_DIGITAL_PINS;
+  getResponseObject()["sysInfo"]["pinTypes"].to<JsonArray>();
+  JsonArray pinTypes = getResponseObject()["sysInfo"]["pinTypes"];
+  for (int i=0; i<NUM_DIGITAL_PINS; i++) {
+    pinTypes.add(pinsM->getPinType(i));
+  }
+
+  sendResponseObject(client);
+
+  JsonArray model = mdl->model->as<JsonArray>();
+
+  //inspired by https://github.com/bblanchon/ArduinoJson/issues/1280
+  //store arrayindex and sort order in vector
+  std::vector<ArrayIndexSortValue> aisvs;
+  size_t index = 0;
+  for (JsonObject moduleVar: model) {
+    ArrayIndexSortValue aisv;
+    aisv.index = index++;
+    aisv.value = Variable(moduleVar).order();
+    aisvs.push_back(aisv);
+  }
+  //sort the vector by the order
+  std::sort(aisvs.begin(), aisvs.end(), [](const ArrayIndexSortValue &a, const ArrayIndexSortValue &b) {return a.value < b.value;});
+
+  //stream model per module in chunks (in loop20ms), to stay under websocket size limit of 8192 and keep memory low
+  WSModelStream stream;
+  stream.clientId = client->id();
+  for (const ArrayIndexSortValue &aisv : aisvs) {
+    stream.moduleIndexes.push_back(aisv.index);
+  }
+  xSemaphoreTake(wsMutex, portMAX_DELAY);
+  wsStreams.push_back(stream);
+  xSemaphoreGive(wsMutex);
+}
+
+void SysModWeb::wsBinaryValues(uint32_t clientId, const byte *data, size_t len) {
+  size_t offset = 1; //data[0] is WS_BIN_VALUES
+  while (offset + 4 <= len) {
+    WSValue wsValue;
+    wsValue.handle = data[offset] | (data[offset + 1] << 8);
+    wsValue.tag = data[offset + 2];
+    wsValue.rowNr = data[offset + 3];
+    size_t size = valueSize(wsValue.tag);
+    if (size == 0 || offset + 4 + size > len) {
+      ppf("dev wsBinaryValues client %d invalid record at %d of %d\n", clientId, offset, len);
+      break;
+    }
+    memcpy(wsValue.value, data + offset + 4, size);
+    offset += 4 + size;
+
+    JsonObject var = mdl->findVarByHandle(wsValue.handle);
+    if (var.isNull()) {
+      ppf("dev wsBinaryValues handle %d not found\n", wsValue.handle);
+      continue;
+    }
+
+    mdl->resetPresetThreshold++;
+    setWSValue(Variable(var), wsValue);
+    mdl->resetPresetThreshold--;
+  }
+
+  //changes go to all clients, including the sender to confirm
+  sendResponseObject();
+  sendValues();
+}
+
+void SysModWeb::setWSValue(Variable variable, const WSValue &wsValue) {
+  //a button never sets the value (see processJson)
+  if (variable.var["type"] == "button")
+    variable.triggerEvent(onChange, wsValue.rowNr);
+  else {
+    switch (wsValue.tag) {
+      case vt_bool: variable.setValue((bool)wsValue.value[0], wsValue.rowNr); break;
+      case vt_uint8: variable.setValue((uint8_t)wsValue.value[0], wsValue.rowNr); break;
+      case vt_uint16: variable.setValue((uint16_t)wsValue.value[0], wsValue.rowNr); break;
+      case vt_int32: variable.setValue(wsValue.value[0], wsValue.rowNr); break;
+      case vt_float: {
+        float value;
+        memcpy(&value, &wsValue.value[0], sizeof(value));
+        variable.setValue(value, wsValue.rowNr);
+        break;
+      }
+      case vt_Coord3D: variable.setValue(Coord3D{wsValue.value[0], wsValue.value[1], wsValue.value[2]}, wsValue.rowNr); break;
+    }
+  }
+}
+
 void SysModWeb::sendDataWs(JsonVariant json, WebClient * client) {
 
   size_t len = measureJson(json);
@@ -475,13 +679,7 @@ void SysModWeb::serveIndex(WebRequest *request) {
 
   if (captivePortal(request)) return;
 
-  // if (handleIfNoneMatchCacheHeader(request)) return;
-
-  WebResponse *response;
-  response = request->beginResponse_P(200, "text/html", PAGE_index, PAGE_index_L);
-  response->addHeader("Content-Encoding","gzip");
-  // setStaticContentCacheHeaders(response);
-  request->send(response);
+  sendStatic(request, "text/html", PAGE_index, PAGE_index_L, PAGE_index_ETag);
 
   ppf("!\n");
 }
@@ -491,15 +689,30 @@ void SysModWeb::serveNewUI(WebRequest *request) {
 
   if (captivePortal(request)) return;
 
-  // if (handleIfNoneMatchCacheHeader(request)) return;
+  sendStatic(request, "text/html", PAGE_newui, PAGE_newui_L, PAGE_newui_ETag);
 
-  WebResponse *response;
-  response = request->beginResponse_P(200, "text/html", PAGE_newui, PAGE_newui_L);
-  response->addHeader("Content-Encoding","gzip");
-  // setStaticContentCacheHeaders(response);
+  ppf("!\n");
+}
+
+bool SysModWeb::notModified(WebRequest *request, const char * etag) {
+  if (!request->hasHeader("If-None-Match")) return false;
+  //If-None-Match can hold a list of etags
+  if (request->header("If-None-Match").indexOf(etag) < 0) return false;
+  WebResponse *response = request->beginResponse(304);
+  response->addHeader("ETag", etag);
   request->send(response);
+  return true;
+}
 
-  ppf("!\n");
+void SysModWeb::sendStatic(WebRequest *request, const char * contentType, const uint8_t * content, size_t len, const char * etag, bool immutable) {
+  if (notModified(request, etag)) return;
+
+  WebResponse *response = request->beginResponse_P(200, contentType, content, len);
+  response->addHeader("Content-Encoding","gzip");
+  response->addHeader("ETag", etag);
+  //pages: always revalidate (a 304 is a few bytes), hashed assets: never
+  response->addHeader("Cache-Control", immutable?"public, max-age=31536000, immutable":"no-cache");
+  request->send(response);
 }
 
 void SysModWeb::serveUpload(WebRequest *request, const String& fileName, size_t index, byte *data, size_t len, bool final) {
@@ -507,8 +720,7 @@ void SysModWeb::serveUpload(WebRequest *request, const String& fileName, size_t
   // curl -F 'data=@fixture1.json' 192.168.1.213/upload
   // ppf("serveUpload i:%d l:%d f:%d\n", index, len, final);
 
-  mdl->setValue("Files", "upload", index/50000);
-  sendResponseObject(); //otherwise not send in asyn_tcp thread
+  queueValue("Files", "upload", index/50000);
 
   if (!index) {
     isBusy = true;
@@ -529,33 +741,22 @@ void SysModWeb::serveUpload(WebRequest *request, const String& fileName, size_t
   if (final) {
     request->_tempFile.close();
 
-    mdl->setValue("Files", "upload", UINT16_MAX - 10); //success
-    sendResponseObject(); //otherwise not send in asyn_tcp thread
+    queueValue("Files", "upload", UINT16_MAX - 10); //success
 
     request->send(200, "text/plain", F("File Uploaded!"));
 
-    files->filesChanged = true;
+    files->markChanged(fileName.c_str()); //final size
 
     ppf("File upload %s %s finished\n", request->url().c_str(), fileName.c_str());
 
-    //if sc files send command to live
+    //if sc files send command to live, in loopTask as the files index is refreshed there
     #ifdef STARBASE_USERMOD_LIVE
-
       if (fileName.indexOf(".sc") > 0) {
-        ppf("sc file added %s\n", fileName.c_str());
-        size_t seqNr = UINT8_MAX;
-        files->nameToSeqNr((fileName).c_str(), &seqNr, ".sc");
-
-        if (seqNr != UINT8_MAX) {
-          //now only working for rowNr 0 !!! TBD!
-          mdl->setValue("effect", "script", 0, 0); //kill the old 
-          mdl->setValue("effect", "script", seqNr + 1, 0); //+1 as None is in dropdown
-        }
+        WSCommand *command = new WSCommand();
+        command->kind = ck_upload;
+        command->data.assign(fileName.c_str(), fileName.c_str() + fileName.length() + 1);
+        pushCommand(command);
       }
-
-      // got multiple definition error here ???
-      // if (filename.indexOf(".sc") > 0)
-      //   liveM->run(filename.c_str());
     #endif
 
     isBusy = false;
@@ -566,45 +767,228 @@ void SysModWeb::serveUpdate(WebRequest *request, const String& fileName, size_t
 
   // curl -F 'data=@fixture1.json' 192.168.1.213/upload
   // ppf("serveUpdate r:%s f:%s i:%d l:%d f:%d\n", index, len, final);
-  
-  mdl->setValue("System", "update", index/50000); //therefore about once per second
-  sendResponseObject(); //otherwise not send in asyn_tcp thread
 
   if (!index) {
-    isBusy = true;
+    size_t offset = request->hasParam("offset")?request->getParam("offset")->value().toInt():0;
+
+    if (ota.active && (offset != ota.received || ota.error)) {
+      ppf("OTA Update resume at %d not possible (received %d), restart\n", offset, ota.received);
+      otaStop();
+    }
+
+    if (ota.active) {
+      ppf("OTA Update %s %s resume at %d\n", request->url().c_str(), fileName.c_str(), offset);
+      ota.request = request;
+      ota.size = offset + request->contentLength();
+    } else if (offset) {
+      print->fFormat(ota.message, sizeof(ota.message), "Update resume at %d not possible", offset);
+      ota.request = nullptr;
+    } else if (!otaImageValid(data, len, fileName)) {
+      ota.request = nullptr;
+    } else {
+      ppf("OTA Update %s %s start\n", request->url().c_str(), fileName.c_str());
+      // WLED::instance().disableWatchdog();
+      // usermods.onUpdateBegin(true); // notify usermods that update is about to begin (some may require task de-init)
+      // lastEditTime = millis(); // make sure PIN does not lock during update
+      if (otaStart(request))
+        ota.request = request;
+      else
+        ota.request = nullptr;
+    }
 
-    ppf("OTA Update %s %s start\n", request->url().c_str(), fileName.c_str());
-    // WLED::instance().disableWatchdog();
-    // usermods.onUpdateBegin(true); // notify usermods that update is about to begin (some may require task de-init)
-    // lastEditTime = millis(); // make sure PIN does not lock during update
-    Update.begin((ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000);
+    ota.resumedAt = ota.received;
+    ota.start = millis();
   }
 
-  if (!Update.hasError()) 
-    Update.write(data, len);
-  else {
-    mdl->setValue("System", "update", UINT16_MAX - 20); //fail
-    sendResponseObject(); //otherwise not send in asyn_tcp thread
+  if (request != ota.request) { //not started (or a previous upload)
+    if (final) {
+      ppf("OTA %s\n", ota.message);
+      queueValue("System", "update", UINT16_MAX - 20); //fail
+      request->send(400, "text/plain", ota.message);
+    }
+    return;
+  }
+
+  ota.lastData = millis();
+
+  //copy into the fill buffer, full buffers go to the ota task while the network fills the other
+  while (len && !ota.error) {
+    size_t copy = min(len, OTA_BUFFER_SIZE - ota.lengths[ota.fillNr]);
+    memcpy(ota.buffers[ota.fillNr] + ota.lengths[ota.fillNr], data, copy);
+    ota.lengths[ota.fillNr] += copy;
+    ota.received += copy;
+    data += copy;
+    len -= copy;
+    if (ota.lengths[ota.fillNr] == OTA_BUFFER_SIZE && !otaFlush()) ota.error = true;
   }
 
+  if (!ota.error) {
+    queueValue("System", "update", ota.received/50000); //therefore about once per second
+    otaProgress();
+  } else
+    queueValue("System", "update", UINT16_MAX - 20); //fail
+
   if (final) {
-    bool success = Update.end(true);
-    mdl->setValue("System", "update", success?UINT16_MAX - 10:UINT16_MAX - 20);
-    sendResponseObject(); //otherwise not send in asyn_tcp thread
+    //write the last (partial) buffer and wait till the ota task has written both
+    if (!ota.error && ota.lengths[ota.fillNr] && !otaFlush()) ota.error = true;
+    uint8_t bufferNr;
+    if (!ota.error && xQueueReceive(ota.emptyQueue, &bufferNr, pdMS_TO_TICKS(5000)) != pdTRUE) ota.error = true;
+
+    otaProgress(true);
+    bool success = !ota.error && Update.end(true); //checks the md5 if given
+    if (!success) ppf("OTA Update error %d %s\n", Update.getError(), Update.errorString());
+    otaStop();
+
+    queueValue("System", "update", success?UINT16_MAX - 10:UINT16_MAX - 20);
 
-    char message[64];
-    const char * name = mdl->getValue("System", "name");
+    char name[sizeof(snapshotName)];
+    snapshotNameJson(name, sizeof(name)); //quoted: the model is owned by loopTask
 
-    print->fFormat(message, sizeof(message), "Update of %s (...%d) %s", name, net->localIP()[3], success?"Successful":"Failed");
+    print->fFormat(ota.message, sizeof(ota.message), "Update of %s (...%d) %s", name, net->localIP()[3], success?"Successful":"Failed");
 
-    ppf("%s\n", message);
-    request->send(200, "text/plain", message);
+    ppf("%s\n", ota.message);
+    request->send(success?200:500, "text/plain", ota.message);
 
     // usermods.onUpdateBegin(false); // notify usermods that update has failed (some may require task init)
     // WLED::instance().enableWatchdog();
+  }
+}
 
-    isBusy = false;
+void SysModWeb::serveUpdateState(WebRequest *request) {
+  char json[160];
+  print->fFormat(json, sizeof(json), "{\"active\":%s,\"offset\":%d,\"written\":%d,\"message\":\"%s\"}", ota.active?"true":"false", ota.received, ota.received - ota.lengths[ota.fillNr], ota.message);
+  request->send(200, "application/json", json);
+}
+
+bool SysModWeb::otaImageValid(const byte *data, size_t len, const String& fileName) {
+  esp_image_header_t header;
+  if (len < sizeof(header)) {
+    print->fFormat(ota.message, sizeof(ota.message), "Update %s too short for an image header", fileName.c_str());
+    return false;
+  }
+  memcpy(&header, data, sizeof(header));
+  if (header.magic != ESP_IMAGE_HEADER_MAGIC || header.segment_count == 0 || header.segment_count > ESP_IMAGE_MAX_SEGMENTS) {
+    print->fFormat(ota.message, sizeof(ota.message), "Update %s is not a firmware image", fileName.c_str());
+    return false;
+  }
+  if (header.chip_id != CONFIG_IDF_FIRMWARE_CHIP_ID) {
+    print->fFormat(ota.message, sizeof(ota.message), "Update %s is for chip %d, not %d", fileName.c_str(), header.chip_id, CONFIG_IDF_FIRMWARE_CHIP_ID);
+    return false;
   }
+  return true;
+}
+
+bool SysModWeb::otaStart(WebRequest *request) {
+  if (!Update.begin((ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000)) {
+    print->fFormat(ota.message, sizeof(ota.message), "Update begin failed (%s)", Update.errorString());
+    return false;
+  }
+  if (request->hasParam("md5") && !Update.setMD5(request->getParam("md5")->value().c_str())) {
+    print->fFormat(ota.message, sizeof(ota.message), "Update md5 not valid");
+    Update.abort();
+    return false;
+  }
+
+  ota.buffers[0] = (byte *)malloc(OTA_BUFFER_SIZE);
+  ota.buffers[1] = (byte *)malloc(OTA_BUFFER_SIZE);
+  ota.fullQueue = xQueueCreate(3, sizeof(uint8_t)); //both buffers and OTA_TASK_STOP
+  ota.emptyQueue = xQueueCreate(2, sizeof(uint8_t));
+  ota.stopped = xSemaphoreCreateBinary();
+
+  ota.active = true; //otaStop frees what is allocated
+  ota.error = false;
+  ota.lengths[0] = 0;
+  ota.lengths[1] = 0;
+  ota.fillNr = 0;
+  ota.received = 0;
+  ota.size = request->contentLength();
+  ota.flashMicros = 0;
+  ota.lastReport = 0;
+
+  if (!ota.buffers[0] || !ota.buffers[1] || !ota.fullQueue || !ota.emptyQueue || !ota.stopped) {
+    print->fFormat(ota.message, sizeof(ota.message), "Update out of memory");
+    otaStop();
+    return false;
+  }
+
+  uint8_t bufferNr = 1;
+  xQueueSend(ota.emptyQueue, &bufferNr, 0); //0 is filled first
+
+  //writes a full buffer while AsyncTCP receives the next one, higher priority than AsyncTCP so a buffer is always ready
+  if (xTaskCreatePinnedToCore([](void *parameter) {
+    OTAState *ota = (OTAState *)parameter;
+    uint8_t bufferNr;
+    for (;;) {
+      if (xQueueReceive(ota->fullQueue, &bufferNr, portMAX_DELAY) != pdTRUE) continue;
+      if (bufferNr == OTA_TASK_STOP) break; //after the buffers queued before
+      if (!ota->error) {
+        unsigned long start = micros();
+        if (Update.write(ota->buffers[bufferNr], ota->lengths[bufferNr]) != ota->lengths[bufferNr]) ota->error = true;
+        ota->flashMicros += micros() - start;
+      }
+      ota->lengths[bufferNr] = 0;
+      xQueueSend(ota->emptyQueue, &bufferNr, portMAX_DELAY);
+    }
+    xSemaphoreGive(ota->stopped); //ota is not used anymore
+    vTaskDelete(nullptr);
+  }, "ota", 4096, &ota, configMAX_PRIORITIES - 2, &ota.task, tskNO_AFFINITY) != pdPASS) {
+    ota.task = nullptr;
+    print->fFormat(ota.message, sizeof(ota.message), "Update task not started");
+    otaStop();
+    return false;
+  }
+
+  isBusy = true;
+  return true;
+}
+
+bool SysModWeb::otaFlush() {
+  xQueueSend(ota.fullQueue, &ota.fillNr, portMAX_DELAY); //2 places: never full
+  //the other buffer: free already or written in the meantime (a flash sector takes up to ~50ms to erase)
+  if (xQueueReceive(ota.emptyQueue, &ota.fillNr, pdMS_TO_TICKS(5000)) != pdTRUE) {
+    ppf("dev OTA flash write timeout\n");
+    return false;
+  }
+  return true;
+}
+
+void SysModWeb::otaStop() {
+  if (ota.task) { //the task exits itself when done, a write still in progress (after a flush timeout) is finished first
+    uint8_t bufferNr = OTA_TASK_STOP;
+    xQueueSend(ota.fullQueue, &bufferNr, portMAX_DELAY); //3 places: never full
+    xSemaphoreTake(ota.stopped, portMAX_DELAY);
+    ota.task = nullptr;
+  }
+  if (Update.isRunning()) Update.abort(); //not ended
+  if (ota.fullQueue) {vQueueDelete(ota.fullQueue); ota.fullQueue = nullptr;}
+  if (ota.emptyQueue) {vQueueDelete(ota.emptyQueue); ota.emptyQueue = nullptr;}
+  if (ota.stopped) {vSemaphoreDelete(ota.stopped); ota.stopped = nullptr;}
+  free(ota.buffers[0]); ota.buffers[0] = nullptr;
+  free(ota.buffers[1]); ota.buffers[1] = nullptr;
+  ota.active = false;
+  ota.request = nullptr; //chunks still coming are ignored
+  isBusy = false;
+}
+
+void SysModWeb::otaProgress(bool force) {
+  unsigned long now = millis();
+  if (!force && now - ota.lastReport < 1000) return;
+  ota.lastReport = now;
+
+  uint8_t percentage = ota.size?min(ota.received * 100 / ota.size, (size_t)100):0;
+  queueValue("System", "otaProgress", percentage);
+  ota.reportPending = true;
+}
+
+void SysModWeb::otaReport() {
+  ota.reportPending = false;
+  //fields written by AsyncTCP and the ota task, each one consistent, together about
+  unsigned long elapsed = max(ota.lastReport - ota.start, 1UL);
+  uint32_t rate = (ota.received - ota.resumedAt) / elapsed; //bytes per ms is about KB/s
+
+  char comment[64];
+  print->fFormat(comment, sizeof(comment), "%d KB of %d KB, %d KB/s, flash %d%%", ota.received / 1024, ota.size / 1024, rate, min(ota.flashMicros / 10 / elapsed, 100UL));
+  addResponse(Variable("System", "otaProgress").var, "comment", "%s", comment); //comment contains %
 }
 
 void SysModWeb::serveFiles(WebRequest *request) {
@@ -612,41 +996,102 @@ void SysModWeb::serveFiles(WebRequest *request) {
   const char * urlString = request->url().c_str();
   const char * path = urlString + strnlen("/file", 6); //remove the uri from the path (skip their positions)
   ppf("fileServer request %s\n", path);
-  if(LittleFS.exists(path)) {
-    isBusy = true;
-    request->send(LittleFS, path, "text/plain");//"application/json");
-    isBusy = false;
+  if(!LittleFS.exists(path)) {
+    request->send(404);
+    return;
   }
+
+  File file = files->open(path, FILE_READ);
+  if (!file) {
+    request->send(500);
+    return;
+  }
+  size_t fileSize = file.size();
+
+  char etag[24];
+  snprintf(etag, sizeof(etag), "\"%x-%lx\"", fileSize, (unsigned long)file.getLastWrite());
+  if (notModified(request, etag)) {
+    file.close();
+    return;
+  }
+
+  //Range: bytes=start-end, bytes=start- or bytes=-suffix (one range)
+  size_t start = 0, end = fileSize?fileSize - 1:0;
+  bool isRange = false;
+  if (request->hasHeader("Range") && fileSize) {
+    String range = request->header("Range");
+    int dash = range.indexOf('-');
+    if (range.startsWith("bytes=") && dash > 0 && range.indexOf(',') < 0) {
+      String first = range.substring(6, dash);
+      String last = range.substring(dash + 1);
+      if (first.length()) {
+        start = first.toInt();
+        if (last.length()) end = min((size_t)last.toInt(), fileSize - 1);
+      } else if (last.length())
+        start = fileSize - min((size_t)last.toInt(), fileSize);
+      if (start > end) {
+        WebResponse *response = request->beginResponse(416);
+        char contentRange[32];
+        snprintf(contentRange, sizeof(contentRange), "bytes */%u", fileSize);
+        response->addHeader("Content-Range", contentRange);
+        request->send(response);
+        file.close();
+        return;
+      }
+      isRange = true;
+    }
+  }
+
+  isBusy = true;
+  //the file is read in chunks while AsyncTCP sends, not loaded at once
+  WebResponse *response = request->beginResponse("text/plain", fileSize?end - start + 1:0, [file, start](uint8_t *buffer, size_t maxLen, size_t index) mutable -> size_t {
+    if (!file.seek(start + index)) return 0;
+    return file.read(buffer, maxLen);
+  }); //the file closes when the response (holding the last copy) is deleted
+  response->addHeader("ETag", etag);
+  response->addHeader("Accept-Ranges", "bytes");
+  response->addHeader("Cache-Control", "no-cache");
+  if (isRange) {
+    response->setCode(206);
+    char contentRange[48];
+    snprintf(contentRange, sizeof(contentRange), "bytes %u-%u/%u", start, end, fileSize);
+    response->addHeader("Content-Range", contentRange);
+  }
+  request->send(response);
+  isBusy = false;
 }
 
 void SysModWeb::jsonHandler(WebRequest *request, JsonVariant json) {
 
   print->printJson("jsonHandler", json);
 
-  JsonObject responseObject = getResponseObject();
-
-  ui->processJson(json);
-
-  //WLED compatibility
-  if (json["v"]) { //WLED compatibility: verbose response
-    serveJson (request); //includes values just updated by processJson e.g. Bri
+  //applied by loopTask, responses go to the ws clients
+  WSCommand *command = new WSCommand();
+  command->kind = ck_http;
+  if (json.is<JsonObject>()) command->doc.set(json);
+  bool verbose = json["v"];
+
+  //WLED compatibility: verbose response with the state after the command, so wait until loopTask applied it (next loop, blocks AsyncTCP meanwhile)
+  std::shared_ptr<CommandDone> done;
+  if (verbose && command->doc.is<JsonObject>()) {
+    done = std::make_shared<CommandDone>();
+    command->done = done;
   }
-  else {
-  
-    if (responseObject.size()) { //responseObject set by processJson e.g. onUI
-
-      char resStr[200];
-      serializeJson(responseObject, resStr, sizeof(resStr));
-      ppf("processJsonUrl response %s\n", resStr);
-      request->send(200, "application/json", resStr);
 
-    }
+  if (!command->doc.is<JsonObject>()) {
+    delete command;
+    request->send(400, "application/json", F("{\"success\":false}"));
+  }
+  else if (!pushCommand(command))
+    request->send(503, "application/json", F("{\"success\":false}"));
+  else if (done) {
+    if (xSemaphoreTake(done->semaphore, pdMS_TO_TICKS(JSON_APPLY_TIMEOUT)) == pdTRUE)
+      serveJson (request);
     else
-      // request->send(200, "text/plain", "OK");
-      request->send(200, "application/json", F("{\"success\":true}"));
+      request->send(503, "application/json", F("{\"success\":false}")); //loopTask busy, applied later
   }
-
-  sendResponseObject();
+  else
+    request->send(200, "application/json", F("{\"success\":true}"));
 }
 
 void SysModWeb::clientsToJson(JsonArray array, bool nameOnly, const char * filter) {
@@ -683,15 +1128,40 @@ bool SysModWeb::captivePortal(WebRequest *request)
   return false;
 }
 
-JsonDocument * SysModWeb::getResponseDoc() {
-  // ppf("response wsevent core %d %s\n", xPortGetCoreID(), pcTaskGetTaskName(nullptr));
-
-  // return responseDocLoopTask;
-  return strncmp(pcTaskGetTaskName(nullptr), "loopTask", 8) == 0?responseDocLoopTask:responseDocAsyncTCP;
+bool SysModWeb::addResponseContext() {
+  TaskHandle_t task = xTaskGetCurrentTaskHandle();
+  bool result = false;
+  xSemaphoreTake(wsMutex, portMAX_DELAY);
+  for (ResponseContext &context: responseContexts) {
+    if (context.task == task) {result = true; break;} //already
+    if (context.task == nullptr) {
+      context.arena = new JsonBumpArena(pcTaskGetTaskName(nullptr));
+      context.doc = new JsonDocument(context.arena); context.doc->to<JsonObject>();
+      context.task = task; //last: lookups without the mutex see a complete context
+      result = true;
+      break;
+    }
+  }
+  xSemaphoreGive(wsMutex);
+  if (!result) ppf("dev addResponseContext no free context for %s\n", pcTaskGetTaskName(nullptr));
+  return result;
 }
 
-JsonObject SysModWeb::getResponseObject() {
-  return getResponseDoc()->as<JsonObject>();
+void SysModWeb::flushResponses() {
+  ResponseContext *context = getResponseContext();
+  if (!context) return;
+  //all changes since last send in one message (per client), max maxRate per second
+  if (millis() - context->flushMillis >= 1000 / max(maxRate, (uint16_t)1)) {
+    context->flushMillis = millis();
+    //changed hot vars, from their shadow
+    shadows.drain(ss_web, [this, context](uint16_t handle) {
+      WSValue wsValue;
+      wsValue.rowNr = UINT8_MAX;
+      if (shadows.get(handle, wsValue)) mergeValue(context->values, wsValue);
+    });
+    sendResponseObject();
+    sendValues(); //after the json responses as these values are newer
+  }
 }
 
 void SysModWeb::sendResponseObject(WebClient * client) {
@@ -716,95 +1186,499 @@ void SysModWeb::sendResponseObject(WebClient * client) {
     //   ppf("\n");
     // }
 
-    size_t len = measureJson(responseObject);
-    AsyncWebSocketMessageBuffer * wsBuf = ws.makeBuffer(len); //assert failed: block_trim_free heap_tlsf.c:371 (block_is_free(block) && "block must be free"), AsyncWebSocket::makeBuffer(unsigned int)
-    if (wsBuf) {
-      wsBuf->lock();
+    xSemaphoreTake(wsMutex, portMAX_DELAY);
 
-      serializeJson(responseObject, wsBuf->get(), len);
+    AsyncWebSocketMessageBuffer * wsBuf = nullptr; //made if needed, shared by all clients which are ready
+    size_t len = 0;
 
-      sendBuffer(wsBuf, false, client); //text
+    for (auto &loopClient:ws.getClients()) {
+      if ((client && client != loopClient) || loopClient->status() != WS_CONNECTED) continue;
 
-      wsBuf->unlock();
-      ws._cleanBuffers();
-    }
-    else {
-      ppf("sendDataWs WS buffer allocation failed\n");
-      ws.closeAll(1013); //code 1013 = temporary overload, try again later
-      ws.cleanupClients(0); //disconnect ALL clients to release memory
-      ws._cleanBuffers();
+      WSPending *pending = nullptr;
+      for (WSPending &wsp: wsPending) if (wsp.clientId == loopClient->id()) pending = &wsp;
+
+      if (!pending && clientReady(loopClient)) {
+        if (!wsBuf) {
+          len = measureJson(responseObject);
+          wsBuf = ws.makeBuffer(len); //assert failed: block_trim_free heap_tlsf.c:371 (block_is_free(block) && "block must be free"), AsyncWebSocket::makeBuffer(unsigned int)
+          if (!wsBuf) {
+            ppf("sendDataWs WS buffer allocation failed\n");
+            ws.closeAll(1013); //code 1013 = temporary overload, try again later
+            ws.cleanupClients(0); //disconnect ALL clients to release memory
+            wsPending.clear();
+            break;
+          }
+          wsBuf->lock();
+          serializeJson(responseObject, wsBuf->get(), len);
+        }
+        loopClient->text(wsBuf);
+        sendWsCounter++;
+        sendWsTBytes+=len;
+      }
+      else {
+        //client is behind: merge in its pending deltas, intermediate values of the same var are collapsed
+        if (!pending) {
+          wsPending.push_back({loopClient->id(), JsonDocument()});
+          pending = &wsPending.back();
+          pending->doc.to<JsonObject>();
+        }
+        sendWsCoalesced += mergeDelta(pending->doc.as<JsonObject>(), responseObject);
+        if (measureJson(pending->doc) > maxPending) {
+          ppf("sendResponseObject client %d too far behind, %d deltas dropped\n", loopClient->id(), pending->doc.size());
+          sendWsDropped += pending->doc.size();
+          pending->doc.to<JsonObject>(); //client gets new values only
+        }
+      }
     }
 
-    getResponseDoc()->to<JsonObject>(); //recreate!
+    if (wsBuf) wsBuf->unlock();
+    ws._cleanBuffers();
+
+    xSemaphoreGive(wsMutex);
+
+    getResponseDoc()->to<JsonObject>(); //recreate! (not null as responseObject has elements)
   }
 }
 
-void SysModWeb::serializeState(JsonVariant root) {
-    const char* jsonState;// = "{\"transition\":7,\"ps\":9,\"pl\":-1,\"nl\":{\"on\":false,\"dur\":60,\"mode\":1,\"tbri\":0,\"rem\":-1},\"udpn\":{\"send\":false,\"recv\":true},\"lor\":0,\"mainseg\":0,\"seg\":[{\"id\":0,\"start\":0,\"stop\":144,\"len\":144,\"grp\":1,\"spc\":0,\"of\":0,\"on\":true,\"frz\":false,\"bri\":255,\"cct\":127,\"col\":[[182,15,98,0],[0,0,0,0],[255,224,160,0]],\"fx\":0,\"sx\":128,\"ix\":128,\"pal\":11,\"c1\":8,\"c2\":20,\"c3\":31,\"sel\":true,\"rev\":false,\"mi\":false,\"o1\":false,\"o2\":false,\"o3\":false,\"ssim\":0,\"mp12\":1}]}";
-    jsonState = "{\"on\":true,\"bri\":60,\"transition\":7,\"ps\":1,\"pl\":-1,\"AudioReactive\":{\"on\":true},\"nl\":{\"on\":false,\"dur\":60,\"mode\":1,\"tbri\":0,\"rem\":-1},\"udpn\":{\"send\":false,\"recv\":true,\"sgrp\":1,\"rgrp\":1},\"lor\":0,\"mainseg\":0,\"seg\":[{\"id\":0,\"start\":0,\"stop\":16,\"startY\":0,\"stopY\":16,\"len\":16,\"grp\":1,\"spc\":0,\"of\":0,\"on\":true,\"frz\":false,\"bri\":255,\"cct\":127,\"set\":0,\"col\":[[255,160,0],[0,0,0],[0,255,200]],\"fx\":139,\"sx\":240,\"ix\":236,\"pal\":11,\"c1\":255,\"c2\":64,\"c3\":16,\"sel\":true,\"rev\":false,\"mi\":false,\"rY\":false,\"mY\":false,\"tp\":false,\"o1\":false,\"o2\":true,\"o3\":false,\"si\":0,\"m12\":0}],\"ledmap\":0}";
-    JsonDocument docState;
-    deserializeJson(root, jsonState);
+void SysModWeb::addResponseValue(JsonObject var, uint8_t rowNr) {
+  if (!responsesNeeded()) return;
+  ResponseContext *context = getResponseContext();
+  if (!context) return; //task without responses
 
-    //tbd:  //StarBase has no idea about leds so this should be led independent
-    root["bri"] = mdl->getValue("Fixture", "brightness");
-    root["on"] = mdl->getValue("Fixture", "on").as<bool>();
+  WSValue wsValue;
+  if (toWSValue(var, rowNr, wsValue)) {
+    mergeValue(context->values, wsValue);
+  }
+  else {
+    //a binary value of the same var would be send after the json and overwrite this newer value
+    if (!var["h"].isNull() && !context->values.empty()) {
+      uint16_t handle = var["h"];
+      context->values.erase(std::remove_if(context->values.begin(), context->values.end(), [handle](const WSValue &v) {return v.handle == handle;}), context->values.end());
+    }
+    addResponse(var, "value", Variable(var).value());
+  }
+}
 
+void SysModWeb::addResponseRows(JsonObject var, const uint8_t *rowNrs, uint8_t count) {
+  if (!responsesNeeded()) return;
+  ResponseContext *context = getResponseContext();
+  if (!context) return; //task without responses
+
+  //binary values of the same var would be send after the json and overwrite these newer rows
+  if (!var["h"].isNull() && !context->values.empty()) {
+    uint16_t handle = var["h"];
+    context->values.erase(std::remove_if(context->values.begin(), context->values.end(), [handle](const WSValue &v) {return v.handle == handle;}), context->values.end());
+  }
+
+  JsonObject responseObject = getResponseObject();
+  char pidid[64];
+  print->fFormat(pidid, sizeof(pidid), "%s.%s", var["pid"].as<const char *>(), var["id"].as<const char *>());
+  JsonArray valArray = Variable(var).valArray();
+  if (responseObject[pidid]["value"].is<JsonArray>()) { //already the whole column in this response: keep it up to date
+    responseObject[pidid]["value"] = valArray;
+    return;
+  }
+  if (!responseObject[pidid]["rows"].is<JsonObject>()) responseObject[pidid]["rows"].to<JsonObject>();
+  JsonObject rows = responseObject[pidid]["rows"]; //merged with the rows of an earlier setValues
+  for (uint8_t index = 0; index < count; index++) {
+    char rowKey[4];
+    print->fFormat(rowKey, sizeof(rowKey), "%d", rowNrs[index]);
+    rows[rowKey] = valArray[rowNrs[index]];
+  }
+  responseObject[pidid]["length"] = valArray.size();
 }
-void SysModWeb::serializeInfo(JsonVariant root) {
-    const char * jsonInfo = "{\"ver\":\"0.14.1-b30.36\",\"rel\":\"abc_wled_controller_v43_M\",\"vid\":2402252,\"leds\":{\"count\":1024,\"countP\":1024,\"pwr\":1124,\"fps\":32,\"maxpwr\":9500,\"maxseg\":32,\"matrix\":{\"w\":32,\"h\":32},\"seglc\":[1],\"lc\":1,\"rgbw\":false,\"wv\":0,\"cct\":0},\"str\":false,\"name\":\"WLED-Wladi\",\"udpport\":21324,\"live\":false,\"liveseg\":-1,\"lm\":\"\",\"lip\":\"\",\"ws\":2,\"fxcount\":195,\"palcount\":75,\"cpalcount\":0,\"maps\":[{\"id\":0}],\"outputs\":[1024],\"wifi\":{\"bssid\":\"\",\"rssi\":0,\"signal\":100,\"channel\":1},\"fs\":{\"u\":20,\"t\":983,\"pmt\":0},\"ndc\":16,\"arch\":\"esp32\",\"core\":\"v3.3.6-16-gcc5440f6a2\",\"lwip\":0,\"totalheap\":294784,\"getflash\":4194304,\"freeheap\":115988,\"freestack\":6668,\"minfreeheap\":99404,\"e32core0code\":12,\"e32core0text\":\"SW restart\",\"e32core1code\":12,\"e32core1text\":\"SW restart\",\"e32code\":4,\"e32text\":\"SW error (panic or exception)\",\"e32model\":\"ESP32-D0WDQ5 rev.3\",\"e32cores\":2,\"e32speed\":240,\"e32flash\":4,\"e32flashspeed\":80,\"e32flashmode\":2,\"e32flashtext\":\" (DIO)\",\"uptime\":167796,\"opt\":79,\"brand\":\"WLED\",\"product\":\"MoonModules\"}";
-    JsonDocument docInfo;
 
-    deserializeJson(root, jsonInfo);
+bool SysModWeb::toWSValue(JsonObject var, uint8_t rowNr, WSValue &wsValue) {
+  if (var["h"].isNull()) return false;
 
-    root["name"] = mdl->getValue("System", "name");
-    // docInfo["arch"] = "esp32"; //platformName
+  wsValue.handle = var["h"];
+  wsValue.rowNr = rowNr;
+  return valueToWSValue(Variable(var).value(rowNr), wsValue);
+}
 
-    // docInfo["rel"] = _INIT(TOSTRING(APP));
-    // docInfo["ver"] = "0.0.1";
-    // docInfo["vid"] = 2025121212; //WLED-native needs int otherwise status offline!!!
-    // docInfo["leds"]["count"] = 999; //StarBase has no idea about leds
-    // docInfo["leds"]["countP"] = 998;  //StarBase has no idea about leds
-    // docInfo["leds"]["fps"] = mdl->getValue("fps"); //tbd: should be realFps but is ro var
-    // docInfo["wifi"]["rssi"] = WiFi.RSSI();// mdl->getValue("rssi"); (ro)
+bool SysModWeb::valueToWSValue(JsonVariant value, WSValue &wsValue) {
+  if (value.is<bool>()) {
+    wsValue.tag = vt_bool;
+    wsValue.value[0] = value.as<bool>();
+  }
+  else if (value.is<int32_t>()) {
+    wsValue.value[0] = value;
+    wsValue.tag = (wsValue.value[0] >= 0 && wsValue.value[0] <= UINT8_MAX)?vt_uint8:(wsValue.value[0] >= 0 && wsValue.value[0] <= UINT16_MAX)?vt_uint16:vt_int32;
+  }
+  else if (value.is<float>() && !value.is<uint32_t>()) { //not an integer above int32
+    float f = value;
+    wsValue.tag = vt_float;
+    memcpy(&wsValue.value[0], &f, sizeof(f));
+  }
+  else if (value.is<JsonObject>() && value["x"].is<int32_t>() && value["y"].is<int32_t>() && value["z"].is<int32_t>() && value.size() == 3) {
+    wsValue.tag = vt_Coord3D;
+    wsValue.value[0] = value["x"];
+    wsValue.value[1] = value["y"];
+    wsValue.value[2] = value["z"];
+  }
+  else
+    return false; //strings, arrays, null etc: json
+  return true;
+}
 
-    root["mac"] = JsonString(mdns->escapedMac.c_str());
-    root["ip"] = JsonString(net->localIP().toString().c_str());
-    // print->printJson("serveJson", root);
+bool SysModWeb::mergeValue(std::vector<WSValue> &values, const WSValue &wsValue) {
+  for (WSValue &v: values) {
+    if (v.handle == wsValue.handle && v.rowNr == wsValue.rowNr) {
+      v = wsValue;
+      return true;
+    }
+  }
+  values.push_back(wsValue);
+  return false;
 }
 
-void SysModWeb::serveJson(WebRequest *request) {
+size_t SysModWeb::serializeValues(const std::vector<WSValue> &values, byte *buffer) {
+  size_t len = 1;
+  if (buffer) buffer[0] = WS_BIN_VALUES;
+  for (const WSValue &wsValue: values) {
+    size_t size = valueSize(wsValue.tag);
+    if (buffer) {
+      buffer[len] = wsValue.handle & 0xFF;
+      buffer[len + 1] = wsValue.handle >> 8;
+      buffer[len + 2] = wsValue.tag;
+      buffer[len + 3] = wsValue.rowNr;
+      memcpy(buffer + len + 4, wsValue.value, size); //ESP32 is little endian: the lower bytes of value
+    }
+    len += 4 + size;
+  }
+  return len;
+}
 
-  AsyncJsonResponse * response;
+void SysModWeb::sendValues() {
+  ResponseContext *context = getResponseContext();
+  if (!context || context->values.empty()) return;
+  std::vector<WSValue> &wsValues = context->values;
 
-  // return model.json
-  if (request->url().indexOf("mdl") > 0) {
-    JsonArray model = mdl->model->as<JsonArray>();
-    ppf("serveJson model ...%d, %s %d %d\n", request->client()->remoteIP()[3], request->url().c_str(), model.size(),  measureJson(model));
+  xSemaphoreTake(wsMutex, portMAX_DELAY);
 
-    response = new AsyncJsonResponse(true); //array, removed size as ArduinoJson v7 doesnt care (tbd: here copy is mode, see WLED for using reference)
-    JsonArray root = response->getRoot();
+  AsyncWebSocketMessageBuffer * wsBuf = nullptr; //made if needed, shared by all clients which are ready
+  size_t len = 0;
 
-    root.set(model);
-  } else { //WLED compatible
-    ppf("serveJson ...%d, %s\n", request->client()->remoteIP()[3], request->url().c_str());
-    response = new AsyncJsonResponse(false); //object. removed size as ArduinoJson v7 doesnt care
-    JsonVariant root = response->getRoot();
+  for (auto &loopClient:ws.getClients()) {
+    if (loopClient->status() != WS_CONNECTED) continue;
+
+    WSPending *pending = nullptr;
+    for (WSPending &wsp: wsPending) if (wsp.clientId == loopClient->id()) pending = &wsp;
+
+    if (!pending && clientReady(loopClient)) {
+      if (!wsBuf) {
+        len = serializeValues(wsValues);
+        wsBuf = ws.makeBuffer(len);
+        if (!wsBuf) {
+          ppf("sendValues WS buffer allocation failed\n");
+          ws.closeAll(1013); //code 1013 = temporary overload, try again later
+          ws.cleanupClients(0); //disconnect ALL clients to release memory
+          wsPending.clear();
+          break;
+        }
+        wsBuf->lock();
+        serializeValues(wsValues, wsBuf->get());
+      }
+      loopClient->binary(wsBuf);
+      sendWsCounter++;
+      sendWsBBytes+=len;
+    }
+    else {
+      //client is behind: merge in its pending values, intermediate values of the same var are collapsed
+      if (!pending) {
+        wsPending.push_back({loopClient->id(), JsonDocument()});
+        pending = &wsPending.back();
+        pending->doc.to<JsonObject>();
+      }
+      for (const WSValue &wsValue: wsValues)
+        if (mergeValue(pending->values, wsValue)) sendWsCoalesced++;
+      if (pending->values.size() * sizeof(WSValue) > maxPending) {
+        ppf("sendValues client %d too far behind, %d values dropped\n", loopClient->id(), pending->values.size());
+        sendWsDropped += pending->values.size();
+        pending->values.clear(); //client gets new values only
+      }
+    }
+  }
+
+  if (wsBuf) wsBuf->unlock();
+  ws._cleanBuffers();
+
+  xSemaphoreGive(wsMutex);
+
+  wsValues.clear();
+}
+
+AsyncWebSocketMessageBuffer * SysModWeb::freeChunk() {
+  for (AsyncWebSocketMessageBuffer * wsBuf: chunkPool)
+    if (wsBuf->count() == 0) return wsBuf; //sent (or dropped), reuse
+  if (chunkPool.size() >= maxChunks) return nullptr; //all in transit
+  AsyncWebSocketMessageBuffer * wsBuf = ws.makeBuffer(chunkSize);
+  if (wsBuf) {
+    wsBuf->lock(); //kept by _cleanBuffers until the streams are done
+    chunkPool.push_back(wsBuf);
+  }
+  return wsBuf;
+}
 
-    //temporary set all WLED variables (as otherwise WLED-native does not show the instance): tbd: clean up (state still needed, info not)
+void SysModWeb::streamModel() {
+  if (wsStreams.empty()) return;
 
-    if (request->url().indexOf("state") > 0) {
-      serializeState(root);
+  xSemaphoreTake(wsMutex, portMAX_DELAY);
+
+  for (std::vector<WSModelStream>::iterator it=wsStreams.begin(); it!=wsStreams.end();) {
+    WebClient *client = ws.client(it->clientId);
+    bool done = !client || client->status() != WS_CONNECTED; //client left
+
+    //next chunk as long as the client keeps up: header WS_BIN_MODEL, last
+    while (!done && clientReady(client)) {
+      if (it->offset >= it->json.length()) {
+        if (it->moduleNr >= it->moduleIndexes.size()) {
+          done = true; //all modules sent
+          break;
+        }
+        //serialize one module at a time per client, in one go so values are consistent over its chunks
+        it->json = "";
+        it->offset = 0;
+        if (!serializeJson(mdl->model->as<JsonArray>()[it->moduleIndexes[it->moduleNr]], it->json)) {
+          ppf("streamModel module allocation failed\n");
+          break; //try again next time
+        }
+        it->moduleNr++;
+      }
+
+      size_t len = min(it->json.length() - it->offset, (size_t)chunkSize - 2);
+      bool last = it->offset + len == it->json.length();
+      //full chunks from the pool, the remainder of a module in a buffer of its size
+      AsyncWebSocketMessageBuffer * wsBuf = (len + 2 == chunkSize)?freeChunk():ws.makeBuffer(len + 2);
+      if (!wsBuf) break; //try again next time
+
+      byte* buffer = wsBuf->get();
+      buffer[0] = WS_BIN_MODEL;
+      buffer[1] = last;
+      memcpy(buffer + 2, it->json.c_str() + it->offset, len);
+      client->binary(wsBuf);
+      sendWsCounter++;
+      sendWsBBytes+=wsBuf->length();
+      it->offset += len;
     }
-    else if (request->url().indexOf("info") > 0) {
-      serializeInfo(root);
+
+    if (done)
+      it = wsStreams.erase(it);
+    else
+      ++it;
+  }
+
+  if (wsStreams.empty()) { //release the pool, removed by _cleanBuffers after sent
+    for (AsyncWebSocketMessageBuffer * wsBuf: chunkPool) wsBuf->unlock();
+    chunkPool.clear();
+  }
+
+  ws._cleanBuffers();
+
+  xSemaphoreGive(wsMutex);
+}
+
+size_t SysModWeb::mergeDelta(JsonObject dest, JsonObject src) {
+  size_t overwritten = 0;
+  for (JsonPair pair: src) {
+    JsonVariant destValue = dest[pair.key()];
+    if (destValue.isNull())
+      dest[pair.key()] = pair.value();
+    else if (destValue.is<JsonObject>() && pair.value().is<JsonObject>()) //e.g. pid.id: merge value, comment, options etc
+      overwritten += mergeDelta(destValue.as<JsonObject>(), pair.value().as<JsonObject>());
+    else if (strcmp(pair.key().c_str(), "value") == 0 && destValue.is<JsonArray>() && pair.value().is<JsonArray>()) { //value per rowNr: merge the rows set
+      JsonArray destArray = destValue.as<JsonArray>();
+      size_t rowNr = 0;
+      for (JsonVariant element: pair.value().as<JsonArray>()) {
+        if (!element.isNull()) {
+          if (rowNr < destArray.size() && !destArray[rowNr].isNull()) overwritten++;
+          destArray[rowNr] = element;
+        }
+        rowNr++;
+      }
     }
     else {
-      root["state"] = ""; root["info"] = ""; //init otherwise result is {}
-      serializeState(root["state"]);
-      serializeInfo(root["info"]);
+      dest[pair.key()] = pair.value();
+      overwritten++;
+    }
+  }
+  return overwritten;
+}
+
+void SysModWeb::sendPending() {
+  if (wsPending.empty()) return;
+
+  xSemaphoreTake(wsMutex, portMAX_DELAY);
+
+  for (std::vector<WSPending>::iterator it=wsPending.begin(); it!=wsPending.end();) {
+    WebClient *client = ws.client(it->clientId);
+    if (!client || client->status() != WS_CONNECTED) { //client left
+      sendWsDropped += it->doc.size() + it->values.size();
+      it = wsPending.erase(it);
+    }
+    else if (clientReady(client)) {
+      //json first, then the (newer) binary values
+      if (it->doc.size()) {
+        size_t len = measureJson(it->doc);
+        AsyncWebSocketMessageBuffer * wsBuf = ws.makeBuffer(len);
+        if (wsBuf) {
+          wsBuf->lock();
+          serializeJson(it->doc, wsBuf->get(), len);
+          client->text(wsBuf);
+          sendWsCounter++;
+          sendWsTBytes+=len;
+          wsBuf->unlock();
+          ws._cleanBuffers();
+          it->doc.to<JsonObject>();
+        }
+      }
+      if (it->doc.size() == 0 && !it->values.empty()) {
+        size_t len = serializeValues(it->values);
+        AsyncWebSocketMessageBuffer * wsBuf = ws.makeBuffer(len);
+        if (wsBuf) {
+          wsBuf->lock();
+          serializeValues(it->values, wsBuf->get());
+          client->binary(wsBuf);
+          sendWsCounter++;
+          sendWsBBytes+=len;
+          wsBuf->unlock();
+          ws._cleanBuffers();
+          it->values.clear();
+        }
+      }
+      if (it->doc.size() == 0 && it->values.empty())
+        it = wsPending.erase(it);
+      else
+        ++it; //try again next time
     }
+    else
+      ++it;
   }
 
-  response->setLength();
+  xSemaphoreGive(wsMutex);
+}
+
+//constant part of the WLED state and info (what WLED-native needs to show the instance), the live fields are written in front
+static const char jsonStateRest[] = "\"transition\":7,\"ps\":1,\"pl\":-1,\"AudioReactive\":{\"on\":true},\"nl\":{\"on\":false,\"dur\":60,\"mode\":1,\"tbri\":0,\"rem\":-1},\"udpn\":{\"send\":false,\"recv\":true,\"sgrp\":1,\"rgrp\":1},\"lor\":0,\"mainseg\":0,\"seg\":[{\"id\":0,\"start\":0,\"stop\":16,\"startY\":0,\"stopY\":16,\"len\":16,\"grp\":1,\"spc\":0,\"of\":0,\"on\":true,\"frz\":false,\"bri\":255,\"cct\":127,\"set\":0,\"col\":[[255,160,0],[0,0,0],[0,255,200]],\"fx\":139,\"sx\":240,\"ix\":236,\"pal\":11,\"c1\":255,\"c2\":64,\"c3\":16,\"sel\":true,\"rev\":false,\"mi\":false,\"rY\":false,\"mY\":false,\"tp\":false,\"o1\":false,\"o2\":true,\"o3\":false,\"si\":0,\"m12\":0}],\"ledmap\":0}";
+static const char jsonInfoRest[] = "\"ver\":\"0.14.1-b30.36\",\"rel\":\"abc_wled_controller_v43_M\",\"vid\":2402252,\"leds\":{\"count\":1024,\"countP\":1024,\"pwr\":1124,\"fps\":32,\"maxpwr\":9500,\"maxseg\":32,\"matrix\":{\"w\":32,\"h\":32},\"seglc\":[1],\"lc\":1,\"rgbw\":false,\"wv\":0,\"cct\":0},\"str\":false,\"udpport\":21324,\"live\":false,\"liveseg\":-1,\"lm\":\"\",\"lip\":\"\",\"ws\":2,\"fxcount\":195,\"palcount\":75,\"cpalcount\":0,\"maps\":[{\"id\":0}],\"outputs\":[1024],\"wifi\":{\"bssid\":\"\",\"rssi\":0,\"signal\":100,\"channel\":1},\"fs\":{\"u\":20,\"t\":983,\"pmt\":0},\"ndc\":16,\"arch\":\"esp32\",\"core\":\"v3.3.6-16-gcc5440f6a2\",\"lwip\":0,\"totalheap\":294784,\"getflash\":4194304,\"freeheap\":115988,\"freestack\":6668,\"minfreeheap\":99404,\"e32core0code\":12,\"e32core0text\":\"SW restart\",\"e32core1code\":12,\"e32core1text\":\"SW restart\",\"e32code\":4,\"e32text\":\"SW error (panic or exception)\",\"e32model\":\"ESP32-D0WDQ5 rev.3\",\"e32cores\":2,\"e32speed\":240,\"e32flash\":4,\"e32flashspeed\":80,\"e32flashmode\":2,\"e32flashtext\":\" (DIO)\",\"uptime\":167796,\"opt\":79,\"brand\":\"WLED\",\"product\":\"MoonModules\"}";
+
+void SysModWeb::updateJsonSnapshot() {
+  //tbd:  //StarBase has no idea about leds so this should be led independent
+  snapshotOn = mdl->getValue("Fixture", "on").as<bool>();
+  snapshotBri = mdl->getValue("Fixture", "brightness").as<uint8_t>();
+
+  char name[sizeof(snapshotName)];
+  serializeJson(mdl->getValue("System", "name"), name, sizeof(name)); //quoted and escaped
+  if (strncmp(name, snapshotName, sizeof(name)) == 0) return; //unchanged, no need to lock
+  portENTER_CRITICAL(&snapshotMux);
+  strlcpy(snapshotName, name, sizeof(snapshotName));
+  portEXIT_CRITICAL(&snapshotMux);
+}
+
+void SysModWeb::snapshotNameJson(char *name, size_t size) {
+  portENTER_CRITICAL(&snapshotMux);
+  strlcpy(name, snapshotName, size);
+  portEXIT_CRITICAL(&snapshotMux);
+}
+
+//AsyncTCP task: only the snapshot, see updateJsonSnapshot
+void SysModWeb::serializeState(Print &out) {
+  out.printf("{\"on\":%s,\"bri\":%d,", snapshotOn?"true":"false", snapshotBri.load());
+  out.print(jsonStateRest);
+}
+
+void SysModWeb::serializeInfo(Print &out) {
+  char name[sizeof(snapshotName)];
+  snapshotNameJson(name, sizeof(name));
+  out.print("{\"name\":");
+  out.print(name);
+  out.printf(",\"mac\":\"%s\",\"ip\":\"%s\",", mdns->escapedMac.c_str(), net->localIP().toString().c_str());
+  out.print(jsonInfoRest);
+}
+
+void SysModWeb::serializeModelPieces() {
+  if (modelCursors.empty()) return;
+
+  xSemaphoreTake(wsMutex, portMAX_DELAY);
+  for (std::vector<std::shared_ptr<ModelCursor>>::iterator it=modelCursors.begin(); it!=modelCursors.end();) {
+    if (it->use_count() == 1) { //response deleted: all sent or client left
+      it = modelCursors.erase(it);
+      continue;
+    }
+    ModelCursor &cursor = **it;
+    JsonArray model = mdl->model->as<JsonArray>();
+    while (!cursor.serialized && !cursor.ready[cursor.fillNr]) {
+      String &piece = cursor.pieces[cursor.fillNr];
+      piece = cursor.moduleNr?",":"[";
+      if (cursor.moduleNr < model.size())
+        serializeJson(model[cursor.moduleNr++], piece); //one module in one go, so its values are consistent
+      cursor.serialized = cursor.moduleNr >= model.size(); //the last module (or no modules)
+      if (cursor.serialized) piece += "]";
+      cursor.last[cursor.fillNr] = cursor.serialized;
+      cursor.ready[cursor.fillNr] = true;
+      cursor.fillNr ^= 1;
+    }
+    ++it;
+  }
+  xSemaphoreGive(wsMutex);
+}
+
+void SysModWeb::serveJson(WebRequest *request) {
+
+  // return model.json
+  if (request->url().indexOf("mdl") > 0) {
+    ppf("serveJson model ...%d, %s\n", request->client()->remoteIP()[3], request->url().c_str());
+
+    //the model is owned by loopTask: it serializes one module at a time (so each is consistent), the filler sends it in chunks of the TCP send window
+    std::shared_ptr<ModelCursor> cursor = std::make_shared<ModelCursor>();
+    xSemaphoreTake(wsMutex, portMAX_DELAY);
+    modelCursors.push_back(cursor);
+    xSemaphoreGive(wsMutex);
+    WebResponse *response = request->beginChunkedResponse("application/json", [cursor](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+      size_t len = 0;
+      while (len < maxLen && cursor->ready[cursor->sendNr]) {
+        const String &piece = cursor->pieces[cursor->sendNr];
+        size_t copy = min(maxLen - len, piece.length() - cursor->offset);
+        memcpy(buffer + len, piece.c_str() + cursor->offset, copy);
+        len += copy;
+        cursor->offset += copy;
+        if (cursor->offset < piece.length() || cursor->last[cursor->sendNr]) break; //chunk full or all sent (piece stays ready)
+        cursor->offset = 0;
+        cursor->ready[cursor->sendNr] = false; //sent, loopTask serializes the next
+        cursor->sendNr ^= 1;
+      }
+      if (len == 0 && !cursor->ready[cursor->sendNr]) return RESPONSE_TRY_AGAIN; //next piece not serialized yet
+      return len; //0: done
+    });
+    request->send(response);
+    return;
+  }
+
+  ppf("serveJson ...%d, %s\n", request->client()->remoteIP()[3], request->url().c_str());
+
+  if (request->url().indexOf("perf") > 0) { //per module min/avg/max/p99 micros of each loop kind, for monitoring
+    AsyncJsonResponse * response = new AsyncJsonResponse(false); //object
+    mdls->perfToJson(response->getRoot().to<JsonObject>());
+    response->setLength();
+    request->send(response);
+    return;
+  }
+
+  //WLED compatible: constant text with the live fields filled in, no JsonDocument
+  //temporary set all WLED variables (as otherwise WLED-native does not show the instance): tbd: clean up (state still needed, info not)
+  AsyncResponseStream *response = request->beginResponseStream("application/json", 2048);
+  if (request->url().indexOf("state") > 0) {
+    serializeState(*response);
+  }
+  else if (request->url().indexOf("info") > 0) {
+    serializeInfo(*response);
+  }
+  else {
+    response->print("{\"state\":");
+    serializeState(*response);
+    response->print(",\"info\":");
+    serializeInfo(*response);
+    response->print("}");
+  }
   request->send(response);
 } //serveJson
\ No newline at end of file
@@ -12,6 +12,8 @@
 #pragma once
 #include "SysModule.h"
 #include "SysModPrint.h"
+#include "SysJsonAllocators.h"
+#include <atomic>
 
 #ifdef STARBASE_USE_Psychic
   #include <PsychicHttp.h>
@@ -34,6 +36,161 @@
   #define WebResponse AsyncWebServerResponse
 #endif
 
+class Variable; //forward
+
+#define WS_BIN_MODEL 2 //binary ws message type (byte 0): chunk of a module, byte 1: 1 if last chunk, then json
+#define WS_BIN_VALUES 3 //binary ws message type (byte 0): values of variables, records of [handle:2][tag:1][rowNr:1][value:1,2,4 or 12], little endian, both directions
+
+//type of the value in a WS_BIN_VALUES record
+enum wsValueTags
+{
+  vt_bool, //1 byte
+  vt_uint8, //1 byte
+  vt_uint16, //2 bytes
+  vt_int32, //4 bytes
+  vt_float, //4 bytes
+  vt_Coord3D, //3 x int32: 12 bytes
+  vt_count
+};
+
+//value of a variable (or a row of it) to be send or received binary, see addResponseValue
+struct WSValue {
+  uint16_t handle; //var["h"]
+  uint8_t tag; //see wsValueTags
+  uint8_t rowNr; //UINT8_MAX if no row
+  int32_t value[3] = {0, 0, 0}; //float stored as its bits, Coord3D as x, y, z
+};
+
+//model streamed to a client after connect, module by module in chunks (see streamModel)
+struct WSModelStream {
+  uint32_t clientId;
+  std::vector<uint16_t> moduleIndexes; //modules in model, sorted by order
+  size_t moduleNr = 0; //next module to serialize
+  String json; //current module, serialized once so its chunks are consistent
+  size_t offset = 0; //bytes of json sent
+};
+
+//chunked /json/mdl response: loopTask serializes the model piece by piece ("[" module 0, "," module 1, ... "]"), the AsyncTCP filler copies them out, see serveJson
+//two pieces, so the next is serialized while the current is sent
+struct ModelCursor {
+  String pieces[2]; //loopTask writes a piece if !ready, AsyncTCP reads it if ready
+  bool last[2] = {false, false}; //piece ends with ]
+  std::atomic<bool> ready[2] = {false, false}; //serialized, handed over to AsyncTCP until sent
+  size_t moduleNr = 0; //next module to serialize (loopTask)
+  uint8_t fillNr = 0; //next piece to serialize (loopTask)
+  bool serialized = false; //] serialized (loopTask)
+  uint8_t sendNr = 0; //piece being sent (AsyncTCP)
+  size_t offset = 0; //bytes of the piece sent (AsyncTCP)
+};
+
+//buffer to reassemble a ws message received in multiple frames / packets, reused (see wsEvent)
+struct WSFrameBuffer {
+  uint32_t clientId = 0; //0: free
+  uint8_t opcode = 0; //of the message
+  byte *data = nullptr;
+  size_t size = 0; //allocated
+  size_t len = 0; //received
+};
+
+//deltas for a client which is behind (queue full), merged last-value-wins until the client can receive again
+struct WSPending {
+  uint32_t clientId;
+  JsonDocument doc;
+  std::vector<WSValue> values; //binary values (WS_BIN_VALUES), same last-value-wins
+};
+
+//lock-free queue for one producer task and one consumer task, N must be a power of 2
+template <typename T, size_t N>
+class SPSCQueue {
+public:
+  //producer only, false if full
+  bool push(T item) {
+    size_t head = this->head.load(std::memory_order_relaxed);
+    if (head - tail.load(std::memory_order_acquire) == N) return false;
+    items[head % N] = item;
+    this->head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  //consumer only, false if empty
+  bool pop(T &item) {
+    size_t tail = this->tail.load(std::memory_order_relaxed);
+    if (head.load(std::memory_order_acquire) == tail) return false;
+    item = items[tail % N];
+    this->tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+private:
+  T items[N];
+  std::atomic<size_t> head{0};
+  std::atomic<size_t> tail{0};
+};
+
+#define STARBASE_RESPONSE_CONTEXTS 4 //max nr of tasks with their own responses (loopTask, module tasks, ...)
+
+//responses (json and binary values) made by one task, send by that task (see flushResponses)
+struct ResponseContext {
+  TaskHandle_t task = nullptr; //nullptr: free
+  JsonBumpArena *arena = nullptr; //of doc: cleared after each send
+  JsonDocument *doc = nullptr;
+  std::vector<WSValue> values; //binary values since last send, last value wins
+};
+
+#define OTA_BUFFER_SIZE 4096 //a flash sector
+#define OTA_RESUME_TIMEOUT 60000 //ms an interrupted update waits for its resume (/update?offset=n)
+#define OTA_TASK_STOP UINT8_MAX //buffer nr which makes the ota task exit
+
+//OTA update in progress: serveUpdate (AsyncTCP) fills one buffer while the ota task writes the other to flash
+struct OTAState {
+  bool active = false; //between Update.begin and Update.end or abort
+  WebRequest *request = nullptr; //upload of the update, chunks of other requests are ignored
+  byte *buffers[2] = {nullptr, nullptr};
+  size_t lengths[2] = {0, 0};
+  uint8_t fillNr = 0; //buffer filled by serveUpdate, the other is written or free
+  QueueHandle_t fullQueue = nullptr; //buffer nrs to write (serveUpdate -> ota task), OTA_TASK_STOP: exit
+  QueueHandle_t emptyQueue = nullptr; //buffer nrs written (ota task -> serveUpdate)
+  TaskHandle_t task = nullptr;
+  SemaphoreHandle_t stopped = nullptr; //given by the ota task when it exits, see otaStop
+  std::atomic<bool> error{false}; //Update.write failed (ota task)
+  size_t received = 0; //bytes of the image received: the offset to resume at
+  size_t size = 0; //expected bytes of the image (offset + content length), for the progress
+  size_t resumedAt = 0; //received at the start of this request, for the throughput
+  uint32_t flashMicros = 0; //spent in Update.write (ota task)
+  unsigned long start = 0; //millis of this request
+  unsigned long lastData = 0; //millis of the last chunk, see OTA_RESUME_TIMEOUT
+  unsigned long lastReport = 0; //millis of the last progress
+  std::atomic<bool> reportPending{false}; //progress changed (AsyncTCP), comment published by loop1s
+  char message[64] = ""; //result of the last update
+};
+
+enum commandKinds
+{
+  ck_connect, //ws client connected: send sysInfo and start streaming the model
+  ck_json, //ws text message
+  ck_values, //ws WS_BIN_VALUES message
+  ck_http, //json posted on /json
+  ck_upload, //file uploaded: files index refreshed first, then sc files are run
+  ck_count
+};
+
+#define JSON_APPLY_TIMEOUT 500 //ms a verbose /json post waits for loopTask to apply it, 503 after
+
+//given by loopTask when the command is applied, shared as the waiter may time out before
+struct CommandDone {
+  SemaphoreHandle_t semaphore = xSemaphoreCreateBinary();
+  ~CommandDone() {vSemaphoreDelete(semaphore);}
+};
+
+//command received in the AsyncTCP task, applied by loopTask in processCommands
+struct WSCommand {
+  uint8_t kind; //see commandKinds
+  uint32_t clientId = 0; //ws client, 0 for http
+  JsonDocument doc; //ck_json and ck_http
+  std::vector<byte> data; //ck_values, ck_upload: file name
+  std::shared_ptr<CommandDone> done; //optional: a request waiting for the result (verbose /json post)
+};
+
 class SysModWeb:public SysModule {
 
 public:
@@ -50,8 +207,11 @@ public:
   uint8_t sendWsCounter = 0;
   uint16_t sendWsTBytes = 0;
   uint16_t sendWsBBytes = 0;
+  uint16_t sendWsCoalesced = 0; //values overwritten by a newer value while client was behind
+  uint16_t sendWsDropped = 0; //values not sent as pending deltas of a client became too big or client left
   uint8_t recvWsCounter = 0;
   uint16_t recvWsBytes = 0;
+  uint16_t commandsProcessed = 0; //commands applied by loopTask
   uint8_t sendUDPCounter = 0;
   uint16_t sendUDPBytes = 0;
   uint8_t recvUDPCounter = 0;
@@ -59,6 +219,12 @@ public:
 
   bool isBusy = false;
 
+  uint16_t maxRate = 10; //max nr of loopTask response messages per second per client
+  uint16_t maxPending = 4096; //max size of the pending deltas of a client (bytes)
+  uint16_t chunkSize = 1024; //size of the chunks the model is streamed in (bytes)
+  uint8_t maxChunks = 16; //max chunk buffers of the model streams, reused when sent
+  uint16_t maxMessageSize = 8192; //max size of a received ws message (bytes)
+
   #ifdef STARBASE_USERMOD_LIVE
     char lastFileUpdated[30] = ""; //workaround!
   #endif
@@ -74,6 +240,19 @@ public:
   void connectedChanged() override;
 
   void wsEvent(WebSocket * ws, WebClient * client, AwsEventType type, void * arg, byte *data, size_t len);
+  //a complete text message (single frame or reassembled), parsed and queued for loopTask
+  void wsTextMessage(WebClient * client, byte *data, size_t len);
+  //a complete WS_BIN_VALUES message: set the values of the vars (loopTask)
+  void wsBinaryValues(uint32_t clientId, const byte *data, size_t len);
+
+  //queue a command for loopTask (AsyncTCP task), false (and command deleted) if the queue is full
+  bool pushCommand(WSCommand *command);
+  //set a value from the AsyncTCP task (e.g. upload progress): queued as a command if changed since last queued, applied and sent by loopTask
+  void queueValue(const char * pid, const char * id, int value);
+  //apply all commands received since the last call, called by SysModules::loop before the modules (loopTask)
+  void processCommands();
+  //apply a json command ({"pid.id":{"value":v}}, onUI, ...) as received over ws and send the response, loopTask only. doc is copied into the response doc
+  void applyJson(JsonDocument &doc, WebClient * client = nullptr);
   
   //send json to client or all clients
   void sendDataWs(JsonVariant json = JsonVariant(), WebClient * client = nullptr);
@@ -83,9 +262,9 @@ public:
   //add an url to the webserver to listen to
   void serveIndex(WebRequest *request);
   void serveNewUI(WebRequest *request);
-  //mdl and WLED style state and info
-  void serializeState(JsonVariant root);
-  void serializeInfo(JsonVariant root);
+  //mdl and WLED style state and info, perf: loop statistics per module (curl http://4.3.2.1/json/perf)
+  void serializeState(Print &out);
+  void serializeInfo(Print &out);
   void serveJson(WebRequest *request);
 
 
@@ -93,9 +272,19 @@ public:
   void serveUpload(WebRequest *request, const String& fileName, size_t index, byte *data, size_t len, bool final);
   // curl -s -F "update=@/Users/ewoudwijma/Developer/GitHub/ewowi/StarBase/.pio/build/esp32dev/firmware.bin" 192.168.1.102/update /dev/null &
   // curl -s -F "update=@/Users/ewoudwijma/Downloads/StarLight_24110513_esp32devICVLD.bin" 192.168.1.245/update /dev/null &
+  //pipelined: chunks are copied in a sector buffer, the ota task writes the previous one. Optional md5 (checked by Update.end)
+  //interrupted? resume with the rest of the image: curl -F "update=@rest.bin" "192.168.1.102/update?offset=n&md5=..." (n: GET /update)
   void serveUpdate(WebRequest *request, const String& fileName, size_t index, byte *data, size_t len, bool final);
+  //curl http://4.3.2.1/update: {"active":..,"offset":n,"written":n,"message":".."}
+  void serveUpdateState(WebRequest *request);
+  //curl -H "Range: bytes=0-99" http://4.3.2.1/file/model.json, ETag from size and last write
   void serveFiles(WebRequest *request);
 
+  //true if the client has etag cached (If-None-Match): 304 sent
+  bool notModified(WebRequest *request, const char * etag);
+  //gzipped page or asset from flash with ETag and Cache-Control: 304 if cached by the client
+  void sendStatic(WebRequest *request, const char * contentType, const uint8_t * content, size_t len, const char * etag, bool immutable = false);
+
   //processJsonUrl handles requests send in javascript using fetch and from a browser or curl
   //try this !!!: 
   //curl -X POST "http://4.3.2.1/json" -d '{"Pins.pin19":false}' -H "Content-Type: application/json"
@@ -119,8 +308,16 @@ public:
 
   bool captivePortal(WebRequest *request);
 
+  bool lazyUI = false; //see SysModules::setup
+
+  //false if lazyUI and no client: responses for the UI are not made (clients get the model and run onUI when they connect)
+  bool responsesNeeded() {
+    return !lazyUI || ws.getClients().length();
+  }
+
   template <typename Type>
   void addResponse(const JsonObject var, const char * key, Type value, const uint8_t rowNr = UINT8_MAX) {
+    if (!responsesNeeded()) return;
     JsonObject responseObject = getResponseObject();
     // if (responseObject[id].isNull()) responseObject[id].to<JsonObject>();;
     char pidid[64];
@@ -146,11 +343,52 @@ public:
     addResponse(var, key, JsonString(value));
   }
 
+  //add the value of var (or row) to the response of the current task: binary (WS_BIN_VALUES) if var has a handle and a numeric, bool or Coord3D value, otherwise json
+  void addResponseValue(JsonObject var, uint8_t rowNr = UINT8_MAX);
+
+  //changed rows of a column (Variable::setValues): {"pid.id":{"rows":{"rowNr":value,..},"length":n}}, merged in the value array by the client
+  void addResponseRows(JsonObject var, const uint8_t *rowNrs, uint8_t count);
+
+  //bytes of a value in a WS_BIN_VALUES record
+  uint8_t valueSize(uint8_t tag) {
+    switch (tag) {
+      case vt_bool: case vt_uint8: return 1;
+      case vt_uint16: return 2;
+      case vt_int32: case vt_float: return 4;
+      case vt_Coord3D: return 12;
+      default: return 0;
+    }
+  }
+
+  //value as WSValue (tag and value), false if not a bool, number or Coord3D (also used by the instances sync)
+  bool valueToWSValue(JsonVariant value, WSValue &wsValue);
+  //set the value of variable (or row) from a WSValue
+  void setWSValue(Variable variable, const WSValue &wsValue);
+
   void clientsToJson(JsonArray array, bool nameOnly = false, const char * filter = nullptr);
 
-  //gets the right responseDoc, depending on which task you are in, alternative for requestJSONBufferLock
-  JsonDocument * getResponseDoc();
-  JsonObject getResponseObject();
+  //response context of the current task, nullptr if the task has none (e.g. AsyncTCP: commands are applied in loopTask, see processCommands)
+  ResponseContext *getResponseContext() {
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+    for (ResponseContext &context: responseContexts) if (context.task == task) return &context; //loopTask is the first
+    return nullptr;
+  }
+  //give the current task its own response context (called once by the task itself), false if no free context
+  bool addResponseContext();
+
+  //the responseDoc of the current task, nullptr if none
+  JsonDocument * getResponseDoc() {
+    ResponseContext *context = getResponseContext();
+    return context?context->doc:nullptr;
+  }
+  //null object if the task has no response context (adding to it does nothing)
+  JsonObject getResponseObject() {
+    JsonDocument *doc = getResponseDoc();
+    return doc?doc->as<JsonObject>():JsonObject();
+  }
+  //send the responses of the current task, max maxRate per second
+  void flushResponses();
+  //send responseObject to client or all clients, clients which are behind get it merged in their pending deltas
   void sendResponseObject(WebClient * client = nullptr);
 
   void printClient(const char * text, WebClient * client) {
@@ -161,10 +399,86 @@ public:
 private:
   bool modelUpdated = false;
 
+  unsigned long flushMillis = 0;
+  std::vector<WSPending> wsPending; //clients which are behind, protected by wsMutex
+
+  //client can receive a message now (not too many messages queued)
+  bool clientReady(WebClient * client) {
+    return client->status() == WS_CONNECTED && !client->queueIsFull() && client->queueLen() <= 3;
+  }
+
+  //merge src in dest, last value wins, returns the number of values overwritten
+  size_t mergeDelta(JsonObject dest, JsonObject src);
+
+  //send pending deltas to clients which are ready again
+  void sendPending();
+
+
+  //value of var[rowNr] as WSValue, false if not a bool, number or Coord3D
+  bool toWSValue(JsonObject var, uint8_t rowNr, WSValue &wsValue);
+  //add wsValue to values, overwriting the value of the same handle and rowNr, returns true if overwritten
+  bool mergeValue(std::vector<WSValue> &values, const WSValue &wsValue);
+  //WS_BIN_VALUES message of values in buffer, returns the length (buffer nullptr: only measure)
+  size_t serializeValues(const std::vector<WSValue> &values, byte *buffer = nullptr);
+  //send the values of the current task to all clients, clients which are behind get them merged in their pending values
+  void sendValues();
+
+  WSFrameBuffer wsFrameBuffers[2]; //max 2 clients sending multi frame messages at the same time, only used by AsyncTCP task
+
+  std::vector<WSModelStream> wsStreams; //clients receiving the model, protected by wsMutex
+  std::vector<AsyncWebSocketMessageBuffer *> chunkPool; //locked buffers of chunkSize, shared by the streams, protected by wsMutex
+  std::vector<std::shared_ptr<ModelCursor>> modelCursors; //chunked /json/mdl responses being sent, protected by wsMutex
+
+  //serialize the next pieces of the model of each chunked /json/mdl response, as far as sent (loopTask)
+  void serializeModelPieces();
+
+  //send the next chunks of each stream as long as the client keeps up, serializing the next module when the current is sent
+  void streamModel();
+  //chunk buffer of the pool not in transit (count 0), nullptr if all maxChunks are
+  AsyncWebSocketMessageBuffer * freeChunk();
+
   bool clientsChanged = false;
 
-  JsonDocument *responseDocLoopTask = nullptr;
-  JsonDocument *responseDocAsyncTCP = nullptr;
+  ResponseContext responseContexts[STARBASE_RESPONSE_CONTEXTS];
+
+  SPSCQueue<WSCommand *, 32> commands; //AsyncTCP task -> loopTask
+  uint16_t commandsDropped = 0; //queue full
+
+  struct QueuedValue {
+    char pidid[32];
+    int value;
+  };
+  std::vector<QueuedValue> queuedValues; //last value per pid.id pushed by queueValue, AsyncTCP task only
+
+  //send sysInfo and start streaming the model to a new client
+  void clientConnected(WebClient * client);
+
+  //live fields of the WLED state and info, filled by loopTask (updateJsonSnapshot) so the AsyncTCP task does not read the model
+  std::atomic<bool> snapshotOn{false};
+  std::atomic<uint8_t> snapshotBri{0};
+  char snapshotName[64] = "\"\""; //System name, quoted and escaped, protected by snapshotMux
+  portMUX_TYPE snapshotMux = portMUX_INITIALIZER_UNLOCKED;
+
+  //copy the state and info fields from the model, the name only if changed (loopTask)
+  void updateJsonSnapshot();
+  //quoted and escaped System name (any task)
+  void snapshotNameJson(char *name, size_t size);
+
+  OTAState ota; //AsyncTCP task, loop1s only after OTA_RESUME_TIMEOUT without data
+
+  //image header of the first chunk: magic, segment count and chip, false (ota.message) if not an image for this chip
+  //checked before anything is erased, the segments and the hash are verified by Update.end (before the boot partition is switched)
+  bool otaImageValid(const byte *data, size_t len, const String& fileName);
+  //Update.begin, buffers, queues and the ota task, false (ota.message) if not possible
+  bool otaStart(WebRequest *request);
+  //hand the filled buffer to the ota task and wait for the other one, false if the ota task does not return it
+  bool otaFlush();
+  //stop the ota task, free buffers and queues, abort the update if not ended
+  void otaStop();
+  //progress (%) in System.otaProgress, once per second (AsyncTCP)
+  void otaProgress(bool force = false);
+  //throughput (KB/s) in the comment of System.otaProgress (loopTask)
+  void otaReport();
 
 };
 
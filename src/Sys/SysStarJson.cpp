@@ -14,9 +14,9 @@
 #include "SysModFiles.h"
 #include "SysModPrint.h"
 
-//Lazy Json Read Deserialize Write Serialize (write / serialize not implemented yet)
+//Lazy Json Read Deserialize Write Serialize
 //ArduinoJson won't work on very large fixture.json, this does
-//only support what is currently needed: read / deserialize uint8/16/char var elements (arrays not yet)
+//read: SAX style, onPath callbacks for int32, float, bool, strings and (nested) arrays, block buffered, no allocation per nesting level
   StarJson::StarJson(const char * path, const char * mode) {
     // ppf("StarJson constructing %s %s\n", path, mode);
     f = files->open(path, mode);
@@ -30,234 +30,325 @@
   }
 
   void StarJson::addExclusion(const char * key) {
-    charList.push_back((char *)key);
+    exclusions.push_back((char *)key);
   }
 
   //serializeJson
   void StarJson::writeJsonDocToFile(JsonDocument* dest) {
-    writeJsonVariantToFile(dest->as<JsonVariant>());
-    f.close();
-    files->filesChanged = true;
+    writeJsonVarToFile(dest->as<JsonVariant>());
+  }
+
+  bool StarJson::writeJsonVarToFile(JsonVariant variant) {
+    if (!f) return false;
+    bool result = writeJsonVarTo(f, variant);
+    f.close(); //files->open marked it changed
+    return result;
+  }
+
+  bool StarJson::writeJsonVarTo(Print &out, JsonVariant variant) {
+    StarJsonBufferedPrint bufferedOut(out);
+    writeJsonVariant(bufferedOut, variant);
+    return bufferedOut.flushBuffer();
+  }
+
+  void StarJson::onPath(const char * pattern, const StarJsonFun &fun, uint16_t types) {
+    pathFuns.push_back({pattern, fun, types, false});
+    if (types & (1 << sj_arrayEnd)) collectNumbers = true;
   }
 
   void StarJson::lookFor(const char * id, uint8_t * value) {
-    uint8List.push_back(value);
-    addToVars(id, "uint8", uint8List.size()-1);
+    onPath(id, [value](const char *path, const StarJsonValue &jsonValue) {
+      *value = jsonValue.type == sj_string?strtol(jsonValue.text, nullptr, 10):jsonValue.i;
+    }, 1 << sj_int | 1 << sj_float | 1 << sj_string);
   }
 
-  // void StarJson::lookFor(const char * id, uint16_t * value) {
-  //   uint16List.push_back(value);
-  //   addToVars(id, "uint16", uint16List.size()-1);
-  // }
+  void StarJson::lookFor(const char * id, int32_t * value) {
+    onPath(id, [value](const char *path, const StarJsonValue &jsonValue) {
+      *value = jsonValue.i;
+    }, 1 << sj_int | 1 << sj_float | 1 << sj_bool);
+  }
+
+  void StarJson::lookFor(const char * id, float * value) {
+    onPath(id, [value](const char *path, const StarJsonValue &jsonValue) {
+      *value = jsonValue.f;
+    }, 1 << sj_int | 1 << sj_float);
+  }
 
-  // void StarJson::lookFor(const char * id, int * value) {
-  //   intList.push_back(value);
-  //   addToVars(id, "int", intList.size()-1);
-  // }
+  void StarJson::lookFor(const char * id, bool * value) {
+    onPath(id, [value](const char *path, const StarJsonValue &jsonValue) {
+      *value = jsonValue.i != 0;
+    }, 1 << sj_int | 1 << sj_bool);
+  }
 
   void StarJson::lookFor(const char * id, char * value) {
-    charList.push_back(value);
-    addToVars(id, "char", charList.size()-1);
+    onPath(id, [value](const char *path, const StarJsonValue &jsonValue) {
+      strlcpy(value, jsonValue.text, 32); //assuming size 32 here
+    });
   }
 
   //look for array of integers
   void StarJson::lookFor(const char * id, const std::function<void(std::vector<uint16_t>)>& fun) {
-    funList.push_back(fun);
-    addToVars(id, "fun", funList.size()-1);
+    onPath(id, [fun](const char *path, const StarJsonValue &jsonValue) {
+      if (jsonValue.numbers && !jsonValue.numbers->empty()) fun(*jsonValue.numbers);
+    }, 1 << sj_arrayEnd);
   }
 
-  //reads from file until all vars have been found (then stops reading)
-  //returns false if not all vars to look for are found
+  //reads from file until all paths looked for have been found (then stops reading)
+  //returns false if not all paths to look for are found
   bool StarJson::deserialize(const bool lazy) {
-    f.read(&character, sizeof(byte));
-    while (f.available() && (!foundAll || !lazy))
-      next();
+    if (!f) return false;
+    buffer = (char *)malloc(STARJSON_BUFFER);
+    if (!buffer) {
+      ppf("dev StarJson no memory for buffer\n");
+      return false;
+    }
+    bufferPos = bufferLength = 0;
+    depth = 0;
+    path[0] = '\0'; pathLength = 0;
+
+    int c = nextChar();
+    while (c >= 0 && (!foundAll || !lazy))
+      c = parse(c);
+
     if (foundAll)
-      ppf("StarJson found all what it was looking for %d >= %d\n", foundCounter, varDetails.size());
+      ppf("StarJson found all what it was looking for %d >= %d\n", foundCounter, pathFuns.size());
     else
-      ppf("StarJson Not all vars looked for where found %d < %d\n", foundCounter, varDetails.size());
+      ppf("StarJson Not all vars looked for where found %d < %d\n", foundCounter, pathFuns.size());
+    free(buffer);
+    buffer = nullptr;
     f.close();
     return foundAll;
   }
 
-  //called by lookedFor, store the var details in varDetails
-  void StarJson::addToVars(const char * id, const char * type, const size_t index) {
-    VarDetails vd;
-    vd.id = id;
-    vd.type = type;
-    vd.index = index;
-    varDetails.push_back(vd);
-  }
-
-  void StarJson::next() {
-    if (character=='{') { //object begin
-      // ppf("Object %c\n", character);
-      varStack.push_back(lastVarId); //copy!!
-      // ppf("Object push %s %d\n", lastVarId, varStack.size());
-      strlcpy(lastVarId, "", sizeof(lastVarId));
-      f.read(&character, sizeof(byte));
+  //pattern without '.': last key of path, else key by key where * matches any key
+  static bool matchPath(const char *pattern, const char *path) {
+    if (!strchr(pattern, '.')) {
+      const char *last = strrchr(path, '.');
+      last = last?last + 1:path;
+      return strcmp(pattern, "*") == 0 || strcmp(pattern, last) == 0;
     }
-    else if (character=='}') { //object end
-      strlcpy(lastVarId, varStack[varStack.size()-1].c_str(), sizeof(lastVarId));
-      // ppf("Object pop %s %d\n", lastVarId, varStack.size());
-      check(lastVarId);
-      varStack.pop_back();
-      f.read(&character, sizeof(byte));
+    for (;;) {
+      const char *patternEnd = pattern; while (*patternEnd && *patternEnd != '.') patternEnd++;
+      const char *pathEnd = path; while (*pathEnd && *pathEnd != '.') pathEnd++;
+      bool any = patternEnd - pattern == 1 && *pattern == '*';
+      if (!any && (patternEnd - pattern != pathEnd - path || strncmp(pattern, path, patternEnd - pattern) != 0)) return false;
+      if (!*patternEnd || !*pathEnd) return !*patternEnd && !*pathEnd;
+      pattern = patternEnd + 1;
+      path = pathEnd + 1;
     }
-    else if (character=='[') { //array begin
-      // ppf("Array %c\n", character);
-      varStack.push_back(lastVarId); //copy!!
-      // ppf("Array push %s %d\n", lastVarId, varStack.size());
-      strlcpy(lastVarId, "", sizeof(lastVarId));
-      f.read(&character, sizeof(byte));
-
-      //now we want to collect the array elements
-      collectNumbers = true;
-      uint16CollectList.clear(); //to be sure not to have old numbers (e.g. pin)
-    }
-    else if (character==']') { //array end
-      //assign back the popped var id from [
-      strlcpy(lastVarId, varStack[varStack.size()-1].c_str(), sizeof(lastVarId));
-      // ppf("Array pop %s %d %d\n", lastVarId, varStack.size(), uint16CollectList.size());
-      check(lastVarId);
-
-      //check the parent array, if exists
-      if (varStack.size() - 2 >= 0) {
-        // ppf("  Parent check %s\n", varStack[varStack.size()-2].c_str());
-        strlcpy(beforeLastVarId, varStack[varStack.size()-2].c_str(), sizeof(beforeLastVarId));
-        check(beforeLastVarId);
+  }
+
+  void StarJson::emit(StarJsonValue &value) {
+    value.depth = depth;
+    value.index = (depth && levels[depth-1].isArray)?levels[depth-1].index:UINT16_MAX;
+    for (PathFun &pathFun: pathFuns) {
+      if ((pathFun.types & (1 << value.type)) && matchPath(pathFun.pattern, path)) {
+        pathFun.fun(path, value);
+        if (!pathFun.found) {
+          pathFun.found = true;
+          foundCounter++;
+          foundAll = foundCounter >= pathFuns.size();
+        }
       }
-      varStack.pop_back(); //remove var id of this array
-      collectNumbers = false;
-      uint16CollectList.clear();
-      f.read(&character, sizeof(byte));
     }
-    else if (character=='"') { //parse String
-      char value[128] = "";
-      f.readBytesUntil('"', value, sizeof(value)-1);
-    
-      //if no lastVar then var found
-      if (strncmp(lastVarId, "", sizeof(lastVarId)) == 0) {
-        // ppf("Element [%s]\n", value);
-        strlcpy(lastVarId, value, sizeof(lastVarId));
+  }
+
+  //a value or container completed in the current level
+  void StarJson::valueDone() {
+    if (depth && levels[depth-1].isArray) levels[depth-1].index++;
+  }
+
+  int StarJson::parse(int c) {
+    StarJsonValue value;
+    switch (c) {
+    case '{':
+    case '[':
+      if (depth == STARJSON_MAX_DEPTH) {
+        ppf("dev StarJson deeper than %d\n", STARJSON_MAX_DEPTH);
+        return -1; //stop
       }
-      else { // if lastvar then string value found
-        // ppf("String var %s: [%s]\n", lastVarId, value);
-        check(lastVarId, value);
-        strlcpy(lastVarId, "", sizeof(lastVarId));
+      levels[depth].pathLength = pathLength;
+      levels[depth].isArray = c == '[';
+      levels[depth].expectKey = c == '{';
+      levels[depth].index = 0;
+      value.type = c == '{'?sj_objectBegin:sj_arrayBegin;
+      emit(value);
+      depth++;
+      if (c == '[') uint16CollectList.clear(); //numbers of this array only
+      return nextChar();
+    case '}':
+    case ']':
+      if (depth == 0) return nextChar(); //not balanced, skip
+      depth--;
+      pathLength = levels[depth].pathLength; //the path of the object or array itself
+      path[pathLength] = '\0';
+      value.type = c == '}'?sj_objectEnd:sj_arrayEnd;
+      if (c == ']') value.numbers = &uint16CollectList;
+      emit(value);
+      if (c == ']') uint16CollectList.clear(); //a parent array does not contain these
+      valueDone();
+      return nextChar();
+    case '"': {
+      int next = parseString();
+      Level *level = depth?&levels[depth-1]:nullptr;
+      if (level && !level->isArray && level->expectKey) { //key: path of the object + key
+        pathLength = level->pathLength;
+        if (pathLength && pathLength < sizeof(path) - 1) path[pathLength++] = '.';
+        pathLength += strlcpy(path + pathLength, token, sizeof(path) - pathLength);
+        if (pathLength > sizeof(path) - 1) pathLength = sizeof(path) - 1;
+        level->expectKey = false;
       }
-
-      f.read(&character, sizeof(byte));
-    }
-    else if (isDigit(character)) { //parse number
-      char value[100] = "";
-
-      size_t len = 0;
-      //readuntil not number
-      while (isDigit(character)) {
-        // ppf("%c", character);
-        value[len++] = character;
-        f.read(&character, sizeof(byte));
+      else {
+        value.type = sj_string;
+        value.text = token;
+        emit(value);
+        valueDone();
       }
-      value[len++] = '\0';
-
-      //number value found
-      // ppf("Number var %s: [%s]\n", lastVarId, value);
-      if (collectNumbers)
-        uint16CollectList.push_back(strtol(value, nullptr, 10));
-
-      check(lastVarId, value);
-  
-      strlcpy(lastVarId, "", sizeof(lastVarId));
+      return next; }
+    case ',':
+      if (depth && !levels[depth-1].isArray) levels[depth-1].expectKey = true;
+      return nextChar();
+    case ':':
+    case ' ':
+    case '\t':
+    case '\n':
+    case '\r':
+      return nextChar();
+    default:
+      if (c == '-' || isDigit(c) || isAlpha(c))
+        return parseScalar(c);
+      return nextChar(); //skip unknown
     }
-    else if (character==':') {
-      // ppf("semicolon %c\n", character);
-      f.read(&character, sizeof(byte));
+  }
+
+  //string into token (without quotes, escapes resolved), returns the character after the closing quote
+  int StarJson::parseString() {
+    size_t len = 0;
+    int c = nextChar();
+    while (c >= 0 && c != '"') {
+      if (c == '\\') {
+        c = nextChar();
+        if (c == 'n') c = '\n';
+        else if (c == 't') c = '\t';
+        else if (c == 'r') c = '\r';
+        //\" \\ \/ as is, \u not resolved
+      }
+      if (c >= 0 && len < sizeof(token) - 1) token[len++] = c;
+      c = nextChar();
     }
-    else if (character==',') {
-      // ppf("sep %c\n", character);
-      f.read(&character, sizeof(byte));
+    token[len] = '\0';
+    return nextChar();
+  }
+
+  //number, true, false or null
+  int StarJson::parseScalar(int c) {
+    size_t len = 0;
+    bool isFloat = false;
+    while (c >= 0 && (c == '-' || c == '+' || c == '.' || isAlphaNumeric(c))) {
+      if (c == '.' || c == 'e' || c == 'E') isFloat = true;
+      if (len < sizeof(token) - 1) token[len++] = c;
+      c = nextChar();
     }
-    else if (character==']') {
-      // ppf("close %c\n", character);
-      f.read(&character, sizeof(byte));
+    token[len] = '\0';
+
+    StarJsonValue value;
+    value.text = token;
+    if (token[0] == 't' || token[0] == 'f') {
+      value.type = sj_bool;
+      value.i = token[0] == 't';
+      value.f = value.i;
     }
-    else if (character=='}') {
-      // ppf("close %c\n", character);
-      f.read(&character, sizeof(byte));
+    else if (token[0] == 'n') {
+      value.type = sj_null;
     }
-    else if (character=='\n') { //skip new lines
-      // ppf("skip newline \n");
-      f.read(&character, sizeof(byte));
+    else if (isFloat) {
+      value.type = sj_float;
+      value.f = strtof(token, nullptr);
+      value.i = value.f;
     }
     else {
-      // ppf("%c", character);
-      f.read(&character, sizeof(byte));
-    }
-  } //next
-
-  void StarJson::check(char * varId, char * value) {
-    //check if var is in lookFor list
-    for (std::vector<VarDetails>::iterator vd=varDetails.begin(); vd!=varDetails.end(); ++vd) {
-      // ppf("check %s %s %s\n", vd->id, varId, value);
-      if (strncmp(vd->id, varId, 32)==0) {
-        // ppf("StarJson found %s:%s %d %s %d %d\n", varId, vd->type, vd->index, value?value:"", uint16CollectList.size(), funList.size());
-        if (strncmp(vd->type, "uint8", 7) ==0 && value) *uint8List[vd->index] = strtol(value, nullptr, 10);
-        // if (strncmp(vd->type, "uint16", 7) ==0 && value) *uint16List[vd->index] = strtol(value, nullptr, 10);
-        // if (strncmp(vd->type, "int", 7) ==0 && value) *intList[vd->index] = strtol(value, nullptr, 10);
-        if (strncmp(vd->type, "char", 5) ==0 && value) strlcpy(charList[vd->index], value, 32); //assuming size 32 here
-        if (strncmp(vd->type, "fun", 4) ==0) funList[vd->index](uint16CollectList); //call for every found item (no value check)
-        foundCounter++;
-      }
+      value.type = sj_int;
+      value.i = strtol(token, nullptr, 10);
+      value.f = value.i;
     }
 
-    foundAll = foundCounter >= varDetails.size();
+    if (collectNumbers && depth && levels[depth-1].isArray && (value.type == sj_int || value.type == sj_float))
+      uint16CollectList.push_back(value.i);
+
+    emit(value);
+    valueDone();
+    return c;
   }
 
-  //writeJsonVariantToFile calls itself recursively until whole json document has been parsed
-  void StarJson::writeJsonVariantToFile(JsonVariant variant) {
+  //writeJsonVariant calls itself recursively for objects and arrays, other values by serializeJson
+  void StarJson::writeJsonVariant(Print &out, JsonVariant variant) {
     if (variant.is<JsonObject>()) {
-      f.printf("{");
-      char sep[2] = "";
+      out.write('{');
+      bool first = true;
       for (JsonPair pair: variant.as<JsonObject>()) {
         bool found = false;
-        for (char *el:charList) {
+        for (char *el:exclusions) {
           if (strncmp(el, pair.key().c_str(), 32)==0) {
             found = true;
             break;
           }
         }
-        // std::vector<char *>::iterator itr = find(charList.begin(), charList.end(), pair.key().c_str());
+        if (!found && exclusionFun) found = exclusionFun(variant.as<JsonObject>(), pair.key().c_str());
         if (!found) { //not found
-          f.printf("%s\"%s\":", sep, pair.key().c_str());
-          strlcpy(sep, ",", sizeof(sep));
-          writeJsonVariantToFile(pair.value());
+          if (!first) out.write(',');
+          first = false;
+          serializeJson(pair.key().c_str(), out); //quoted and escaped
+          out.write(':');
+          writeJsonVariant(out, pair.value());
         }
       }
-      f.printf("}");
+      out.write('}');
     }
     else if (variant.is<JsonArray>()) {
-      f.printf("[");
-      char sep[2] = "";
+      out.write('[');
+      bool first = true;
       for (JsonVariant variant2: variant.as<JsonArray>()) {
-        f.print(sep);
-        strlcpy(sep, ",", sizeof(sep));
-        writeJsonVariantToFile(variant2);
-      }      
-      f.printf("]");
-    }
-    else if (variant.is<const char *>()) {
-      f.printf("\"%s\"", variant.as<const char *>());      
-    }
-    else if (variant.is<int>()) {
-      f.printf("%d", variant.as<int>());      
+        if (!first) out.write(',');
+        first = false;
+        writeJsonVariant(out, variant2);
+      }
+      out.write(']');
     }
-    else if (variant.is<bool>()) {
-      f.printf("%s", variant.as<bool>()?"true":"false");      
+    else
+      serializeJson(variant, out); //strings escaped, floats, null, ...
+  }
+
+  StarJsonBufferedPrint::StarJsonBufferedPrint(Print &out, size_t size): out(out), size(size) {
+    buffer = (uint8_t *)malloc(size);
+    if (!buffer) this->size = 0; //unbuffered
+  }
+
+  StarJsonBufferedPrint::~StarJsonBufferedPrint() {
+    flushBuffer();
+    free(buffer);
+  }
+
+  size_t StarJsonBufferedPrint::write(const uint8_t *data, size_t dataLength) {
+    if (failed) return 0;
+    if (size == 0) { //no buffer
+      size_t written = out.write(data, dataLength);
+      failed = written != dataLength;
+      return written;
     }
-    else if (variant.isNull()) {
-      f.print("null");      
+    size_t remaining = dataLength;
+    while (remaining) {
+      size_t chunk = min(remaining, size - length);
+      memcpy(buffer + length, data, chunk);
+      length += chunk;
+      data += chunk;
+      remaining -= chunk;
+      if (length == size && !flushBuffer()) return dataLength - remaining;
     }
-    else
-      ppf("dev StarJson write %s not supported\n", variant.as<String>().c_str());
+    return dataLength;
+  }
+
+  bool StarJsonBufferedPrint::flushBuffer() {
+    if (length && !failed) failed = out.write(buffer, length) != length;
+    length = 0;
+    return !failed;
   }
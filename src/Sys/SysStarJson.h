@@ -9,76 +9,147 @@
    @license   For non GPL-v3 usage, commercial licenses must be purchased. Contact moonmodules@icloud.com
 */
 
+#pragma once
+
 #include <Arduino.h>
 #include <LittleFS.h>
 #include "ArduinoJson.h"
 
 #include <vector>
+#include <functional>
+
+#define STARJSON_BUFFER 1024 //read window, allocated while deserializing
+#define STARJSON_MAX_DEPTH 16 //nesting of objects and arrays
+#define STARJSON_MAX_PATH 128 //keys joined by '.', arrays add no key
+#define STARJSON_MAX_TOKEN 128 //strings and numbers, longer strings are truncated
+#define STARJSON_WRITE_BUFFER 1024 //write chunk, a multiple of the LittleFS page (256)
+
+enum StarJsonTypes {sj_int, sj_float, sj_bool, sj_null, sj_string, sj_objectBegin, sj_objectEnd, sj_arrayBegin, sj_arrayEnd};
+#define SJ_VALUES (1 << sj_int | 1 << sj_float | 1 << sj_bool | 1 << sj_null | 1 << sj_string)
+
+//passed to onPath callbacks, only valid during the call
+struct StarJsonValue {
+  uint8_t type; //StarJsonTypes
+  int32_t i = 0; //numbers and bool, floats truncated
+  float f = 0; //numbers
+  const char *text = ""; //string, or number / literal as written
+  uint16_t index = UINT16_MAX; //element in the innermost array, UINT16_MAX if an object member
+  uint8_t depth = 0;
+  const std::vector<uint16_t> *numbers = nullptr; //sj_arrayEnd: the numbers directly in the array
+};
+
+typedef std::function<void(const char *path, const StarJsonValue &value)> StarJsonFun;
+
+//collects small prints and passes them to out in chunks of size (e.g. a File or a network client)
+class StarJsonBufferedPrint: public Print {
+public:
+  StarJsonBufferedPrint(Print &out, size_t size = STARJSON_WRITE_BUFFER);
+  ~StarJsonBufferedPrint();
+
+  size_t write(uint8_t c) override {return write(&c, 1);}
+  size_t write(const uint8_t *data, size_t length) override;
+  bool flushBuffer(); //false if out did not take all, also after an earlier failure
 
-//Lazy Json Read Deserialize Write Serialize (write / serialize not implemented yet)
+private:
+  Print &out;
+  uint8_t *buffer;
+  size_t size;
+  size_t length = 0;
+  bool failed = false;
+};
+
+//Lazy Json Read Deserialize Write Serialize
 //ArduinoJson won't work on very large fixture.json, this does
-//only support what is currently needed: read / deserialize uint8/16/char var elements (arrays not yet)
+//read: SAX style, onPath callbacks for int32, float, bool, strings and (nested) arrays, block buffered, no allocation per nesting level
 class StarJson {
 
   public:
 
   explicit StarJson(const char * path, const char * mode = FILE_READ);
 
+  StarJson() {} //no file, to stream to another Print, see writeJsonVarTo
+
   ~StarJson();
 
   void addExclusion(const char * key);
+  //keys of an object not written if fun returns true, e.g. the value of read only vars
+  void addExclusion(const std::function<bool(JsonObject object, const char * key)> &fun) {exclusionFun = fun;}
 
   //serializeJson
   void writeJsonDocToFile(JsonDocument* dest);
+  //serializeJson of a part of a document (e.g. a module), returns false if the file could not be opened or written
+  bool writeJsonVarToFile(JsonVariant variant);
+  //serializeJson buffered to out (file, network client, ...) without keys added by addExclusion, false if out did not take all
+  bool writeJsonVarTo(Print &out, JsonVariant variant);
 
-  //look for uint8 var
-  // void lookFor(const char * id, uint8_t * value) {
-  //   // const char *p = (const char*)&value; //pointer trick
-  //   uint8List.push_back(value);
-  //   addToVars(id, "uint8", uint8List.size()-1);
-  // }
+  //call fun for the events in types (bitmask of 1 << StarJsonTypes) of path matching pattern
+  //pattern without '.': the last key of the path (e.g. "pin"), with '.': all keys, "*" matches any key (e.g. "leds.*.x")
+  void onPath(const char * pattern, const StarJsonFun &fun, uint16_t types = SJ_VALUES);
 
   void lookFor(const char * id, uint8_t * value);
-  // void lookFor(const char * id, uint16_t * value);
-  // void lookFor(const char * id, int * value);
-  void lookFor(const char * id, char * value);
+  void lookFor(const char * id, int32_t * value);
+  void lookFor(const char * id, float * value);
+  void lookFor(const char * id, bool * value);
+  void lookFor(const char * id, char * value); //assuming size 32
+  //array of integers, called for each array directly containing numbers (e.g. each x,y,z of an array of coordinates)
   void lookFor(const char * id, const std::function<void(std::vector<uint16_t>)>& fun);
 
-  //reads from file until all vars have been found (then stops reading)
-  //returns false if not all vars to look for are found
+  //reads from file until all paths looked for have been found (then stops reading)
+  //returns false if not all paths to look for are found
   bool deserialize(bool lazy = false);
 
 private:
-  struct VarDetails {
-    const char * id;
-    const char * type;
-    size_t index;
+  struct PathFun {
+    const char * pattern;
+    StarJsonFun fun;
+    uint16_t types;
+    bool found;
+  };
+
+  struct Level {
+    uint8_t pathLength; //path of the object or array
+    bool isArray;
+    bool expectKey; //object: next string is a key
+    uint16_t index; //array: current element
   };
 
   File f;
-  byte character; //the last character parsed
-  std::vector<VarDetails> varDetails; //details of vars looking for
-  std::vector<uint8_t *> uint8List; //pointer of uint8 to assign found values to (index of list stored in varDetails)
-  // std::vector<uint16_t *> uint16List; //same for uint16
-  // std::vector<int *> intList; //same for int
-  std::vector<char *> charList; //same for char
-  std::vector<std::function<void(std::vector<uint16_t>)>> funList; //same for function calls
-  std::vector<String> varStack; //objects and arrays store their names in a stack
-  bool collectNumbers = false; //array can ask to store all numbers found in array (now used for x,y,z coordinates)
-  std::vector<uint16_t> uint16CollectList; //collected numbers
-  char lastVarId[128] = ""; //last found var id in json
-  char beforeLastVarId[128] = ""; //last found var id in json
-  size_t foundCounter = 0; //count how many of the id's to lookFor have been actually found
+  std::vector<char *> exclusions; //keys not written
+  std::function<bool(JsonObject, const char *)> exclusionFun = nullptr; //keys not written, depending on the object
+  std::vector<PathFun> pathFuns;
+  size_t foundCounter = 0; //count how many of the patterns to look for have been actually found
   bool foundAll = false;
 
-  //called by lookedFor, store the var details in varDetails
-  void addToVars(const char * id, const char * type, size_t index);
-
-  void next();
-
-  void check(char * varId, char * value = nullptr);
-
-  //writeJsonVariantToFile calls itself recursively until whole json document has been parsed
-  void writeJsonVariantToFile(JsonVariant variant);
+  //parse state
+  char *buffer = nullptr;
+  size_t bufferPos = 0;
+  size_t bufferLength = 0;
+  Level levels[STARJSON_MAX_DEPTH];
+  uint8_t depth = 0;
+  char path[STARJSON_MAX_PATH] = "";
+  uint8_t pathLength = 0;
+  char token[STARJSON_MAX_TOKEN] = "";
+  bool collectNumbers = false; //an array fun is looked for
+  std::vector<uint16_t> uint16CollectList; //numbers in the innermost array
+
+  int nextChar() {
+    if (bufferPos == bufferLength) {
+      bufferLength = f.read((uint8_t *)buffer, STARJSON_BUFFER);
+      bufferPos = 0;
+      if (bufferLength == 0) return -1;
+    }
+    return (uint8_t)buffer[bufferPos++];
+  }
+
+  //one token starting with character c, returns the character after it (-1: end of file)
+  int parse(int c);
+  int parseString();
+  int parseScalar(int c);
+
+  void emit(StarJsonValue &value);
+  void valueDone();
+
+  //writeJsonVariant calls itself recursively for objects and arrays, other values by serializeJson
+  void writeJsonVariant(Print &out, JsonVariant variant);
 
 };
\ No newline at end of file
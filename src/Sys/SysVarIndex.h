@@ -0,0 +1,115 @@
+/*
+   @title     StarBase
+   @file      SysVarIndex.h
+   @date      20241219
+   @repo      https://github.com/ewowi/StarBase, submit changes to this file as PRs to ewowi/StarBase
+   @Authors   https://github.com/ewowi/StarBase/commits/main
+   @Copyright © 2024 Github StarBase Commit Authors
+   @license   GNU GENERAL PUBLIC LICENSE Version 3, 29 June 2007
+   @license   For non GPL-v3 usage, commercial licenses must be purchased. Contact moonmodules@icloud.com
+*/
+
+#pragma once
+
+#include "ArduinoJson.h"
+
+#include <unordered_map>
+
+//FNV-1a hash of pid.id, same on all instances (used as var key in the instances sync)
+inline uint32_t varIndexKey(const char * pid, const char * id) {
+  uint32_t hash = 2166136261;
+  for (const char *c = pid; *c; c++) hash = (hash ^ (uint8_t)*c) * 16777619;
+  hash = (hash ^ '.') * 16777619;
+  for (const char *c = id; *c; c++) hash = (hash ^ (uint8_t)*c) * 16777619;
+  return hash;
+}
+
+//entry of the pid.id index of the model: the var and the module (top level var) it belongs to
+struct VarIndexEntry {
+  JsonObject var; //the first var of pid.id's with this key (null if removed)
+  JsonObject moduleVar;
+  bool collided = false; //more pid.id's have this key: findVarByKey can not tell which one is meant
+};
+
+//pid.id -> var of the model (see SysModModel::findVar), json only so also benched natively (test/native)
+class VarIndex {
+
+public:
+
+  //var of pid.id, null if not indexed. walk set if pid.id collides with an indexed one: only found by walking the model
+  JsonObject find(const char * pid, const char * id, bool *walk = nullptr) const {
+    auto it = entries.find(varIndexKey(pid, id));
+    if (it == entries.end()) return JsonObject();
+    if (it->second.var["pid"] == pid && it->second.var["id"] == id) return it->second.var;
+    if (walk) *walk = true;
+    return JsonObject();
+  }
+
+  //module of pid.id, null if not indexed (or hash collision)
+  JsonObject findModule(const char * pid, const char * id) const {
+    auto it = entries.find(varIndexKey(pid, id));
+    return it != entries.end() && it->second.var["pid"] == pid && it->second.var["id"] == id?it->second.moduleVar:JsonObject();
+  }
+
+  //var of a varIndexKey, null if not indexed or if the key is of more than one var (hash collision)
+  JsonObject findByKey(uint32_t key) const {
+    auto it = entries.find(key);
+    return it != entries.end() && !it->second.collided?it->second.var:JsonObject();
+  }
+
+  //false if pid.id is a new hash collision (the var already indexed stays)
+  bool add(JsonObject var, JsonObject moduleVar) {
+    const char *pid = var["pid"];
+    const char *id = var["id"];
+    if (!pid || !id) return true;
+
+    uint32_t key = varIndexKey(pid, id);
+    auto it = entries.find(key);
+    if (it == entries.end())
+      entries[key] = {var, moduleVar};
+    else if (it->second.var.isNull() || (it->second.var["pid"] == pid && it->second.var["id"] == id)) { //removed or same pid.id
+      it->second.var = var;
+      it->second.moduleVar = moduleVar;
+    }
+    else if (!it->second.collided) {
+      it->second.collided = true; //findVar walks for the other one
+      return false;
+    }
+    return true;
+  }
+
+  //var only, not its children
+  void remove(JsonObject var) {
+    const char *pid = var["pid"];
+    const char *id = var["id"];
+    if (!pid || !id) return;
+
+    auto it = entries.find(varIndexKey(pid, id));
+    if (it != entries.end() && it->second.var["pid"] == pid && it->second.var["id"] == id) { //not if hash collision
+      if (it->second.collided)
+        it->second.var = JsonObject(); //keep the key ambiguous, findVar walks for the other one
+      else
+        entries.erase(it);
+    }
+  }
+
+  //(re)create from the modules of the model, returns the nr of hash collisions
+  uint16_t build(JsonArray model) {
+    entries.clear();
+    uint16_t collisions = 0;
+    for (JsonObject moduleVar: model) collisions += addTree(moduleVar, moduleVar);
+    return collisions;
+  }
+
+  size_t size() const {return entries.size();}
+
+private:
+  std::unordered_map<uint32_t, VarIndexEntry> entries; //hash of pid.id -> var, see varIndexKey
+
+  uint16_t addTree(JsonObject var, JsonObject moduleVar) {
+    uint16_t collisions = add(var, moduleVar)?0:1;
+    for (JsonObject childVar: var["n"].as<JsonArray>()) collisions += addTree(childVar, moduleVar);
+    return collisions;
+  }
+
+};
@@ -48,39 +48,11 @@ void SysModule::addPresets(JsonObject parentVar) {
     uint8_t presetValue = variable.var["value"];
     ppf("publish preset.onchange %s.%s [%d] %d %s\n", variable.pid(), variable.id(), rowNr, presetValue, variable.valueString().c_str());
 
-    if (presetValue == 0) return; else presetValue--;
-
-    JsonObject allPresets = mdl->presets->as<JsonObject>();
-
-    if (!allPresets.isNull()) {
-
-      JsonArray modulePresets = allPresets[name];
-      if (!modulePresets.isNull() && presetValue < modulePresets.size()) {
+    if (presetCache) presetCache->fades.clear(); //a running crossfade stops at the values it has reached
 
-        mdl->resetPresetThreshold--;
-
-        for (JsonPair pidPair: modulePresets[presetValue].as<JsonObject>()) {
-          for (JsonPair idPair: pidPair.value().as<JsonObject>()) {
-            ppf("load %s.%s: %s\n", pidPair.key().c_str(), idPair.key().c_str(), idPair.value().as<String>().c_str());
-            if (pidPair.key() != "name") { //preset name
-              JsonVariant jv = idPair.value();
-              if (jv.is<JsonArray>()) {
-                uint8_t rowNr = 0;
-                for (JsonVariant element: jv.as<JsonArray>()) {
-                  mdl->setValue(pidPair.key().c_str(), idPair.key().c_str(), element, rowNr++);
-                }
-              }
-              else
-                mdl->setValue(pidPair.key().c_str(), idPair.key().c_str(), jv);
-            }
-          }
-        }
-
-        mdl->resetPresetThreshold++;
-
-      }
-    }
+    if (presetValue == 0) return; else presetValue--;
 
+    applyPreset(presetValue);
   });
 
   currentVar = ui->initButton(parentVariable, "assignPreset", false);
@@ -137,7 +109,7 @@ void SysModule::addPresets(JsonObject parentVar) {
       modulePresets[presetIndex].to<JsonObject>();//empty
       mdl->walkThroughModel([modulePresets, presetIndex, &result](JsonObject parentVar, JsonObject var) {
         Variable variable = Variable(var);
-        if (!variable.readOnly() && var["id"] != "preset" && var["id"] != "assignPreset" && var["id"] != "clearPreset" && !var["value"].isNull()) { //exclude preset
+        if (!variable.readOnly() && var["id"] != "preset" && var["id"] != "assignPreset" && var["id"] != "clearPreset" && var["id"] != "crossfade" && !var["value"].isNull()) { //exclude preset
           ppf("save %s.%s: %s\n", variable.pid(), variable.id(), variable.valueString().c_str());
           modulePresets[presetIndex][variable.pid()][variable.id()] = var["value"];
 
@@ -162,6 +134,7 @@ void SysModule::addPresets(JsonObject parentVar) {
     if (result.length() == 0) result.format("Preset %d", presetIndex); //if no text found then default text
 
     modulePresets[presetIndex]["name"] = result.getString(); //store the text
+    if (presetCache) presetCache->valid = false; //compiled again by the next applyPreset
 
     presetVariable.publish(onUI); //reload ui for new list of values
 
@@ -198,6 +171,7 @@ void SysModule::addPresets(JsonObject parentVar) {
         if (presetValue < modulePresets.size()) {
 
           modulePresets[presetValue] = (char*)0; // set element in valArray to 0 (is content deleted from memory?)
+          if (presetCache) presetCache->valid = false; //compiled again by the next applyPreset
 
           // presetVariable.publish(onUI); //reload ui for new list of values
         }
@@ -219,6 +193,172 @@ void SysModule::addPresets(JsonObject parentVar) {
 
   });
 
+  ui->initNumber(parentVariable, "crossfade", &presetCrossfade, 0, 10000, false, [this](EventArguments) { switch (eventType) {
+    case onUI:
+      variable.setComment("ms, numbers and ranges fade to the preset");
+      return true;
+    case onLoop:
+      //runs while a crossfade is going on: frames on the var loop scheduler, idle (no cost) otherwise
+      if (!crossfadePreset()) ui->setLoopInterval(variable, 0);
+      return true;
+    default: return false;
+  }});
+
   // ui->initVCR(parentVariable, "vcr", false); //for next release
 
+}
+
+//value of a preset resolved by compilePresets: var handle, rowNr and typed value
+struct PresetValue {
+  WSValue value; //tag vt_count: not a bool, number or Coord3D, set from json
+  JsonVariant json; //the value in mdl->presets if tag is vt_count, valid until the presets of the module change
+  bool fade = false; //number or range: crossfaded
+};
+
+//number or range between two values during a crossfade
+struct PresetFade {
+  WSValue from; //tag vt_float or vt_int32
+  WSValue to; //the value of the preset, set at the end
+};
+
+struct PresetCache {
+  std::vector<std::vector<PresetValue>> presets; //per slot of the module presets, empty if the slot is empty
+  bool valid = false; //false after assignPreset and clearPreset
+  size_t handles = 0; //mdl->varHandles.size() at compile: vars made since then (e.g. controls of an effect) are resolved by a new compile
+  std::vector<PresetFade> fades; //of the running crossfade
+  unsigned long fadeStart = 0; //millis
+};
+
+static float presetFloat(const WSValue &wsValue) {
+  if (wsValue.tag != vt_float) return wsValue.value[0];
+  float value;
+  memcpy(&value, &wsValue.value[0], sizeof(value));
+  return value;
+}
+
+static void addPresetValue(std::vector<PresetValue> &presetValues, uint16_t handle, uint8_t rowNr, JsonVariant value, bool fade) {
+  PresetValue &presetValue = presetValues.emplace_back();
+  presetValue.value.handle = handle;
+  presetValue.value.rowNr = rowNr;
+  if (!web->valueToWSValue(value, presetValue.value)) {
+    presetValue.value.tag = vt_count;
+    presetValue.json = value;
+  }
+  presetValue.fade = fade && presetValue.value.tag != vt_count && presetValue.value.tag != vt_bool && presetValue.value.tag != vt_Coord3D;
+}
+
+void SysModule::compilePresets() {
+  if (!presetCache) presetCache = new PresetCache();
+  if (presetCache->valid && presetCache->handles == mdl->varHandles.size()) return;
+
+  unsigned long start = micros();
+  size_t count = 0;
+  presetCache->presets.clear();
+
+  JsonArray modulePresets = mdl->presets->as<JsonObject>()[name];
+  for (JsonVariant modulePreset: modulePresets) {
+    std::vector<PresetValue> &presetValues = presetCache->presets.emplace_back();
+    for (JsonPair pidPair: modulePreset.as<JsonObject>()) {
+      if (pidPair.key() == "name") continue; //preset name
+      for (JsonPair idPair: pidPair.value().as<JsonObject>()) {
+        JsonObject var = mdl->findVar(pidPair.key().c_str(), idPair.key().c_str());
+        if (var.isNull() || !var["h"].is<uint16_t>() || var["type"] == "button") continue; //not (yet) in the model
+        bool fade = var["type"] == "number" || var["type"] == "range";
+
+        //a value per row if the var has rows
+        JsonVariant value = idPair.value();
+        if (value.is<JsonArray>()) {
+          uint8_t rowNr = 0;
+          for (JsonVariant element: value.as<JsonArray>())
+            addPresetValue(presetValues, var["h"], rowNr++, element, fade);
+        }
+        else
+          addPresetValue(presetValues, var["h"], UINT8_MAX, value, fade);
+      }
+    }
+    count += presetValues.size();
+  }
+
+  presetCache->valid = true;
+  presetCache->handles = mdl->varHandles.size();
+  ppf("%s compilePresets %d presets %d values (%d µs)\n", name, presetCache->presets.size(), count, micros() - start);
+}
+
+void SysModule::applyPreset(uint8_t presetIndex) {
+  mdl->resetPresetThreshold--; //not a change by the UI: the preset stays selected
+  mdl->beginBatch();
+
+  //a value can make vars (e.g. the controls of an effect): compiled again and a second pass for their values (unchanged values are no-ops)
+  for (uint8_t pass = 0; pass < 2; pass++) {
+    compilePresets();
+    PresetCache &cache = *presetCache;
+    cache.fades.clear();
+    if (presetIndex >= cache.presets.size()) break;
+
+    for (const PresetValue &presetValue: cache.presets[presetIndex]) {
+      JsonObject var = mdl->findVarByHandle(presetValue.value.handle);
+      if (var.isNull()) continue; //deleted since the compile
+      Variable variable = Variable(var);
+
+      if (presetValue.fade && presetCrossfade) {
+        PresetFade fade;
+        fade.from = presetValue.value;
+        fade.to = presetValue.value;
+        if (web->valueToWSValue(variable.value(presetValue.value.rowNr), fade.from) && fade.from.tag != vt_bool && fade.from.tag != vt_Coord3D) {
+          cache.fades.push_back(fade); //the first frame sets it
+          continue;
+        }
+      }
+
+      if (presetValue.value.tag == vt_count)
+        variable.setValue(presetValue.json, presetValue.value.rowNr);
+      else
+        web->setWSValue(variable, presetValue.value);
+    }
+
+    if (cache.handles == mdl->varHandles.size()) break; //no vars made
+  }
+
+  mdl->endBatch(mdl->findVar("m", name));
+  mdl->resetPresetThreshold++;
+
+  if (!presetCache->fades.empty()) {
+    presetCache->fadeStart = millis();
+    ui->setLoopInterval(Variable(name, "crossfade"), VARLOOP_INTERVAL); //runs crossfadePreset
+  }
+}
+
+bool SysModule::crossfadePreset() {
+  if (!presetCache || presetCache->fades.empty()) return false;
+  PresetCache &cache = *presetCache;
+
+  float progress = presetCrossfade?min((float)(millis() - cache.fadeStart) / presetCrossfade, 1.0f):1.0f;
+
+  mdl->resetPresetThreshold--;
+  mdl->beginBatch();
+
+  for (const PresetFade &fade: cache.fades) {
+    JsonObject var = mdl->findVarByHandle(fade.to.handle);
+    if (var.isNull()) continue;
+
+    if (progress >= 1.0f)
+      web->setWSValue(Variable(var), fade.to); //exactly the value of the preset
+    else {
+      WSValue wsValue = fade.to;
+      float value = presetFloat(fade.from) + (presetFloat(fade.to) - presetFloat(fade.from)) * progress;
+      if (fade.to.tag == vt_float)
+        memcpy(&wsValue.value[0], &value, sizeof(value));
+      else {
+        wsValue.tag = vt_int32; //from and to can be of different integer tags
+        wsValue.value[0] = lroundf(value);
+      }
+      web->setWSValue(Variable(var), wsValue);
+    }
+  }
+
+  mdl->endBatch(mdl->findVar("m", name));
+  mdl->resetPresetThreshold++;
+
+  if (progress >= 1.0f) cache.fades.clear();
+  return !cache.fades.empty();
 }
\ No newline at end of file
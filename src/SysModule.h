@@ -86,19 +86,99 @@ class StarString {
 
 };
 
+//kinds of loops of a module, see SysModule::stats
+enum loopKinds
+{
+  lk_loop,
+  lk_20ms,
+  lk_1s,
+  lk_10s,
+  lk_count
+};
+
+//summary of LoopStats of the last window
+struct LoopSummary {
+  uint32_t count = 0;
+  uint32_t min = 0; //micros
+  uint32_t avg = 0;
+  uint32_t max = 0;
+  uint32_t p99 = 0; //upper bound of the histogram bucket
+  unsigned long maxMillis = 0; //millis() when max happened
+};
+
+//durations of one loop kind of a module in the current window, cheap enough to always collect (no allocations, a few adds per sample)
+struct LoopStats {
+  static const uint8_t nrOfBuckets = 16; //bucket b: durations < 2^b micros, last bucket: all above
+  uint32_t count = 0;
+  uint64_t sum = 0; //micros
+  uint32_t lowest = UINT32_MAX; //micros
+  uint32_t highest = 0;
+  unsigned long highestMillis = 0;
+  uint32_t buckets[nrOfBuckets] = {};
+
+  void add(uint32_t micros) {
+    count++;
+    sum += micros;
+    if (micros < lowest) lowest = micros;
+    if (micros > highest) {
+      highest = micros;
+      highestMillis = millis();
+    }
+    uint8_t bucket = micros?32 - __builtin_clz(micros):0;
+    buckets[bucket < nrOfBuckets?bucket:nrOfBuckets - 1]++;
+  }
+
+  //summary of the window and start a new one
+  LoopSummary roll() {
+    LoopSummary summary;
+    summary.count = count;
+    if (count) {
+      summary.min = lowest;
+      summary.avg = sum / count;
+      summary.max = highest;
+      summary.maxMillis = highestMillis;
+      //p99: first bucket where 99% of the samples are in, capped by max
+      uint32_t threshold = count - count / 100, total = 0;
+      for (uint8_t bucket = 0; bucket < nrOfBuckets; bucket++) {
+        total += buckets[bucket];
+        if (total >= threshold) {
+          uint32_t upper = (1UL << bucket) - 1;
+          summary.p99 = (bucket < nrOfBuckets - 1 && upper < highest)?upper:highest;
+          break;
+        }
+      }
+    }
+    *this = LoopStats();
+    return summary;
+  }
+};
+
+struct PresetCache; //presets of a module compiled to var handles and typed values, see SysModule::compilePresets
+
 class SysModule {
 
 public:
   const char * name;
   bool success;
   bool isEnabled;
-  unsigned long twentyMsMillis = millis() - random(1000); //random so not all 1s are fired at once
-  unsigned long oneSecondMillis = millis() - random(1000); //random so not all 1s are fired at once
-  unsigned long tenSecondMillis = millis() - random(10000); //random within a second
   // void (SysModule::*loopCached)() = &SysModule::loop; //use virtual cached function for speed??? tested, no difference ...
 
   unsigned long cpuTime = 0;
 
+  //scheduling of loop20ms, loop1s and loop10s, see ModuleScheduler
+  unsigned long jitter = 0; //max lateness of the timers (micros), reset every second by Modules
+  uint16_t overruns = 0; //timers more than a period late (runs skipped), reset every second by Modules
+  unsigned long timerCycles = 0; //cycles of the timers since last loop, added to cpuTime
+
+  //boot profile, measured by SysModules::setup
+  unsigned long setupMicros = 0;
+  int32_t setupHeap = 0; //bytes of heap used by setup
+  uint16_t setupVars = 0; //vars made by setup
+
+  //profiling per loop kind, see SysModules::perfToJson
+  LoopStats stats[lk_count]; //current window
+  LoopSummary summaries[lk_count]; //last window
+
   explicit SysModule(const char * name) {
     this->name = name;
     success = true;
@@ -118,5 +198,15 @@ public:
   virtual void enabledChanged() {onOffChanged();}
   virtual void onOffChanged() {}
 
+  //presets
+  uint16_t presetCrossfade = 0; //ms numbers and ranges fade to the values of a preset, 0: set at once
+  PresetCache *presetCache = nullptr; //made by the first compilePresets
+
   void addPresets(JsonObject parentVar);
+  //resolve the presets of this module in mdl->presets to var handles and typed values, if changed since the last compile
+  void compilePresets();
+  //set all values of a preset in one batch: one response, the module made dirty once. Numbers and ranges crossfade if presetCrossfade
+  void applyPreset(uint8_t presetIndex);
+  //next frame of the crossfade, false if done
+  bool crossfadePreset();
 };
\ No newline at end of file
@@ -17,6 +17,66 @@
 #include "Sys/SysModPins.h"
 #include "Sys/SysModSystem.h"
 
+//period per moduleTimers in micros
+static const unsigned long timerPeriods[mt_count] = {20000, 1000000, 10000000};
+
+static uint32_t cpuMHz = 240; //to convert cycles to micros for LoopStats, set in setup
+
+//heap compare: later due is lower priority (micros wrap safe)
+static bool dueLater(const ModuleTimer &a, const ModuleTimer &b) {
+  return (long)(a.due - b.due) > 0;
+}
+
+void ModuleScheduler::add(SysModule *module) {
+  unsigned long now = micros();
+  for (uint8_t timer = 0; timer < mt_count; timer++) {
+    timers.push_back({now + random(timerPeriods[timer]), module, timer});
+    std::push_heap(timers.begin(), timers.end(), dueLater);
+  }
+}
+
+uint16_t ModuleScheduler::run(unsigned long budget) {
+  unsigned long start = micros();
+  uint16_t count = 0;
+
+  while (!timers.empty()) {
+    unsigned long now = micros();
+    if ((long)(now - timers.front().due) < 0) break; //nothing due
+    if (count && now - start >= budget) break; //rest in next pass (they will show as jitter)
+
+    std::pop_heap(timers.begin(), timers.end(), dueLater);
+    ModuleTimer timer = timers.back();
+    timers.pop_back();
+
+    SysModule *module = timer.module;
+    bool active = module->isEnabled && module->success;
+    if (active) {
+      if (now - timer.due > module->jitter) module->jitter = now - timer.due;
+      uint32_t cycles = ESP.getCycleCount();
+      switch (timer.timer) {
+        case mt_20ms: module->loop20ms(); break;
+        case mt_1s: module->loop1s(); break;
+        case mt_10s: module->loop10s(); break;
+      }
+      cycles = ESP.getCycleCount() - cycles;
+      module->timerCycles += cycles;
+      module->stats[lk_20ms + timer.timer].add(cycles / cpuMHz);
+      count++;
+    }
+
+    //next due on the grid of the period (no drift), if already passed skip to now + period (no catch up bursts)
+    timer.due += timerPeriods[timer.timer];
+    if ((long)(micros() - timer.due) >= 0) {
+      if (active) module->overruns++;
+      timer.due = micros() + timerPeriods[timer.timer];
+    }
+    timers.push_back(timer);
+    std::push_heap(timers.begin(), timers.end(), dueLater);
+  }
+
+  return count;
+}
+
 SysModules::SysModules() = default;
 
 void SysModules::setup() {
@@ -28,9 +88,28 @@ void SysModules::setup() {
 
   #endif
 
+  cpuMHz = ESP.getCpuFreqMHz();
+
+  //lazy UI (Modules.lazyUI, model loaded by the SysModModel constructor): no UI responses while no client is connected
+  JsonVariant lazyUI = mdl->getValue("Modules", "lazyUI");
+  web->lazyUI = !lazyUI.isNull() && lazyUI.as<bool>();
+
+  unsigned long bootStart = micros();
   for (SysModule *module:modules) {
+    unsigned long setupStart = micros();
+    uint32_t freeHeap = ESP.getFreeHeap();
+    size_t vars = mdl->varHandles.size(); //each var gets a handle
+
     module->setup();
+
+    module->setupMicros = micros() - setupStart;
+    module->setupHeap = (int32_t)freeHeap - (int32_t)ESP.getFreeHeap();
+    module->setupVars = mdl->varHandles.size() - vars;
   }
+  ppf("setup modules %lu ms%s\n", (micros() - bootStart) / 1000, web->lazyUI?" (lazy UI)":"");
+
+  for (SysModule *module:modules)
+    scheduler.add(module);
 
   //delete Modules values if nr of modules has changed (new values created using module defaults)
   for (JsonObject childVar: Variable("Modules", "Modules").children()) {
@@ -52,19 +131,20 @@ void SysModules::setup() {
   }});
 
   ui->initText(tableVar, "name", nullptr, 32, true, [this](EventArguments) { switch (eventType) {
-    case onSetValue:
-      for (size_t rowNr = 0; rowNr < modules.size(); rowNr++)
-        variable.setValue(JsonString(modules[rowNr]->name), rowNr);
-      return true;
+    case onSetValue: {
+      std::vector<JsonString> values; for (SysModule *module: modules) values.push_back(JsonString(module->name));
+      variable.setValues(values);
+      return true; }
     default: return false;
   }});
 
   //UINT8_MAX: tri state boolean: not true not false
   ui->initCheckBox(tableVar, "success", UINT8_MAX, true, [this](EventArguments) { switch (eventType) {
-    case onSetValue:
-      for (size_t rowNr = 0; rowNr < modules.size(); rowNr++)
-        variable.setValue(modules[rowNr]->success, rowNr);
-      return true;
+    case onSetValue: {
+      bool values[UINT8_MAX]; uint8_t count = 0; //no vector<bool>
+      for (SysModule *module: modules) if (count < UINT8_MAX) values[count++] = module->success;
+      variable.setValues(values, count);
+      return true; }
     default: return false;
   }});
 
@@ -73,14 +153,20 @@ void SysModules::setup() {
     case onSetValue:
       //never a rowNr as parameter, set all
       //execute only if var has not been set
-      for (size_t rowNr = 0; rowNr < modules.size(); rowNr++)
-        variable.setValue(modules[rowNr]->isEnabled, rowNr);
+      {
+        bool values[UINT8_MAX]; uint8_t count = 0; //no vector<bool>
+        for (SysModule *module: modules) if (count < UINT8_MAX) values[count++] = module->isEnabled;
+        variable.setValues(values, count);
+      }
       return true;
     case onChange:
       if (rowNr != UINT8_MAX && rowNr < modules.size()) {
         modules[rowNr]->isEnabled = variable.getValue(rowNr);
         modules[rowNr]->enabledChanged();
       }
+      else if (rowNr == UINT8_MAX) {
+        //all rows set by onSetValue (setValues), from isEnabled: nothing changed
+      }
       else {
         ppf(" no rowNr or %d > modules.size %d!!\n", rowNr, modules.size());
       }
@@ -92,59 +178,106 @@ void SysModules::setup() {
   Variable currentVar = ui->initText(tableVar, "cpuTime", nullptr, 32, true);
 
   currentVar.subscribe(onSetValue, [this](Variable variable, uint8_t rowNr, uint8_t eventType) {
+      std::vector<StarString> texts(modules.size());
+      std::vector<JsonString> values;
       for (size_t rowNr = 0; rowNr < modules.size(); rowNr++) {
-        StarString buf;
         uint16_t lps = modules[rowNr]->cpuTime?ESP.getCpuFreqMHz() * 1000000 / modules[rowNr]->cpuTime:0; //lps
         if (lps > 2000)
-          variable.setValue("~0", rowNr);
+          values.push_back("~0");
         else if (lps) {
-          buf.format("%d ms %d lps", 1000 / lps, lps);
-          variable.setValue(JsonString(buf.getString()), rowNr);
+          texts[rowNr].format("%d ms %d lps", 1000 / lps, lps);
+          values.push_back(JsonString(texts[rowNr].getString()));
         }
         else 
-          variable.setValue("0", rowNr);
-
+          values.push_back("0");
       }
+      variable.setValues(values);
   });
 
   currentVar.subscribe(onLoop1s, [this](Variable variable, uint8_t rowNr, uint8_t eventType) {
     variable.triggerEvent(onSetValue);
   });
 
+  currentVar = ui->initText(tableVar, "jitter", nullptr, 32, true);
+
+  currentVar.subscribe(onSetValue, [this](Variable variable, uint8_t rowNr, uint8_t eventType) {
+    std::vector<StarString> texts(modules.size());
+    std::vector<JsonString> values;
+    for (size_t rowNr = 0; rowNr < modules.size(); rowNr++) {
+      texts[rowNr].format("%lu µs %d over", modules[rowNr]->jitter, modules[rowNr]->overruns);
+      values.push_back(JsonString(texts[rowNr].getString()));
+      //per second
+      modules[rowNr]->jitter = 0;
+      modules[rowNr]->overruns = 0;
+    }
+    variable.setValues(values);
+  });
+
+  currentVar.subscribe(onLoop1s, [this](Variable variable, uint8_t rowNr, uint8_t eventType) {
+    variable.triggerEvent(onSetValue);
+  });
+
+  ui->initText(tableVar, "setup", nullptr, 32, true, [this](EventArguments) { switch (eventType) {
+    case onSetValue: {
+      std::vector<StarString> texts(modules.size());
+      std::vector<JsonString> values;
+      for (size_t rowNr = 0; rowNr < modules.size(); rowNr++) {
+        texts[rowNr].format("%lu ms %d B %d vars", modules[rowNr]->setupMicros / 1000, modules[rowNr]->setupHeap, modules[rowNr]->setupVars);
+        values.push_back(JsonString(texts[rowNr].getString()));
+      }
+      variable.setValues(values);
+      return true; }
+    case onUI:
+      variable.setComment("Boot: time, heap and vars of setup");
+      return true;
+    default: return false;
+  }});
+
+  ui->initNumber(parentVar, "passBudget", &passBudget, 1, 1000, false, [](EventArguments) { switch (eventType) {
+    case onUI:
+      variable.setComment("Max ms of 20ms, 1s and 10s loops per loop");
+      return true;
+    default: return false;
+  }});
+
+  ui->initCheckBox(parentVar, "lazyUI", (bool3State)false, false, [](EventArguments) { switch (eventType) {
+    case onUI:
+      variable.setComment("No values, labels and comments for the UI until a client connects (they get the model then), less memory at boot on headless nodes");
+      return true;
+    case onChange:
+      web->lazyUI = variable.value().as<bool>();
+      return true;
+    default: return false;
+  }});
+
 }
 
 void SysModules::loop() {
-  // bool oneSec = false;
-  // bool tenSec = false;
-  // if (millis() - oneSecondMillis >= 1000) {
-  //   oneSecondMillis = millis();
-  //   oneSec = true;
-  // }
-  // if (millis() - tenSecondMillis >= 10000) {
-  //   tenSecondMillis = millis();
-  //   tenSec = true;
-  // }
+  //commands received by the AsyncTCP task, applied before the modules run
+  web->processCommands();
+
+  scheduler.run(passBudget * 1000);
+
   for (SysModule *module:modules) {
     if (module->isEnabled && module->success) {
       uint32_t cycles = ESP.getCycleCount();
       module->loop();
       // (module->*module->loopCached)(); //use virtual cached function for speed??? tested, no difference ...
-      if (millis() - module->twentyMsMillis >= 20) {
-        module->twentyMsMillis = millis();
-        module->loop20ms(); //use virtual cached function for speed???
-      }
-      if (millis() - module->oneSecondMillis >= 1000) {
-        module->oneSecondMillis = millis();
-        module->loop1s();
-      }
-      if (millis() - module->tenSecondMillis >= 10000) {
-        module->tenSecondMillis = millis();
-        module->loop10s();
-      }
-      module->cpuTime = (ESP.getCycleCount() - cycles);
+      cycles = ESP.getCycleCount() - cycles;
+      module->stats[lk_loop].add(cycles / cpuMHz);
+      module->cpuTime = cycles + module->timerCycles;
+      module->timerCycles = 0;
     }
   }
 
+  //new profiling window
+  if (millis() - perfMillis >= perfWindow) {
+    perfMillis = millis();
+    for (SysModule *module:modules)
+      for (uint8_t kind = 0; kind < lk_count; kind++)
+        module->summaries[kind] = module->stats[kind].roll();
+  }
+
   #ifdef STARBASE_BOOT_BUTTON_PIN
 
     if (digitalRead(STARBASE_BOOT_BUTTON_PIN) == 0) { //pressed
@@ -170,6 +303,30 @@ void SysModules::loop() {
   }
 }
 
+void SysModules::perfToJson(JsonObject root) {
+  static const char * kindNames[lk_count] = {"loop", "loop20ms", "loop1s", "loop10s"};
+  root["window"] = perfWindow;
+  root["windowAge"] = millis() - perfMillis; //ms since the summaries were made
+  root["uptime"] = millis();
+  JsonArray modulesArray = root["modules"].to<JsonArray>();
+  for (SysModule *module:modules) {
+    JsonObject moduleObject = modulesArray.add<JsonObject>();
+    moduleObject["name"] = module->name;
+    moduleObject["enabled"] = module->isEnabled && module->success;
+    for (uint8_t kind = 0; kind < lk_count; kind++) {
+      const LoopSummary &summary = module->summaries[kind];
+      if (summary.count == 0) continue;
+      JsonObject kindObject = moduleObject[kindNames[kind]].to<JsonObject>();
+      kindObject["n"] = summary.count;
+      kindObject["min"] = summary.min;
+      kindObject["avg"] = summary.avg;
+      kindObject["max"] = summary.max;
+      kindObject["p99"] = summary.p99;
+      kindObject["maxAt"] = summary.maxMillis;
+    }
+  }
+}
+
 void SysModules::reboot() {
   for (SysModule *module:modules) {
     module->reboot();
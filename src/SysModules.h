@@ -12,11 +12,41 @@
 #pragma once
 #include "SysModule.h"
 
+enum moduleTimers
+{
+  mt_20ms, //loop20ms
+  mt_1s, //loop1s
+  mt_10s, //loop10s
+  mt_count
+};
+
+//next run of a timer of a module
+struct ModuleTimer {
+  unsigned long due; //micros
+  SysModule *module;
+  uint8_t timer; //see moduleTimers
+};
+
+//timer queue of the modules run by loopTask, ordered by due time
+class ModuleScheduler {
+public:
+  //add the timers of module, staggered so not all modules fire at once
+  void add(SysModule *module);
+
+  //run the due timers until budget (micros) is used (at least one), returns the number of timers run
+  uint16_t run(unsigned long budget);
+
+private:
+  std::vector<ModuleTimer> timers; //min heap on due
+};
+
 class SysModules {
 public:
   bool newConnection = false;
   bool isConnected = false;
   uint32_t buttonPressedTime = 0;
+  uint16_t passBudget = 10; //max time of the timers per loop (ms), the rest waits for the next loop
+  unsigned long perfWindow = 10000; //ms of the profiling window (see LoopStats)
 
   SysModules();
 
@@ -30,10 +60,13 @@ public:
 
   void connectedChanged();
 
+  //loop statistics of the last window per module and loop kind (micros), served on /json/perf
+  void perfToJson(JsonObject root);
+
 private:
   std::vector<SysModule *> modules;
-  // unsigned long oneSecondMillis = 0;
-  // unsigned long tenSecondMillis = millis() - 4500;
+  ModuleScheduler scheduler; //timers of the modules
+  unsigned long perfMillis = 0; //start of the current profiling window
 };
 
 extern SysModules *mdls;
\ No newline at end of file
@@ -0,0 +1,251 @@
+/*
+   @title     StarBase
+   @file      DMXPatcher.h
+   @date      20241219
+   @repo      https://github.com/ewowi/StarBase, submit changes to this file as PRs to ewowi/StarBase
+   @Authors   https://github.com/ewowi/StarBase/commits/main
+   @Copyright © 2024 Github StarBase Commit Authors
+   @license   GNU GENERAL PUBLIC LICENSE Version 3, 29 June 2007
+   @license   For non GPL-v3 usage, commercial licenses must be purchased. Contact moonmodules@icloud.com
+*/
+
+#pragma once
+
+#include "SysModules.h"
+
+#define DMX_CHANNELS 512 //per universe, without start code
+#define DMX_MAX_UNIVERSES 4
+#define DMX_SEQUENCE_WINDOW 20 //sequence numbers up to 20 before the last are late (E1.31 6.7.2), discarded
+
+//patches DMX channels to variables (pid.id with max scaling), shared by the DMX input modules (E1.31, Art-Net, DDP)
+//feed / feedChannels may be called from the UDP task, apply from the loopTask. No heap allocation per packet
+class DMXPatcher {
+
+public:
+
+  uint16_t channel = 1; //first channel of the patches
+  uint16_t universe = 1; //first universe
+  uint16_t universeCount = 1;
+
+  //stats per second, shown in stats
+  uint16_t packetsCounter = 0;
+  uint16_t framesCounter = 0;
+  uint16_t lostCounter = 0;
+
+  //universe, universeCount (if universes), channel, the patches table and stats in parentVar
+  void setupUI(const Variable &parentVar, bool universes = true, int maxUniverse = 7) {
+    if (universes) {
+      ui->initNumber(parentVar, "universe", &universe, 0, maxUniverse, false, [](EventArguments) { switch (eventType) {
+        case onUI:
+          variable.setComment("First universe");
+          return true;
+        default: return false;
+      }});
+
+      ui->initNumber(parentVar, "universeCount", &universeCount, 1, DMX_MAX_UNIVERSES, false, [this](EventArguments) { switch (eventType) {
+        case onUI:
+          variable.setComment("Patches can span universes");
+          return true;
+        case onChange:
+          indexPatches();
+          return true;
+        default: return false;
+      }});
+    }
+
+    Variable currentVar = ui->initNumber(parentVar, "channel", &channel, 1, 512, false, [this](EventArguments) { switch (eventType) {
+      case onUI:
+        variable.setComment("First channel");
+        return true;
+      case onChange:
+        indexPatches();
+        for (JsonObject childVar: Variable(variable.pid(), "patches").children())
+          Variable(childVar).triggerEvent(onSetValue); //set the value (WIP)
+        return true;
+      default: return false;
+    }});
+    currentVar.var["dash"] = true;
+
+    Variable tableVar = ui->initTable(parentVar, "patches", nullptr, true, [](EventArguments) { switch (eventType) {
+      case onUI:
+        variable.setComment("Variables to watch");
+        return true;
+      default: return false;
+    }});
+
+    ui->initNumber(tableVar, "channel", UINT16_MAX, 1, 512, true, [this](EventArguments) { switch (eventType) {
+      case onSetValue: {
+        std::vector<uint16_t> values; for (size_t rowNr = 0; rowNr < varsToWatch.size(); rowNr++) values.push_back(channel + varsToWatch[rowNr].channelOffset);
+        variable.setValues(values);
+        return true; }
+      default: return false;
+    }});
+
+    ui->initText(tableVar, "variable", nullptr, 32, true, [this](EventArguments) { switch (eventType) {
+      case onSetValue: {
+        std::vector<JsonString> values; for (const VarToWatch &varToWatch: varsToWatch) values.push_back(JsonString(varToWatch.id));
+        variable.setValues(values);
+        return true; }
+      default: return false;
+    }});
+
+    ui->initNumber(tableVar, "max", UINT16_MAX, 0, UINT16_MAX, true, [this](EventArguments) { switch (eventType) {
+      case onSetValue: {
+        std::vector<uint16_t> values; for (size_t rowNr = 0; rowNr < varsToWatch.size(); rowNr++) values.push_back(varsToWatch[rowNr].max);
+        variable.setValues(values);
+        return true; }
+      default: return false;
+    }});
+
+    ui->initNumber(tableVar, "value", UINT16_MAX, 0, 255, true, [this](EventArguments) { switch (eventType) {
+      case onSetValue: {
+        std::vector<uint16_t> values; for (size_t rowNr = 0; rowNr < varsToWatch.size(); rowNr++) values.push_back(varsToWatch[rowNr].savedValue);
+        variable.setValues(values);
+        return true; }
+      default: return false;
+    }});
+
+    ui->initText(parentVar, "stats", nullptr, 32, true, [this](EventArguments) { switch (eventType) {
+      case onLoop1s:
+        variable.setValueF("%d P/s %d fps L:%d", packetsCounter, framesCounter / universeCount, lostCounter);
+        packetsCounter = 0;
+        framesCounter = 0;
+        lostCounter = 0;
+        return true;
+      case onUI:
+        variable.setComment("Packets, frames per universe and lost (sequence gaps) per second");
+        return true;
+      default: return false;
+    }});
+  }
+
+  void patchChannel(uint8_t channelOffset, const char * pid, const char * id, uint8_t max = 255) {
+    VarToWatch varToWatch;
+    varToWatch.channelOffset = channelOffset;
+    varToWatch.pid = pid;
+    varToWatch.id = id;
+    varToWatch.savedValue = 0; // Always reset when (re)patching so variable gets set to DMX value even if unchanged
+    varToWatch.newValue = 0;
+    varToWatch.max = max;
+    xSemaphoreTake(patchMutex, portMAX_DELAY);
+    varsToWatch.push_back(varToWatch);
+    xSemaphoreGive(patchMutex);
+    indexPatches();
+  }
+
+  //universe and slot of each patch (channel + channelOffset counted over the universes), so feed does not search the channels
+  void indexPatches() {
+    xSemaphoreTake(patchMutex, portMAX_DELAY);
+    for (std::vector<uint8_t> &patches: universePatches) patches.clear();
+    for (size_t patchNr = 0; patchNr < varsToWatch.size(); patchNr++) {
+      VarToWatch &varToWatch = varsToWatch[patchNr];
+      uint16_t address = channel + varToWatch.channelOffset - 1; //0 based over all universes
+      varToWatch.universeIndex = address / DMX_CHANNELS;
+      varToWatch.slot = address % DMX_CHANNELS;
+      if (varToWatch.universeIndex < DMX_MAX_UNIVERSES)
+        universePatches[varToWatch.universeIndex].push_back(patchNr);
+      else
+        ppf("dev DMXPatcher patch %s.%s beyond %d universes\n", varToWatch.pid, varToWatch.id, DMX_MAX_UNIVERSES);
+    }
+    xSemaphoreGive(patchMutex);
+  }
+
+  //false if the packet is late or a duplicate, counts gaps as lost. sequence: 0..modulo-1, -1: sequence not used by the sender
+  bool acceptSequence(uint8_t universeIndex, int16_t sequence, uint16_t modulo) {
+    if (sequence < 0 || universeIndex >= DMX_MAX_UNIVERSES) return true;
+    UniverseState &state = universeStates[universeIndex];
+    int16_t gap = (sequence - state.sequence + modulo) % modulo;
+    if (gap > modulo / 2) gap -= modulo; //before the last
+    if (state.received && gap <= 0 && gap > -min((int16_t)DMX_SEQUENCE_WINDOW, (int16_t)(modulo / 4))) return false;
+    if (state.received && gap > 1) lostCounter += gap - 1;
+    state.sequence = sequence;
+    state.received = true;
+    return true;
+  }
+
+  //channel values of a universe: slots[0] is channel 1 (no start code). The newest value per patch wins until apply
+  void feed(uint8_t universeIndex, const uint8_t *slots, uint16_t count) {
+    if (universeIndex >= DMX_MAX_UNIVERSES) return;
+    if (xSemaphoreTake(patchMutex, 0) != pdTRUE) return; //(re)patching: skip this packet, do not block the UDP task
+    for (uint8_t patchNr: universePatches[universeIndex]) {
+      VarToWatch &varToWatch = varsToWatch[patchNr];
+      if (varToWatch.slot < count) {
+        varToWatch.newValue = slots[varToWatch.slot];
+        fresh = true;
+      }
+    }
+    xSemaphoreGive(patchMutex);
+  }
+
+  //channel values without universes (e.g. DDP offset): firstChannel is 0 based counted over all universes
+  void feedChannels(uint32_t firstChannel, const uint8_t *data, uint16_t count) {
+    if (xSemaphoreTake(patchMutex, 0) != pdTRUE) return;
+    for (VarToWatch &varToWatch: varsToWatch) {
+      uint32_t address = varToWatch.universeIndex * DMX_CHANNELS + varToWatch.slot;
+      if (address >= firstChannel && address < firstChannel + count) {
+        varToWatch.newValue = data[address - firstChannel];
+        fresh = true;
+      }
+    }
+    xSemaphoreGive(patchMutex);
+  }
+
+  //set the variables of the changed patches, call from the loopTask
+  void apply() {
+    if (!fresh) return;
+    fresh = false;
+
+    for (VarToWatch &varToWatch : varsToWatch) {
+      uint8_t newValue = varToWatch.newValue; //a byte, written atomically by feed
+      if (newValue != varToWatch.savedValue) {
+
+        ppf("DMX U:%u CH%d: %u -> %u", universe + varToWatch.universeIndex, varToWatch.slot + 1, varToWatch.savedValue, newValue);
+
+        varToWatch.savedValue = newValue;
+
+        if (varToWatch.id != nullptr && varToWatch.max != 0) {
+          ppf(" varsToWatch: %s.%s\n", varToWatch.pid, varToWatch.id);
+          //patched vars are set at DMX rate: by handle (no pid.id lookup) and hot (compared with their shadow)
+          JsonObject var = mdl->findVarByHandle(varToWatch.handle);
+          if (var.isNull()) {
+            var = mdl->findVar(varToWatch.pid, varToWatch.id);
+            if (!var.isNull() && var["h"].is<uint16_t>()) {
+              varToWatch.handle = var["h"];
+              shadows.add(varToWatch.handle);
+            }
+          }
+          if (!var.isNull())
+            Variable(var).setValue(varToWatch.savedValue%(varToWatch.max+1)); // TODO: ugly to have magic string
+          else
+            ppf("setValue var %s.%s not found\n", varToWatch.pid, varToWatch.id);
+        }
+        else
+          ppf("\n");
+      }//!= savedValue
+    } //for varToWatch
+  }
+
+  private:
+    struct VarToWatch {
+      uint16_t channelOffset;
+      const char * pid = nullptr;
+      const char * id = nullptr;
+      uint16_t max = -1;
+      uint8_t savedValue = -1;
+      uint8_t newValue = -1; //last received
+      uint8_t universeIndex = 0; //see indexPatches
+      uint16_t slot = 0; //0 based channel in the universe
+      uint16_t handle = UINT16_MAX; //of the var, found at the first apply
+    };
+
+    struct UniverseState {
+      uint16_t sequence = 0; //last accepted
+      bool received = false;
+    };
+
+    std::vector<VarToWatch> varsToWatch;
+    std::vector<uint8_t> universePatches[DMX_MAX_UNIVERSES]; //varsToWatch index per universe
+    UniverseState universeStates[DMX_MAX_UNIVERSES];
+    volatile bool fresh = false; //newValues received since apply
+    SemaphoreHandle_t patchMutex = xSemaphoreCreateMutex(); //feed (UDP task) against patch changes (loopTask), no critical section as patching allocates
+};
@@ -0,0 +1,96 @@
+/*
+   @title     StarBase
+   @file      UserModArtNetIn.h
+   @date      20241219
+   @repo      https://github.com/ewowi/StarBase, submit changes to this file as PRs to ewowi/StarBase
+   @Authors   https://github.com/ewowi/StarBase/commits/main
+   @Copyright © 2024 Github StarBase Commit Authors
+   @license   GNU GENERAL PUBLIC LICENSE Version 3, 29 June 2007
+   @license   For non GPL-v3 usage, commercial licenses must be purchased. Contact moonmodules@icloud.com
+*/
+
+#pragma once
+#include <AsyncUDP.h>
+
+#include "SysModules.h"
+#include "DMXPatcher.h"
+
+#define ARTNET_PORT 6454
+#define ARTNET_OPDMX 0x5000
+#define ARTNET_DMX_HEADER 18 //ID[8], OpCode[2], ProtVer[2], Sequence, Physical, SubUni, Net, Length[2]
+
+//Art-Net input: ArtDmx packets patched to variables, see DMXPatcher
+class UserModArtNetIn:public SysModule {
+
+public:
+
+  UserModArtNetIn() :SysModule("ArtNetIn") {
+    isEnabled = false; //default not enabled
+  };
+
+  void setup() override {
+    SysModule::setup();
+
+    const Variable parentVar = ui->initUserMod(Variable(), name, 6202);
+
+    dmx.setupUI(parentVar, true, 32767); //15 bit port address: Net, SubNet, Universe
+  }
+
+  void onOffChanged() {
+    if (mdls->isConnected && isEnabled) {
+      ppf("UserModArtNetIn::connected && enabled\n");
+      if (!udp.connected()) {
+        if (udp.listen(ARTNET_PORT)) {
+          udp.onPacket([this](AsyncUDPPacket &packet) {
+            receive(packet.data(), packet.length());
+          });
+          success = true;
+        }
+        else
+          ppf("UserModArtNetIn listen on %d FAILED\n", ARTNET_PORT);
+      }
+      dmx.indexPatches();
+      listening = true;
+    }
+    else {
+      listening = false;
+    }
+  }
+
+  //parsed in place in the UDP task (no copy), the values are set in loopTask
+  void receive(const uint8_t *data, size_t length) {
+    if (!listening || length < ARTNET_DMX_HEADER) return;
+    if (memcmp(data, "Art-Net\0", 8) != 0) return;
+    if ((data[8] | data[9] << 8) != ARTNET_OPDMX) return; //OpCode little endian, other ops (poll, sync, ...) not used
+
+    dmx.packetsCounter++;
+
+    uint16_t portAddress = data[14] | (data[15] & 0x7F) << 8; //SubUni, Net
+    uint16_t universeIndex = portAddress - dmx.universe;
+    if (universeIndex >= dmx.universeCount) return; //not ours
+
+    //Sequence 1..255, 0: not used by the sender
+    if (!dmx.acceptSequence(universeIndex, data[12]?data[12] - 1:-1, 255)) return;
+    dmx.framesCounter++;
+
+    uint16_t dataLength = data[16] << 8 | data[17]; //big endian
+    if (ARTNET_DMX_HEADER + dataLength > length) dataLength = length - ARTNET_DMX_HEADER;
+    dmx.feed(universeIndex, data + ARTNET_DMX_HEADER, dataLength);
+  }
+
+  void loop20ms() override {
+    if (listening) dmx.apply();
+  }
+
+  void patchChannel(uint8_t channelOffset, const char * pid, const char * id, uint8_t max = 255) {
+    dmx.patchChannel(channelOffset, pid, id, max);
+  }
+
+  private:
+    DMXPatcher dmx;
+    AsyncUDP udp;
+    volatile bool listening = false;
+
+};
+
+extern UserModArtNetIn *artNetInMod;
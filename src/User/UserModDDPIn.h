@@ -0,0 +1,99 @@
+/*
+   @title     StarBase
+   @file      UserModDDPIn.h
+   @date      20241219
+   @repo      https://github.com/ewowi/StarBase, submit changes to this file as PRs to ewowi/StarBase
+   @Authors   https://github.com/ewowi/StarBase/commits/main
+   @Copyright © 2024 Github StarBase Commit Authors
+   @license   GNU GENERAL PUBLIC LICENSE Version 3, 29 June 2007
+   @license   For non GPL-v3 usage, commercial licenses must be purchased. Contact moonmodules@icloud.com
+*/
+
+#pragma once
+#include <AsyncUDP.h>
+
+#include "SysModules.h"
+#include "DMXPatcher.h"
+
+#define DDP_PORT 4048
+#define DDP_HEADER 10 //flags, sequence, data type, id, offset[4], length[2]
+#define DDP_FLAG_TIMECODE 0x10 //4 extra header bytes
+#define DDP_FLAG_PUSH 0x01 //last packet of a frame
+#define DDP_ID_DISPLAY 1
+
+//DDP input: the data of the default output device (id 1) patched to variables, the offset counts channels over universes, see DMXPatcher
+class UserModDDPIn:public SysModule {
+
+public:
+
+  UserModDDPIn() :SysModule("DDPIn") {
+    isEnabled = false; //default not enabled
+  };
+
+  void setup() override {
+    SysModule::setup();
+
+    const Variable parentVar = ui->initUserMod(Variable(), name, 6203);
+
+    dmx.setupUI(parentVar, false); //no universes, channel counts from offset 0
+  }
+
+  void onOffChanged() {
+    if (mdls->isConnected && isEnabled) {
+      ppf("UserModDDPIn::connected && enabled\n");
+      if (!udp.connected()) {
+        if (udp.listen(DDP_PORT)) {
+          udp.onPacket([this](AsyncUDPPacket &packet) {
+            receive(packet.data(), packet.length());
+          });
+          success = true;
+        }
+        else
+          ppf("UserModDDPIn listen on %d FAILED\n", DDP_PORT);
+      }
+      dmx.indexPatches();
+      listening = true;
+    }
+    else {
+      listening = false;
+    }
+  }
+
+  //parsed in place in the UDP task (no copy), the values are set in loopTask
+  void receive(const uint8_t *data, size_t length) {
+    if (!listening || length < DDP_HEADER) return;
+    uint8_t flags = data[0];
+    if ((flags >> 6) != 1) return; //version 1
+    if (data[3] != DDP_ID_DISPLAY) return; //status, config and control ids not used
+
+    dmx.packetsCounter++;
+
+    //sequence 1..15, 0: not used by the sender
+    uint8_t sequence = data[1] & 0x0F;
+    if (!dmx.acceptSequence(0, sequence?sequence - 1:-1, 15)) return;
+    if (flags & DDP_FLAG_PUSH) dmx.framesCounter++;
+
+    size_t headerLength = (flags & DDP_FLAG_TIMECODE)?DDP_HEADER + 4:DDP_HEADER;
+    if (length < headerLength) return;
+    uint32_t offset = data[4] << 24 | data[5] << 16 | data[6] << 8 | data[7]; //big endian
+    uint16_t dataLength = data[8] << 8 | data[9];
+    if (headerLength + dataLength > length) dataLength = length - headerLength;
+    dmx.feedChannels(offset, data + headerLength, dataLength);
+  }
+
+  void loop20ms() override {
+    if (listening) dmx.apply();
+  }
+
+  void patchChannel(uint8_t channelOffset, const char * pid, const char * id, uint8_t max = 255) {
+    dmx.patchChannel(channelOffset, pid, id, max);
+  }
+
+  private:
+    DMXPatcher dmx;
+    AsyncUDP udp;
+    volatile bool listening = false;
+
+};
+
+extern UserModDDPIn *ddpInMod;
@@ -11,10 +11,11 @@
 
 #pragma once
 #include <ESPAsyncE131.h>
+#include <lwip/igmp.h>
 
 #include "SysModules.h"
-
-#define maxChannels 513
+#include "SysModNetwork.h" //for localIP
+#include "DMXPatcher.h"
 
 class UserModE131:public SysModule {
 
@@ -29,55 +30,11 @@ public:
 
     const Variable parentVar = ui->initUserMod(Variable(), name, 6201);
 
-    ui->initNumber(parentVar, "universe", &universe, 0, 7);
-
-    Variable currentVar = ui->initNumber(parentVar, "channel", &channel, 1, 512, false, [this](EventArguments) { switch (eventType) {
-      case onUI:
-        variable.setComment("First channel");
-        return true;
-      case onChange:
-        for (JsonObject childVar: Variable("E131", "patches").children())
-          Variable(childVar).triggerEvent(onSetValue); //set the value (WIP)
-        return true;
-      default: return false;
-    }});
-    currentVar.var["dash"] = true;
+    dmx.setupUI(parentVar);
 
-    Variable tableVar = ui->initTable(parentVar, "patches", nullptr, true, [](EventArguments) { switch (eventType) {
+    ui->initCheckBox(parentVar, "multicast", &multicast, false, [](EventArguments) { switch (eventType) {
       case onUI:
-        variable.setComment("Variables to watch");
-        return true;
-      default: return false;
-    }});
-
-    ui->initNumber(tableVar, "channel", UINT16_MAX, 1, 512, true, [this](EventArguments) { switch (eventType) {
-      case onSetValue:
-        for (size_t rowNr = 0; rowNr < varsToWatch.size(); rowNr++)
-          variable.setValue(channel + varsToWatch[rowNr].channelOffset, rowNr);
-        return true;
-      default: return false;
-    }});
-
-    ui->initText(tableVar, "variable", nullptr, 32, true, [this](EventArguments) { switch (eventType) {
-      case onSetValue:
-        for (size_t rowNr = 0; rowNr < varsToWatch.size(); rowNr++)
-          variable.setValue(varsToWatch[rowNr].id, rowNr);
-        return true;
-      default: return false;
-    }});
-
-    ui->initNumber(tableVar, "max", UINT16_MAX, 0, UINT16_MAX, true, [this](EventArguments) { switch (eventType) {
-      case onSetValue:
-        for (size_t rowNr = 0; rowNr < varsToWatch.size(); rowNr++)
-          variable.setValue(varsToWatch[rowNr].max, rowNr);
-        return true;
-      default: return false;
-    }});
-
-    ui->initNumber(tableVar, "value", UINT16_MAX, 0, 255, true, [this](EventArguments) { switch (eventType) {
-      case onSetValue:
-        for (size_t rowNr = 0; rowNr < varsToWatch.size(); rowNr++)
-          variable.setValue(varsToWatch[rowNr].savedValue, rowNr);
+        variable.setComment("Join 239.255.x.y per universe, off: unicast only (restart needed)");
         return true;
       default: return false;
     }});
@@ -97,73 +54,68 @@ public:
     if (mdls->isConnected && isEnabled) {
       ppf("UserModE131::connected && enabled\n");
 
-      if (e131Created) { // TODO: crashes here - no idea why!
+      if (e131) { //ESPAsyncE131 has no end(), keep listening
         ppf("UserModE131 - ESPAsyncE131 created already\n");
+        listening = true;
         return;
       }
       ppf("UserModE131 - Create ESPAsyncE131\n");
 
-      e131 = ESPAsyncE131(universeCount);
-      if (this->e131.begin(E131_MULTICAST, universe, universeCount)) { // TODO: multicast igmp failing, so only works with unicast currently
+      //the argument is the number of packets in the ring buffer (not universes): room for all universes of 2 frames while loop20ms drains it
+      //created once and not copied: a copy would free the ring buffer of the original
+      e131 = new ESPAsyncE131(dmx.universeCount * 2 + 2);
+      if (e131->begin(multicast?E131_MULTICAST:E131_UNICAST, dmx.universe, dmx.universeCount)) {
         ppf("Network exists, begin e131.begin ok\n");
+        if (multicast) joinMulticast();
         success = true;
       }
       else {
         ppf("Network exists, begin e131.begin FAILED\n");
       }
-      e131Created = true;
+      listening = true;
+      dmx.indexPatches();
     }
     else {
-      // e131.end();//???
-      e131Created = false;
+      listening = false;
+    }
+  }
+
+  //ESPAsyncE131 joins the extra universes on WiFi.localIP() only, join all on the interface in use (e.g. ethernet)
+  void joinMulticast() {
+    ip4_addr_t ifaddr;
+    ifaddr.addr = static_cast<uint32_t>(net->localIP());
+    for (uint8_t i = 0; i < dmx.universeCount; i++) {
+      uint16_t u = dmx.universe + i;
+      ip4_addr_t multicastAddr;
+      multicastAddr.addr = static_cast<uint32_t>(IPAddress(239, 255, (u >> 8) & 0xff, u & 0xff));
+      if (igmp_joingroup(&ifaddr, &multicastAddr) != ERR_OK)
+        ppf("UserModE131 igmp join universe %d failed\n", u);
     }
   }
 
   void loop20ms() override {
-    if(!e131Created) {
-      return;
+    if (!e131 || !listening) return;
+
+    //drain the ring buffer, the newest value per patch wins (only the last frame of each universe counts)
+    while (!e131->isEmpty()) {
+      e131->pull(&packet); // Pull packet from ring buffer
+      dmx.packetsCounter++;
+
+      uint16_t universeIndex = htons(packet.universe) - dmx.universe;
+      if (universeIndex >= dmx.universeCount) continue; //not ours
+      if (!dmx.acceptSequence(universeIndex, packet.sequence_number, 256)) continue; //late or duplicate
+      dmx.framesCounter++;
+
+      uint16_t valueCount = htons(packet.property_value_count); //including start code
+      if (valueCount > 1)
+        dmx.feed(universeIndex, packet.property_values + 1, valueCount - 1); //property_values[0] is the start code
     }
-    if (!e131.isEmpty()) {
-      e131_packet_t packet;
-      e131.pull(&packet);     // Pull packet from ring buffer
-
-      for (VarToWatch &varToWatch : varsToWatch) {
-        for (int i=0; i < maxChannels; i++) {
-          if (i == channel + varToWatch.channelOffset) {
-            if (packet.property_values[i] != varToWatch.savedValue) {
-
-              ppf("Universe %u / %u Channels | Packet#: %u / Errors: %u / CH%d: %u -> %u",
-                      htons(packet.universe),                 // The Universe for this packet
-                      htons(packet.property_value_count) - 1, // Start code is ignored, we're interested in dimmer data
-                      e131.stats.num_packets,                 // Packet counter
-                      e131.stats.packet_errors,               // Packet error counter
-                      i,
-                      varToWatch.savedValue,
-                      packet.property_values[i]);             // Dimmer data for Channel i
-
-              varToWatch.savedValue = packet.property_values[i];
-
-              if (varToWatch.id != nullptr && varToWatch.max != 0) {
-                ppf(" varsToWatch: %s.%s\n", varToWatch.pid, varToWatch.id);
-                mdl->setValue(varToWatch.pid, varToWatch.id, varToWatch.savedValue%(varToWatch.max+1)); // TODO: ugly to have magic string 
-              }
-              else
-                ppf("\n");
-            }//!= savedValue
-          }//if channel
-        }//maxChannels
-      } //for varToWatch
-    } //!e131.isEmpty()
+
+    dmx.apply();
   } //loop
 
   void patchChannel(uint8_t channelOffset, const char * pid, const char * id, uint8_t max = 255) {
-    VarToWatch varToWatch;
-    varToWatch.channelOffset = channelOffset;
-    varToWatch.pid = pid;
-    varToWatch.id = id;
-    varToWatch.savedValue = 0; // Always reset when (re)patching so variable gets set to DMX value even if unchanged
-    varToWatch.max = max;
-    varsToWatch.push_back(varToWatch);
+    dmx.patchChannel(channelOffset, pid, id, max);
   }
 
   // uint8_t getValue(const char * id) {
@@ -177,22 +129,13 @@ public:
   // }
 
   private:
-    struct VarToWatch {
-      uint16_t channelOffset;
-      const char * pid = nullptr;
-      const char * id = nullptr;
-      uint16_t max = -1;
-      uint8_t savedValue = -1;
-    };
-
-    std::vector<VarToWatch> varsToWatch;
-
-    ESPAsyncE131 e131;
-    boolean e131Created = false;
-    uint16_t channel = 1;
-    uint16_t universe = 1;
-    uint8_t universeCount = 1;
+    DMXPatcher dmx;
+
+    ESPAsyncE131 *e131 = nullptr;
+    e131_packet_t packet; //not on the stack (638 bytes)
+    bool listening = false;
+    bool3State multicast = true;
 
 };
 
-extern UserModE131 *e131mod;
\ No newline at end of file
+extern UserModE131 *e131mod;
@@ -11,12 +11,38 @@
 
 #include <ArduinoHA.h>
 
-// Basic example of MQTT connectivity to Home Assistant.
-// Add HALight, HASelect etc as required
+#define HA_MAX_ENTITIES 32 //dash vars, above are not discovered
+
+//entity of a dash var, see UserModHA::discover
+struct HAEntity {
+  JsonObject var;
+  HABaseDeviceType *entity = nullptr;
+  uint8_t kind; //haKinds
+  bool rows = false; //value is an array: the entity is row 0
+  char uniqueId[48]; //entities keep the pointers
+  char name[64];
+  char pidid[64]; //key of commands
+  int32_t published = 0; //numbers and booleans
+  uint32_t publishedHash = 0; //strings
+  bool publishedOnce = false;
+};
+
+enum haKinds
+{
+  ha_switch, //checkbox
+  ha_number, //number, slider, range, select (index), pin
+  ha_sensorNumber, //read only numbers
+  ha_sensor //read only text
+};
+
+//MQTT connectivity to Home Assistant: each dash var becomes an entity (discovery), published when changed, max once per publishInterval
+//commands of Home Assistant are coalesced per var and applied in loopTask as ws commands (SysModWeb::applyJson)
 class UserModHA:public SysModule {
 
 public:
 
+  uint16_t publishInterval = 1000; //ms, changes within the interval are published as the last value
+
   UserModHA() :SysModule("Home Assistant support") {
     isEnabled = false;
   };
@@ -29,11 +55,31 @@ public:
     ui->initText(parentVar, "mqttAddr");
     ui->initText(parentVar, "mqttUser");
     ui->initText(parentVar, "mqttPass");
-  }
 
+    ui->initNumber(parentVar, "publishInterval", &publishInterval, 100, 60000, false, [](EventArguments) { switch (eventType) {
+      case onUI:
+        variable.setComment("ms, changes are published at most once per interval");
+        return true;
+      default: return false;
+    }});
+
+    ui->initText(parentVar, "entities", nullptr, 32, true, [this](EventArguments) { switch (eventType) {
+      case onUI:
+        variable.setComment("Dash variables discovered, published and commands per second");
+        return true;
+      case onLoop1s:
+        variable.setValueF("%d P:%d C:%d", entities.size(), publishCounter, commandCounter);
+        publishCounter = 0;
+        commandCounter = 0;
+        return true;
+      default: return false;
+    }});
+  }
 
   void connectedChanged() override {
     ppf("connectedChanged\n");
+    discover(); //once, before begin: ArduinoHA publishes the discovery on connect
+
     if (mdls->isConnected) {
       // set device's details (optional)
       device.setName(mdl->getValue("instance"));
@@ -69,7 +115,19 @@ public:
   }
 
   void loop20ms() override {
-    mqtt->loop();
+    if (!mqtt) return;
+    mqtt->loop(); //commands are added to pendingCommands
+
+    //commands: after the mqtt callbacks, as a batch as ws commands
+    if (pendingCommands.as<JsonObject>().size()) {
+      web->applyJson(pendingCommands);
+      pendingCommands.to<JsonObject>();
+    }
+
+    if (started && millis() - lastPublish >= publishInterval) {
+      lastPublish = millis();
+      publishChanges();
+    }
   }
 
   void loop10s() override {
@@ -80,9 +138,130 @@ public:
   private:
     WiFiClient client;
     HADevice device;
-    HAMqtt* mqtt = new HAMqtt(client, device);
-    HASensorNumber* testSensor = new HASensorNumber("uptime");
+    HAMqtt* mqtt = nullptr; //made by discover, sized to the entities
+    HASensorNumber* testSensor = nullptr;
     bool started = false;
+
+    std::vector<HAEntity> entities; //reserved once: the HA entities keep pointers to the names
+    JsonDocument pendingCommands; //{"pid.id":{"value":v}}, the last command of a var wins
+    unsigned long lastPublish = 0;
+    uint16_t publishCounter = 0;
+    uint16_t commandCounter = 0;
+
+    //entities of the dash vars, the same walk as SysModInstances
+    void discover() {
+      if (mqtt) return;
+
+      std::vector<JsonObject> dashVars;
+      mdl->findVars("dash", true, [&dashVars](Variable variable) {
+        if (dashVars.size() < HA_MAX_ENTITIES) dashVars.push_back(variable.var);
+        else ppf("dev UserModHA more than %d dash vars, %s.%s not discovered\n", HA_MAX_ENTITIES, variable.pid(), variable.id());
+      });
+
+      byte mac[6];
+      WiFi.macAddress(mac);
+
+      entities.reserve(dashVars.size());
+      for (JsonObject var: dashVars) {
+        Variable variable = Variable(var);
+        JsonVariant value = var["value"];
+        HAEntity haEntity;
+        haEntity.var = var;
+        haEntity.rows = value.is<JsonArray>();
+        if (haEntity.rows) value = value[0];
+
+        bool readOnly = var["ro"];
+        if (var["type"] == "checkbox" && !readOnly) haEntity.kind = ha_switch;
+        else if (value.is<int>() || value.isNull()) haEntity.kind = readOnly?ha_sensorNumber:ha_number;
+        else if (value.is<const char *>()) haEntity.kind = ha_sensor;
+        else {
+          ppf("dev UserModHA %s.%s type %s not supported\n", variable.pid(), variable.id(), var["type"].as<const char *>());
+          continue;
+        }
+
+        //unique per device and var, [a-zA-Z0-9_]
+        print->fFormat(haEntity.uniqueId, sizeof(haEntity.uniqueId), "%02x%02x%02x_%s_%s", mac[3], mac[4], mac[5], variable.pid(), variable.id());
+        for (char *c = haEntity.uniqueId; *c; c++) if (!isalnum(*c)) *c = '_';
+        print->fFormat(haEntity.name, sizeof(haEntity.name), "%s %s", variable.pid(), variable.id());
+        print->fFormat(haEntity.pidid, sizeof(haEntity.pidid), haEntity.rows?"%s.%s#0":"%s.%s", variable.pid(), variable.id());
+
+        entities.push_back(haEntity);
+      }
+
+      mqtt = new HAMqtt(client, device, entities.size() + 1); //+ uptime
+      testSensor = new HASensorNumber("uptime");
+
+      for (HAEntity &haEntity: entities) {
+        switch (haEntity.kind) {
+          case ha_switch: {
+            HASwitch *entity = new HASwitch(haEntity.uniqueId);
+            entity->onCommand(onSwitchCommand);
+            haEntity.entity = entity;
+            break; }
+          case ha_number: {
+            HANumber *entity = new HANumber(haEntity.uniqueId);
+            entity->setMin(haEntity.var["min"] | 0);
+            entity->setMax(haEntity.var["max"] | 255);
+            entity->setMode(HANumber::ModeSlider);
+            entity->onCommand(onNumberCommand);
+            haEntity.entity = entity;
+            break; }
+          case ha_sensorNumber:
+            haEntity.entity = new HASensorNumber(haEntity.uniqueId);
+            break;
+          case ha_sensor:
+            haEntity.entity = new HASensor(haEntity.uniqueId);
+            break;
+        }
+        haEntity.entity->setName(haEntity.name);
+      }
+      ppf("UserModHA %d entities discovered\n", entities.size());
+    }
+
+    //the vars changed since the last publish, at their last value
+    void publishChanges() {
+      for (HAEntity &haEntity: entities) {
+        JsonVariant value = haEntity.var["value"];
+        if (haEntity.rows) value = value[0];
+
+        if (haEntity.kind == ha_sensor) {
+          const char * text = value | "";
+          uint32_t hash = 2166136261; //fnv1a
+          for (const char *c = text; *c; c++) hash = (hash ^ (uint8_t)*c) * 16777619;
+          if (haEntity.publishedOnce && hash == haEntity.publishedHash) continue;
+          ((HASensor *)haEntity.entity)->setValue(text);
+          haEntity.publishedHash = hash;
+        }
+        else {
+          int32_t number = value.as<int32_t>();
+          if (haEntity.publishedOnce && number == haEntity.published) continue;
+          switch (haEntity.kind) {
+            case ha_switch: ((HASwitch *)haEntity.entity)->setState(number != 0, true); break;
+            case ha_number: ((HANumber *)haEntity.entity)->setState(number, true); break;
+            case ha_sensorNumber: ((HASensorNumber *)haEntity.entity)->setValue(number, true); break;
+          }
+          haEntity.published = number;
+        }
+        haEntity.publishedOnce = true;
+        publishCounter++;
+      }
+    }
+
+    //called in mqtt->loop: only queued, the published state follows the applied value
+    void queueCommand(HABaseDeviceType *sender, int32_t value) {
+      for (HAEntity &haEntity: entities)
+        if (haEntity.entity == sender) {
+          pendingCommands[haEntity.pidid]["value"] = value;
+          commandCounter++;
+          return;
+        }
+    }
+
+    static void onSwitchCommand(bool state, HASwitch* sender);
+    static void onNumberCommand(HANumeric number, HANumber* sender);
 };
 
-extern UserModHA *hamod;
\ No newline at end of file
+extern UserModHA *hamod;
+
+inline void UserModHA::onSwitchCommand(bool state, HASwitch* sender) {hamod->queueCommand(sender, state);}
+inline void UserModHA::onNumberCommand(HANumeric number, HANumber* sender) {if (number.isSet()) hamod->queueCommand(sender, number.toInt32());}
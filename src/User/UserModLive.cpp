@@ -19,6 +19,9 @@
 #include "../Sys/SysModUI.h"
 #include "../Sys/SysModSystem.h"
 #include "../Sys/SysModFiles.h"
+#ifdef STARBASE_USERMOD_MPU6050
+  #include "UserModMPU6050.h"
+#endif
 
 // #define __RUN_CORE 0
 
@@ -27,9 +30,53 @@
   static long previousCycleCount;
   static uint16_t fps;
   static unsigned long frameCounter; //temp, can be removed if syncing tested
-  static bool waitingOnLiveScript = true;
   static bool syncActive = false;
 
+  //frame handoff between the script task (sync) and the main loop (syncWithSync), blocking instead of polling
+  #define LIVE_SYNC_TIMEOUT_MS 100 //max wait for a frame in the main loop
+  #define LIVE_CONSUMER_TIMEOUT_MS 1000 //no syncWithSync for this long: the script runs free
+  static SemaphoreHandle_t frameReady = nullptr; //given by the script when a frame is rendered
+  static SemaphoreHandle_t frameConsumed = nullptr; //given by the main loop: the script may render the next frame
+  static bool frameHeld = false; //main loop holds the script, frame not consumed yet (not doubleBuffer)
+  static unsigned long lastConsumed = 0; //millis of the last syncWithSync
+  static bool3State doubleBuffer = false; //script renders frame N+1 while the main loop shows frame N
+
+  static ScriptMetrics scriptMetrics[LIVE_MAX_SCRIPTS];
+
+  //metrics of the script running on task (bound by executeBackgroundTask)
+  static ScriptMetrics *metricsOfTask(TaskHandle_t task) {
+    for (ScriptMetrics &metrics: scriptMetrics)
+      if (metrics.task == task) return &metrics;
+    return nullptr;
+  }
+
+  //scripts on the core opposite of networking (AsyncTCP), so rendering is not disturbed by a busy UI
+  #ifdef CONFIG_ASYNC_TCP_RUNNING_CORE
+    #define LIVE_RENDER_CORE (portNUM_PROCESSORS > 1 && CONFIG_ASYNC_TCP_RUNNING_CORE == 0?1:0)
+  #else
+    #define LIVE_RENDER_CORE 0
+  #endif
+  static bool3State renderCore = true;
+
+  //stop the task of a script started by executeBackgroundTask
+  static void killScriptTask(ScriptMetrics &metrics) {
+    if (!metrics.task) return;
+    UserModLive::preKill();
+    TaskHandle_t task = metrics.task;
+    metrics.task = nullptr;
+    vTaskDelete(task);
+    UserModLive::postKill();
+  }
+
+  UserModLive::ExternalTimer::ExternalTimer() {
+    metrics = metricsOfTask(xTaskGetCurrentTaskHandle());
+    start = esp_timer_get_time();
+  }
+
+  UserModLive::ExternalTimer::~ExternalTimer() {
+    if (metrics) metrics->externalTime += esp_timer_get_time() - start;
+  }
+
 Parser parser = Parser();
 
  void UserModLive::preKill()
@@ -41,17 +88,29 @@ Parser parser = Parser();
   ppf("ELS postKill\n");
 }
 
+//FNV-1a, continuing from hash
+static uint32_t fnv1a(uint32_t hash, const void *data, size_t size) {
+  for (size_t i = 0; i < size; i++) hash = (hash ^ ((const uint8_t *)data)[i]) * 16777619;
+  return hash;
+}
+
 static float _hypot(float x,float y) {return hypot(x,y);}
 static float _atan2(float x,float y) { return atan2(x,y);}
 static float _sin(float j) {return sin(j);}
 static float _cos(float j) {return cos(j);}
 static float _triangle(float j) {return 1.0 - fabs(fmod(2 * j, 2.0) - 1.0);}
+static void _delay(int ms) {UserModLive::ExternalTimer timer; delay(ms);}
 static float _time(float j) {
   float myVal = sys->now;
   myVal = myVal / 65535 / j;           // PixelBlaze uses 1000/65535 = .015259. 
   myVal = fmod(myVal, 1.0);               // ewowi: with 0.015 as input, you get fmod(millis/1000,1.0), which has a period of 1 second, sounds right
   return myVal;
 }
+#ifdef STARBASE_USERMOD_MPU6050
+//latest sample of the reader task, not the values published to the model. axis 0: x, 1: y, 2: z
+static float _gyro(int axis) {MotionSample sample = mpu6050->latest(); return axis == 0?sample.gyro.x:axis == 1?sample.gyro.y:sample.gyro.z;}
+static float _accell(int axis) {MotionSample sample = mpu6050->latest(); return axis == 0?sample.accell.x:axis == 1?sample.accell.y:sample.accell.z;}
+#endif
 
   void UserModLive::setup() {
     SysModule::setup();
@@ -81,18 +140,14 @@ static float _time(float j) {
           files->seqNrToName(fileName, fileNr, ".sc");
           ppf("script.onChange f:%d n:%s\n", fileNr, fileName);
 
-          uint8_t exeID = liveM->findExecutable(fileName);
-          if (exeID == UINT8_MAX) {
+          addDefaultExternals();
 
-            addDefaultExternals();
+          //to run blinkSL.sc
+          addExternalFun("void", "pinMode", "(int a1, int a2)", (void *)&pinMode);
+          addExternalFun("void", "digitalWrite", "(int a1, int a2)", (void *)&digitalWrite);
+          addExternalFun("void", "delay", "(int a1)", (void *)_delay);
 
-            //to run blinkSL.sc
-            addExternalFun("void", "pinMode", "(int a1, int a2)", (void *)&pinMode);
-            addExternalFun("void", "digitalWrite", "(int a1, int a2)", (void *)&digitalWrite);
-            addExternalFun("void", "delay", "(int a1)", (void *)&delay);
-
-            exeID = compile(fileName, "void main(){setup();while(2>1){loop();sync();}}");
-          }
+          uint8_t exeID = compile(fileName, "void main(){setup();while(2>1){loop();sync();}}"); //the compiled executable if script and externals unchanged
 
           if (exeID != UINT8_MAX)
             liveM->executeBackgroundTask(exeID);
@@ -108,6 +163,33 @@ static float _time(float j) {
       default: return false; 
     }}); //script
 
+    ui->initCheckBox(parentVar, "printScript", &printScript, false, [](EventArguments) { switch (eventType) {
+      case onUI:
+        variable.setComment("Print each line when compiling (debug)");
+        return true;
+      default: return false;
+    }});
+
+    ui->initCheckBox(parentVar, "doubleBuffer", &doubleBuffer, false, [](EventArguments) { switch (eventType) {
+      case onUI:
+        variable.setComment("Render the next frame while the current is shown");
+        return true;
+      case onChange:
+        if (frameHeld) { //release a script waiting on the previous mode
+          frameHeld = false;
+          xSemaphoreGive(frameConsumed);
+        }
+        return true;
+      default: return false;
+    }});
+
+    ui->initCheckBox(parentVar, "renderCore", &renderCore, false, [](EventArguments) { switch (eventType) {
+      case onUI:
+        variable.setComment("Scripts with core 2 (auto) on the core opposite networking (next start)");
+        return true;
+      default: return false;
+    }});
+
     ui->initText(parentVar, "fpsCycles", nullptr, 10, true, [this](EventArguments) { switch (eventType) {
       case onLoop1s:
         variable.setValueF("%d /s", fps, 0); //0 is to force format overload used
@@ -133,88 +215,225 @@ static float _time(float j) {
     }); 
 
     ui->initText(tableVar, "name", nullptr, 32, true, [this](EventArguments) { switch (eventType) {
-      case onSetValue:
-        variable.var["value"].to<JsonArray>(); web->addResponse(variable.var, "value", variable.value()); // empty the value
-        rowNr = 0;
+      case onSetValue: {
+        std::vector<JsonString> values; for (Executable &exec: scriptRuntime._scExecutables) values.push_back(JsonString(exec.name.c_str()));
+        variable.setValues(values);
+        return true; }
+      default: return false;
+    }});
+
+    ui->initCheckBox(tableVar, "running", UINT8_MAX, true, [this](EventArguments) { switch (eventType) {
+      case onSetValue: {
+        bool values[UINT8_MAX]; uint8_t count = 0; //no vector<bool>
+        for (Executable &exec: scriptRuntime._scExecutables) if (count < UINT8_MAX) {
+          ScriptMetrics *metrics = findMetrics(exec.name.c_str());
+          values[count++] = exec.isRunning() || (metrics && metrics->task);
+        }
+        variable.setValues(values, count);
+        return true; }
+      default: return false;
+    }});
+
+    ui->initCheckBox(tableVar, "halted", UINT8_MAX, true, [this](EventArguments) { switch (eventType) {
+      case onSetValue: {
+        bool values[UINT8_MAX]; uint8_t count = 0; //no vector<bool>
+        for (Executable &exec: scriptRuntime._scExecutables) if (count < UINT8_MAX) values[count++] = exec.isHalted;
+        variable.setValues(values, count);
+        return true; }
+      default: return false;
+    }});
+
+    ui->initCheckBox(tableVar, "exe", UINT8_MAX, true, [this](EventArguments) { switch (eventType) {
+      case onSetValue: {
+        bool values[UINT8_MAX]; uint8_t count = 0; //no vector<bool>
+        for (Executable &exec: scriptRuntime._scExecutables) if (count < UINT8_MAX) values[count++] = exec.exeExist;
+        variable.setValues(values, count);
+        return true; }
+      default: return false;
+    }});
+
+    ui->initNumber(tableVar, "handle", UINT16_MAX, 0, UINT16_MAX, true, [this](EventArguments) { switch (eventType) {
+      case onSetValue: {
+        std::vector<int> values; for (Executable &exec: scriptRuntime._scExecutables) values.push_back(exec.__run_handle_index);
+        variable.setValues(values);
+        return true; }
+      default: return false;
+    }});
+
+    ui->initText(tableVar, "size", nullptr, 32, true, [this](EventArguments) { switch (eventType) {
+      case onSetValue: {
+        std::vector<StarString> texts(scriptRuntime._scExecutables.size());
+        std::vector<JsonString> values;
+        for (Executable &exec: scriptRuntime._scExecutables) {
+          exe_info exeInfo = scriptRuntime.getExecutableInfo(exec.name);
+          StarString &text = texts[values.size()];
+          text.format("%d+%d=%d B", exeInfo.binary_size, exeInfo.data_size, exeInfo.total_size);
+          values.push_back(JsonString(text.getString()));
+        }
+        variable.setValues(values);
+        return true; }
+      default: return false;
+    }});
+
+    ui->initText(tableVar, "frame", nullptr, 32, true, [this](EventArguments) { switch (eventType) {
+      case onSetValue: {
+        std::vector<StarString> texts(scriptRuntime._scExecutables.size());
+        std::vector<JsonString> values;
         for (Executable &exec: scriptRuntime._scExecutables) {
-          const char *name = exec.name.c_str();
-          variable.setValue(JsonString(exec.name.c_str()), rowNr++);
+          ScriptMetrics *metrics = findMetrics(exec.name.c_str());
+          StarString &text = texts[values.size()];
+          if (metrics && metrics->task) text.format("%lu/%lu µs ext %lu", metrics->renderAvg, metrics->renderPeak, metrics->externalAvg);
+          values.push_back(JsonString(text.getString()));
         }
+        variable.setValues(values);
+        return true; }
+      case onUI:
+        variable.setComment("Avg/max render and external µs per frame");
         return true;
       default: return false;
     }});
 
-    ui->initCheckBox(tableVar, "running", UINT8_MAX, true, [this](EventArguments) { switch (eventType) {
-      case onSetValue:
-        variable.var["value"].to<JsonArray>(); web->addResponse(variable.var, "value", variable.value()); // empty the value
-        rowNr = 0;
+    ui->initNumber(tableVar, "stack", UINT16_MAX, 0, UINT16_MAX, true, [this](EventArguments) { switch (eventType) {
+      case onSetValue: {
+        std::vector<uint32_t> values;
         for (Executable &exec: scriptRuntime._scExecutables) {
-          variable.setValue(exec.isRunning(), rowNr++);
+          ScriptMetrics *metrics = findMetrics(exec.name.c_str());
+          values.push_back(metrics?metrics->stackFree:0);
         }
+        variable.setValues(values);
+        return true; }
+      case onUI:
+        variable.setComment("Free B (high water)");
         return true;
       default: return false;
     }});
 
-    ui->initCheckBox(tableVar, "halted", UINT8_MAX, true, [this](EventArguments) { switch (eventType) {
-      case onSetValue:
-        variable.var["value"].to<JsonArray>(); web->addResponse(variable.var, "value", variable.value()); // empty the value
-        rowNr = 0;
+    ui->initNumber(tableVar, "heap", UINT16_MAX, 0, UINT16_MAX, true, [this](EventArguments) { switch (eventType) {
+      case onSetValue: {
+        std::vector<uint32_t> values;
         for (Executable &exec: scriptRuntime._scExecutables) {
-          variable.setValue(exec.isHalted, rowNr++);
+          ScriptMetrics *metrics = findMetrics(exec.name.c_str());
+          values.push_back(metrics?metrics->heapUsed:0);
         }
+        variable.setValues(values);
+        return true; }
+      case onUI:
+        variable.setComment("B beyond size");
         return true;
       default: return false;
     }});
 
-    ui->initCheckBox(tableVar, "exe", UINT8_MAX, true, [this](EventArguments) { switch (eventType) {
-      case onSetValue:
-        variable.var["value"].to<JsonArray>(); web->addResponse(variable.var, "value", variable.value()); // empty the value
-        rowNr = 0;
+    ui->initNumber(tableVar, "budget", UINT16_MAX, 0, UINT16_MAX, false, [this](EventArguments) { switch (eventType) {
+      case onSetValue: {
+        std::vector<uint16_t> values;
         for (Executable &exec: scriptRuntime._scExecutables) {
-          variable.setValue(exec.exeExist, rowNr++);
+          ScriptMetrics *metrics = findMetrics(exec.name.c_str());
+          values.push_back(metrics?metrics->budget:0);
         }
+        variable.setValues(values);
+        return true; }
+      case onChange:
+        if (rowNr < scriptRuntime._scExecutables.size()) {
+          ScriptMetrics *metrics = findMetrics(scriptRuntime._scExecutables[rowNr].name.c_str(), true);
+          if (metrics) {
+            metrics->budget = variable.getValue(rowNr);
+            saveTaskSettings(*metrics);
+          }
+        }
+        return true;
+      case onUI:
+        variable.setComment("Max avg µs per frame, 0: none");
         return true;
       default: return false;
     }});
 
-    ui->initNumber(tableVar, "handle", UINT16_MAX, 0, UINT16_MAX, true, [this](EventArguments) { switch (eventType) {
-      case onSetValue:
-        variable.var["value"].to<JsonArray>(); web->addResponse(variable.var, "value", variable.value()); // empty the value
-        rowNr = 0;
+    ui->initNumber(tableVar, "core", UINT16_MAX, 0, 2, false, [this](EventArguments) { switch (eventType) {
+      case onSetValue: {
+        std::vector<uint8_t> values;
         for (Executable &exec: scriptRuntime._scExecutables) {
-          variable.setValue(exec.__run_handle_index, rowNr++);
+          ScriptMetrics *metrics = findMetrics(exec.name.c_str(), true);
+          values.push_back(metrics?metrics->core:0);
         }
+        variable.setValues(values);
+        return true; }
+      case onChange:
+        if (rowNr < scriptRuntime._scExecutables.size()) {
+          ScriptMetrics *metrics = findMetrics(scriptRuntime._scExecutables[rowNr].name.c_str(), true);
+          if (metrics) {
+            metrics->core = variable.getValue(rowNr);
+            saveTaskSettings(*metrics);
+          }
+        }
+        return true;
+      case onUI:
+        variable.setComment("0, 1 or 2: auto (next start)");
         return true;
       default: return false;
     }});
 
-    ui->initText(tableVar, "size", nullptr, 32, true, [this](EventArguments) { switch (eventType) {
-      case onSetValue:
-        variable.var["value"].to<JsonArray>(); web->addResponse(variable.var, "value", variable.value()); // empty the value
-        rowNr = 0;
+    ui->initNumber(tableVar, "priority", UINT16_MAX, 1, configMAX_PRIORITIES - 1, false, [this](EventArguments) { switch (eventType) {
+      case onSetValue: {
+        std::vector<uint8_t> values;
         for (Executable &exec: scriptRuntime._scExecutables) {
-          exe_info exeInfo = scriptRuntime.getExecutableInfo(exec.name);
-          StarString text;
-          text.format("%d+%d=%d B", exeInfo.binary_size, exeInfo.data_size, exeInfo.total_size);
-          variable.setValue(JsonString(text.getString()), rowNr++);
+          ScriptMetrics *metrics = findMetrics(exec.name.c_str(), true);
+          values.push_back(metrics?metrics->priority:0);
+        }
+        variable.setValues(values);
+        return true; }
+      case onChange:
+        if (rowNr < scriptRuntime._scExecutables.size()) {
+          ScriptMetrics *metrics = findMetrics(scriptRuntime._scExecutables[rowNr].name.c_str(), true);
+          if (metrics) {
+            metrics->priority = variable.getValue(rowNr);
+            if (metrics->task) vTaskPrioritySet(metrics->task, metrics->priority);
+            saveTaskSettings(*metrics);
+          }
+        }
+        return true;
+      case onUI:
+        variable.setComment("Task priority");
+        return true;
+      default: return false;
+    }});
+
+    ui->initNumber(tableVar, "stackKB", UINT16_MAX, 2, 64, false, [this](EventArguments) { switch (eventType) {
+      case onSetValue: {
+        std::vector<uint8_t> values;
+        for (Executable &exec: scriptRuntime._scExecutables) {
+          ScriptMetrics *metrics = findMetrics(exec.name.c_str(), true);
+          values.push_back(metrics?metrics->stackKB:0);
+        }
+        variable.setValues(values);
+        return true; }
+      case onChange:
+        if (rowNr < scriptRuntime._scExecutables.size()) {
+          ScriptMetrics *metrics = findMetrics(scriptRuntime._scExecutables[rowNr].name.c_str(), true);
+          if (metrics) {
+            metrics->stackKB = variable.getValue(rowNr);
+            saveTaskSettings(*metrics);
+          }
         }
         return true;
+      case onUI:
+        variable.setComment("Task stack KB (next start)");
+        return true;
       default: return false;
     }});
 
     ui->initText(tableVar, "error", nullptr, 32, true, [this](EventArguments) { switch (eventType) {
-      case onSetValue:
-        variable.var["value"].to<JsonArray>(); web->addResponse(variable.var, "value", variable.value()); // empty the value
-        rowNr = 0;
+      case onSetValue: {
+        std::vector<StarString> texts(scriptRuntime._scExecutables.size());
+        std::vector<JsonString> values;
         for (Executable &exec: scriptRuntime._scExecutables) {
           if (exec.error.error) {
-            StarString text;
+            StarString &text = texts[values.size()];
             const char *error_message = exec.error.error_message.c_str();
             text.format("%d-%d %s (%d)", exec.error.line, exec.error.pos, error_message?error_message:"dev", exec.error.error);
-            variable.setValue(JsonString(text.getString()), rowNr++);
+            values.push_back(JsonString(text.getString()));
           }
         }
-        return true;
+        variable.setValues(values);
+        return true; }
       default: return false;
     }});
 
@@ -228,6 +447,9 @@ static float _time(float j) {
       default: return false;
     }});
 
+    frameReady = xSemaphoreCreateBinary();
+    frameConsumed = xSemaphoreCreateBinary();
+
     runningPrograms.setPrekill(preKill, postKill); //for clockless driver...
     runningPrograms.setFunctionToSync(sync);
 
@@ -236,6 +458,7 @@ static float _time(float j) {
   void UserModLive::addDefaultExternals() {
 
     scScript = "";
+    externalsHash = 2166136261;
 
     //Live Scripts defaults
 
@@ -246,16 +469,22 @@ static float _time(float j) {
     addExternalFun("float", "time", "(float a1)", (void *)_time);
     addExternalFun("float", "triangle", "(float a1)", (void *)_triangle);
     addExternalFun("uint32_t", "millis", "()", (void *)millis);
+    #ifdef STARBASE_USERMOD_MPU6050
+      addExternalFun("float", "gyro", "(int a1)", (void *)_gyro);
+      addExternalFun("float", "accell", "(int a1)", (void *)_accell);
+    #endif
   }
 
   void UserModLive::addExternalVal(string result, string name, void * ptr) {
     if (findLink(name, externalType::value) == -1) //not allready added earlier
       addExternalVariable(name, result, "", ptr);
+    externalsHash = fnv1a(fnv1a(fnv1a(externalsHash, result.c_str(), result.length() + 1), name.c_str(), name.length() + 1), &ptr, sizeof(ptr));
   }
 
   void UserModLive::addExternalFun(string result, string name, string parameters, void * ptr) {
     if (findLink(name, externalType::function) == -1) //not allready added earlier
       addExternalFunction(name, result, parameters, ptr);
+    externalsHash = fnv1a(fnv1a(fnv1a(fnv1a(externalsHash, result.c_str(), result.length() + 1), name.c_str(), name.length() + 1), parameters.c_str(), parameters.length() + 1), &ptr, sizeof(ptr));
   }
 
   // void UserModLive::addExternalFun(string name, std::function<void(int)> fun) {
@@ -269,6 +498,18 @@ static float _time(float j) {
 
   void UserModLive::sync() {
     frameCounter++; //temp
+
+    ScriptMetrics *metrics = metricsOfTask(xTaskGetCurrentTaskHandle());
+    if (metrics) {
+      uint32_t renderTime = esp_timer_get_time() - metrics->frameStart;
+      renderTime = renderTime > metrics->externalTime?renderTime - metrics->externalTime:0;
+      if (metrics->frames == 0) metrics->stackFree = uxTaskGetStackHighWaterMark(nullptr); //once a second, it scans the stack
+      metrics->frames++;
+      metrics->renderSum += renderTime;
+      metrics->renderMax = max(metrics->renderMax, renderTime);
+      metrics->externalSum += metrics->externalTime;
+      metrics->externalTime = 0;
+    }
       
     fps = ESP.getCpuFreqMHz() * 1000000 / (ESP.getCycleCount() - previousCycleCount);
     previousCycleCount = ESP.getCycleCount();
@@ -280,18 +521,38 @@ static float _time(float j) {
       // So if what you display is the seen fps( animation & driver.showPixel) you should see the global FPS.
       // fps is shown as fps1 in the ui, frameCounter is shown as fps2 in the ui. 
 
-    delay(1); //to feed the watchdog (also if loopState == 0)
-    while (!waitingOnLiveScript) delay(1); //to feed the watchdog
-    //do Live Script cycle
-    waitingOnLiveScript = false; //Live Script produced a frame, main loop will deal with it
+    if (!syncActive || millis() - lastConsumed > LIVE_CONSUMER_TIMEOUT_MS)
+      vTaskDelay(1); //no main loop showing frames: run free, feed the watchdog
+    else {
+      //frame rendered, block (no polling) until the main loop has taken it
+      xSemaphoreGive(frameReady);
+      while (xSemaphoreTake(frameConsumed, pdMS_TO_TICKS(LIVE_SYNC_TIMEOUT_MS)) != pdTRUE)
+        if (!syncActive || millis() - lastConsumed > LIVE_CONSUMER_TIMEOUT_MS) break;
+    }
+
+    if (metrics) metrics->frameStart = esp_timer_get_time(); //waiting is not render time
   }
 
-  void UserModLive::syncWithSync() {
+  //called by the main loop before showing a frame: returns when the script has rendered the next one (or after LIVE_SYNC_TIMEOUT_MS)
+  //not doubleBuffer: the script waits until the next call, so it does not write while the frame is shown
+  //doubleBuffer: the script renders the next frame directly, swapBuffers (if given) runs while the script waits
+  void UserModLive::syncWithSync(const std::function<void()> &swapBuffers) {
+    if (!syncActive) return;
+    lastConsumed = millis();
 
-    if (syncActive && !waitingOnLiveScript) {// show has been called (in other loop)
-      waitingOnLiveScript = true; //waiting on Live Script
-      while (waitingOnLiveScript) delay(1); // so live can continue
+    if (frameHeld) { //previous frame shown
+      frameHeld = false;
+      xSemaphoreGive(frameConsumed);
     }
+
+    if (xSemaphoreTake(frameReady, pdMS_TO_TICKS(LIVE_SYNC_TIMEOUT_MS)) != pdTRUE) return; //no new frame, show the previous
+
+    if (doubleBuffer) {
+      if (swapBuffers) swapBuffers();
+      xSemaphoreGive(frameConsumed);
+    }
+    else
+      frameHeld = true;
   }
 
   void UserModLive::loop1s() {
@@ -301,8 +562,32 @@ static float _time(float j) {
       if (exec.isRunning())
         scriptsRunning = true;
     }
+    for (ScriptMetrics &metrics: scriptMetrics)
+      if (metrics.task) scriptsRunning = true;
     syncActive = scriptsRunning;
-    if (!syncActive) waitingOnLiveScript = true; //reset to default
+
+    //metrics of the last second, kill scripts over budget
+    for (ScriptMetrics &metrics: scriptMetrics) {
+      if (!metrics.name[0]) continue;
+      uint32_t frames = metrics.frames; //sync may count a frame meanwhile, not accurate to the frame
+      metrics.renderAvg = frames?metrics.renderSum / frames:0;
+      metrics.renderPeak = metrics.renderMax;
+      metrics.externalAvg = frames?metrics.externalSum / frames:0;
+      metrics.frames = 0;
+      metrics.renderSum = 0;
+      metrics.renderMax = 0;
+      metrics.externalSum = 0;
+      if (metrics.budget && frames && metrics.renderAvg > metrics.budget) {
+        ppf("LiveScripts %s over budget %lu > %d µs per frame, killed\n", metrics.name, metrics.renderAvg, metrics.budget);
+        killScriptTask(metrics);
+        scriptRuntime.kill(string(metrics.name));
+      }
+    }
+    if (!syncActive) { //reset to default
+      frameHeld = false;
+      xSemaphoreTake(frameReady, 0);
+      xSemaphoreTake(frameConsumed, 0);
+    }
 
   }
 
@@ -337,7 +622,31 @@ static float _time(float j) {
 
   void UserModLive::executeBackgroundTask(uint8_t exeID, const char * function)
   {
-    scriptRuntime._scExecutables[exeID].executeAsTask(string(function));
+    ScriptMetrics *metrics = findMetrics(scriptRuntime._scExecutables[exeID].name.c_str(), true);
+    if (!metrics) { //no slot free: runtime defaults, not profiled
+      scriptRuntime._scExecutables[exeID].executeAsTask(string(function));
+      return;
+    }
+    killScriptTask(*metrics); //running already
+
+    //own task instead of executeAsTask (no core, priority and stack arguments): the slot is bound to the task before it runs
+    BaseType_t core = metrics->core;
+    if (core == LIVE_CORE_AUTO) core = renderCore?LIVE_RENDER_CORE:tskNO_AFFINITY;
+    else if (core >= portNUM_PROCESSORS) core = 0;
+    strlcpy(metrics->function, function, sizeof(metrics->function));
+    metrics->frameStart = esp_timer_get_time();
+    ppf("LiveScripts startTask %s core:%d prio:%d stack:%d KB\n", metrics->name, (int)core, metrics->priority, metrics->stackKB);
+
+    if (xTaskCreatePinnedToCore([](void *parameter) {
+      ScriptMetrics *metrics = (ScriptMetrics *)parameter;
+      uint8_t exeID = liveM->findExecutable(metrics->name);
+      if (exeID != UINT8_MAX) liveM->executeTask(exeID, metrics->function); //returns when the script ends
+      metrics->task = nullptr;
+      vTaskDelete(nullptr);
+    }, metrics->name, metrics->stackKB * 1024, metrics, metrics->priority, &metrics->task, core) != pdPASS) {
+      ppf("dev LiveScripts startTask %s failed\n", metrics->name);
+      metrics->task = nullptr;
+    }
   }
 
   uint8_t UserModLive::compile(const char * fileName, const char * post) {
@@ -358,28 +667,46 @@ static float _time(float j) {
       }
       ppf("preScript of %s has %d lines\n", fileName, preScriptNrOfLines+1); //+1 to subtract the line from parser error line reported
 
-      scScript += string(f.readString().c_str()); // add sc file
+      size_t preScriptLength = scScript.length();
+      scScript.resize(preScriptLength + f.size()); // add sc file, read in place (no String copy)
+      scScript.resize(preScriptLength + f.read((uint8_t *)&scScript[preScriptLength], f.size()));
       f.close();
 
       if (post) scScript += post;
 
+      //script and externals unchanged since the last compile: use that executable, no parsing
+      uint32_t sourceHash = fnv1a(externalsHash, scScript.c_str(), scScript.length());
+      uint8_t exeID = findExecutable(fileName);
+      if (exeID != UINT8_MAX) {
+        auto cached = sourceHashes.find(fileName);
+        if (cached != sourceHashes.end() && cached->second == sourceHash && scriptRuntime._scExecutables[exeID].exeExist) {
+          ppf("live compile %s unchanged (%08x), reuse exe %d\n", fileName, sourceHash, exeID);
+          return exeID;
+        }
+        ppf("live compile %s changed (%08x), recompile\n", fileName, sourceHash);
+        killAndDelete(fileName);
+      }
+
       //print the script
-      size_t scripLines = 0;
-      size_t lastIndex = 0;
-      for (size_t i = 0; i < scScript.length(); i++)
-      {
-        if (scScript[i] == '\n' || i == scScript.length()-1) {
-          ppf("%3d %s", scripLines+1, scScript.substr(lastIndex, i-lastIndex+1).c_str());
-          scripLines++;
-          lastIndex = i + 1;
+      if (printScript) {
+        size_t scripLines = 0;
+        size_t lastIndex = 0;
+        for (size_t i = 0; i < scScript.length(); i++)
+        {
+          if (scScript[i] == '\n' || i == scScript.length()-1) {
+            ppf("%3d %s", scripLines+1, scScript.substr(lastIndex, i-lastIndex+1).c_str());
+            scripLines++;
+            lastIndex = i + 1;
+          }
         }
+        ppf("\n");
       }
-      ppf("\n");
 
       ppf("Before parsing of %s\n", fileName);
       ppf("Heap %s:%d f:%d / t:%d (l:%d) B [%d %d]\n", __FUNCTION__, __LINE__, ESP.getFreeHeap(), ESP.getHeapSize(), ESP.getMaxAllocHeap(), esp_get_free_heap_size(), esp_get_free_internal_heap_size());
       ppf("Stack %d of %d B (async %d of %d B) %d\n", sys->sysTools_get_arduino_maxStackUsage(), getArduinoLoopTaskStackSize(), sys->sysTools_get_webserver_maxStackUsage(), CONFIG_ASYNC_TCP_STACK_SIZE, uxTaskGetStackHighWaterMark(xTaskGetCurrentTaskHandle()));
 
+      uint32_t heapBefore = ESP.getFreeHeap();
       Executable executable = parser.parseScript(&scScript);
       executable.name = string(fileName);
 
@@ -387,6 +714,16 @@ static float _time(float j) {
       ppf("%s:%d f:%d / t:%d (l:%d) B [%d %d]\n", __FUNCTION__, __LINE__, ESP.getFreeHeap(), ESP.getHeapSize(), ESP.getMaxAllocHeap(), esp_get_free_heap_size(), esp_get_free_internal_heap_size());
 
       scriptRuntime.addExe(executable);
+      sourceHashes[executable.name] = sourceHash;
+
+      if (executable.exeExist) {
+        ScriptMetrics *metrics = findMetrics(fileName, true);
+        if (metrics) {
+          exe_info exeInfo = scriptRuntime.getExecutableInfo(executable.name);
+          uint32_t heapUsed = heapBefore - min(heapBefore, ESP.getFreeHeap());
+          metrics->heapUsed = heapUsed > exeInfo.total_size?heapUsed - exeInfo.total_size:0;
+        }
+      }
 
       if (executable.exeExist) {
         ppf("exe created %d\n", scriptRuntime._scExecutables.size());
@@ -400,15 +737,20 @@ static float _time(float j) {
 
   void UserModLive::killAndDelete(const char *name) {
     if (name != nullptr) { 
+      ScriptMetrics *metrics = findMetrics(name);
+      if (metrics) killScriptTask(*metrics);
       scriptRuntime.kill(string(name));
       scriptRuntime.deleteExe(string(name));
+      sourceHashes.erase(string(name));
+      if (metrics) *metrics = ScriptMetrics(); //free the slot
     } else {
       scriptRuntime.killAndFreeRunningProgram();
     }
 
-    if (waitingOnLiveScript) {
-      waitingOnLiveScript = false;
-      ppf("waitingOnLiveScript killAndDelete %d\n", waitingOnLiveScript);
+    if (frameHeld) {
+      frameHeld = false;
+      xSemaphoreGive(frameConsumed);
+      ppf("frameHeld released killAndDelete\n");
     }
 
     // fix->liveFixtureID = nullptr; //to be sure! todo: nullify exec pointers fix->liveFixtureID and leds.liveEffectID
@@ -419,11 +761,45 @@ static float _time(float j) {
       killAndDelete(scriptRuntime._scExecutables[exeID].name.c_str());
   }
 
+  ScriptMetrics *UserModLive::findMetrics(const char *name, bool create) {
+    if (!name || !name[0]) return nullptr;
+    ScriptMetrics *free = nullptr;
+    for (ScriptMetrics &metrics: scriptMetrics) {
+      if (strncmp(metrics.name, name, sizeof(metrics.name)) == 0) return &metrics;
+      if (!free && !metrics.name[0]) free = &metrics;
+    }
+    if (create && free) {
+      strlcpy(free->name, name, sizeof(free->name));
+      //task settings persisted in the model as scripts.tasks.<name> = [core, priority, stackKB, budget]
+      JsonArray settings = Variable(this->name, "scripts").var["tasks"][name];
+      if (settings.size() >= 4) {
+        free->core = settings[0];
+        free->priority = settings[1];
+        free->stackKB = settings[2];
+        free->budget = settings[3];
+      }
+      return free;
+    }
+    return nullptr;
+  }
+
+  void UserModLive::saveTaskSettings(ScriptMetrics &metrics) {
+    Variable tableVar = Variable(name, "scripts");
+    JsonObject tasks = tableVar.var["tasks"].is<JsonObject>()?tableVar.var["tasks"].as<JsonObject>():tableVar.var["tasks"].to<JsonObject>();
+    JsonArray settings = tasks[metrics.name].to<JsonArray>();
+    settings.add(metrics.core);
+    settings.add(metrics.priority);
+    settings.add(metrics.stackKB);
+    settings.add(metrics.budget);
+    mdl->setDirty(tableVar.var);
+  }
+
   uint8_t UserModLive::findExecutable(const char *fileName) {
     uint8_t exeID = 0;
     for (Executable &exec: scriptRuntime._scExecutables) {
       if (exec.name.compare(string(fileName)) == 0)
-        return exeID++;
+        return exeID;
+      exeID++;
     }
     return UINT8_MAX;
   }
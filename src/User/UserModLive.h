@@ -11,13 +11,51 @@
 
 #pragma once
 #include "../SysModule.h"
+#include <unordered_map>
+
+#define LIVE_MAX_SCRIPTS 8 //profiled at the same time
+#define LIVE_CORE_AUTO 2 //renderCore if set, else no affinity
+
+//per executable runtime, measured in sync() on the task of the script
+struct ScriptMetrics {
+  char name[32] = ""; //executable, "" if slot free
+  TaskHandle_t task = nullptr; //of the script, set by executeBackgroundTask
+  int64_t frameStart = 0; //µs, end of the previous sync
+  uint32_t externalTime = 0; //µs in external calls this frame (see ExternalTimer)
+  //this second
+  uint32_t frames = 0;
+  uint32_t renderSum = 0; //µs excluding externals and waiting in sync
+  uint32_t renderMax = 0;
+  uint32_t externalSum = 0;
+  //last second, shown in the scripts table
+  uint32_t renderAvg = 0;
+  uint32_t renderPeak = 0;
+  uint32_t externalAvg = 0;
+  uint32_t stackFree = 0; //B, high water mark of the task
+  uint32_t heapUsed = 0; //B taken by compiling beyond exeInfo.total_size
+  uint16_t budget = 0; //µs render time per frame, 0: no budget, overrun for a second: the script is killed
+  //task of the script, persisted in the model (scripts.tasks), core and stackKB used at the next start
+  uint8_t core = LIVE_CORE_AUTO;
+  uint8_t priority = 1;
+  uint8_t stackKB = 16;
+  char function[16] = "main"; //executed by the task
+};
 
 class UserModLive: public SysModule {
 
 public:
 
+  //declare in an external function to count its time as external time of the calling script
+  struct ExternalTimer {
+    ExternalTimer();
+    ~ExternalTimer();
+    ScriptMetrics *metrics;
+    int64_t start;
+  };
+
   char fileName[32] = ""; //running sc file
   std::string scScript; //externals etc generated (would prefer String for esp32...)
+  bool3State printScript = false; //echo each line of the script when compiling (debug)
 
   UserModLive() :SysModule("LiveScripts") {};
 
@@ -37,7 +75,7 @@ public:
   static void preKill();
   static void postKill();
 
-  void syncWithSync();
+  void syncWithSync(const std::function<void()> &swapBuffers = nullptr);
 
   void loop1s() override;
 
@@ -51,6 +89,14 @@ public:
 
   void killAndDelete(const char *fileName = nullptr);
   void killAndDelete(uint8_t exeID);
+
+  ScriptMetrics *findMetrics(const char *name, bool create = false);
+
+  void saveTaskSettings(ScriptMetrics &metrics);
+
+private:
+  uint32_t externalsHash = 2166136261; //FNV-1a of the externals added since addDefaultExternals
+  std::unordered_map<std::string, uint32_t> sourceHashes; //per executable name: FNV-1a of script and externals it is compiled from
 };
 
 extern UserModLive *liveM;
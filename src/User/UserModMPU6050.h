@@ -15,19 +15,35 @@
 #include "../Sys/SysModPins.h"
 
 #include <MPU6050_6Axis_MotionApps20.h>
+#include <atomic>
 
 //see https://github.com/ElectronicCats/mpu6050/blob/0281cd4532b36922f4d68a4cae70eca7aebe9988/examples/MPU6050_DMP6/MPU6050_DMP6.ino
 
+//latest sample of the DMP, see UserModMPU6050::latest
+struct MotionSample {
+  //as read from the DMP, every sample (not only the published ones)
+  Coord3D gyro; // in degrees (not radians)
+  Coord3D accell;
+  VectorFloat gravityVector;
+
+  unsigned long micros = 0; //when read
+};
+
 class UserModMPU6050: public SysModule {
 
 public:
 
   bool3State motionTrackingReady = false;  // set true if DMP init was successful
 
+  //as published to the model (publishRate), high rate readers use latest()
   Coord3D gyro; // in degrees (not radians)
   Coord3D accell;
   VectorFloat gravityVector;
 
+  uint8_t intPin = UINT8_MAX; //INT of the MPU: a reader task drains the FIFO at the DMP rate (100/s). UINT8_MAX: polled in loop20ms (max 50/s)
+  uint8_t publishRate = 1; //gyro and accell to the model, per second
+  std::atomic<uint16_t> samplesCounter = {0}; //read this second (reader task or loop20ms), shown and reset in rate (loop1s)
+
   UserModMPU6050() :SysModule("Motion Tracking") {
     isEnabled = false; //need to enable after fresh setup
   };
@@ -43,12 +59,45 @@ public:
       default: return false;
     }}); 
 
+    ui->initPin(parentVar, "intPin", &intPin, false, [this](EventArguments) { switch (eventType) {
+      case onUI:
+        variable.setComment("Interrupt: read at the sensor rate by a task, no pin: polled 50/s");
+        return true;
+      case onChange: {
+        uint8_t oldValue = variable.var["oldValue"];
+        if (oldValue != UINT8_MAX)
+          pinsM->deallocatePin(oldValue, "Motion");
+        if (intPin != UINT8_MAX)
+          pinsM->allocatePin(intPin, "Motion", "MPU6050 INT");
+        startReader();
+        return true; }
+      default: return false;
+    }});
+
+    ui->initNumber(parentVar, "publishRate", &publishRate, 1, 50, false, [](EventArguments) { switch (eventType) {
+      case onUI:
+        variable.setComment("gyro and accell in the UI per second");
+        return true;
+      default: return false;
+    }});
+
+    ui->initText(parentVar, "rate", nullptr, 32, true, [this](EventArguments) { switch (eventType) {
+      case onUI:
+        variable.setComment("Samples read per second");
+        return true;
+      case onLoop1s:
+        variable.setValueF("%d /s", samplesCounter.exchange(0));
+        return true;
+      default: return false;
+    }});
+
     ui->initCoord3D(parentVar, "gyro", &gyro, 0, UINT16_MAX, true, [this](EventArguments) { switch (eventType) {
       case onUI:
         variable.setComment("in degrees");
         return true;
-      case onLoop1s:
-        variable.setValue(gyro); //automatic as var is referenced???
+      case onLoop:
+        ui->setLoopInterval(variable, 1000 / publishRate);
+        variable.setValue(gyro);
         return true;
       default: return false;
     }});
@@ -57,8 +106,9 @@ public:
       case onUI:
         variable.setComment("in m/s²");
         return true;
-      case onLoop1s:
-        variable.setValue(accell); //automatic as var is referenced???
+      case onLoop:
+        ui->setLoopInterval(variable, 1000 / publishRate);
+        variable.setValue(accell);
         return true;
       default: return false;
     }}); 
@@ -73,29 +123,30 @@ public:
 
     // if programming failed, don't try to do anything
     if (!motionTrackingReady) return;
-    // read a packet from FIFO
-    if (mpu.dmpGetCurrentFIFOPacket(fifoBuffer)) { // Get the Latest packet 
-      mpu.dmpGetQuaternion(&q, fifoBuffer);
-      mpu.dmpGetGravity(&gravity, &q);
-      mpu.dmpGetYawPitchRoll(ypr, &q, &gravity);
-      gyro.y = ypr[0] * 180/M_PI; //pan = yaw !
-      gyro.x = ypr[1] * 180/M_PI; //tilt = pitch !
-      gyro.z = ypr[2] * 180/M_PI; //roll = roll
-      gravityVector = gravity;
-      // display real acceleration, adjusted to remove gravity
 
-      //needed to repeat the following 3 lines (yes if you look at the output: otherwise not 0)
-      mpu.dmpGetQuaternion(&q, fifoBuffer); 
-      mpu.dmpGetAccel(&aa, fifoBuffer);
-      mpu.dmpGetGravity(&gravity, &q);
+    //no interrupt: read here, else the reader task did
+    if (!interruptMode && xSemaphoreTake(mpuMutex, 0) == pdTRUE) {
+      readSample();
+      xSemaphoreGive(mpuMutex);
+    }
 
-      mpu.dmpGetLinearAccel(&aaReal, &aa, &gravity);
-      // mpu.dmpGetLinearAccelInWorld(&aaWorld, &aaReal, &q); //worked in 0.6.0, not in 1.3.0 anymore
+    MotionSample sample = latest();
+    gyro = sample.gyro;
+    accell = sample.accell;
+    gravityVector = sample.gravityVector;
+  }
 
-      accell.x = aaReal.x;
-      accell.y = aaReal.y;
-      accell.z = aaReal.z;
-    }
+  //latest sample without locking (seqlock): for effects and scripts reading at their own rate, from any task
+  MotionSample latest() const {
+    MotionSample sample;
+    uint32_t sequence;
+    do {
+      sequence = sampleSequence.load(std::memory_order_acquire);
+      if (sequence & 1) continue; //being written
+      sample = latestSample;
+      std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((sequence & 1) || sequence != sampleSequence.load(std::memory_order_relaxed));
+    return sample;
   }
 
   void onOffChanged() {
@@ -119,6 +170,7 @@ public:
             // mpuIntStatus = mpu.getIntStatus();
 
             motionTrackingReady = true;
+            startReader();
           }
           else {
             // ERROR!
@@ -132,11 +184,91 @@ public:
           ppf("Testing device connections MPU6050 connection failed\n");
       }
     } else {
+      startReader(); //stops it
     }
   }
 
   private:
     MPU6050 mpu;
+    SemaphoreHandle_t mpuMutex = xSemaphoreCreateMutex(); //I2C of the mpu: reader task against loop20ms
+    TaskHandle_t readerTask = nullptr;
+    volatile bool interruptMode = false; //intPin attached and reader task reading
+    uint8_t attachedPin = UINT8_MAX;
+
+    MotionSample latestSample; //written by readSample only, read by latest
+    std::atomic<uint32_t> sampleSequence{0}; //odd while latestSample is written
+
+    static void IRAM_ATTR onInterrupt(void *parameter) {
+      BaseType_t woken = pdFALSE;
+      vTaskNotifyGiveFromISR(((UserModMPU6050 *)parameter)->readerTask, &woken);
+      if (woken) portYIELD_FROM_ISR();
+    }
+
+    //reader task on the INT pin, stopped (interrupt detached, task waits) without pin, when disabled or not ready
+    void startReader() {
+      if (attachedPin != UINT8_MAX) {
+        detachInterrupt(digitalPinToInterrupt(attachedPin));
+        attachedPin = UINT8_MAX;
+      }
+      interruptMode = false;
+      if (!isEnabled || !motionTrackingReady || intPin == UINT8_MAX) return;
+
+      if (!readerTask && xTaskCreatePinnedToCore([](void *parameter) {
+        UserModMPU6050 *motion = (UserModMPU6050 *)parameter;
+        for (;;) {
+          //woken by the INT pin, the timeout keeps reading if an interrupt is missed (FIFO overflow clears INT)
+          ulTaskNotifyTake(pdTRUE, motion->interruptMode?pdMS_TO_TICKS(100):portMAX_DELAY);
+          if (!motion->interruptMode) continue;
+          xSemaphoreTake(motion->mpuMutex, portMAX_DELAY);
+          motion->readSample();
+          xSemaphoreGive(motion->mpuMutex);
+        }
+      }, "mpu6050", 4096, this, tskIDLE_PRIORITY + 3, &readerTask, tskNO_AFFINITY) != pdPASS) {
+        ppf("dev MPU6050 reader task not created, polling\n");
+        readerTask = nullptr;
+        return;
+      }
+
+      pinMode(intPin, INPUT);
+      attachInterruptArg(digitalPinToInterrupt(intPin), onInterrupt, this, RISING);
+      attachedPin = intPin;
+      interruptMode = true;
+      xTaskNotifyGive(readerTask); //drain what is in the FIFO already
+    }
+
+    //latest packet of the FIFO (older packets are skipped, an overflowed FIFO is reset) to latestSample
+    bool readSample() {
+      if (!mpu.dmpGetCurrentFIFOPacket(fifoBuffer)) return false; // Get the Latest packet 
+      MotionSample sample;
+      mpu.dmpGetQuaternion(&q, fifoBuffer);
+      mpu.dmpGetGravity(&gravity, &q);
+      mpu.dmpGetYawPitchRoll(ypr, &q, &gravity);
+      sample.gyro.y = ypr[0] * 180/M_PI; //pan = yaw !
+      sample.gyro.x = ypr[1] * 180/M_PI; //tilt = pitch !
+      sample.gyro.z = ypr[2] * 180/M_PI; //roll = roll
+      sample.gravityVector = gravity;
+      // display real acceleration, adjusted to remove gravity
+
+      //needed to repeat the following 3 lines (yes if you look at the output: otherwise not 0)
+      mpu.dmpGetQuaternion(&q, fifoBuffer); 
+      mpu.dmpGetAccel(&aa, fifoBuffer);
+      mpu.dmpGetGravity(&gravity, &q);
+
+      mpu.dmpGetLinearAccel(&aaReal, &aa, &gravity);
+      // mpu.dmpGetLinearAccelInWorld(&aaWorld, &aaReal, &q); //worked in 0.6.0, not in 1.3.0 anymore
+
+      sample.accell.x = aaReal.x;
+      sample.accell.y = aaReal.y;
+      sample.accell.z = aaReal.z;
+      sample.micros = micros();
+
+      sampleSequence.fetch_add(1, std::memory_order_relaxed); //odd: writing
+      std::atomic_thread_fence(std::memory_order_release);
+      latestSample = sample;
+      sampleSequence.fetch_add(1, std::memory_order_release);
+      samplesCounter++;
+      return true;
+    }
 
     // MPU control/status vars
     uint8_t devStatus;      // return status after each device operation (0 = success, !0 = error)
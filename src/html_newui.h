@@ -7,610 +7,682 @@
  */
  
 // Autogenerated from data/newui/index.htm, do not edit!!
-const uint16_t PAGE_newui_L = 9657;
+const uint16_t PAGE_newui_L = 10789;
+const char PAGE_newui_ETag[] = "\"64f8dc08f0ca602d\""; //sha1 of the gzipped page
 const uint8_t PAGE_newui[] PROGMEM = {
-  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x13, 0xed, 0x7d, 0xd9, 0x76, 0xdb, 0x48,
-  0xd3, 0xd8, 0xbd, 0x9e, 0x02, 0xc6, 0xcc, 0x67, 0x11, 0x43, 0x10, 0x04, 0x57, 0x49, 0xa4, 0x20,
-  0x7f, 0x94, 0x2c, 0xdb, 0xf2, 0x22, 0x6b, 0xb4, 0xd8, 0x1e, 0x3b, 0x3e, 0xa3, 0x26, 0xd1, 0x24,
-  0x61, 0x81, 0x00, 0x07, 0x00, 0x45, 0x51, 0x1c, 0xbc, 0x41, 0xae, 0x72, 0x72, 0x91, 0xbb, 0xff,
-  0x3a, 0x27, 0xef, 0x90, 0x8b, 0x3c, 0x4a, 0x9e, 0xe0, 0x7f, 0x84, 0x54, 0xf5, 0x82, 0x85, 0x84,
-  0x16, 0x7b, 0xe6, 0x3f, 0xc9, 0x77, 0x4e, 0xbc, 0x90, 0x40, 0xf5, 0x56, 0x5d, 0x55, 0x5d, 0x4b,
-  0x6f, 0x54, 0x76, 0x9f, 0x3c, 0x7f, 0x7f, 0x70, 0xfe, 0xdb, 0xc9, 0xa1, 0x32, 0x8e, 0x26, 0xee,
-  0x9e, 0xb2, 0x2b, 0xbf, 0x28, 0xb1, 0xe1, 0x6b, 0x42, 0x23, 0xa2, 0x0c, 0xc6, 0x24, 0x08, 0x69,
-  0x64, 0xa9, 0xb3, 0x68, 0x58, 0xd9, 0x56, 0x13, 0xb0, 0xef, 0x45, 0xd4, 0x03, 0xf0, 0x82, 0x86,
-  0xaa, 0xb2, 0xe1, 0x91, 0x09, 0xb5, 0x54, 0x32, 0x9d, 0xba, 0xb4, 0x32, 0xf1, 0xfb, 0x0e, 0x7c,
-  0xcd, 0x69, 0xbf, 0x02, 0x80, 0xca, 0x80, 0x4c, 0x49, 0xdf, 0xa5, 0x49, 0xc9, 0x8d, 0xa4, 0xe8,
-  0xdc, 0xb1, 0xa3, 0xb1, 0x65, 0xd3, 0x6b, 0x67, 0x00, 0xd9, 0xf1, 0x45, 0x77, 0x3c, 0x27, 0x72,
-  0x88, 0x5b, 0x09, 0x07, 0xc4, 0xa5, 0x56, 0x4d, 0x55, 0x78, 0xc5, 0xd7, 0x0e, 0x9d, 0x4f, 0xfd,
-  0x20, 0x4a, 0x2b, 0x11, 0x0d, 0xce, 0xa2, 0xb1, 0x1f, 0xa8, 0x29, 0x36, 0xef, 0x7c, 0xdf, 0x7b,
-  0xe7, 0xdb, 0x33, 0x97, 0x86, 0x0a, 0xf1, 0x6c, 0xc5, 0x89, 0x42, 0x96, 0x18, 0x38, 0xfd, 0x59,
-  0xe4, 0x07, 0x21, 0x56, 0xe0, 0x3a, 0xde, 0x95, 0x12, 0x50, 0xd7, 0x52, 0x1d, 0x48, 0x02, 0xe4,
-  0xc7, 0x01, 0x1d, 0x5a, 0xaa, 0x4d, 0x22, 0xd2, 0x71, 0x26, 0x64, 0x44, 0xab, 0x53, 0x6f, 0xd4,
-  0xed, 0x93, 0x90, 0xb6, 0x9b, 0xba, 0xf3, 0x61, 0xff, 0xfd, 0xe9, 0xdc, 0x7c, 0xf3, 0x72, 0xe4,
-  0xf7, 0xe0, 0xcf, 0xf1, 0xd9, 0xc5, 0xf8, 0xf0, 0x62, 0x04, 0x4f, 0xfb, 0xf8, 0xda, 0xfb, 0xf5,
-  0xa0, 0xf7, 0x1b, 0x7e, 0x0f, 0xb7, 0xab, 0x3b, 0x63, 0x06, 0xf9, 0x74, 0x7c, 0x76, 0x6a, 0x1e,
-  0xf5, 0x82, 0xb0, 0x39, 0x68, 0xff, 0x0a, 0xef, 0x87, 0xa7, 0xee, 0xc7, 0x43, 0x77, 0x72, 0x7e,
-  0x61, 0xf6, 0xde, 0x60, 0xb9, 0x1e, 0x7c, 0xfc, 0x66, 0x4f, 0xa1, 0x68, 0x4f, 0xd6, 0xf2, 0x92,
-  0xc1, 0xe1, 0x4f, 0x1b, 0xdf, 0xdf, 0x09, 0xf8, 0x61, 0xaf, 0xf7, 0xa6, 0x77, 0x90, 0xcd, 0x77,
-  0xf8, 0xa6, 0xf7, 0x3c, 0xf7, 0xce, 0x4b, 0x99, 0x1f, 0x3e, 0xbd, 0x5a, 0x20, 0xac, 0x7e, 0xe8,
-  0x1e, 0xfe, 0xfa, 0xe1, 0xd7, 0xe6, 0xe1, 0x6f, 0x1f, 0xce, 0xce, 0x2f, 0xa2, 0xfe, 0xc5, 0x69,
-  0x6f, 0x67, 0xfb, 0xe6, 0xcd, 0xb9, 0xfb, 0x72, 0xff, 0xe2, 0xf6, 0xf0, 0xf3, 0x9b, 0x17, 0x17,
-  0xaf, 0xf6, 0xdd, 0xc1, 0x07, 0xe7, 0xc5, 0xbe, 0x7d, 0x76, 0xe0, 0xbe, 0x26, 0x67, 0x57, 0xaf,
-  0x1b, 0x9f, 0x68, 0x70, 0x10, 0x9d, 0x5f, 0x7f, 0x3a, 0xfd, 0xb0, 0x78, 0xdd, 0xec, 0x6d, 0xfb,
-  0x6f, 0xa3, 0x9b, 0x9a, 0xb7, 0xe8, 0x45, 0xfd, 0x2b, 0xff, 0x53, 0xf0, 0xf1, 0xc0, 0xf5, 0x6d,
-  0xf3, 0x8f, 0x17, 0x47, 0x9f, 0xc8, 0xf8, 0xf4, 0x65, 0xff, 0xe3, 0xcb, 0x63, 0x7a, 0x76, 0xdc,
-  0x32, 0x5b, 0x41, 0xeb, 0xe4, 0xa4, 0x79, 0xf4, 0x7c, 0x6b, 0xa7, 0x76, 0xdb, 0x6a, 0xcd, 0x6f,
-  0xed, 0xad, 0x71, 0xe3, 0x60, 0xbf, 0x7e, 0xb0, 0xa8, 0x5e, 0x0d, 0xea, 0xd7, 0xe7, 0x07, 0xe6,
-  0xf3, 0x57, 0xe5, 0xb3, 0xfd, 0xf7, 0x6e, 0xbf, 0x61, 0xbf, 0x6e, 0x7f, 0x24, 0x67, 0xc3, 0xdb,
-  0x9b, 0x13, 0xbf, 0xe5, 0xb6, 0x0f, 0x9a, 0xe1, 0xa7, 0x39, 0x1d, 0xdd, 0x9e, 0xbc, 0x3f, 0x1c,
-  0x3c, 0x9f, 0x98, 0x8e, 0xf9, 0xc1, 0x19, 0xdf, 0xdc, 0xce, 0x3e, 0x5d, 0x0c, 0xca, 0xb5, 0x9e,
-  0x77, 0x3b, 0x7f, 0xe7, 0xbf, 0xaf, 0x6e, 0x5f, 0x6c, 0x8f, 0x4e, 0x8e, 0x26, 0x6f, 0x7a, 0xe1,
-  0x6d, 0xf3, 0x5b, 0xb4, 0xf5, 0xf1, 0xdd, 0x4d, 0xb0, 0x73, 0x71, 0x72, 0x7c, 0xeb, 0x8e, 0xaa,
-  0xef, 0x3e, 0xfa, 0xb5, 0x6b, 0xfb, 0xf9, 0x59, 0xf0, 0x6b, 0x6f, 0x16, 0xbc, 0x1e, 0xbf, 0xde,
-  0xdf, 0xdf, 0x5a, 0x0c, 0x6f, 0xcd, 0xe0, 0xed, 0xb0, 0xd1, 0xb4, 0x3f, 0x85, 0xe7, 0x27, 0x6f,
-  0xbe, 0xfd, 0x36, 0xf9, 0xbc, 0xf5, 0xa6, 0xd7, 0xdc, 0x1a, 0x9f, 0x2d, 0xb6, 0xdf, 0x96, 0xfb,
-  0xa3, 0x4f, 0x3b, 0xf5, 0xb3, 0xb3, 0x97, 0xa7, 0x5b, 0xd3, 0xfe, 0xc5, 0xc4, 0xe9, 0xbd, 0xbe,
-  0x0a, 0x3f, 0xbc, 0x1e, 0xbc, 0x7b, 0xff, 0xf2, 0xf9, 0xd5, 0xf8, 0xdb, 0x89, 0x77, 0x35, 0xeb,
-  0xb5, 0x66, 0xc7, 0x2f, 0x9e, 0x0f, 0xcb, 0xf5, 0xa3, 0xf2, 0xcd, 0xe7, 0xe0, 0x7c, 0xfe, 0xc7,
-  0x1f, 0xa7, 0xa3, 0xc6, 0xeb, 0xf2, 0x61, 0xe3, 0x70, 0x78, 0x70, 0xf2, 0xee, 0x68, 0x3e, 0x75,
-  0xce, 0x3f, 0x97, 0xcf, 0xe7, 0x1f, 0xc7, 0x9f, 0x06, 0xfd, 0xf1, 0x84, 0x4c, 0x6e, 0x7f, 0x7b,
-  0xd3, 0x9f, 0x7f, 0x7e, 0xfe, 0x87, 0xfd, 0xb2, 0x5d, 0xdf, 0xea, 0xf5, 0xb6, 0x3f, 0xdc, 0x1c,
-  0xf6, 0xce, 0xae, 0xcf, 0x47, 0xd5, 0x73, 0x33, 0x78, 0x33, 0x78, 0xf3, 0xf9, 0xac, 0x3f, 0x26,
-  0xd1, 0xf6, 0xf4, 0xd8, 0x1b, 0xf6, 0x4e, 0x6a, 0xd5, 0xda, 0xbc, 0xff, 0xb9, 0xbc, 0x28, 0xb7,
-  0xf7, 0xdb, 0x5b, 0xdf, 0xbc, 0xdb, 0xad, 0xf1, 0x81, 0xe9, 0xb9, 0x47, 0xcd, 0x9d, 0x6b, 0x0f,
-  0xc8, 0xf5, 0x5b, 0xf4, 0xfe, 0xec, 0x73, 0xf9, 0xb4, 0x1d, 0x98, 0x93, 0x85, 0xd9, 0x9e, 0x1e,
-  0x8e, 0xde, 0x06, 0xd5, 0xd9, 0x69, 0x3f, 0xda, 0x99, 0x1e, 0x6c, 0x8f, 0x3e, 0xed, 0xbf, 0x38,
-  0x5c, 0x98, 0x53, 0xf3, 0xf9, 0xfb, 0xcf, 0xb5, 0xf0, 0xf4, 0xe3, 0xd5, 0xa2, 0xb7, 0xef, 0x84,
-  0x67, 0x2f, 0x1b, 0xbd, 0xed, 0xd7, 0x5b, 0xaf, 0x5f, 0x4c, 0x6f, 0x07, 0x6f, 0x83, 0x8f, 0x37,
-  0xaf, 0xbe, 0x11, 0x93, 0x2c, 0x60, 0x98, 0x9c, 0x05, 0xaf, 0x7c, 0x77, 0xf4, 0xdc, 0x9b, 0x9f,
-  0x6f, 0x95, 0x3f, 0x0e, 0x17, 0xb3, 0x77, 0x1f, 0x3f, 0x7f, 0xae, 0xde, 0x0c, 0x76, 0x5a, 0x64,
-  0xd4, 0x7c, 0x77, 0x70, 0xfe, 0xf9, 0xa2, 0x7c, 0x5a, 0x7d, 0xdf, 0x38, 0x70, 0x46, 0xd3, 0x5f,
-  0x6f, 0x3f, 0x1e, 0x8d, 0x83, 0xfa, 0x8b, 0xd3, 0x37, 0x6f, 0x5f, 0x39, 0xaf, 0xaf, 0x8f, 0xdf,
-  0xb8, 0x6f, 0x5f, 0xef, 0x9f, 0x4e, 0x68, 0xb3, 0x3d, 0xfe, 0xbc, 0xfd, 0x5b, 0xa3, 0xb1, 0x4d,
-  0x9d, 0x6f, 0x57, 0xb5, 0x8f, 0xad, 0xab, 0xdb, 0x57, 0xd3, 0xfe, 0x76, 0x74, 0xf5, 0xb2, 0x37,
-  0x3b, 0xf8, 0x30, 0xff, 0x74, 0x42, 0x9b, 0xd3, 0xd1, 0xc1, 0xd9, 0xe0, 0xe6, 0xac, 0xe7, 0xce,
-  0xe9, 0x8b, 0x93, 0x76, 0xf9, 0x60, 0x18, 0x7c, 0xa8, 0xbe, 0x6f, 0x7d, 0x7c, 0xf5, 0xa6, 0xd1,
-  0xbc, 0xad, 0xb6, 0x4c, 0x72, 0x34, 0x18, 0xff, 0xfa, 0x6a, 0xbf, 0xc5, 0x45, 0xf3, 0xf5, 0xe9,
-  0x45, 0xeb, 0x30, 0xb8, 0x7a, 0x3d, 0x1a, 0x8d, 0x2c, 0x4b, 0xdd, 0xdb, 0x50, 0x76, 0xc3, 0x41,
-  0xe0, 0x4c, 0xa3, 0xbd, 0x6a, 0x55, 0xf9, 0xa7, 0x0b, 0x63, 0xdd, 0x0b, 0xa9, 0xa2, 0x28, 0x2f,
-  0x8f, 0x2f, 0x94, 0x97, 0x87, 0xc7, 0x87, 0xa7, 0xbd, 0xb7, 0xca, 0xc9, 0xc5, 0xfe, 0xdb, 0xa3,
-  0x03, 0x05, 0xfe, 0x1f, 0x1e, 0x9f, 0x1d, 0x2a, 0x1f, 0x68, 0x10, 0x3a, 0xbe, 0xa7, 0x34, 0x74,
-  0xa5, 0xbe, 0xa3, 0xbc, 0x9e, 0x79, 0x54, 0xa9, 0x9b, 0xe6, 0xd6, 0x46, 0xbe, 0x82, 0x17, 0x7e,
-  0xa0, 0x78, 0x90, 0xeb, 0xe5, 0xc9, 0xdb, 0xca, 0x75, 0x43, 0x99, 0x85, 0x30, 0x74, 0x75, 0x18,
-  0xed, 0x93, 0x09, 0x0d, 0x06, 0xa0, 0x44, 0x14, 0x91, 0x35, 0x54, 0x26, 0xb3, 0x30, 0x52, 0xfa,
-  0x54, 0x99, 0xce, 0x02, 0x50, 0x67, 0x21, 0xb5, 0x0d, 0xe5, 0x00, 0x94, 0x02, 0x19, 0x44, 0xca,
-  0x04, 0x14, 0xc6, 0x84, 0x2b, 0x8c, 0x7f, 0x3a, 0x03, 0xd7, 0x9f, 0xd9, 0x06, 0xd4, 0xb0, 0x31,
-  0x70, 0x49, 0x18, 0xb2, 0x4c, 0x81, 0xef, 0xba, 0x34, 0x58, 0xce, 0x43, 0xcb, 0x9b, 0xb9, 0x6e,
-  0x37, 0x5c, 0x84, 0x47, 0xde, 0xd0, 0xb7, 0x96, 0x71, 0x57, 0x14, 0xe3, 0xf0, 0x68, 0x4c, 0x41,
-  0x21, 0xb1, 0xc7, 0x09, 0x71, 0xbc, 0x63, 0x72, 0xcd, 0x5f, 0x7c, 0xef, 0xad, 0x4f, 0xec, 0x92,
-  0xb6, 0xb4, 0xfd, 0xc1, 0x6c, 0x02, 0x3a, 0xca, 0x88, 0x9c, 0x08, 0x54, 0x1b, 0x68, 0xc6, 0x63,
-  0x50, 0x61, 0x25, 0xad, 0xac, 0xfe, 0xfb, 0xbf, 0xfd, 0x97, 0xff, 0xa1, 0xf4, 0x17, 0x4a, 0x56,
-  0x77, 0xfd, 0xfb, 0xbf, 0xfd, 0xe7, 0xff, 0xaa, 0xea, 0x73, 0xc7, 0xb3, 0xfd, 0xb9, 0xe1, 0xfa,
-  0x03, 0x12, 0x01, 0x3d, 0x0c, 0x54, 0x54, 0x86, 0xe3, 0x0d, 0xdc, 0x99, 0x4d, 0xc3, 0x92, 0x5a,
-  0xab, 0x6f, 0x19, 0x26, 0xfc, 0xad, 0xa9, 0xda, 0xb3, 0x68, 0xec, 0x84, 0xc6, 0x90, 0x46, 0x83,
-  0x31, 0x54, 0x41, 0x5d, 0xa0, 0xcd, 0x5b, 0xe7, 0x9a, 0x9e, 0xd1, 0xe0, 0x9a, 0x06, 0x25, 0xad,
-  0xc3, 0x92, 0x27, 0xe4, 0x8a, 0x7e, 0x3c, 0x2b, 0x69, 0x3a, 0x7f, 0x93, 0xe8, 0xd3, 0xb9, 0x22,
-  0x9a, 0xed, 0xba, 0x34, 0x52, 0xa8, 0x35, 0x3a, 0xb2, 0x4b, 0x6a, 0xdf, 0xb7, 0x17, 0xaa, 0xd6,
-  0xa5, 0xd0, 0x9e, 0x47, 0x83, 0x57, 0xe7, 0xef, 0xde, 0x96, 0x2d, 0x75, 0x77, 0x5c, 0xdb, 0x3b,
-  0x8b, 0x08, 0xd4, 0x3d, 0x1a, 0x47, 0x0a, 0x22, 0xbe, 0x5b, 0x05, 0x90, 0xca, 0x6b, 0x14, 0x34,
-  0x80, 0xfa, 0xce, 0xf1, 0x29, 0x03, 0x34, 0x06, 0x01, 0x25, 0x11, 0xc5, 0x5a, 0x64, 0xf3, 0x1c,
-  0x3e, 0xa2, 0x11, 0xcb, 0x0b, 0xd0, 0xc7, 0x77, 0xf6, 0xe9, 0xd3, 0x52, 0x0e, 0xad, 0xcd, 0x5d,
-  0xc7, 0x9b, 0xce, 0x22, 0xc5, 0xb1, 0x2d, 0x15, 0x7b, 0x6d, 0xa0, 0x56, 0x8f, 0x16, 0x53, 0x30,
-  0x10, 0x83, 0x31, 0x1d, 0x5c, 0xf5, 0xfd, 0x1b, 0x30, 0x11, 0xc8, 0xd1, 0x1c, 0x00, 0x9f, 0xa8,
-  0xbd, 0xb7, 0x29, 0xe9, 0x21, 0xd9, 0x86, 0xf4, 0xe0, 0xcf, 0xa5, 0x2c, 0xa1, 0xf0, 0x9b, 0xba,
-  0xf9, 0xcc, 0xf9, 0x7e, 0xcd, 0x42, 0x1a, 0xbc, 0x98, 0x79, 0x67, 0x34, 0x9a, 0x4d, 0x4b, 0x5a,
-  0x4c, 0xc2, 0x85, 0x37, 0x50, 0xee, 0xe4, 0xc9, 0x92, 0x13, 0x9b, 0xcc, 0x89, 0x13, 0x95, 0xd8,
-  0x27, 0xcf, 0x5b, 0x52, 0xab, 0x13, 0x27, 0x1c, 0x54, 0x59, 0x73, 0xc6, 0xb7, 0x10, 0x3a, 0xa3,
-  0x69, 0xec, 0xbb, 0x84, 0xec, 0x08, 0xc1, 0x0c, 0x96, 0x4a, 0xc3, 0x99, 0x37, 0x40, 0x2a, 0x95,
-  0x80, 0xca, 0xda, 0x32, 0x80, 0x16, 0x03, 0x0f, 0xb0, 0x8e, 0xc6, 0x06, 0xe9, 0x87, 0x40, 0x1d,
-  0x5f, 0xab, 0x24, 0x6f, 0x11, 0xbc, 0xc5, 0x9a, 0xd6, 0x1d, 0xfa, 0x41, 0x09, 0xdb, 0x8c, 0x14,
-  0x7f, 0xa8, 0x50, 0x2d, 0xd7, 0x37, 0x62, 0xdb, 0x5c, 0x06, 0x4a, 0x91, 0xc6, 0xa4, 0x20, 0xb2,
-  0x96, 0x42, 0xd4, 0x3b, 0xcb, 0x38, 0xee, 0x46, 0x86, 0x78, 0x33, 0xfa, 0x3e, 0x09, 0x80, 0xce,
-  0x34, 0x9c, 0x36, 0xea, 0xc0, 0xf7, 0x04, 0xee, 0x05, 0xef, 0x87, 0x27, 0x8e, 0x17, 0x5a, 0x4d,
-  0x33, 0x03, 0x9d, 0x3a, 0xde, 0x39, 0x30, 0x22, 0xb4, 0xbe, 0x7c, 0x4d, 0xda, 0xa7, 0x96, 0xd9,
-  0xa5, 0xbb, 0xeb, 0x25, 0xbb, 0xb4, 0x5c, 0xd6, 0xd6, 0x8b, 0x7e, 0xa1, 0x5f, 0x2d, 0xd6, 0x97,
-  0xc0, 0x9f, 0x79, 0x76, 0xa9, 0xf1, 0x0b, 0x7f, 0x01, 0xeb, 0xee, 0x4f, 0x4a, 0xd0, 0x2d, 0xd6,
-  0x8f, 0x80, 0x0e, 0x28, 0xd0, 0xf6, 0x39, 0xd8, 0x70, 0xe8, 0x81, 0x94, 0x25, 0xf0, 0x5b, 0x8e,
-  0xc0, 0x31, 0x08, 0xae, 0x89, 0x9b, 0x21, 0x99, 0xb6, 0x64, 0x02, 0x2e, 0x25, 0x45, 0x33, 0x84,
-  0x24, 0x3c, 0x7d, 0x3a, 0x48, 0xc6, 0x7b, 0x42, 0x98, 0x11, 0x05, 0x31, 0x03, 0x16, 0xb3, 0x9a,
-  0x81, 0x8c, 0x7a, 0x8d, 0x36, 0x1e, 0xac, 0x9f, 0xf7, 0xf2, 0x8b, 0xa9, 0xd7, 0xf4, 0xba, 0xde,
-  0xd0, 0x9b, 0x5f, 0xbb, 0xce, 0xb0, 0x44, 0xbf, 0x98, 0xb9, 0x8e, 0xd4, 0x57, 0x3a, 0xa2, 0x9b,
-  0x96, 0x85, 0x79, 0x78, 0xf1, 0x88, 0x8f, 0x42, 0xa4, 0x0b, 0x27, 0x39, 0x8c, 0x45, 0xa8, 0x04,
-  0x98, 0x9d, 0xb0, 0x11, 0xc8, 0x18, 0xed, 0x66, 0x50, 0x5e, 0xa3, 0x67, 0x04, 0xf4, 0xa4, 0x5f,
-  0xa2, 0x72, 0x2b, 0xdf, 0x6e, 0xab, 0xbd, 0x4a, 0xc2, 0x82, 0x7e, 0x4f, 0x03, 0x8a, 0x4e, 0xd7,
-  0x3e, 0x36, 0x5d, 0x8a, 0x74, 0xaa, 0xc5, 0x31, 0x75, 0x41, 0xed, 0x0a, 0x19, 0x2f, 0x51, 0x46,
-  0x0b, 0xd3, 0xd4, 0x62, 0xa9, 0x55, 0x96, 0x88, 0x1e, 0xf2, 0x62, 0x1e, 0x6a, 0x5c, 0x20, 0x85,
-  0x3a, 0x29, 0xa9, 0xe3, 0x28, 0x9a, 0x86, 0x1d, 0xd5, 0xb2, 0x56, 0xc7, 0xf8, 0x34, 0xf0, 0x23,
-  0x7f, 0xe0, 0xbb, 0xcf, 0xd4, 0x79, 0x18, 0xaa, 0x1d, 0xf8, 0x54, 0x41, 0x21, 0x76, 0xaa, 0x55,
-  0xb5, 0xbc, 0xa6, 0x0e, 0xfc, 0x30, 0x42, 0xa7, 0xaf, 0xac, 0x56, 0x21, 0x17, 0xa2, 0x1c, 0xfa,
-  0x2e, 0x85, 0xf4, 0x51, 0x49, 0xe5, 0x28, 0x28, 0xb3, 0xc0, 0x55, 0x01, 0x53, 0x5d, 0x60, 0xc1,
-  0x46, 0xf2, 0x47, 0xda, 0x3f, 0xf3, 0x81, 0xbb, 0x51, 0x29, 0x4d, 0x30, 0xfa, 0x8e, 0x47, 0x82,
-  0xc5, 0x39, 0xd3, 0x10, 0x24, 0x08, 0xc8, 0xa2, 0x3f, 0x1b, 0x0e, 0x69, 0xa0, 0x26, 0x19, 0xc0,
-  0x26, 0xd0, 0x10, 0xed, 0x89, 0x45, 0xad, 0x3d, 0xec, 0x18, 0x35, 0xd0, 0x3d, 0x54, 0x80, 0xaa,
-  0x11, 0xf1, 0x06, 0x14, 0x06, 0x50, 0x0f, 0xcb, 0xed, 0xb3, 0x72, 0x92, 0x63, 0xd8, 0xde, 0x85,
-  0xe3, 0x45, 0xdb, 0x2c, 0x4d, 0x94, 0x61, 0x6c, 0x03, 0xd6, 0x46, 0x09, 0x6b, 0x69, 0x01, 0x6b,
-  0xe9, 0xd3, 0xa7, 0xb9, 0xf1, 0x98, 0x23, 0x3f, 0x8e, 0xf1, 0x3c, 0xf5, 0xc5, 0xbb, 0x6c, 0x97,
-  0x19, 0xa0, 0x60, 0xb1, 0x8c, 0xac, 0xd7, 0x67, 0xef, 0x8f, 0x8d, 0x29, 0x7a, 0xec, 0xb2, 0xf9,
-  0x18, 0xe8, 0x07, 0x4a, 0xc5, 0xd7, 0x96, 0x3c, 0xa3, 0x2e, 0x29, 0x47, 0x83, 0x00, 0x24, 0x49,
-  0xd2, 0x0e, 0xf5, 0x8b, 0xc2, 0x40, 0xaa, 0xee, 0xeb, 0xb2, 0x2c, 0x93, 0x38, 0xfc, 0x30, 0x50,
-  0x9d, 0x3e, 0x7d, 0xfa, 0x05, 0x5d, 0x7c, 0xc0, 0x51, 0xd5, 0x55, 0x44, 0x85, 0x3f, 0x81, 0xdc,
-  0xe1, 0xc3, 0xd7, 0x54, 0x59, 0xf3, 0xec, 0x9a, 0xec, 0xee, 0x93, 0x5a, 0x32, 0xf6, 0x7d, 0xd4,
-  0x3d, 0x05, 0x5a, 0xd5, 0x37, 0x40, 0x79, 0x5b, 0x11, 0x7c, 0xa2, 0x72, 0xb7, 0x9e, 0x98, 0x5a,
-  0xf7, 0x09, 0xd2, 0xc4, 0xf0, 0x9f, 0xdd, 0xa9, 0xa7, 0x3a, 0x39, 0x19, 0xc0, 0xd0, 0x05, 0x2b,
-  0xe7, 0x39, 0x15, 0xe2, 0x82, 0x66, 0xb6, 0x17, 0x8a, 0x1c, 0xbf, 0x80, 0xa8, 0x24, 0x22, 0xe3,
-  0x8e, 0xe1, 0x84, 0x9c, 0x4b, 0x91, 0xf6, 0x2c, 0x57, 0x0f, 0x84, 0x23, 0x0a, 0x93, 0x09, 0xf0,
-  0x2d, 0x00, 0xf9, 0x9b, 0x29, 0x1d, 0x88, 0xd2, 0x9d, 0x02, 0x4d, 0x13, 0xc7, 0x19, 0x99, 0x01,
-  0xf7, 0x21, 0xe4, 0x12, 0x93, 0xab, 0x11, 0xa8, 0xcb, 0x52, 0x58, 0x40, 0x02, 0x23, 0x23, 0x58,
-  0x30, 0x29, 0x05, 0xe5, 0x71, 0xee, 0x4c, 0xa8, 0x3f, 0x8b, 0x4a, 0x9c, 0x07, 0x7a, 0xad, 0x05,
-  0xe3, 0x29, 0x95, 0x5e, 0x60, 0x56, 0xb6, 0x76, 0x7f, 0x4a, 0xbd, 0xc2, 0xca, 0x31, 0x01, 0x6b,
-  0xcc, 0x66, 0x66, 0x9c, 0x2c, 0xcc, 0x2d, 0x78, 0x8c, 0x03, 0x3a, 0xa0, 0x7f, 0xcc, 0x68, 0x18,
-  0xbd, 0x46, 0xd3, 0x42, 0xd9, 0xf8, 0x7d, 0xbc, 0x0d, 0x06, 0x91, 0x45, 0x01, 0x84, 0x32, 0x4f,
-  0x0a, 0x06, 0xbd, 0x10, 0xc4, 0x10, 0xe2, 0x2e, 0x6f, 0xe4, 0x0c, 0x61, 0x2c, 0x08, 0x3d, 0x0d,
-  0xc8, 0x85, 0x14, 0x94, 0x50, 0xc4, 0x9a, 0x4f, 0x29, 0xc9, 0x9b, 0x77, 0xc2, 0xf7, 0xfd, 0x6f,
-  0x40, 0x6f, 0x78, 0xd5, 0x72, 0xd6, 0x8a, 0x83, 0x8d, 0x2b, 0xba, 0x08, 0x4b, 0x52, 0xae, 0x7c,
-  0xd0, 0x96, 0xd1, 0x57, 0xdd, 0x03, 0xa9, 0x09, 0xa7, 0x2e, 0xd8, 0x50, 0xd5, 0x50, 0x81, 0xaa,
-  0x56, 0x4e, 0x5e, 0x86, 0xd0, 0xa1, 0x0f, 0x24, 0x28, 0x79, 0x30, 0xfa, 0x74, 0xef, 0x4b, 0xed,
-  0x2b, 0x1b, 0x8e, 0xa1, 0xb6, 0xbc, 0x26, 0x01, 0xf6, 0xfb, 0xdc, 0x3f, 0x40, 0xbf, 0x00, 0x20,
-  0x39, 0xc6, 0xfa, 0x5c, 0x54, 0x54, 0xa1, 0x52, 0x41, 0x73, 0x45, 0x20, 0x97, 0xac, 0x66, 0xe9,
-  0x00, 0x42, 0x96, 0x38, 0x16, 0xf4, 0x4a, 0xf5, 0x27, 0xd3, 0x01, 0xa9, 0xdb, 0xc8, 0xd4, 0x54,
-  0xa4, 0x5c, 0x1c, 0x1d, 0x9f, 0x6f, 0xff, 0xfe, 0xae, 0xf7, 0xc9, 0xaa, 0xb7, 0x5a, 0x3a, 0xbe,
-  0xd5, 0xda, 0xec, 0xb5, 0xdd, 0x6a, 0x35, 0x5a, 0x5d, 0x69, 0x39, 0x14, 0xd4, 0x0b, 0x34, 0x31,
-  0xe7, 0x89, 0xc7, 0x08, 0x4e, 0xd2, 0xa1, 0x4b, 0xf1, 0x71, 0x7f, 0xc1, 0x72, 0xc4, 0x49, 0x89,
-  0xc1, 0x61, 0x51, 0x01, 0xee, 0x95, 0x88, 0x32, 0xf9, 0xfc, 0x07, 0x87, 0xdc, 0x65, 0xe0, 0x14,
-  0xbc, 0xa3, 0x04, 0xf8, 0x00, 0xa2, 0x4a, 0x6a, 0xc0, 0x80, 0x07, 0x86, 0x1d, 0x8c, 0x1d, 0xd7,
-  0x06, 0xb2, 0xe8, 0x7e, 0x5a, 0x97, 0x13, 0xbe, 0xf5, 0xe7, 0x10, 0x3e, 0x12, 0x54, 0x36, 0x09,
-  0x12, 0xd4, 0x88, 0xfc, 0x14, 0xae, 0x81, 0x4d, 0xcb, 0x94, 0x80, 0xe8, 0xfe, 0x80, 0x4c, 0x05,
-  0xb7, 0x55, 0x2e, 0x1e, 0xea, 0x13, 0x0b, 0xb5, 0x05, 0xf3, 0x49, 0x78, 0x1d, 0xaa, 0x2a, 0x84,
-  0x08, 0x1e, 0x12, 0xc5, 0x01, 0xd6, 0xce, 0xdf, 0x05, 0x31, 0xa6, 0xde, 0x28, 0x1a, 0x77, 0x7d,
-  0x30, 0x6d, 0xa0, 0x54, 0x41, 0x3b, 0x94, 0x2d, 0xf0, 0x2e, 0xc7, 0x24, 0xe8, 0x45, 0x80, 0x1e,
-  0xb4, 0x7d, 0x01, 0xf8, 0x8a, 0xb6, 0x3b, 0x4f, 0x72, 0x28, 0xa6, 0xd9, 0xc0, 0x83, 0x2c, 0x4e,
-  0xa9, 0xd4, 0x34, 0x0d, 0xab, 0x54, 0x15, 0xb5, 0x9c, 0xc9, 0xdf, 0x51, 0x2b, 0x20, 0x02, 0x19,
-  0xc0, 0x9f, 0x7f, 0xaa, 0xbf, 0xe7, 0x21, 0xa2, 0x54, 0x27, 0x8f, 0x8f, 0x24, 0x63, 0x94, 0xa5,
-  0x5a, 0x22, 0xe3, 0x82, 0x64, 0x4f, 0xf2, 0x0a, 0x89, 0xa2, 0x7f, 0x8b, 0x83, 0xff, 0x09, 0x34,
-  0x00, 0x8f, 0xaa, 0x2c, 0x8a, 0x52, 0x28, 0x08, 0x05, 0xed, 0xfb, 0xac, 0x96, 0x0c, 0x4c, 0xcb,
-  0xb0, 0x99, 0x39, 0x92, 0x3d, 0xcf, 0x3e, 0xbc, 0xa1, 0x83, 0x59, 0x44, 0x91, 0xe5, 0xa0, 0xd5,
-  0x3d, 0x9d, 0x6b, 0x15, 0xf0, 0x21, 0x98, 0xa3, 0x49, 0xcb, 0x91, 0xbe, 0x9c, 0xd0, 0x68, 0xec,
-  0xdb, 0x1d, 0x15, 0x84, 0x4c, 0x8d, 0x35, 0x74, 0xcb, 0x41, 0x19, 0x58, 0x7b, 0xe0, 0x1a, 0x5d,
-  0x3d, 0x03, 0x5e, 0xd2, 0x9b, 0x08, 0x08, 0x59, 0x0a, 0x9f, 0x3e, 0x85, 0xf1, 0xff, 0xc2, 0x01,
-  0xcd, 0xaa, 0x96, 0xa3, 0xb2, 0xca, 0x94, 0xe3, 0x10, 0xfd, 0x09, 0x18, 0x73, 0x2a, 0x3a, 0xa8,
-  0xb2, 0xe0, 0xd2, 0x2b, 0xf9, 0xa8, 0x5d, 0xc0, 0xad, 0x62, 0x86, 0x27, 0xe3, 0xaa, 0x6a, 0x4b,
-  0x56, 0x8d, 0xaf, 0xab, 0x87, 0xa8, 0x84, 0x40, 0x37, 0x47, 0x11, 0x08, 0x00, 0xd6, 0xa8, 0xe9,
-  0x59, 0x3d, 0x85, 0xc5, 0x35, 0x1c, 0xbb, 0xc4, 0x75, 0x17, 0x25, 0x10, 0xa2, 0xbd, 0x65, 0xac,
-  0xc5, 0x1b, 0xbb, 0x55, 0x11, 0x48, 0x26, 0x11, 0xe5, 0xc6, 0xbf, 0x5c, 0x48, 0xc9, 0xa2, 0x9d,
-  0x65, 0x36, 0x6c, 0x58, 0x66, 0xc2, 0xad, 0x6c, 0x54, 0x73, 0xb9, 0x3b, 0xdd, 0xdb, 0x75, 0x49,
-  0x9f, 0xba, 0x7b, 0xac, 0xd0, 0x6e, 0x95, 0xbf, 0x28, 0xff, 0xc9, 0x03, 0x4c, 0x81, 0x04, 0xd4,
-  0x05, 0x01, 0x10, 0x13, 0x64, 0x2c, 0x9a, 0xaa, 0x70, 0x90, 0xca, 0x02, 0xa1, 0x3c, 0x04, 0x8c,
-  0xd3, 0x98, 0x78, 0x23, 0x8c, 0x88, 0x52, 0x5f, 0x8f, 0x87, 0x60, 0xa1, 0x0c, 0xc1, 0x98, 0x7a,
-  0x03, 0x57, 0x76, 0x46, 0x35, 0x75, 0x8f, 0x37, 0x02, 0xcd, 0xf8, 0x53, 0x26, 0x51, 0x0c, 0x6e,
-  0xc1, 0x90, 0x25, 0x01, 0xce, 0x8c, 0xa9, 0x2c, 0x0c, 0xdc, 0x87, 0xa7, 0xdd, 0x2a, 0xcf, 0x71,
-  0x5f, 0x09, 0x17, 0xc3, 0x45, 0x35, 0x8d, 0x1c, 0x1f, 0x2a, 0x33, 0x77, 0xc1, 0xe2, 0xee, 0x7d,
-  0x7c, 0x7b, 0xf8, 0xfc, 0xa1, 0x9c, 0x23, 0x18, 0x31, 0x14, 0xcc, 0xdf, 0xde, 0x4b, 0xfe, 0xf0,
-  0x50, 0x7e, 0xb0, 0xee, 0xea, 0xde, 0x73, 0x7a, 0xfd, 0x50, 0x3e, 0x81, 0xf1, 0xa3, 0xb0, 0xb5,
-  0x49, 0x70, 0x85, 0x95, 0x82, 0x4f, 0x8d, 0x3d, 0x7c, 0x28, 0x7b, 0x1f, 0x3e, 0xd5, 0xbd, 0x7d,
-  0xf8, 0x7c, 0x28, 0x27, 0x44, 0x40, 0x50, 0x31, 0xf8, 0x89, 0x57, 0x0f, 0x12, 0x79, 0x4a, 0x06,
-  0xc8, 0x13, 0xfc, 0x7a, 0x28, 0xaf, 0xb7, 0x20, 0x40, 0xaf, 0x63, 0xf8, 0x5c, 0xcf, 0x59, 0xe5,
-  0xf2, 0xb2, 0xb7, 0x0b, 0x15, 0x7a, 0x7b, 0xca, 0x9f, 0x08, 0xc1, 0x27, 0x11, 0x60, 0xf3, 0x98,
-  0xba, 0x3f, 0x8b, 0x22, 0x8c, 0xb0, 0x45, 0x7d, 0xcc, 0x80, 0x3a, 0x83, 0x8b, 0x23, 0x2e, 0x77,
-  0xfd, 0xcc, 0x3b, 0xba, 0x44, 0xce, 0xe0, 0x0a, 0x67, 0x7a, 0x99, 0x9d, 0x44, 0x4f, 0xa5, 0xb4,
-  0xf9, 0xf3, 0xb2, 0xd0, 0xcd, 0x08, 0xe8, 0xd4, 0x05, 0xf4, 0x21, 0xfc, 0x05, 0x1b, 0x3a, 0x73,
-  0x54, 0x54, 0x2b, 0xf1, 0xa6, 0xa2, 0x6f, 0xfe, 0x0e, 0x48, 0x0d, 0x37, 0xb5, 0xae, 0xba, 0xb7,
-  0x5b, 0x65, 0x78, 0x64, 0xf0, 0x9d, 0xee, 0x5d, 0xc6, 0x89, 0x00, 0x83, 0x82, 0xc9, 0x79, 0x3b,
-  0x32, 0x81, 0xb9, 0x5b, 0xd8, 0x98, 0x7b, 0x16, 0xf9, 0x01, 0x0c, 0x69, 0x16, 0xb8, 0x45, 0x74,
-  0x52, 0xe2, 0xa3, 0x84, 0xa5, 0x27, 0xa6, 0x50, 0x3e, 0x08, 0x63, 0x68, 0xb0, 0x71, 0x8b, 0x73,
-  0x35, 0x60, 0xc9, 0xd2, 0xe9, 0x0a, 0xe1, 0xda, 0xe6, 0x6a, 0x1d, 0xe5, 0x6b, 0x65, 0x5e, 0xbd,
-  0x8a, 0x0a, 0x17, 0x4c, 0x1c, 0x6a, 0x72, 0x36, 0xd0, 0x73, 0xe3, 0x52, 0xe3, 0xe3, 0xcd, 0x42,
-  0x6f, 0x2c, 0xa7, 0xde, 0xa2, 0x85, 0x4b, 0xf7, 0x36, 0x3a, 0x81, 0xef, 0x47, 0x3a, 0xfb, 0x34,
-  0xe4, 0xc8, 0x5b, 0x56, 0x2a, 0xfd, 0x51, 0x05, 0x62, 0x26, 0x3f, 0xe8, 0xfc, 0x54, 0xab, 0xe3,
-  0xdf, 0x6e, 0xa5, 0x82, 0x7a, 0x5a, 0x02, 0x07, 0x43, 0xdb, 0xdc, 0x69, 0x23, 0x70, 0x9c, 0x80,
-  0xea, 0x5b, 0xb4, 0x8d, 0xa0, 0x75, 0x48, 0xdf, 0x0f, 0x6c, 0x1a, 0x24, 0x60, 0x9b, 0xd8, 0x6d,
-  0x02, 0x60, 0x8e, 0x60, 0xd2, 0x0e, 0xd9, 0x26, 0xc3, 0x21, 0x80, 0x99, 0x0a, 0x92, 0xd0, 0xed,
-  0xc6, 0xa0, 0x45, 0xfb, 0x00, 0x65, 0x0a, 0xd2, 0x4b, 0x72, 0xb7, 0x76, 0xb6, 0x49, 0xb3, 0x01,
-  0xf0, 0x21, 0xe8, 0x9a, 0x4a, 0xe8, 0xdc, 0xd2, 0x4e, 0xad, 0x39, 0xbd, 0x89, 0xd3, 0x8e, 0xb0,
-  0xe1, 0x95, 0xed, 0x89, 0xeb, 0x78, 0x94, 0x04, 0x15, 0x18, 0xce, 0xb6, 0xc3, 0x3c, 0x10, 0x5f,
-  0xe9, 0xfb, 0x20, 0x66, 0x13, 0x5d, 0xf9, 0x69, 0x38, 0xec, 0xd3, 0x46, 0x43, 0x31, 0xff, 0x01,
-  0xcf, 0xfd, 0xb6, 0x39, 0x6c, 0xd7, 0x15, 0x08, 0x3c, 0xff, 0xa1, 0xad, 0x74, 0xdb, 0x6c, 0xe0,
-  0xdf, 0x5c, 0xb7, 0x79, 0xee, 0xed, 0x5a, 0xb6, 0xe3, 0x1c, 0xb6, 0xd6, 0xf1, 0x36, 0x23, 0x46,
-  0xbe, 0xd7, 0x2f, 0xd8, 0x9f, 0xb5, 0x5e, 0xb7, 0x69, 0x7f, 0x7b, 0xa5, 0x77, 0x66, 0xd2, 0x3b,
-  0x54, 0x5d, 0x0f, 0xb3, 0x68, 0xc8, 0x88, 0x99, 0x20, 0x1a, 0x8c, 0xfa, 0x25, 0xf4, 0x0c, 0x95,
-  0x5a, 0xdb, 0xd4, 0x15, 0x53, 0xcb, 0xe0, 0x5b, 0x90, 0x94, 0x43, 0xbc, 0x20, 0x3d, 0xd7, 0x89,
-  0x82, 0xf4, 0x42, 0xbc, 0x85, 0x22, 0x7d, 0x2c, 0x4f, 0x76, 0xb6, 0x76, 0xea, 0x3b, 0x4d, 0xce,
-  0x93, 0xe6, 0x56, 0xb3, 0xd5, 0x2c, 0xe6, 0xc9, 0xb0, 0x3f, 0x6c, 0x0e, 0x9b, 0x39, 0x9e, 0xd4,
-  0x6b, 0xcd, 0xed, 0x7a, 0x3f, 0xcb, 0x91, 0x04, 0x92, 0xe7, 0x48, 0x02, 0xce, 0x33, 0x25, 0x01,
-  0xe7, 0xbb, 0x91, 0x05, 0x54, 0xc2, 0xce, 0x76, 0xd2, 0x31, 0xd0, 0xf8, 0xff, 0xa2, 0x43, 0x26,
-  0x65, 0xce, 0xda, 0x70, 0x91, 0x02, 0x94, 0xe9, 0x42, 0xad, 0xde, 0xc8, 0x22, 0x6b, 0xb2, 0x3f,
-  0xb9, 0x1e, 0xb5, 0xed, 0xf6, 0x76, 0x9b, 0xb0, 0xd1, 0x90, 0x47, 0x55, 0x26, 0x48, 0x8a, 0x81,
-  0x3d, 0x7b, 0x98, 0x64, 0xed, 0x9d, 0xb6, 0xbd, 0x65, 0x8b, 0x22, 0x68, 0xd3, 0x72, 0x45, 0xcc,
-  0x56, 0x63, 0xa7, 0xbd, 0xbf, 0x52, 0xe4, 0x70, 0xeb, 0x45, 0xed, 0xc5, 0xe1, 0xe3, 0x47, 0x68,
-  0x1e, 0x4b, 0x99, 0x55, 0x34, 0x89, 0xc6, 0x71, 0x85, 0x24, 0x03, 0x62, 0x37, 0x57, 0x9a, 0xa4,
-  0x5b, 0xad, 0xe6, 0xb6, 0xb9, 0x56, 0x17, 0x07, 0x4b, 0x85, 0x84, 0x56, 0x33, 0x8f, 0x3d, 0xa7,
-  0x5c, 0x56, 0x90, 0xeb, 0x7d, 0xbb, 0xc6, 0x78, 0x3f, 0xaa, 0xcc, 0x02, 0xb7, 0x03, 0xff, 0x4b,
-  0x9b, 0x6c, 0xc5, 0x10, 0xd7, 0x3c, 0x1d, 0x6e, 0xc7, 0xaa, 0xfe, 0x20, 0xa2, 0xc0, 0xbd, 0x08,
-  0xbc, 0xbb, 0x89, 0x5c, 0x40, 0xdc, 0x4c, 0x86, 0xdc, 0x90, 0x4c, 0x1c, 0x77, 0xd1, 0xd9, 0x3c,
-  0x09, 0x28, 0x38, 0x82, 0xe8, 0x2a, 0x44, 0x4a, 0xfd, 0x64, 0x53, 0x1f, 0xcc, 0xc0, 0x35, 0xbd,
-  0xa6, 0x02, 0x1b, 0x34, 0xcf, 0x79, 0x64, 0x6a, 0x8d, 0x46, 0x7b, 0xab, 0x50, 0x81, 0xfc, 0x0d,
-  0xc8, 0x1c, 0xf8, 0x13, 0x67, 0xa0, 0x1c, 0xd3, 0x19, 0x4d, 0x11, 0x41, 0x4b, 0xc4, 0x0c, 0x50,
-  0x6e, 0xe5, 0x86, 0xad, 0x5b, 0x30, 0xb3, 0x2b, 0x5d, 0x3f, 0xe6, 0x3c, 0x0f, 0x1d, 0x01, 0x55,
-  0x70, 0x4e, 0xdc, 0x23, 0xd7, 0xc6, 0xb7, 0x90, 0x25, 0x00, 0x42, 0x22, 0xa1, 0x6e, 0xd6, 0x9b,
-  0x20, 0x41, 0x3b, 0x0c, 0x0c, 0x66, 0xde, 0xe7, 0x60, 0x3e, 0x2b, 0x58, 0xad, 0x8e, 0x9c, 0x68,
-  0x3c, 0xeb, 0xa3, 0x8f, 0x5c, 0xa5, 0x73, 0x7f, 0xee, 0x54, 0x65, 0xfd, 0xba, 0x12, 0xce, 0xfa,
-  0x13, 0x27, 0x52, 0xb8, 0xef, 0x1a, 0x2a, 0xa0, 0x81, 0xd0, 0x49, 0x55, 0x58, 0x9b, 0x24, 0x54,
-  0x4e, 0x4e, 0x19, 0x2c, 0x5f, 0x8a, 0xb5, 0xd2, 0x63, 0x0b, 0xc3, 0xe1, 0x63, 0x5a, 0xa9, 0xe2,
-  0x50, 0x74, 0xa2, 0xb0, 0x8a, 0xf8, 0xb3, 0xc2, 0x07, 0xfe, 0x74, 0x11, 0xb0, 0x15, 0x8e, 0xff,
-  0xf5, 0xdf, 0x19, 0xf2, 0xca, 0x4b, 0x56, 0x38, 0xe9, 0x38, 0xb8, 0xfa, 0x58, 0x44, 0x11, 0xad,
-  0xfc, 0x2b, 0x45, 0x21, 0x1b, 0xd5, 0x5f, 0x7e, 0xd9, 0x50, 0x7e, 0xc1, 0x38, 0x84, 0x31, 0x4c,
-  0xc9, 0x88, 0x0c, 0x5f, 0x23, 0xc1, 0xd4, 0x93, 0xc0, 0xb9, 0x46, 0xf6, 0x4d, 0x59, 0x70, 0x18,
-  0x2a, 0x24, 0x80, 0x67, 0x70, 0xd2, 0x9c, 0x1b, 0x6a, 0x2b, 0x73, 0x20, 0x86, 0x42, 0x94, 0xcd,
-  0x9f, 0x36, 0x95, 0x10, 0x19, 0x42, 0x17, 0x00, 0x72, 0x5d, 0xc4, 0x63, 0x02, 0x11, 0xfe, 0x04,
-  0x94, 0x97, 0x8d, 0xeb, 0x59, 0x90, 0xa2, 0xf4, 0x21, 0x42, 0x84, 0x50, 0x03, 0xea, 0xac, 0x8a,
-  0x00, 0x48, 0x2c, 0xad, 0x28, 0xcb, 0x8d, 0x0d, 0x45, 0xc9, 0xc6, 0x41, 0x00, 0x41, 0xa9, 0x40,
-  0xbf, 0x0a, 0x83, 0x21, 0xc5, 0x52, 0xb2, 0xeb, 0x50, 0x1b, 0x2c, 0x11, 0x5f, 0xb8, 0x43, 0xf6,
-  0xd6, 0x81, 0x9e, 0x97, 0x2d, 0x45, 0xb5, 0x2b, 0x43, 0x97, 0xde, 0x28, 0xf8, 0x81, 0x83, 0x63,
-  0x36, 0xf1, 0xd4, 0x6c, 0xe6, 0x24, 0xa0, 0xc2, 0xcc, 0x97, 0xbb, 0x4f, 0x2a, 0x15, 0xa5, 0x07,
-  0x08, 0x45, 0xac, 0x4f, 0x44, 0x09, 0x71, 0x83, 0x00, 0x89, 0x18, 0xae, 0x91, 0x3f, 0x55, 0x48,
-  0xdf, 0xbf, 0xa6, 0xec, 0x8d, 0x11, 0x07, 0xc4, 0xd9, 0x19, 0x71, 0x1f, 0x15, 0x8a, 0xb9, 0xfe,
-  0x9c, 0x25, 0x8d, 0x29, 0x13, 0x0e, 0x94, 0xbc, 0x9b, 0x29, 0x4e, 0xea, 0x5d, 0x43, 0x85, 0x40,
-  0x43, 0x08, 0x56, 0x11, 0x38, 0x04, 0xc9, 0x20, 0xde, 0x42, 0x6e, 0x4a, 0x50, 0x36, 0xb8, 0xb8,
-  0x2b, 0xc0, 0xd5, 0x70, 0x1c, 0xe0, 0xe6, 0x03, 0x07, 0xe7, 0x40, 0x29, 0xd0, 0x14, 0x64, 0x19,
-  0x02, 0xe9, 0x31, 0x06, 0xc1, 0x50, 0x30, 0x1c, 0x43, 0x03, 0xd0, 0x2a, 0xb6, 0x41, 0x32, 0x48,
-  0x56, 0x2a, 0x7b, 0x50, 0xc7, 0xae, 0xed, 0x5c, 0x33, 0x0f, 0x9b, 0x27, 0x25, 0x2b, 0x5a, 0x5c,
-  0x2d, 0x50, 0x5c, 0x87, 0x50, 0x40, 0x21, 0xf0, 0xf9, 0xbd, 0x3d, 0xd6, 0x28, 0xeb, 0xee, 0x09,
-  0x7a, 0xd5, 0x69, 0x9d, 0x0a, 0xe6, 0xc7, 0x56, 0x88, 0x32, 0x25, 0xb6, 0x0d, 0xac, 0xc2, 0x7a,
-  0x19, 0x23, 0x81, 0x0e, 0x73, 0x88, 0xe2, 0x15, 0x27, 0xda, 0x64, 0x78, 0x21, 0xcb, 0x43, 0xec,
-  0x41, 0x5a, 0x98, 0xe1, 0x23, 0xb9, 0x3d, 0x76, 0xa0, 0xbc, 0xc7, 0xb1, 0x13, 0x8d, 0x31, 0x24,
-  0x05, 0x62, 0x53, 0x52, 0x69, 0x28, 0x19, 0xec, 0xd4, 0xbd, 0xd0, 0x9f, 0x64, 0xb1, 0xd8, 0xad,
-  0x42, 0xee, 0x3d, 0xd1, 0x3b, 0xf6, 0x0c, 0x0f, 0x1b, 0xa2, 0xa6, 0x77, 0x79, 0xfa, 0x2b, 0x7d,
-  0x12, 0x28, 0x20, 0xe2, 0x80, 0x36, 0x97, 0x42, 0xc1, 0x04, 0x24, 0x3f, 0x20, 0x0f, 0x24, 0x07,
-  0x5a, 0x12, 0x77, 0x4e, 0x16, 0xa1, 0x72, 0xed, 0x84, 0x4e, 0x1f, 0x34, 0xc4, 0x0a, 0xdd, 0x90,
-  0xa3, 0x15, 0xa8, 0x31, 0xa1, 0x9c, 0x10, 0x1d, 0x02, 0xe6, 0xd5, 0x63, 0x8a, 0x32, 0x1a, 0x8c,
-  0xb9, 0x20, 0x71, 0x3e, 0x55, 0x4c, 0x0c, 0x39, 0x18, 0x5e, 0x39, 0xac, 0x18, 0x11, 0x90, 0xbb,
-  0xf0, 0x12, 0x32, 0xe2, 0x4c, 0x61, 0x84, 0x26, 0xfc, 0x46, 0x94, 0x40, 0x43, 0xb9, 0x80, 0x08,
-  0x5d, 0x11, 0x0b, 0x46, 0xc8, 0x6b, 0xe2, 0xb8, 0xb8, 0x23, 0x46, 0xe9, 0x07, 0x7e, 0x38, 0x07,
-  0xae, 0x31, 0x03, 0x64, 0x28, 0xef, 0x41, 0x8c, 0x86, 0x28, 0x63, 0xd0, 0x13, 0x08, 0x50, 0x12,
-  0xb9, 0x81, 0xb2, 0x9c, 0xd2, 0xd8, 0x51, 0x92, 0x08, 0x9b, 0x02, 0xba, 0x19, 0xe2, 0x78, 0xa4,
-  0x8b, 0x47, 0xaf, 0xb1, 0x1a, 0x10, 0x9f, 0x50, 0x87, 0xee, 0x40, 0x1d, 0x4c, 0xa2, 0xa0, 0xb1,
-  0x21, 0x98, 0x14, 0x48, 0x42, 0xd7, 0x8d, 0x0a, 0xc2, 0x09, 0x69, 0xe7, 0xae, 0x5c, 0x11, 0x8d,
-  0x12, 0xfa, 0x30, 0x52, 0x8c, 0x02, 0x7f, 0x5e, 0xa9, 0x29, 0xbe, 0x40, 0xae, 0xc2, 0x51, 0xc9,
-  0x0a, 0x18, 0xa3, 0x49, 0xd2, 0x79, 0xa4, 0x0d, 0xe7, 0x53, 0x48, 0x01, 0x08, 0xce, 0xc4, 0x02,
-  0x46, 0x99, 0x4d, 0xb3, 0xbc, 0x44, 0x0a, 0x11, 0x41, 0xc7, 0x21, 0x0c, 0x0b, 0x46, 0x96, 0x41,
-  0x04, 0xb6, 0x87, 0x53, 0x32, 0x11, 0xa9, 0x1c, 0xeb, 0x44, 0x13, 0xab, 0xec, 0x1b, 0x57, 0xc0,
-  0xf3, 0x14, 0xf8, 0x64, 0x8a, 0xf0, 0xd6, 0x73, 0xfc, 0xce, 0xb1, 0x36, 0xed, 0xd1, 0xa2, 0x42,
-  0x66, 0x91, 0x9f, 0xd6, 0x20, 0x25, 0x31, 0x57, 0x1d, 0xe2, 0x55, 0x48, 0x98, 0x6c, 0xa5, 0xb5,
-  0xb5, 0x4a, 0x15, 0x66, 0x48, 0x21, 0x00, 0x06, 0x97, 0xb1, 0xd2, 0x87, 0xfe, 0x5e, 0x75, 0x14,
-  0xf6, 0x55, 0x41, 0x88, 0xba, 0xb7, 0xb1, 0xde, 0x68, 0x2a, 0x71, 0x82, 0xbe, 0xe7, 0x68, 0xf2,
-  0x50, 0xba, 0x3d, 0xd0, 0x37, 0x64, 0x32, 0x05, 0xc9, 0xf1, 0x87, 0x6c, 0xf8, 0x8e, 0x28, 0x1f,
-  0xb5, 0xb2, 0x55, 0x66, 0x0d, 0xb9, 0x58, 0x64, 0x74, 0x92, 0x8e, 0xfa, 0x66, 0xe1, 0xcf, 0x40,
-  0x4c, 0x80, 0xfd, 0xac, 0x40, 0x76, 0xcc, 0x3e, 0x82, 0xd2, 0x8c, 0xc4, 0x77, 0x13, 0x6c, 0x5c,
-  0x93, 0xdd, 0xe4, 0x83, 0xb2, 0xd3, 0xa2, 0x13, 0x75, 0xef, 0x15, 0x85, 0xb8, 0x01, 0xc4, 0xf0,
-  0xbd, 0x47, 0xd9, 0x26, 0x81, 0xc7, 0xe5, 0x3e, 0x9f, 0xfb, 0xdf, 0x93, 0x7b, 0x1c, 0xd0, 0xef,
-  0xa9, 0xfd, 0x85, 0x3f, 0x0b, 0xbe, 0x27, 0x3b, 0x48, 0x64, 0x9a, 0x3d, 0xc3, 0x23, 0xa4, 0xdf,
-  0xf7, 0x30, 0x88, 0xab, 0x03, 0x14, 0x73, 0x20, 0xab, 0x13, 0x08, 0x5d, 0x71, 0x93, 0xe8, 0x53,
-  0xb0, 0xb2, 0xb3, 0x48, 0x70, 0x0e, 0x1a, 0xfe, 0xdb, 0x39, 0x26, 0x06, 0xad, 0xec, 0x6b, 0x9f,
-  0x0c, 0xae, 0x46, 0x6c, 0x35, 0x58, 0xf8, 0x93, 0xca, 0x28, 0xa0, 0x0b, 0x35, 0xed, 0x9b, 0xa0,
-  0x0e, 0x33, 0x1f, 0x80, 0x18, 0x61, 0x52, 0xae, 0x50, 0x3e, 0x23, 0x82, 0xc6, 0x83, 0x59, 0x2f,
-  0xe6, 0x08, 0x70, 0xdd, 0x0e, 0x68, 0x0e, 0x70, 0x89, 0x20, 0x00, 0x2d, 0x25, 0x2d, 0x19, 0xc3,
-  0x9b, 0x2b, 0xe6, 0x88, 0x5c, 0x21, 0x3d, 0x67, 0x53, 0xae, 0x94, 0x66, 0x20, 0x9f, 0x6c, 0xbf,
-  0x1f, 0xd3, 0x04, 0x42, 0x93, 0xe7, 0xdb, 0xcd, 0x8e, 0xbf, 0x82, 0xf1, 0x2e, 0x94, 0xb6, 0x30,
-  0x7b, 0xdf, 0xc0, 0x0d, 0x72, 0x86, 0x8b, 0xc4, 0xce, 0x48, 0xcd, 0x89, 0xfc, 0xdd, 0x3b, 0xa7,
-  0xe0, 0x29, 0x1c, 0x08, 0xf5, 0xf4, 0x02, 0x9b, 0xfe, 0xc8, 0x9a, 0x2e, 0x2b, 0xaf, 0x28, 0x9f,
-  0xde, 0xcb, 0xc8, 0x43, 0xc2, 0xe2, 0x75, 0x66, 0xaf, 0x59, 0xa8, 0x17, 0x5c, 0xb7, 0x66, 0x5d,
-  0x08, 0xa1, 0x54, 0x85, 0x87, 0x94, 0x33, 0x54, 0x2b, 0x8a, 0x96, 0x2b, 0xe6, 0x3b, 0x54, 0x53,
-  0xd6, 0xa4, 0xb3, 0xe7, 0x28, 0x98, 0x79, 0x03, 0xe6, 0x90, 0x81, 0x4d, 0x55, 0xf7, 0x9e, 0x0e,
-  0xc0, 0x43, 0xed, 0x2a, 0x6c, 0x96, 0x4e, 0xd4, 0xb0, 0x89, 0xa0, 0xcd, 0x3d, 0x31, 0x5f, 0x97,
-  0xdb, 0x4b, 0xf4, 0xbf, 0xff, 0xdb, 0xff, 0x54, 0x2a, 0xcc, 0x77, 0x05, 0x88, 0x9e, 0x3a, 0xb1,
-  0x48, 0xfb, 0x74, 0x33, 0x0f, 0x70, 0x49, 0xb8, 0x95, 0xb6, 0x02, 0x82, 0x01, 0x2d, 0x73, 0xf7,
-  0x53, 0x74, 0xfb, 0x92, 0xcb, 0x3b, 0x38, 0xaa, 0x17, 0x53, 0xe6, 0xd9, 0x63, 0x77, 0x07, 0x89,
-  0xa3, 0x0c, 0xde, 0x02, 0x14, 0x96, 0xce, 0x0b, 0xef, 0x1c, 0x2b, 0x90, 0x4c, 0xab, 0xfd, 0x31,
-  0xa3, 0xc1, 0xe2, 0x8c, 0x45, 0x61, 0x7e, 0x50, 0xda, 0xfc, 0x49, 0x58, 0x26, 0x83, 0xe1, 0x2d,
-  0x26, 0xbe, 0xcf, 0x71, 0x48, 0x58, 0x0a, 0xae, 0xa1, 0x3d, 0x87, 0x36, 0x4a, 0x1a, 0x4e, 0xa9,
-  0x21, 0xcb, 0x7e, 0xa3, 0x24, 0x28, 0x69, 0x50, 0x61, 0x0c, 0x18, 0x80, 0xd7, 0xb2, 0x0f, 0xae,
-  0xdd, 0x06, 0x62, 0xc4, 0xbc, 0x59, 0x05, 0x3c, 0xd6, 0x33, 0x1a, 0x65, 0xcd, 0x08, 0xf7, 0x7c,
-  0x79, 0xd2, 0x3f, 0xa7, 0x24, 0x20, 0x13, 0x65, 0xc9, 0x57, 0x4c, 0x62, 0xb9, 0x42, 0x0c, 0x8e,
-  0x60, 0x36, 0x5b, 0x15, 0x3e, 0xd1, 0xea, 0xf2, 0x0a, 0x38, 0xed, 0xd8, 0xca, 0xe8, 0x24, 0x79,
-  0x94, 0x2e, 0x2a, 0x0c, 0xce, 0xd2, 0x93, 0x2c, 0x98, 0xaf, 0xe3, 0x70, 0x0a, 0xb1, 0x59, 0xf4,
-  0x9f, 0x56, 0x6b, 0x81, 0x5e, 0xa5, 0x05, 0x78, 0xc6, 0xc2, 0x09, 0xc9, 0xcd, 0x6c, 0xc1, 0x23,
-  0x7b, 0x53, 0xcf, 0x14, 0x33, 0x1c, 0x5b, 0xfa, 0xc1, 0x79, 0x36, 0xac, 0xb8, 0xaa, 0xf7, 0xd0,
-  0x1d, 0x7c, 0x58, 0x20, 0xbd, 0x74, 0x84, 0x14, 0x03, 0x72, 0xcc, 0x2a, 0x0e, 0x34, 0x0c, 0x1c,
-  0x00, 0x43, 0x7c, 0x48, 0x06, 0xe3, 0x12, 0xc2, 0x10, 0x17, 0xc5, 0xda, 0x13, 0xfd, 0xe5, 0x3d,
-  0x96, 0x70, 0xb6, 0x35, 0x00, 0xf0, 0x65, 0x6b, 0xfc, 0x8a, 0x65, 0xdd, 0xd1, 0x63, 0xbe, 0x05,
-  0x20, 0xa9, 0x01, 0xc2, 0x43, 0x59, 0x3e, 0xf1, 0xdf, 0x71, 0x35, 0xbf, 0xb4, 0xc9, 0x23, 0x73,
-  0x6a, 0x6f, 0x6a, 0x22, 0x6b, 0xac, 0xb0, 0x65, 0xfa, 0x7b, 0x4b, 0x06, 0x74, 0x02, 0xca, 0xad,
-  0xa8, 0x30, 0xfb, 0x8e, 0xb5, 0x22, 0x3a, 0xa5, 0x0e, 0xc9, 0x77, 0x10, 0x2b, 0xf5, 0x23, 0xfe,
-  0x22, 0xb9, 0x1c, 0xfb, 0x1e, 0x62, 0x01, 0x6b, 0xff, 0x9f, 0x22, 0x55, 0xd6, 0xa1, 0x4d, 0x64,
-  0x9e, 0xe3, 0x9e, 0xc6, 0x6c, 0x2f, 0x66, 0x5e, 0x8a, 0x35, 0x06, 0x6b, 0x9b, 0x58, 0x6c, 0x33,
-  0xb3, 0x8a, 0x05, 0x62, 0x2f, 0x92, 0x2f, 0x0b, 0x34, 0x79, 0x26, 0x66, 0x53, 0x8a, 0x0d, 0x56,
-  0x46, 0x93, 0x67, 0x8a, 0xaf, 0xb8, 0xe8, 0x49, 0x1e, 0x6e, 0xcf, 0x65, 0x58, 0x84, 0xd3, 0x15,
-  0xea, 0xde, 0xcf, 0xcb, 0x3b, 0x29, 0x1e, 0x67, 0x35, 0xff, 0x8a, 0xdf, 0x97, 0xd1, 0xd4, 0xbc,
-  0x8c, 0x91, 0xf3, 0x8c, 0xd7, 0x5c, 0xa1, 0xbc, 0xd3, 0xc8, 0x5e, 0x2e, 0xc5, 0x5b, 0x01, 0xd5,
-  0x4a, 0xc5, 0x38, 0xe9, 0x3c, 0xe2, 0xcd, 0x36, 0xa8, 0x71, 0x66, 0xc5, 0x1b, 0x42, 0xf7, 0x3d,
-  0xa4, 0xa1, 0x1e, 0xd6, 0x89, 0x7c, 0x12, 0x05, 0x83, 0x81, 0x00, 0xec, 0xa2, 0xef, 0x25, 0x4a,
-  0x5b, 0x24, 0xbb, 0x18, 0x58, 0xcf, 0xc7, 0xb8, 0x5f, 0x85, 0x0d, 0xf0, 0x09, 0xae, 0xe2, 0xd2,
-  0x30, 0xaf, 0x4a, 0xf9, 0xca, 0xbd, 0x54, 0xa5, 0xb8, 0x91, 0x4a, 0xa9, 0xf0, 0x29, 0x05, 0xd1,
-  0x06, 0x40, 0x78, 0x09, 0xc8, 0x38, 0x1a, 0x31, 0xff, 0xa0, 0xbf, 0x60, 0xd2, 0x29, 0x17, 0x85,
-  0xee, 0x54, 0xba, 0x58, 0x5b, 0x29, 0xad, 0x58, 0x4a, 0x18, 0x23, 0x59, 0x81, 0x5a, 0x2d, 0xd8,
-  0xbb, 0xc6, 0x77, 0x4e, 0xe2, 0xd6, 0x8f, 0x0c, 0x69, 0x70, 0x7c, 0x4e, 0xf2, 0xda, 0x09, 0xc7,
-  0x63, 0xa6, 0xa1, 0x8c, 0xfa, 0x9e, 0xb1, 0x91, 0x70, 0x26, 0xf5, 0xc5, 0x3b, 0xc0, 0xbb, 0x04,
-  0xba, 0x57, 0x30, 0xe2, 0x71, 0x04, 0x16, 0x6f, 0xe1, 0x94, 0x0e, 0x9c, 0xa1, 0x93, 0x4e, 0x89,
-  0x38, 0x76, 0x31, 0x2d, 0x41, 0x3f, 0xe4, 0x68, 0x28, 0xf3, 0x7d, 0x3f, 0x05, 0x41, 0x88, 0x52,
-  0x7d, 0xf2, 0x37, 0xd3, 0x8d, 0x6b, 0x31, 0xa8, 0x3e, 0x21, 0x46, 0x55, 0x79, 0x29, 0xc8, 0x30,
-  0xf3, 0x1c, 0x50, 0xa0, 0x5c, 0x82, 0xd2, 0x9d, 0x58, 0x48, 0x69, 0x14, 0x1f, 0x41, 0x54, 0x8c,
-  0x16, 0x39, 0x3d, 0x05, 0x82, 0x7c, 0x8b, 0x0c, 0x2f, 0xcb, 0x36, 0x7c, 0xde, 0x83, 0x1c, 0x2b,
-  0x00, 0x18, 0xba, 0xe0, 0x3a, 0x94, 0x32, 0x48, 0x82, 0xc3, 0x0c, 0x2e, 0xcb, 0x8d, 0xb4, 0x96,
-  0xa1, 0x96, 0xd5, 0xc6, 0x62, 0x0f, 0x46, 0x76, 0x4b, 0xd0, 0x11, 0xe6, 0x2e, 0x31, 0x9d, 0x3d,
-  0x91, 0xa2, 0x60, 0xad, 0x8a, 0x87, 0xc6, 0x80, 0xac, 0x62, 0xa9, 0x29, 0x59, 0xf3, 0x13, 0x32,
-  0xbd, 0x5f, 0xae, 0x52, 0x8d, 0x8a, 0x16, 0x22, 0x4b, 0x07, 0x88, 0xc2, 0x07, 0xfe, 0x04, 0xcf,
-  0xa6, 0xb0, 0xd9, 0x26, 0x17, 0xe2, 0x76, 0x97, 0xf1, 0x34, 0x43, 0x09, 0xb6, 0x91, 0xcd, 0xca,
-  0x12, 0x44, 0xf4, 0x83, 0x35, 0xcc, 0x91, 0xdd, 0xcb, 0xa8, 0x7c, 0x5e, 0x4a, 0x6a, 0x77, 0x28,
-  0xf9, 0x08, 0xbb, 0xac, 0x3c, 0x53, 0x52, 0x7b, 0xa0, 0x74, 0x94, 0xcd, 0xcd, 0xa4, 0x3a, 0x41,
-  0x2d, 0xae, 0xaf, 0x93, 0x05, 0xdc, 0x2c, 0x43, 0xc4, 0xd6, 0xe7, 0xd5, 0x31, 0xcb, 0x37, 0x5e,
-  0x65, 0x9d, 0x83, 0x44, 0x5d, 0x26, 0x76, 0x53, 0xa0, 0xc9, 0x66, 0x3f, 0x7e, 0x5e, 0x4a, 0x0c,
-  0x62, 0x74, 0x6b, 0x9b, 0xaa, 0x82, 0x65, 0x2b, 0x7c, 0x8d, 0x19, 0xd4, 0x36, 0x7c, 0xc7, 0x4c,
-  0x7f, 0xe3, 0x43, 0x5e, 0xa5, 0xc6, 0xd2, 0x84, 0x19, 0xdf, 0x7c, 0xc7, 0x2b, 0x6d, 0x0a, 0x93,
-  0xc6, 0x4c, 0x90, 0x74, 0x6e, 0x56, 0xcc, 0x10, 0x52, 0x35, 0x23, 0xb2, 0x0f, 0x78, 0x05, 0x92,
-  0x27, 0xc5, 0x8a, 0x20, 0x27, 0xb8, 0x42, 0xac, 0xee, 0x1f, 0x51, 0x4c, 0x5e, 0x1f, 0xd4, 0x45,
-  0xf7, 0x39, 0x52, 0x1b, 0xeb, 0x12, 0x22, 0x1a, 0xb9, 0x4b, 0x28, 0xa5, 0x84, 0xac, 0xc9, 0xc7,
-  0xda, 0x68, 0xbe, 0xd3, 0x42, 0xde, 0x29, 0x26, 0x3f, 0x24, 0x24, 0x47, 0x76, 0x5e, 0x44, 0x1c,
-  0xfb, 0xf1, 0x02, 0x52, 0x10, 0x05, 0x71, 0x71, 0x41, 0x0b, 0xfd, 0xf3, 0x32, 0xd7, 0x25, 0x26,
-  0x35, 0x93, 0x15, 0x4b, 0x9f, 0x8a, 0x8f, 0x1c, 0xc6, 0xeb, 0xa2, 0x93, 0xba, 0x7a, 0xf7, 0x09,
-  0x8f, 0x54, 0xfe, 0x19, 0x11, 0xba, 0x38, 0x4a, 0x74, 0x71, 0xb5, 0xca, 0x45, 0xe6, 0xe2, 0x08,
-  0x23, 0xaa, 0x09, 0xb1, 0xc1, 0x3a, 0x0c, 0x31, 0xd0, 0x21, 0x10, 0x78, 0x4a, 0x59, 0x19, 0x93,
-  0x6b, 0x54, 0x05, 0x54, 0x6c, 0xd4, 0xa2, 0x10, 0x95, 0xb1, 0x80, 0xd9, 0x57, 0x88, 0x4d, 0xa6,
-  0x11, 0x7f, 0xb0, 0x99, 0x71, 0xe6, 0x45, 0x9e, 0x41, 0xcd, 0xb2, 0xde, 0x9c, 0xda, 0x5b, 0x73,
-  0xc6, 0x84, 0xe6, 0x91, 0x9b, 0xae, 0x42, 0x05, 0xa7, 0x80, 0x70, 0xd2, 0x1e, 0x27, 0x76, 0x39,
-  0x3d, 0x31, 0x12, 0x27, 0x99, 0xd0, 0xa7, 0xc8, 0x43, 0x41, 0x71, 0xce, 0xbe, 0x6f, 0xac, 0x19,
-  0xc7, 0x54, 0x8f, 0x77, 0x1f, 0x63, 0x38, 0x93, 0xb9, 0xfd, 0xbc, 0x44, 0x40, 0x3b, 0x85, 0x5b,
-  0x28, 0x56, 0xe3, 0x20, 0xd1, 0x08, 0x73, 0xac, 0x57, 0xc5, 0x37, 0x9f, 0x35, 0xf5, 0x48, 0xef,
-  0xb2, 0x7c, 0x99, 0x61, 0xc2, 0x1d, 0xaa, 0xc4, 0xc2, 0xa6, 0xbe, 0x16, 0x53, 0x12, 0x47, 0xb9,
-  0x69, 0xfa, 0x15, 0x2b, 0x8f, 0x05, 0x9d, 0x68, 0xcd, 0x9b, 0x4a, 0xd0, 0x5c, 0xed, 0x27, 0x84,
-  0xb5, 0x38, 0xf7, 0xf0, 0xf4, 0xe9, 0x9d, 0x11, 0xa2, 0x05, 0xe3, 0x0b, 0xd3, 0xef, 0xd4, 0x23,
-  0x7c, 0xef, 0xe3, 0xc3, 0x1d, 0xbc, 0xab, 0x82, 0x2f, 0xe6, 0xd7, 0x0d, 0xe9, 0xf8, 0xaf, 0x38,
-  0x32, 0x40, 0x7e, 0x11, 0xd2, 0xcf, 0x82, 0x00, 0x7c, 0x7e, 0x77, 0x51, 0x10, 0x49, 0xa3, 0x7c,
-  0x17, 0x45, 0xb6, 0xa0, 0x16, 0x98, 0xe4, 0x87, 0x58, 0x4b, 0x28, 0xa6, 0x78, 0xc4, 0x4e, 0x44,
-  0xb6, 0x48, 0xc2, 0x36, 0x21, 0xe2, 0xa3, 0xed, 0x84, 0x53, 0x97, 0x2c, 0x32, 0x92, 0x8d, 0x55,
-  0xae, 0x4a, 0x1e, 0xdb, 0xcf, 0xbe, 0x11, 0xaf, 0xef, 0x87, 0xc1, 0x15, 0x1d, 0x1d, 0x07, 0xe3,
-  0x52, 0xcc, 0xd6, 0xe1, 0x9e, 0x83, 0xee, 0x84, 0x04, 0x23, 0xc7, 0xeb, 0x98, 0x5d, 0x5c, 0xcf,
-  0x00, 0xe1, 0xee, 0x98, 0x31, 0x66, 0x5c, 0xa6, 0xb3, 0x5c, 0x7c, 0x45, 0x37, 0xb3, 0x74, 0x9a,
-  0x5d, 0x02, 0x0d, 0x89, 0x17, 0x56, 0x42, 0x1a, 0x38, 0xc3, 0xd8, 0xe8, 0x8f, 0x2a, 0xe1, 0x6c,
-  0x30, 0xa0, 0x61, 0xb8, 0x5c, 0x9b, 0x23, 0xfb, 0xa9, 0x39, 0x20, 0xc3, 0x96, 0xc9, 0x32, 0x39,
-  0xde, 0xd0, 0x2f, 0xc8, 0x51, 0xaf, 0xed, 0xb4, 0x87, 0x0d, 0x96, 0x63, 0x4e, 0x02, 0xaf, 0x20,
-  0xc7, 0x70, 0x38, 0xa8, 0x99, 0x5b, 0x2c, 0x07, 0x5b, 0xa8, 0x29, 0xcc, 0xd2, 0xaa, 0xb7, 0xea,
-  0x71, 0x12, 0xa5, 0x17, 0x64, 0x69, 0x34, 0x1a, 0xb1, 0x98, 0x40, 0x29, 0x4c, 0x6d, 0xc6, 0x86,
-  0x5d, 0xe9, 0xc3, 0xc0, 0xba, 0x5a, 0x0a, 0x8a, 0x77, 0xd8, 0x1b, 0x82, 0x31, 0x78, 0x4a, 0xa0,
-  0xf8, 0x82, 0x40, 0x0f, 0x18, 0x92, 0x00, 0xf1, 0x25, 0x36, 0x32, 0xc1, 0xd9, 0x92, 0x3d, 0xdb,
-  0x4e, 0x40, 0x19, 0x4f, 0x3b, 0x1c, 0x2a, 0xb2, 0xf0, 0x69, 0xf0, 0x65, 0xf2, 0xdc, 0xa9, 0x89,
-  0x04, 0x19, 0xa0, 0x2d, 0x33, 0x6f, 0xc0, 0x9a, 0x5c, 0x62, 0x2d, 0x97, 0x08, 0x25, 0x57, 0x02,
-  0xc0, 0xa5, 0x7c, 0xef, 0xf0, 0xf7, 0x4c, 0x06, 0x1e, 0x79, 0x2d, 0xd3, 0xf7, 0x0e, 0xbe, 0xc7,
-  0xc6, 0x1c, 0x03, 0xc9, 0x25, 0x9b, 0x5d, 0x64, 0xe2, 0x11, 0x1b, 0x2c, 0xb4, 0xcc, 0x4a, 0x4c,
-  0x0c, 0xe6, 0x09, 0xf0, 0x92, 0x72, 0xc3, 0x5e, 0xeb, 0xf2, 0x15, 0x77, 0x8e, 0x18, 0x93, 0x45,
-  0x02, 0xa8, 0x80, 0xa3, 0x86, 0x40, 0x21, 0x66, 0x15, 0x3e, 0xc5, 0x27, 0xb2, 0x05, 0x1c, 0x09,
-  0x91, 0xc4, 0xa6, 0xc2, 0x04, 0x1a, 0x53, 0xac, 0x52, 0x0a, 0x24, 0xcb, 0x8c, 0x46, 0x2b, 0x81,
-  0xd4, 0xea, 0x02, 0xd4, 0x4c, 0x41, 0x6d, 0x06, 0x5a, 0xa4, 0xb9, 0x58, 0xd3, 0x98, 0x53, 0x4a,
-  0xb6, 0x6c, 0x9c, 0x97, 0xce, 0xcc, 0x12, 0x2e, 0xd9, 0x33, 0x9b, 0x13, 0xed, 0x70, 0x88, 0x48,
-  0x96, 0x26, 0x73, 0x95, 0x90, 0x5d, 0x96, 0x9a, 0x00, 0xa9, 0xeb, 0x3a, 0xd3, 0xd0, 0x09, 0xbb,
-  0xf3, 0x31, 0x58, 0xe1, 0x0a, 0x5b, 0x90, 0x02, 0x39, 0x98, 0x07, 0x64, 0x1a, 0x1b, 0xd9, 0xa9,
-  0xd6, 0x25, 0x7f, 0x41, 0x53, 0x1d, 0x26, 0x2d, 0xe5, 0x16, 0xd0, 0x72, 0x39, 0x04, 0x2c, 0x36,
-  0xe4, 0x0c, 0x6d, 0x9f, 0x46, 0x73, 0xdc, 0x66, 0x94, 0xcc, 0xd8, 0xf2, 0x29, 0x86, 0x0e, 0x6b,
-  0x51, 0xa6, 0xa6, 0xd9, 0x45, 0xa3, 0xab, 0xb9, 0x65, 0xc3, 0xa9, 0xb3, 0xb0, 0xc4, 0xbd, 0x0b,
-  0x20, 0xfc, 0x53, 0x30, 0xea, 0x2b, 0x49, 0x9d, 0x31, 0x76, 0x73, 0x7d, 0x9c, 0x04, 0xa3, 0x3e,
-  0x61, 0x5b, 0xa3, 0xe4, 0x7f, 0xa3, 0xae, 0xc5, 0x06, 0x1e, 0x09, 0x4f, 0x46, 0x82, 0xe3, 0xe1,
-  0x1e, 0x28, 0x3e, 0x92, 0xba, 0x5c, 0xa4, 0x1a, 0xc8, 0x0e, 0x21, 0x4b, 0xec, 0x39, 0x53, 0x6f,
-  0x40, 0xa7, 0xa0, 0xc8, 0x80, 0x6e, 0xe2, 0x29, 0x9b, 0x36, 0xf5, 0x43, 0x87, 0x0f, 0x1e, 0x81,
-  0x3b, 0x36, 0x54, 0x41, 0xbf, 0x27, 0x8b, 0x19, 0x3b, 0x7e, 0x9e, 0xd9, 0xcf, 0xc1, 0x8f, 0xa3,
-  0x87, 0xd7, 0xa3, 0xf2, 0xcd, 0xc4, 0xed, 0xca, 0xa3, 0xf8, 0x17, 0xe7, 0x2f, 0x2a, 0xdb, 0xfa,
-  0x2e, 0x80, 0x15, 0x00, 0x7b, 0x38, 0xdd, 0x1f, 0x45, 0xd3, 0x4e, 0xb5, 0x3a, 0x9f, 0xcf, 0x8d,
-  0x79, 0xc3, 0xf0, 0x83, 0x51, 0xb5, 0x0e, 0x1a, 0x0f, 0x0b, 0xaa, 0x7c, 0xa2, 0xdd, 0x52, 0x1b,
-  0xa6, 0x2a, 0xa6, 0xa2, 0xf9, 0x33, 0x3f, 0x5e, 0x74, 0x63, 0xa9, 0xa6, 0x62, 0x2a, 0x0d, 0xfc,
-  0xa7, 0xee, 0xed, 0x4e, 0x49, 0x34, 0x56, 0x70, 0xce, 0xa3, 0xa5, 0x6c, 0x19, 0xad, 0x71, 0xdd,
-  0x84, 0x87, 0x9a, 0xf8, 0xae, 0xd7, 0x19, 0x04, 0x17, 0x11, 0x02, 0xff, 0x0a, 0xd7, 0xb4, 0x50,
-  0x56, 0xe4, 0x6b, 0x45, 0x34, 0xd3, 0x4c, 0x00, 0x48, 0xba, 0x01, 0x99, 0x5a, 0x2a, 0xeb, 0x9a,
-  0x5a, 0xc5, 0xb9, 0xe9, 0xeb, 0xd1, 0xde, 0xa6, 0x96, 0x51, 0x6d, 0x72, 0xd1, 0xa5, 0x01, 0x84,
-  0xcc, 0xec, 0x7c, 0xda, 0x96, 0xaf, 0x73, 0x9e, 0xbe, 0x65, 0x9a, 0x71, 0xd1, 0xac, 0xa5, 0x21,
-  0x1d, 0xc4, 0x65, 0xdf, 0x47, 0x2d, 0x42, 0x6c, 0x90, 0x65, 0xc7, 0x43, 0xd3, 0x6c, 0x2a, 0x95,
-  0xd6, 0xf4, 0x06, 0xbe, 0x7e, 0x6a, 0x6f, 0x0f, 0xe3, 0xcc, 0x2c, 0x9e, 0x54, 0x0d, 0x2d, 0x30,
-  0x1c, 0x50, 0xa1, 0x7c, 0x33, 0xd9, 0x08, 0xbf, 0x11, 0xef, 0x40, 0x3d, 0x64, 0xed, 0x6a, 0xa5,
-  0x95, 0x1a, 0xab, 0xd2, 0xc4, 0x3d, 0x89, 0xc3, 0x66, 0x5c, 0x3c, 0x37, 0x98, 0x41, 0x6a, 0x4d,
-  0x35, 0x03, 0x2e, 0xcd, 0x82, 0x6a, 0x5b, 0xb2, 0x5a, 0x86, 0x2b, 0x9b, 0x7b, 0x1b, 0xd7, 0xf8,
-  0x41, 0xe1, 0x44, 0x4b, 0x75, 0xef, 0xac, 0x8d, 0x6d, 0x46, 0x93, 0x9a, 0x01, 0x6a, 0x0a, 0x7d,
-  0x17, 0x1c, 0x23, 0x86, 0x62, 0x37, 0xa7, 0x6f, 0xd6, 0xf7, 0xf5, 0xfc, 0x4b, 0xed, 0x9f, 0x67,
-  0x71, 0x8c, 0x38, 0x15, 0x7a, 0xf4, 0xde, 0x32, 0x75, 0xf1, 0x7c, 0x4a, 0x89, 0xfd, 0xde, 0x73,
-  0x17, 0x56, 0x2d, 0x85, 0x84, 0x78, 0xc8, 0xd6, 0xb6, 0xea, 0x12, 0x72, 0x36, 0x75, 0xac, 0x86,
-  0x7c, 0x39, 0xf2, 0xae, 0x41, 0x49, 0xd9, 0x56, 0x72, 0x2c, 0xa7, 0x2b, 0xb6, 0xa6, 0xf0, 0x46,
-  0x97, 0xcc, 0x59, 0xc2, 0x13, 0xab, 0x99, 0xed, 0x29, 0x54, 0x27, 0xda, 0x92, 0xa4, 0x51, 0x81,
-  0x75, 0x99, 0x2e, 0xc0, 0x19, 0x3f, 0x2f, 0x29, 0x8f, 0x3b, 0x44, 0x9c, 0xa1, 0x17, 0x78, 0x60,
-  0x11, 0x0d, 0xa3, 0x92, 0x8a, 0x9f, 0xaa, 0xa6, 0x53, 0xc3, 0x5b, 0x3f, 0xc8, 0x4b, 0x1e, 0x3a,
-  0xc8, 0x4b, 0x56, 0x0e, 0xf2, 0x12, 0x76, 0x90, 0xd7, 0xf0, 0xd6, 0x4e, 0x33, 0x11, 0x2d, 0x7b,
-  0x30, 0x99, 0x4d, 0x2a, 0x4e, 0x0c, 0x3c, 0xd1, 0xe2, 0xd8, 0x9a, 0x16, 0xc7, 0x0c, 0x15, 0xaa,
-  0x2d, 0xe3, 0xf4, 0x34, 0x1d, 0xbc, 0x51, 0x83, 0x87, 0xde, 0xe2, 0x84, 0x1f, 0x9e, 0x6e, 0x41,
-  0xc0, 0xb3, 0xe4, 0xa4, 0x7a, 0x27, 0x39, 0xf3, 0x97, 0xa4, 0xa9, 0x17, 0x00, 0x51, 0x3b, 0xea,
-  0xd9, 0x22, 0x04, 0xc9, 0x57, 0x93, 0x83, 0xe5, 0xe0, 0xac, 0x4e, 0x67, 0xe1, 0x18, 0xcf, 0x5c,
-  0x16, 0x04, 0x85, 0x49, 0x24, 0x23, 0x8e, 0x88, 0xa7, 0xb8, 0x6a, 0xf1, 0x9c, 0xb8, 0x57, 0xe7,
-  0x63, 0x10, 0xf3, 0x11, 0x3f, 0x34, 0x8d, 0x74, 0x91, 0x87, 0x56, 0x44, 0xb7, 0x1d, 0xb6, 0xba,
-  0xfa, 0x8c, 0x18, 0x5e, 0x27, 0x6d, 0x4f, 0x9e, 0xc1, 0xa4, 0x25, 0xa2, 0x3b, 0xe2, 0xa8, 0xac,
-  0x3c, 0x7c, 0x83, 0x6f, 0x8e, 0xe1, 0xe1, 0x09, 0x2e, 0x1e, 0x81, 0x16, 0x34, 0xe2, 0x68, 0x7a,
-  0xa4, 0x25, 0x25, 0xe2, 0x38, 0x7f, 0xee, 0x77, 0x59, 0x5c, 0x6c, 0x85, 0x7b, 0x78, 0x4e, 0xb4,
-  0x88, 0x17, 0x2b, 0x67, 0x88, 0x63, 0x3c, 0xa9, 0x23, 0xce, 0xa5, 0x65, 0xb9, 0xfe, 0x50, 0x1b,
-  0x0e, 0x9e, 0xdb, 0x62, 0x87, 0x31, 0xa7, 0x78, 0x58, 0x92, 0x1d, 0x8f, 0xc4, 0x07, 0x92, 0xa2,
-  0x2d, 0x6a, 0x3e, 0x21, 0xe8, 0xc3, 0xff, 0x68, 0xfd, 0xce, 0xd3, 0xa7, 0x8e, 0x51, 0xdc, 0x82,
-  0x83, 0x2d, 0xac, 0x9c, 0x4d, 0x25, 0x9c, 0xf4, 0x4e, 0xd7, 0x11, 0xa7, 0xc2, 0xc3, 0x3a, 0x08,
-  0x48, 0xc1, 0xb9, 0x64, 0x76, 0xd6, 0xf5, 0x99, 0x0a, 0x23, 0x7e, 0xea, 0x52, 0x10, 0x1a, 0x9e,
-  0xb9, 0x71, 0x6f, 0x66, 0x76, 0x58, 0xa2, 0xa3, 0x8e, 0x02, 0x3c, 0xe4, 0x21, 0x4e, 0x85, 0xb1,
-  0x28, 0xf1, 0x80, 0x2f, 0xa0, 0x97, 0xd4, 0x3a, 0x9e, 0x40, 0x72, 0xad, 0x7b, 0xce, 0x41, 0xef,
-  0x5a, 0x4d, 0xf3, 0x59, 0xbd, 0xd3, 0xd4, 0x83, 0xfb, 0x72, 0x55, 0x5d, 0xdd, 0xe3, 0xc7, 0xa4,
-  0xc1, 0x2c, 0xc0, 0xc0, 0x63, 0x86, 0x00, 0x80, 0xd4, 0xe0, 0x46, 0xaa, 0x5a, 0x0a, 0xca, 0x75,
-  0x0d, 0x0f, 0x18, 0xd6, 0xcc, 0x5f, 0x3c, 0xdd, 0xb6, 0x02, 0xf8, 0xf4, 0x79, 0x09, 0xf0, 0xa1,
-  0x40, 0x36, 0x65, 0xa1, 0x4a, 0xa8, 0x55, 0xeb, 0x9a, 0x3e, 0xc6, 0x3b, 0x22, 0xf0, 0xf8, 0x00,
-  0x25, 0xc1, 0x29, 0x1e, 0xf8, 0x32, 0x75, 0x53, 0x17, 0x59, 0x92, 0x5a, 0x21, 0x9b, 0x71, 0x63,
-  0xf9, 0xf0, 0xb9, 0xb0, 0x3c, 0x3d, 0x32, 0xfa, 0x14, 0x94, 0xfd, 0x09, 0xd4, 0x89, 0xd7, 0x24,
-  0xe0, 0xc4, 0x11, 0x44, 0xc6, 0xb8, 0x64, 0xef, 0x88, 0x37, 0x56, 0x11, 0x14, 0xc1, 0x02, 0x7a,
-  0xa8, 0xdb, 0xf9, 0x5c, 0xec, 0x28, 0x0a, 0x9e, 0x2c, 0x51, 0xf5, 0xba, 0x65, 0xb9, 0xcf, 0xf2,
-  0x65, 0xca, 0x35, 0xa3, 0x05, 0x38, 0x9b, 0xfa, 0x16, 0x7c, 0x36, 0x7e, 0xf1, 0xb4, 0xce, 0x4a,
-  0x7a, 0x5d, 0xa4, 0xb7, 0x44, 0x7a, 0xbe, 0x6e, 0xdc, 0x21, 0x7e, 0x5f, 0xbd, 0x80, 0x51, 0x19,
-  0x4a, 0xb1, 0xda, 0xb7, 0xee, 0xac, 0x5d, 0xe6, 0x6a, 0xf1, 0xff, 0xda, 0x7a, 0x9f, 0x81, 0x45,
-  0x16, 0xab, 0xb1, 0xac, 0xa2, 0x31, 0xc3, 0xc0, 0x4c, 0xcd, 0x63, 0xd2, 0x77, 0xc1, 0x14, 0x22,
-  0x0c, 0x25, 0xa0, 0x87, 0xee, 0xa6, 0xa5, 0x8a, 0xa5, 0x7f, 0x91, 0x11, 0x17, 0x92, 0x4b, 0x77,
-  0x49, 0x15, 0x92, 0xbc, 0x2c, 0x71, 0x69, 0x23, 0x0e, 0xd8, 0x29, 0xd4, 0x0e, 0x85, 0x8d, 0xe4,
-  0x3a, 0xd1, 0x16, 0xc5, 0x6a, 0x75, 0x78, 0xa8, 0x8b, 0x3e, 0xac, 0x11, 0x8a, 0x2e, 0xd6, 0x0a,
-  0x36, 0x58, 0xef, 0xc1, 0x57, 0x40, 0xca, 0x32, 0xea, 0x32, 0x69, 0x1e, 0x58, 0xe6, 0xca, 0xbd,
-  0x08, 0x2e, 0xbb, 0x06, 0x21, 0xd1, 0x75, 0x00, 0x73, 0x76, 0x83, 0xae, 0x03, 0x30, 0x36, 0xcc,
-  0x02, 0xb4, 0x4b, 0xe1, 0xdc, 0xc1, 0xa3, 0x75, 0x05, 0x1d, 0x4c, 0x2e, 0x4d, 0x18, 0x7c, 0xd5,
-  0x96, 0x03, 0x5c, 0xe5, 0x37, 0x3b, 0x50, 0x64, 0x6b, 0x5b, 0xaf, 0x6d, 0x35, 0xf4, 0x96, 0xf9,
-  0xb5, 0xcb, 0x76, 0x1f, 0x75, 0x59, 0x52, 0x0d, 0x93, 0xea, 0x35, 0x48, 0x6b, 0xec, 0xe8, 0xcd,
-  0x9d, 0x5c, 0x5a, 0x1d, 0xd3, 0x6a, 0xad, 0x36, 0x94, 0xd1, 0xeb, 0xcd, 0xb6, 0x4c, 0xb3, 0xe9,
-  0x90, 0xcc, 0xdc, 0x88, 0x25, 0xee, 0xd4, 0xf5, 0xe6, 0xb6, 0xde, 0xd8, 0xfe, 0x1a, 0x67, 0xbb,
-  0x7f, 0xc9, 0xfc, 0xea, 0x9f, 0x97, 0xc1, 0x17, 0xf3, 0x6b, 0xac, 0xe3, 0x77, 0x4d, 0x7c, 0xd7,
-  0xd9, 0x37, 0xf9, 0x32, 0x28, 0xb7, 0xbe, 0xc6, 0xda, 0x25, 0x93, 0xf9, 0x92, 0x53, 0x36, 0x5a,
-  0x1a, 0xf0, 0x7a, 0x55, 0xf8, 0x71, 0x58, 0x98, 0x4c, 0x05, 0x21, 0x73, 0xfe, 0xfc, 0x93, 0xee,
-  0x5a, 0xb5, 0xa7, 0x4f, 0x9b, 0x28, 0x7d, 0x25, 0x2a, 0xca, 0xf8, 0x9d, 0x7a, 0xfe, 0xbd, 0xbc,
-  0xfd, 0x8b, 0xd7, 0xc9, 0xbc, 0x22, 0xb7, 0x22, 0x83, 0x04, 0x83, 0x64, 0xc8, 0x18, 0x4d, 0x26,
-  0xe1, 0xe2, 0xee, 0x85, 0x93, 0x23, 0xc9, 0xba, 0xd2, 0x1d, 0x82, 0xf8, 0xb7, 0xc8, 0xa1, 0x2e,
-  0x5a, 0x2f, 0x7b, 0xd5, 0x26, 0x18, 0xc4, 0x72, 0x39, 0x8e, 0xd3, 0xa3, 0x9a, 0x2b, 0xe6, 0x02,
-  0x0f, 0x49, 0x72, 0xee, 0x72, 0x13, 0xcb, 0xb9, 0xc8, 0x36, 0x79, 0xaa, 0x1d, 0xa1, 0x85, 0xd9,
-  0x0d, 0x2b, 0x00, 0x00, 0x05, 0xef, 0x60, 0x84, 0x83, 0xa7, 0xab, 0x59, 0x2e, 0x6f, 0x36, 0xe9,
-  0xa3, 0x3d, 0xce, 0xe4, 0x3b, 0x66, 0xa0, 0xb5, 0x9c, 0xc9, 0x35, 0x28, 0xd9, 0xbc, 0x07, 0x02,
-  0xb8, 0x96, 0x3b, 0xc0, 0xed, 0xd7, 0xb9, 0xac, 0xa7, 0x08, 0x59, 0xcb, 0x27, 0x4e, 0x86, 0x65,
-  0x33, 0xee, 0x33, 0xd0, 0x5a, 0x4e, 0x71, 0xfe, 0x29, 0x9b, 0x93, 0x2f, 0xbb, 0xaf, 0xe5, 0x9c,
-  0x06, 0xfe, 0x08, 0x37, 0xcc, 0xe7, 0xf2, 0x9e, 0x08, 0xe0, 0x7a, 0xbf, 0x08, 0xf8, 0x76, 0xf9,
-  0xbc, 0x07, 0x0c, 0xb4, 0x9e, 0x13, 0x54, 0xb6, 0xdd, 0x78, 0x9e, 0xcf, 0xca, 0x61, 0x6b, 0x79,
-  0x59, 0x1c, 0x99, 0x27, 0x3f, 0x42, 0xb2, 0xf9, 0x92, 0x81, 0x91, 0xe6, 0xc9, 0x24, 0xc7, 0x31,
-  0xf7, 0x30, 0x25, 0x88, 0x9d, 0x53, 0x83, 0xd8, 0x9c, 0xed, 0x85, 0xa1, 0xc2, 0xbd, 0xb8, 0x16,
-  0x89, 0x96, 0x70, 0x8b, 0x3c, 0xb0, 0xcf, 0xec, 0xaa, 0x08, 0xf6, 0x06, 0x36, 0xdf, 0xb1, 0x4b,
-  0x68, 0x7e, 0xd9, 0x03, 0x4d, 0xbd, 0xd7, 0xf4, 0xe8, 0xb5, 0x95, 0x02, 0x9f, 0xe5, 0xaa, 0xc4,
-  0xd2, 0x65, 0x15, 0x5c, 0xc0, 0x3c, 0xd4, 0xb1, 0x3b, 0x8f, 0xcb, 0x56, 0x56, 0x7f, 0x02, 0xf7,
-  0x31, 0xe6, 0x8e, 0xda, 0x31, 0xe0, 0xc5, 0xdc, 0xb2, 0x0c, 0x06, 0xd2, 0x03, 0xc8, 0x17, 0x0c,
-  0xfc, 0x67, 0x97, 0x7c, 0x93, 0x12, 0x9f, 0xa6, 0xcf, 0x74, 0x84, 0x68, 0x71, 0x32, 0xfb, 0xff,
-  0x73, 0xbe, 0xff, 0x46, 0xba, 0xf4, 0x93, 0x03, 0xb3, 0xa3, 0x72, 0xb1, 0xd8, 0xe1, 0x74, 0xd9,
-  0xb9, 0xcc, 0xdc, 0xfa, 0xb3, 0x5e, 0x75, 0xb2, 0x8c, 0x54, 0x50, 0xf3, 0xfd, 0xed, 0xca, 0x73,
-  0x8d, 0xc5, 0xcd, 0xa7, 0x87, 0x10, 0x2f, 0xf5, 0xdc, 0x25, 0x44, 0x4e, 0x9c, 0x8f, 0x16, 0xb2,
-  0xd4, 0xa1, 0xf9, 0x73, 0xbd, 0x3c, 0x70, 0x50, 0x2c, 0x65, 0x0d, 0xef, 0xdf, 0xed, 0x24, 0x86,
-  0xe8, 0x72, 0xf5, 0xbf, 0xc2, 0x7f, 0xa2, 0x95, 0xd5, 0xdf, 0xc5, 0x5d, 0x30, 0xea, 0xf9, 0x73,
-  0x3c, 0x58, 0xc8, 0xe4, 0x04, 0x3d, 0x74, 0xb0, 0x60, 0x4e, 0xbe, 0x21, 0x7e, 0x60, 0xf8, 0xe7,
-  0xa5, 0x3c, 0x77, 0xbf, 0xca, 0x56, 0x2d, 0x96, 0x87, 0x8a, 0x2f, 0xb5, 0xac, 0x2b, 0xce, 0x38,
-  0xec, 0x80, 0x67, 0xa7, 0x17, 0x90, 0x00, 0x9a, 0x21, 0x6b, 0x82, 0x26, 0x2e, 0x4f, 0xf8, 0x80,
-  0x19, 0x4a, 0x05, 0x85, 0xf2, 0x97, 0x67, 0xdc, 0x99, 0xed, 0x0b, 0xf9, 0x0a, 0xad, 0xae, 0x36,
-  0x0b, 0x9e, 0xbb, 0x18, 0x82, 0x4f, 0xac, 0x75, 0x8e, 0x81, 0xcf, 0x5a, 0x44, 0xde, 0x75, 0xa1,
-  0xf8, 0x3d, 0xdd, 0xbf, 0xe1, 0x41, 0x9e, 0x94, 0xd2, 0x89, 0x01, 0x4e, 0x2e, 0x27, 0x49, 0x9b,
-  0x5e, 0xf3, 0xe7, 0xe9, 0x5a, 0x6c, 0xb5, 0xca, 0x1e, 0x0f, 0x1c, 0x52, 0x68, 0x0e, 0x2f, 0x4f,
-  0xc9, 0x12, 0x4a, 0x1e, 0x19, 0x05, 0xaf, 0x10, 0xef, 0x1d, 0xba, 0x38, 0xb2, 0xbe, 0x64, 0x07,
-  0xf6, 0xd7, 0x6c, 0xa4, 0x94, 0xbf, 0x99, 0x23, 0xb9, 0x2a, 0x83, 0xd3, 0xad, 0x68, 0xe8, 0xad,
-  0xcb, 0x09, 0x88, 0x08, 0x5e, 0x1e, 0x70, 0x76, 0xd2, 0x3b, 0x06, 0x0f, 0xdb, 0x49, 0xa4, 0xe4,
-  0x19, 0xbf, 0x5a, 0x20, 0x43, 0xb3, 0xbc, 0xdc, 0x58, 0xc0, 0x2b, 0x99, 0x45, 0xf2, 0xdb, 0x49,
-  0x8e, 0xa9, 0x6a, 0x12, 0x95, 0x03, 0x7e, 0x7e, 0x4d, 0x5c, 0xe5, 0x40, 0x39, 0x1a, 0xc4, 0x4a,
-  0x14, 0x17, 0x5e, 0x42, 0x03, 0xe9, 0x28, 0x49, 0x2b, 0x5b, 0xff, 0x54, 0x71, 0xf4, 0x0d, 0x84,
-  0x98, 0xfc, 0xf9, 0x27, 0x90, 0x08, 0xef, 0xa4, 0x28, 0x2a, 0xa7, 0xa7, 0x39, 0x81, 0xa0, 0xe9,
-  0x0e, 0x41, 0x8b, 0x16, 0xdd, 0x1d, 0x92, 0xd4, 0x20, 0x51, 0x59, 0xe1, 0x5b, 0x41, 0x48, 0x9e,
-  0x0f, 0x95, 0xd6, 0x34, 0xa1, 0xbe, 0x36, 0x5c, 0xd8, 0xb0, 0xa3, 0x06, 0x1b, 0x32, 0xdf, 0xd3,
-  0x63, 0x56, 0x00, 0xfb, 0xfb, 0x2c, 0xd7, 0x0d, 0x5e, 0x51, 0xa7, 0xb0, 0x86, 0xec, 0x44, 0x83,
-  0x1c, 0xc6, 0xa2, 0x40, 0x3a, 0x68, 0xcb, 0xf7, 0x17, 0x45, 0x09, 0xe4, 0xac, 0x94, 0xa3, 0xb0,
-  0x5a, 0x7d, 0x62, 0x29, 0x26, 0xae, 0xc4, 0x88, 0x4b, 0x5d, 0x14, 0x73, 0x03, 0x32, 0xad, 0x5c,
-  0x40, 0x21, 0x32, 0xe3, 0x7c, 0x47, 0x5e, 0xf0, 0x44, 0x42, 0x3a, 0x01, 0x01, 0xde, 0x29, 0xd9,
-  0x15, 0x60, 0x79, 0x35, 0x07, 0xc1, 0x5b, 0xbc, 0xd6, 0x06, 0x7b, 0x6e, 0x80, 0xf3, 0x7b, 0x78,
-  0xee, 0xcc, 0x24, 0xc8, 0x2c, 0xb8, 0x9f, 0x19, 0xfc, 0x24, 0x3f, 0xf2, 0xc5, 0x9d, 0x49, 0xab,
-  0x12, 0x29, 0x0b, 0xe2, 0x34, 0x0b, 0x9e, 0x14, 0x13, 0x9c, 0xea, 0x12, 0xeb, 0x3b, 0xee, 0xd3,
-  0x13, 0x97, 0xb0, 0xa9, 0x9d, 0x4b, 0x31, 0xb7, 0x5a, 0x70, 0x6a, 0x5d, 0xdc, 0x48, 0x15, 0x57,
-  0xb1, 0x95, 0xea, 0xa5, 0xbe, 0x7a, 0xeb, 0x06, 0x11, 0x08, 0xe4, 0x05, 0x49, 0x5f, 0x99, 0x35,
-  0xe0, 0x79, 0xb2, 0x37, 0x37, 0x11, 0x89, 0xb9, 0x01, 0x6e, 0x84, 0xf5, 0xc4, 0xcc, 0xdd, 0x8d,
-  0xa1, 0x66, 0x44, 0x9f, 0x1f, 0x84, 0x13, 0x6b, 0xc8, 0x2a, 0xda, 0x23, 0x5b, 0xf6, 0x19, 0x03,
-  0xf5, 0x74, 0x16, 0x83, 0x93, 0x57, 0x3a, 0x0a, 0xaa, 0x5a, 0xce, 0xdd, 0x07, 0xd6, 0x5a, 0xb9,
-  0x0f, 0x2c, 0x3f, 0xf9, 0x01, 0xa6, 0x50, 0x95, 0xc2, 0xae, 0xaa, 0xba, 0x83, 0xb7, 0xb2, 0xc8,
-  0xf1, 0xb6, 0x52, 0x3f, 0x48, 0x8c, 0x95, 0x30, 0xeb, 0xef, 0x18, 0x70, 0x7c, 0x96, 0xe9, 0x12,
-  0x2c, 0x58, 0xac, 0xa8, 0x4c, 0x36, 0xd4, 0x8e, 0x50, 0xeb, 0x2b, 0x4d, 0xc7, 0xe0, 0x10, 0xe4,
-  0xb2, 0x7d, 0xb9, 0x23, 0x9f, 0xae, 0x7c, 0x6f, 0xc2, 0xd7, 0x4b, 0xec, 0xb4, 0xae, 0xc6, 0x94,
-  0xdd, 0x4d, 0x05, 0xd4, 0x73, 0xca, 0x94, 0x83, 0xe4, 0x5d, 0x79, 0xa2, 0x69, 0xa9, 0xaf, 0x3a,
-  0xca, 0x9a, 0xf7, 0x80, 0x3e, 0x94, 0x22, 0xe9, 0x2e, 0x08, 0x6d, 0x44, 0xfe, 0x19, 0xdb, 0xfc,
-  0x55, 0x6a, 0xb4, 0x35, 0x23, 0xc4, 0xb9, 0xd1, 0x52, 0x1d, 0x9c, 0x97, 0xcb, 0x6e, 0xce, 0x14,
-  0xa4, 0x9a, 0x2e, 0x23, 0x23, 0x97, 0xcb, 0xbc, 0x7d, 0x83, 0x62, 0x9d, 0x25, 0x44, 0x57, 0x31,
-  0xf4, 0x82, 0xe2, 0x47, 0x04, 0xec, 0xbf, 0xd4, 0x12, 0xcf, 0x33, 0x1b, 0x2f, 0x28, 0xf0, 0x4c,
-  0x3d, 0x3b, 0xe3, 0x8e, 0x16, 0xcb, 0xc9, 0x25, 0x34, 0xf1, 0x38, 0x84, 0x65, 0x2b, 0xf9, 0x68,
-  0x63, 0xbd, 0x9d, 0xff, 0xef, 0x40, 0x42, 0xf2, 0xc4, 0xf1, 0xd6, 0x13, 0x01, 0x88, 0x49, 0xe4,
-  0xa6, 0x20, 0x89, 0xdc, 0xc4, 0xea, 0x3d, 0x7e, 0xe7, 0x0f, 0x0e, 0x72, 0xc1, 0xb2, 0xd5, 0xa0,
-  0xef, 0x7b, 0x98, 0xb6, 0xe2, 0xd7, 0xde, 0x47, 0xce, 0xf2, 0x5f, 0x20, 0x68, 0xd2, 0xf5, 0xec,
-  0x81, 0x07, 0x1e, 0xc2, 0x4e, 0xd8, 0xdd, 0x2b, 0x92, 0xa5, 0x3f, 0xec, 0x27, 0x09, 0x2b, 0xc9,
-  0x5c, 0x1d, 0x71, 0x1b, 0x24, 0x44, 0x61, 0xe8, 0x15, 0xd9, 0x14, 0xc2, 0x79, 0x60, 0x0e, 0x50,
-  0xc0, 0xaa, 0xd4, 0x2c, 0x6b, 0x45, 0x99, 0x03, 0x79, 0x59, 0x21, 0xdb, 0x09, 0xf1, 0xd5, 0xc6,
-  0x9b, 0xeb, 0xb4, 0xbb, 0x39, 0x52, 0xca, 0xf1, 0x60, 0xd7, 0x68, 0x34, 0x9e, 0x55, 0x6a, 0x9d,
-  0x15, 0x60, 0xbb, 0xfd, 0xcc, 0xec, 0xd4, 0x12, 0x06, 0xe5, 0x42, 0xed, 0xff, 0x20, 0xee, 0xdc,
-  0xcb, 0x1b, 0x26, 0xaf, 0xa6, 0x10, 0x4e, 0x10, 0xa4, 0xef, 0xe3, 0x56, 0xa1, 0x27, 0x1e, 0x5c,
-  0x3f, 0x34, 0x3a, 0xef, 0x65, 0x65, 0x38, 0x9b, 0xa6, 0x9a, 0x31, 0xc9, 0xa1, 0xdd, 0x13, 0x32,
-  0x41, 0x83, 0x6b, 0x8c, 0xce, 0x78, 0x62, 0xda, 0x5f, 0x1c, 0x44, 0xf9, 0x59, 0x8e, 0xff, 0x1b,
-  0x4c, 0x7a, 0xa4, 0x46, 0xba, 0x3b, 0x12, 0xcc, 0x28, 0x98, 0x3b, 0x88, 0xc1, 0xf6, 0xe5, 0xc8,
-  0x1e, 0xe7, 0x67, 0x6b, 0xbe, 0xa7, 0xc7, 0x6b, 0x1a, 0x7e, 0x85, 0x04, 0xff, 0x51, 0xea, 0x7e,
-  0xb5, 0x19, 0x7e, 0x7d, 0xd6, 0x0f, 0x34, 0xf4, 0xf0, 0x04, 0x81, 0xb8, 0x45, 0xe9, 0x47, 0xf5,
-  0xd1, 0xb0, 0xe4, 0x48, 0x87, 0xcb, 0xc1, 0xb5, 0x8e, 0x5e, 0xc4, 0xef, 0xaf, 0xa7, 0x25, 0x95,
-  0x5f, 0xd8, 0x14, 0xf2, 0x09, 0x00, 0xa2, 0xb1, 0x10, 0x93, 0xc8, 0xfb, 0x0f, 0xc1, 0x1f, 0x59,
-  0xd3, 0x4e, 0x2c, 0x36, 0x22, 0x72, 0x75, 0x2c, 0x9d, 0x6c, 0x66, 0x77, 0x65, 0x12, 0x2d, 0xb2,
-  0xd6, 0x06, 0x03, 0x5e, 0x71, 0x8c, 0x53, 0x94, 0xc9, 0xfd, 0x8e, 0x99, 0xe0, 0x30, 0x17, 0x6b,
-  0x5b, 0xe2, 0x9e, 0x3e, 0x9a, 0xa9, 0x36, 0xe2, 0xd5, 0xae, 0x44, 0xe4, 0xb9, 0x0b, 0xa8, 0xc0,
-  0x3f, 0x81, 0xea, 0x91, 0x5b, 0x71, 0x72, 0x01, 0xd5, 0x65, 0x9c, 0x0f, 0x33, 0xe3, 0x7b, 0x23,
-  0xbc, 0x64, 0x18, 0x1b, 0x82, 0x1c, 0xda, 0xdd, 0x31, 0xcc, 0x83, 0xa1, 0xca, 0xbd, 0x76, 0xc1,
-  0xc1, 0x83, 0x59, 0x05, 0xe4, 0xd7, 0xd3, 0xa6, 0x33, 0xb1, 0x0c, 0x0b, 0xc4, 0x1e, 0x2c, 0xd0,
-  0xcd, 0x69, 0x2f, 0xd1, 0xbf, 0xef, 0x32, 0x19, 0x66, 0x81, 0xc5, 0xa8, 0x75, 0xea, 0xda, 0xea,
-  0xa2, 0x25, 0x6f, 0x28, 0x07, 0xdc, 0x4c, 0x30, 0xea, 0x7c, 0x51, 0xa9, 0x83, 0x98, 0xa9, 0xb7,
-  0x73, 0x8a, 0xb7, 0x6d, 0xd9, 0x01, 0x7c, 0x7d, 0xdd, 0x4c, 0x74, 0xda, 0xea, 0x1c, 0xeb, 0x5f,
-  0xd0, 0x6a, 0x72, 0x0e, 0xf7, 0x1e, 0xff, 0xe6, 0xfe, 0x81, 0x98, 0x4c, 0x02, 0xc3, 0xe0, 0x92,
-  0xcf, 0x7b, 0x89, 0xd7, 0x99, 0x9f, 0xe1, 0xfd, 0x0b, 0x78, 0xf2, 0xd9, 0xe3, 0x1f, 0x52, 0x3e,
-  0xbb, 0x55, 0x5e, 0x18, 0xb0, 0xba, 0x7b, 0x1e, 0x30, 0x5f, 0x12, 0xe3, 0x34, 0x79, 0xab, 0x68,
-  0x0e, 0x28, 0xc2, 0x3e, 0x4d, 0xe7, 0x0c, 0x5c, 0xd9, 0x85, 0xf0, 0x18, 0xed, 0x9c, 0x9b, 0x9e,
-  0xfe, 0x6e, 0x37, 0xdc, 0xe2, 0xb7, 0x84, 0x8a, 0x48, 0x8e, 0x2b, 0x24, 0x5c, 0x07, 0xce, 0x86,
-  0x1b, 0xe0, 0x1c, 0xa5, 0x17, 0xa3, 0xad, 0x53, 0x44, 0xc7, 0x2a, 0x1c, 0xa8, 0x82, 0x5f, 0xdf,
-  0xa1, 0xaf, 0xcd, 0xaa, 0x71, 0xc5, 0x81, 0xb9, 0x64, 0x4e, 0xfc, 0xd1, 0x11, 0xbc, 0x4c, 0x32,
-  0x0a, 0xd4, 0x74, 0x86, 0xc1, 0x29, 0x9c, 0x92, 0xe3, 0xca, 0x4c, 0x62, 0x39, 0x86, 0xfc, 0x6c,
-  0x9d, 0xda, 0x49, 0xe6, 0xaf, 0x11, 0x5d, 0x3d, 0x7b, 0x75, 0x9b, 0xc3, 0xb1, 0x8a, 0x32, 0xda,
-  0x4b, 0x9a, 0x42, 0x87, 0x9d, 0xab, 0x64, 0x3a, 0x71, 0x75, 0xce, 0x08, 0x37, 0x12, 0x24, 0x93,
-  0x60, 0xb9, 0x20, 0x9c, 0x1d, 0x76, 0xe6, 0xb4, 0xc6, 0x7a, 0xb8, 0x6a, 0x53, 0x75, 0x37, 0x11,
-  0x18, 0x5d, 0x14, 0xd4, 0x74, 0xf2, 0xe4, 0x7b, 0x27, 0x4b, 0xf9, 0x24, 0x49, 0xc7, 0xcd, 0xe9,
-  0x88, 0x25, 0x4b, 0xea, 0x88, 0x6a, 0x79, 0x78, 0x7f, 0x9f, 0x79, 0x59, 0x57, 0x89, 0xda, 0xfa,
-  0x94, 0xd5, 0xca, 0x3c, 0x95, 0xe0, 0x56, 0x4a, 0x7d, 0xb0, 0x2d, 0x6b, 0x47, 0x22, 0x19, 0x83,
-  0xa4, 0x06, 0x75, 0xd2, 0x2b, 0x59, 0x93, 0x25, 0x4a, 0xce, 0x56, 0xb2, 0xc2, 0x49, 0xf2, 0x08,
-  0x4e, 0xe2, 0xc4, 0xf6, 0xbd, 0x5b, 0x59, 0x22, 0xdd, 0xd1, 0x61, 0x60, 0xc4, 0xf1, 0xda, 0x06,
-  0x8d, 0x44, 0x17, 0xe4, 0x97, 0x70, 0xfe, 0x82, 0x32, 0xf8, 0x61, 0x3f, 0x24, 0x77, 0x59, 0xa2,
-  0x58, 0x92, 0xcb, 0x3b, 0xd1, 0x78, 0xed, 0x6f, 0x5b, 0x55, 0xd8, 0x7d, 0x87, 0x63, 0xdf, 0xb5,
-  0x69, 0x60, 0xa9, 0x37, 0xb8, 0x43, 0xee, 0x87, 0x4a, 0x2e, 0x7e, 0xb8, 0xe4, 0x2d, 0xdf, 0x95,
-  0xf7, 0x37, 0xc5, 0x4e, 0x18, 0x3a, 0xc1, 0xa8, 0x40, 0xd2, 0x86, 0xec, 0x27, 0x1a, 0x6e, 0xf2,
-  0xb0, 0x2f, 0xe6, 0x57, 0x11, 0x60, 0x65, 0x20, 0xd2, 0xe4, 0x1b, 0x37, 0x38, 0xe9, 0xb5, 0x58,
-  0x29, 0x51, 0x5b, 0x2b, 0x51, 0x4b, 0x4b, 0x2c, 0xb0, 0xc4, 0xed, 0x4a, 0x89, 0xfa, 0x5a, 0x89,
-  0x7a, 0x5a, 0xe2, 0xf6, 0xce, 0xd8, 0xec, 0x72, 0x09, 0x0c, 0xe8, 0xc8, 0xe9, 0x0e, 0xfe, 0x43,
-  0x03, 0x6d, 0x73, 0xd5, 0xdb, 0xd7, 0x15, 0x20, 0xf6, 0x63, 0x72, 0xdd, 0x3e, 0x9c, 0x2b, 0xbe,
-  0x2c, 0xbc, 0xf2, 0x91, 0xed, 0x5c, 0xcf, 0x6e, 0x4f, 0xef, 0x81, 0x70, 0xb9, 0xfa, 0x2b, 0xea,
-  0xf2, 0xcb, 0x64, 0xf4, 0x74, 0xbb, 0x7a, 0xb7, 0x78, 0x83, 0x3b, 0x88, 0x63, 0x29, 0x7b, 0x59,
-  0x98, 0x96, 0xd9, 0x59, 0xc9, 0xd3, 0x92, 0x77, 0x2d, 0x1e, 0xd7, 0xf4, 0x71, 0x7d, 0x99, 0x2d,
-  0x38, 0x96, 0xa5, 0xd8, 0xd6, 0x57, 0xb9, 0x41, 0x73, 0x7a, 0x13, 0xdb, 0xce, 0xf5, 0x32, 0x0b,
-  0xab, 0xc7, 0x6c, 0x16, 0x3a, 0xbf, 0xf9, 0xb9, 0x3d, 0xbd, 0xc9, 0xa1, 0x91, 0xb9, 0xfc, 0x4e,
-  0x8b, 0xc5, 0xf4, 0x18, 0xef, 0x1e, 0xeb, 0x6f, 0xc7, 0x89, 0x88, 0xeb, 0x0c, 0xe4, 0xde, 0x6a,
-  0x97, 0x0e, 0xd7, 0xab, 0xc8, 0xdd, 0x94, 0xa7, 0xc5, 0x4c, 0xd0, 0xb3, 0x7b, 0xfb, 0x71, 0xbb,
-  0xc5, 0x23, 0xba, 0xce, 0x76, 0x40, 0x72, 0xc7, 0x3c, 0x5b, 0xda, 0x54, 0xcc, 0xc7, 0x16, 0xe6,
-  0x9e, 0xd3, 0xf2, 0xae, 0xdc, 0x99, 0x4a, 0x79, 0xa2, 0xbc, 0xc2, 0x4d, 0x8b, 0x49, 0x31, 0x85,
-  0x59, 0x69, 0x9b, 0x0e, 0xfc, 0x80, 0x4d, 0x28, 0xf3, 0x8d, 0xf7, 0x08, 0xc4, 0x5b, 0x41, 0x32,
-  0x5b, 0xd8, 0xbb, 0xd9, 0xd3, 0x0e, 0x62, 0xbf, 0x27, 0x5e, 0xca, 0x38, 0x0b, 0xf9, 0xee, 0xf0,
-  0xc7, 0x75, 0x27, 0xe6, 0x0e, 0x8a, 0xa8, 0xb7, 0x01, 0xf2, 0x22, 0xb7, 0x31, 0xc3, 0x63, 0x51,
-  0xad, 0x0c, 0x94, 0xdd, 0x51, 0x8a, 0x32, 0xb6, 0xda, 0x16, 0xdf, 0x76, 0x2d, 0x56, 0xbf, 0x63,
-  0x03, 0x17, 0xd6, 0x96, 0x59, 0x6e, 0xd6, 0x4d, 0xb6, 0x55, 0x9d, 0xa9, 0xde, 0xc7, 0x8a, 0x75,
-  0x72, 0xbd, 0xa2, 0x4b, 0xa6, 0x21, 0xed, 0xc8, 0x07, 0xb1, 0x03, 0x7b, 0x0d, 0x59, 0x33, 0x41,
-  0x56, 0x08, 0x95, 0xd8, 0xe2, 0x9e, 0xd9, 0x67, 0x6b, 0xb2, 0xed, 0xb5, 0xd8, 0x15, 0xbc, 0xe8,
-  0x53, 0xe0, 0xa3, 0x44, 0xb6, 0x2e, 0x9f, 0xc6, 0xcb, 0xe2, 0xee, 0xca, 0xfd, 0xb3, 0x28, 0x94,
-  0xf2, 0x46, 0x1d, 0xb1, 0xcf, 0x3e, 0xf2, 0xa7, 0x71, 0x5a, 0x3c, 0xb3, 0x01, 0x1f, 0xfb, 0xbd,
-  0xbe, 0x5b, 0x57, 0xf0, 0x23, 0x61, 0xfe, 0x9d, 0xa3, 0xc4, 0xe0, 0x1b, 0x30, 0x75, 0x31, 0x6b,
-  0xae, 0x1b, 0xfc, 0xf7, 0x15, 0x74, 0x43, 0xec, 0xbe, 0x94, 0x98, 0xd6, 0x13, 0x4c, 0x85, 0xb8,
-  0x65, 0x6e, 0xa5, 0xbc, 0x4f, 0x1a, 0x8b, 0xc8, 0x27, 0xbb, 0xd9, 0x4a, 0xce, 0x39, 0xb0, 0x47,
-  0xc1, 0x5d, 0xbc, 0x3f, 0x00, 0xba, 0xea, 0xfb, 0x6e, 0xe4, 0x4c, 0x97, 0xc9, 0x4e, 0xf6, 0x80,
-  0xba, 0x04, 0xcf, 0x02, 0x75, 0x0b, 0xb7, 0xcb, 0xaf, 0xef, 0x4b, 0xb6, 0xe1, 0x91, 0x72, 0xba,
-  0x26, 0xb5, 0x29, 0xf2, 0x01, 0xe9, 0xb7, 0x64, 0x17, 0x77, 0x39, 0x10, 0xcb, 0x2e, 0x24, 0x0f,
-  0xc5, 0x20, 0xa8, 0x9b, 0xf9, 0x9d, 0xf6, 0x59, 0xe2, 0xa5, 0x1d, 0x5b, 0xd7, 0x2b, 0x77, 0xeb,
-  0x91, 0xee, 0xda, 0x89, 0x89, 0x2c, 0x11, 0x94, 0x55, 0x21, 0x43, 0xfe, 0x27, 0x1d, 0x27, 0x7d,
-  0xa0, 0x3b, 0x84, 0x77, 0xdd, 0xdb, 0x0a, 0x3b, 0x1d, 0xdc, 0xa9, 0x75, 0x93, 0x83, 0x19, 0xad,
-  0x7f, 0x74, 0x99, 0xdc, 0xb7, 0x92, 0x83, 0x49, 0x7c, 0x1c, 0x54, 0xda, 0xd8, 0x05, 0x7f, 0x4a,
-  0x06, 0xd8, 0x3b, 0xb3, 0x1b, 0x81, 0x25, 0x10, 0xd5, 0x09, 0xa0, 0x62, 0x34, 0xc2, 0x62, 0xba,
-  0x74, 0x3a, 0xec, 0x08, 0xe1, 0x52, 0x1e, 0x7f, 0x80, 0xb8, 0x7b, 0x1d, 0x17, 0x76, 0x56, 0x04,
-  0x15, 0x44, 0x71, 0xf3, 0xad, 0x74, 0x90, 0x70, 0x9a, 0xb6, 0x56, 0x47, 0x0d, 0x93, 0xa5, 0x6e,
-  0xfe, 0x6e, 0xd3, 0x56, 0xab, 0xa5, 0x30, 0x4c, 0xf9, 0xf2, 0xe2, 0x5d, 0xcf, 0x09, 0xda, 0xfc,
-  0xac, 0xc5, 0x9d, 0x4c, 0x15, 0x17, 0xb3, 0x25, 0x64, 0xa8, 0xc5, 0x45, 0x9b, 0xe5, 0x05, 0xbf,
-  0xb2, 0x37, 0x76, 0x6a, 0x45, 0x7b, 0xd7, 0x93, 0x2d, 0x54, 0xc9, 0x0e, 0x65, 0x19, 0x35, 0x3f,
-  0xa7, 0x13, 0x5f, 0x4d, 0xb7, 0x58, 0xe5, 0x7f, 0x97, 0x69, 0xb9, 0x96, 0x50, 0xf2, 0x92, 0x20,
-  0xaa, 0x66, 0x59, 0xf8, 0x53, 0x11, 0x05, 0x77, 0xcd, 0x0b, 0xdf, 0xca, 0x99, 0xe0, 0xef, 0x10,
-  0x4e, 0xc8, 0x54, 0x4d, 0x4f, 0xd8, 0x0a, 0x20, 0xc4, 0xd4, 0x99, 0x63, 0xd9, 0x10, 0x97, 0x04,
-  0x94, 0xe2, 0x52, 0x90, 0xbc, 0x81, 0x72, 0xe6, 0x4d, 0xaf, 0x46, 0xec, 0x02, 0x4a, 0x96, 0xf4,
-  0x4f, 0xd3, 0xa8, 0xb5, 0xda, 0x46, 0xad, 0xda, 0x9f, 0x81, 0xaf, 0xc2, 0x61, 0x62, 0xcc, 0x1b,
-  0xdf, 0x20, 0x2e, 0x5f, 0xa9, 0x09, 0xaf, 0xbd, 0x81, 0x08, 0xa4, 0xfa, 0x98, 0x1a, 0xc5, 0x2d,
-  0x54, 0x61, 0xf5, 0x5b, 0x38, 0xa9, 0xaa, 0xf9, 0xeb, 0x3e, 0x94, 0x4c, 0xcf, 0xaa, 0xe2, 0x87,
-  0x1e, 0xd9, 0x7d, 0x8b, 0xec, 0xf2, 0x6e, 0xf4, 0xff, 0x15, 0xdf, 0x73, 0x7d, 0x62, 0xe7, 0xce,
-  0xf3, 0xca, 0x9f, 0x31, 0xc3, 0x40, 0x17, 0x33, 0xed, 0x29, 0x40, 0x21, 0xf6, 0x6b, 0x91, 0xff,
-  0x07, 0x8c, 0x4b, 0xb5, 0x35, 0x45, 0x72, 0x00, 0x00
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0xdd, 0x76, 0xdb, 0x38,
+  0x93, 0xe0, 0xbd, 0x9e, 0x02, 0x61, 0xe7, 0xb3, 0xc4, 0x16, 0x45, 0x51, 0xbf, 0x76, 0x24, 0xd3,
+  0xf9, 0x64, 0xc7, 0x49, 0x9c, 0x38, 0x89, 0x3b, 0xb6, 0xe3, 0x74, 0xb2, 0x3e, 0x9f, 0x21, 0x12,
+  0x92, 0x10, 0x53, 0x24, 0x9b, 0xa4, 0xfe, 0xac, 0xd6, 0x1b, 0xec, 0xd5, 0x9c, 0xb9, 0xd8, 0xbb,
+  0xb9, 0xde, 0xb3, 0xef, 0xb0, 0x17, 0xfb, 0x28, 0xfb, 0x04, 0xf3, 0x08, 0x7b, 0x0a, 0x00, 0x49,
+  0x50, 0xa2, 0x6c, 0x27, 0x9d, 0x99, 0x33, 0xdf, 0x39, 0xdb, 0xdf, 0x4c, 0x4c, 0x00, 0x55, 0x40,
+  0xa1, 0x50, 0x28, 0x14, 0x0a, 0x40, 0x09, 0xed, 0x3f, 0x79, 0xf1, 0xe1, 0xe8, 0xe2, 0xf7, 0xb3,
+  0x63, 0x34, 0x8a, 0xc6, 0xce, 0x01, 0xda, 0x8f, 0xff, 0x10, 0x6c, 0x1f, 0xa0, 0xfd, 0x31, 0x89,
+  0x30, 0xb2, 0x46, 0x38, 0x08, 0x49, 0x64, 0x2a, 0x93, 0x68, 0x50, 0xd9, 0x53, 0x92, 0x6c, 0xcf,
+  0x8d, 0x88, 0x1b, 0x99, 0xca, 0x82, 0x84, 0x0a, 0x2a, 0xb8, 0x78, 0x4c, 0x4c, 0x05, 0xfb, 0xbe,
+  0x43, 0x2a, 0x63, 0xaf, 0x4f, 0x1d, 0x52, 0x99, 0x91, 0x7e, 0x05, 0xfb, 0x7e, 0xc5, 0xc2, 0x3e,
+  0xee, 0x3b, 0x24, 0xc1, 0x2c, 0x24, 0xa8, 0x33, 0x6a, 0x47, 0x23, 0xd3, 0x26, 0x53, 0x6a, 0x91,
+  0x0a, 0x4b, 0x68, 0xd4, 0xa5, 0x11, 0xc5, 0x4e, 0x25, 0xb4, 0xb0, 0x43, 0xcc, 0x9a, 0x82, 0x78,
+  0xc5, 0x53, 0x4a, 0x66, 0xbe, 0x17, 0x44, 0x69, 0x25, 0xa2, 0xc1, 0x49, 0x34, 0xf2, 0x02, 0x25,
+  0xa5, 0xe6, 0x9d, 0xe7, 0xb9, 0xef, 0x3c, 0x7b, 0xe2, 0x90, 0x10, 0x61, 0xd7, 0x46, 0x34, 0x0a,
+  0x59, 0x61, 0x40, 0xfb, 0x93, 0xc8, 0x0b, 0x42, 0xa8, 0xc0, 0xa1, 0xee, 0x2d, 0x0a, 0x88, 0x63,
+  0x2a, 0xd4, 0xf2, 0x5c, 0x05, 0x15, 0x46, 0x01, 0x19, 0x98, 0x8a, 0x8d, 0x23, 0xdc, 0xa1, 0x63,
+  0x3c, 0x24, 0x55, 0xdf, 0x1d, 0x76, 0xfb, 0x38, 0x24, 0xed, 0xa6, 0x46, 0x3f, 0x1d, 0x7e, 0xf8,
+  0x38, 0x33, 0xde, 0xbe, 0x1a, 0x7a, 0xbd, 0x5e, 0xaf, 0xf7, 0xfe, 0xfc, 0x72, 0x74, 0x7c, 0x39,
+  0xec, 0xf5, 0x7a, 0x87, 0x90, 0xec, 0xfd, 0x76, 0xd4, 0xfb, 0x1d, 0xfe, 0x0e, 0xf6, 0xaa, 0xcf,
+  0x46, 0x2c, 0xe7, 0xf3, 0xfb, 0xf3, 0x8f, 0xc6, 0x49, 0x2f, 0x08, 0x9b, 0x56, 0xfb, 0xb7, 0x5e,
+  0xaf, 0x77, 0xfc, 0xd1, 0xb9, 0x3a, 0x76, 0xc6, 0x17, 0x97, 0x46, 0xef, 0x2d, 0xe0, 0xf5, 0x86,
+  0xbd, 0xde, 0xef, 0xb6, 0xdf, 0xeb, 0x41, 0x21, 0xaf, 0xe5, 0x15, 0xcb, 0xef, 0xf5, 0x7a, 0x6d,
+  0x48, 0xbf, 0x13, 0xf9, 0xc7, 0xbd, 0xde, 0xdb, 0xde, 0x91, 0x0c, 0x77, 0xfc, 0xb6, 0xf7, 0x22,
+  0x93, 0xe6, 0x58, 0xc6, 0xa7, 0xcf, 0xaf, 0x17, 0x90, 0x57, 0x3f, 0x76, 0x8e, 0x7f, 0xfb, 0xf4,
+  0x5b, 0xf3, 0xf8, 0xf7, 0x4f, 0xe7, 0x17, 0x97, 0x51, 0xff, 0xf2, 0x63, 0xef, 0xd9, 0xde, 0xfc,
+  0xed, 0x85, 0xf3, 0xea, 0xf0, 0xf2, 0xee, 0xf8, 0xcb, 0xdb, 0x97, 0x97, 0xaf, 0x0f, 0x1d, 0xeb,
+  0x13, 0x7d, 0x79, 0x68, 0x9f, 0x1f, 0x39, 0x6f, 0xf0, 0xf9, 0xed, 0x9b, 0xc6, 0x67, 0x12, 0x1c,
+  0x45, 0x17, 0xd3, 0xcf, 0x1f, 0x3f, 0x2d, 0xde, 0x34, 0x7b, 0x7b, 0xde, 0x69, 0x34, 0xaf, 0xb9,
+  0x8b, 0x5e, 0xd4, 0xbf, 0xf5, 0x3e, 0x07, 0x57, 0x47, 0x8e, 0x67, 0x1b, 0x7f, 0xbc, 0x3c, 0xf9,
+  0x8c, 0x47, 0x1f, 0x5f, 0xf5, 0xaf, 0x5e, 0xbd, 0x27, 0xe7, 0xef, 0x5b, 0x46, 0x2b, 0x68, 0x9d,
+  0x9d, 0x35, 0x4f, 0x5e, 0xec, 0x3e, 0xab, 0xdd, 0xb5, 0x5a, 0xb3, 0x3b, 0x7b, 0x77, 0xd4, 0x38,
+  0x3a, 0xac, 0x1f, 0x2d, 0xaa, 0xb7, 0x56, 0x7d, 0x7a, 0x71, 0x64, 0xbc, 0x78, 0x5d, 0x3e, 0x3f,
+  0xfc, 0xe0, 0xf4, 0x1b, 0xf6, 0x9b, 0xf6, 0x15, 0x3e, 0x1f, 0xdc, 0xcd, 0xcf, 0xbc, 0x96, 0xd3,
+  0x3e, 0x6a, 0x86, 0x9f, 0x67, 0x64, 0x78, 0x77, 0xf6, 0xe1, 0xd8, 0x7a, 0x31, 0x36, 0xa8, 0xf1,
+  0x89, 0x8e, 0xe6, 0x77, 0x93, 0xcf, 0x97, 0x56, 0xb9, 0xd6, 0x73, 0xef, 0x66, 0xef, 0xbc, 0x0f,
+  0xd5, 0xbd, 0xcb, 0xbd, 0xe1, 0xd9, 0xc9, 0xf8, 0x6d, 0x2f, 0xbc, 0x6b, 0x7e, 0x8b, 0x76, 0xaf,
+  0xde, 0xcd, 0x83, 0x67, 0x97, 0x67, 0xef, 0xef, 0x9c, 0x61, 0xf5, 0xdd, 0x95, 0x57, 0x9b, 0xda,
+  0x2f, 0xce, 0x83, 0xdf, 0x7a, 0x93, 0xe0, 0xcd, 0xe8, 0xcd, 0xe1, 0xe1, 0xee, 0x62, 0x70, 0x67,
+  0x04, 0xa7, 0x83, 0x46, 0xd3, 0xfe, 0x1c, 0x5e, 0x9c, 0xbd, 0xfd, 0xf6, 0xfb, 0xf8, 0xcb, 0xee,
+  0xdb, 0x5e, 0x73, 0x77, 0x74, 0xbe, 0xd8, 0x3b, 0x2d, 0xf7, 0x87, 0x9f, 0x9f, 0xd5, 0xcf, 0xcf,
+  0x5f, 0x7d, 0xdc, 0xf5, 0xfb, 0x97, 0x63, 0xda, 0x7b, 0x73, 0x1b, 0x7e, 0x7a, 0x63, 0xbd, 0xfb,
+  0xf0, 0xea, 0xc5, 0xed, 0xe8, 0xdb, 0x99, 0x7b, 0x3b, 0xe9, 0xb5, 0x26, 0xef, 0x5f, 0xbe, 0x18,
+  0x94, 0xeb, 0x27, 0xe5, 0xf9, 0x97, 0xe0, 0x62, 0xf6, 0xc7, 0x1f, 0x1f, 0x87, 0x8d, 0x37, 0xe5,
+  0xe3, 0xc6, 0xf1, 0xe0, 0xe8, 0xec, 0xdd, 0xc9, 0xcc, 0xa7, 0x17, 0x5f, 0xca, 0x17, 0xb3, 0xab,
+  0xd1, 0x67, 0xab, 0x3f, 0x1a, 0xe3, 0xf1, 0xdd, 0xef, 0x6f, 0xfb, 0xb3, 0x2f, 0x2f, 0xfe, 0xb0,
+  0x5f, 0xb5, 0xeb, 0xbb, 0xbd, 0xde, 0xde, 0xa7, 0xf9, 0x71, 0xef, 0x7c, 0x7a, 0x31, 0xac, 0x5e,
+  0x18, 0xc1, 0x5b, 0xeb, 0xed, 0x97, 0xf3, 0xfe, 0x08, 0x47, 0x7b, 0xfe, 0x7b, 0x77, 0xd0, 0x3b,
+  0xab, 0x55, 0x6b, 0xb3, 0xfe, 0x97, 0xf2, 0xa2, 0xdc, 0x3e, 0x6c, 0xef, 0x7e, 0x73, 0xef, 0x76,
+  0x47, 0x47, 0x86, 0xeb, 0x9c, 0x34, 0x9f, 0x4d, 0xdd, 0xdd, 0x51, 0xe3, 0xf7, 0xe8, 0xc3, 0xf9,
+  0x97, 0xf2, 0xc7, 0x76, 0x60, 0x8c, 0x17, 0x46, 0xdb, 0x3f, 0x1e, 0x9e, 0x06, 0xd5, 0xc9, 0xc7,
+  0x7e, 0xf4, 0xcc, 0x3f, 0xda, 0x1b, 0x7e, 0x3e, 0x7c, 0x79, 0xbc, 0x30, 0x7c, 0xe3, 0xc5, 0x87,
+  0x2f, 0xb5, 0xf0, 0xe3, 0xd5, 0xed, 0xa2, 0x77, 0x48, 0xc3, 0xf3, 0x57, 0x8d, 0xde, 0xde, 0x9b,
+  0xdd, 0x37, 0x2f, 0xfd, 0x3b, 0xeb, 0x34, 0xb8, 0x9a, 0xbf, 0xfe, 0x86, 0x0d, 0xbc, 0xb0, 0xb0,
+  0x73, 0x1e, 0xbc, 0xf6, 0x9c, 0xe1, 0x0b, 0x77, 0x76, 0xb1, 0x5b, 0xbe, 0x1a, 0x2c, 0x26, 0xef,
+  0xae, 0xbe, 0x7c, 0xa9, 0xce, 0xad, 0x67, 0x2d, 0x3c, 0x6c, 0xbe, 0x3b, 0xba, 0xf8, 0x72, 0x59,
+  0xfe, 0x58, 0xfd, 0xd0, 0x38, 0xa2, 0x43, 0xff, 0xb7, 0xbb, 0xab, 0x93, 0x51, 0x50, 0x7f, 0xf9,
+  0xf1, 0xed, 0xe9, 0x6b, 0xfa, 0x66, 0xfa, 0xfe, 0xad, 0x73, 0xfa, 0xe6, 0xf0, 0xe3, 0x98, 0x34,
+  0xdb, 0xa3, 0x2f, 0x7b, 0xbf, 0x37, 0x1a, 0x7b, 0x84, 0x7e, 0xbb, 0xad, 0x5d, 0xb5, 0x6e, 0xef,
+  0x5e, 0xfb, 0xfd, 0xbd, 0xe8, 0xf6, 0x55, 0x6f, 0x72, 0xf4, 0x69, 0xf6, 0xf9, 0x8c, 0x34, 0xfd,
+  0xe1, 0xd1, 0xb9, 0x35, 0x3f, 0xef, 0x39, 0x33, 0xf2, 0xf2, 0xac, 0x5d, 0x3e, 0x1a, 0x04, 0x9f,
+  0xaa, 0x1f, 0x5a, 0x57, 0xaf, 0xdf, 0x36, 0x9a, 0x77, 0xd5, 0x96, 0x81, 0x4f, 0xac, 0xd1, 0x6f,
+  0xaf, 0x0f, 0x5b, 0x5c, 0x34, 0xdf, 0x7c, 0xbc, 0x6c, 0x1d, 0x07, 0xb7, 0x6f, 0x86, 0xc3, 0xa1,
+  0x69, 0x2a, 0x07, 0x05, 0xb4, 0x1f, 0x5a, 0x01, 0xf5, 0xa3, 0x83, 0x6a, 0x15, 0xfd, 0xdd, 0xa1,
+  0x16, 0x71, 0x43, 0x82, 0x10, 0x7a, 0xf5, 0xfe, 0x12, 0xbd, 0x3a, 0x7e, 0x7f, 0xfc, 0xb1, 0x77,
+  0x8a, 0xce, 0x2e, 0x0f, 0x4f, 0x4f, 0x8e, 0xd0, 0xe9, 0xc9, 0xd1, 0xf1, 0xfb, 0xf3, 0x63, 0xf4,
+  0x89, 0x04, 0x21, 0xf5, 0x5c, 0xd4, 0xd0, 0x50, 0xfd, 0x19, 0x7a, 0x33, 0x71, 0x09, 0xaa, 0x1b,
+  0xc6, 0x6e, 0x21, 0x5b, 0xc1, 0x4b, 0x2f, 0x40, 0xae, 0xe7, 0xa2, 0x57, 0x67, 0xa7, 0x95, 0x69,
+  0x03, 0x4d, 0x42, 0x3c, 0x24, 0x1a, 0xb2, 0xbc, 0xf1, 0x98, 0x04, 0x16, 0xc5, 0x0e, 0x12, 0xa0,
+  0x21, 0x1a, 0x4f, 0xc2, 0x08, 0xf5, 0x09, 0xf2, 0x27, 0x81, 0x35, 0xc2, 0x21, 0xb1, 0x75, 0x74,
+  0xe4, 0xb9, 0x11, 0xb6, 0x22, 0x34, 0xf6, 0x3c, 0x77, 0xcc, 0x15, 0xc6, 0xdf, 0xa9, 0xe5, 0x78,
+  0x13, 0x5b, 0xb7, 0xbc, 0x71, 0xc1, 0x72, 0x70, 0x18, 0x32, 0xa0, 0xc0, 0x73, 0x1c, 0x12, 0x2c,
+  0x67, 0xa1, 0xe9, 0x4e, 0x1c, 0xa7, 0x30, 0xf6, 0x6c, 0xe2, 0x1c, 0x8d, 0x26, 0xee, 0x6d, 0x68,
+  0x7e, 0xbd, 0x2e, 0x84, 0x8b, 0xf0, 0xc4, 0x1d, 0x78, 0xe6, 0x72, 0x55, 0x10, 0xb5, 0x70, 0xb0,
+  0x68, 0x44, 0xc6, 0x44, 0x60, 0x60, 0xea, 0xbe, 0xc7, 0x53, 0x9e, 0xf0, 0xdc, 0x53, 0x0f, 0xdb,
+  0x25, 0x75, 0x69, 0x7b, 0xd6, 0x64, 0x4c, 0xdc, 0x48, 0x8f, 0x68, 0xe4, 0x10, 0x13, 0xfb, 0xfe,
+  0x7b, 0x3c, 0x26, 0x25, 0xb5, 0xac, 0xfc, 0xfb, 0xbf, 0xfd, 0xcb, 0xff, 0x42, 0xfd, 0x05, 0x92,
+  0x55, 0xd9, 0xbf, 0xff, 0xdb, 0x7f, 0xff, 0x57, 0xa5, 0x40, 0x07, 0xa5, 0x19, 0x75, 0x6d, 0x6f,
+  0xa6, 0x3b, 0x9e, 0x85, 0x23, 0xea, 0xb9, 0x3a, 0xa8, 0x2e, 0x9d, 0xba, 0x96, 0x33, 0xb1, 0x49,
+  0x58, 0x52, 0x6a, 0xf5, 0x5d, 0xdd, 0xd0, 0x0d, 0xbd, 0xa6, 0xa8, 0x6a, 0x21, 0x1a, 0xd1, 0x50,
+  0x1f, 0x90, 0xc8, 0x1a, 0xbd, 0x03, 0xa2, 0x5f, 0x7a, 0xc1, 0x29, 0x9d, 0x92, 0x73, 0x12, 0x4c,
+  0x49, 0x50, 0x52, 0xbb, 0xc4, 0x09, 0x09, 0x87, 0x19, 0xe3, 0x5b, 0x72, 0x75, 0x5e, 0x52, 0xbb,
+  0x3c, 0x15, 0xf7, 0x83, 0xcc, 0x90, 0x68, 0xbf, 0xa4, 0x76, 0x1d, 0x12, 0xa1, 0xbe, 0x67, 0x2f,
+  0xcc, 0xe1, 0x89, 0x5d, 0x52, 0xe0, 0x4b, 0x51, 0xbb, 0xf0, 0x47, 0xa7, 0xae, 0x4b, 0x82, 0xd7,
+  0x17, 0xef, 0x4e, 0xcb, 0xe6, 0xcd, 0xfe, 0xa8, 0x76, 0x70, 0x1e, 0xe1, 0xe0, 0x94, 0x0e, 0x47,
+  0x11, 0x82, 0x9e, 0xec, 0x57, 0x47, 0xb5, 0x83, 0x1b, 0xde, 0x8e, 0x60, 0x0a, 0x99, 0xa1, 0x0b,
+  0xf8, 0x8a, 0x1b, 0x64, 0xd9, 0xba, 0x15, 0x10, 0x1c, 0x11, 0xa8, 0x27, 0x9b, 0x3f, 0x24, 0x51,
+  0x0c, 0xfd, 0x7d, 0xfd, 0x5f, 0x6e, 0x52, 0x47, 0x5d, 0x7f, 0x12, 0x21, 0x6a, 0x9b, 0x0a, 0x70,
+  0x42, 0x07, 0xe5, 0x1f, 0x2d, 0x7c, 0x62, 0x2a, 0xd6, 0x88, 0x58, 0xb7, 0x7d, 0x6f, 0xae, 0x20,
+  0x36, 0xf0, 0x99, 0x0c, 0xf8, 0x22, 0xf6, 0xc1, 0xcd, 0x2a, 0x66, 0x96, 0x18, 0x4e, 0x60, 0x0f,
+  0xff, 0x2e, 0xc9, 0x7c, 0xd3, 0x99, 0x84, 0xc4, 0xbc, 0xe4, 0x00, 0xd9, 0xce, 0x4d, 0x42, 0x12,
+  0xbc, 0x9c, 0xb8, 0xe7, 0x24, 0x9a, 0xf8, 0x25, 0x75, 0x55, 0xc0, 0xe1, 0xc2, 0xb5, 0xd0, 0xd6,
+  0x81, 0x5a, 0x02, 0xeb, 0xa1, 0xc3, 0x0e, 0x2b, 0x35, 0xf1, 0x0c, 0xd3, 0xa8, 0xc4, 0xfe, 0xe5,
+  0x48, 0xa5, 0x62, 0x75, 0x4c, 0x43, 0xab, 0xca, 0x1a, 0xd6, 0xbf, 0x85, 0x9e, 0x5b, 0x54, 0x55,
+  0xf6, 0xb7, 0xa4, 0x16, 0x52, 0x44, 0x3d, 0xf4, 0x82, 0xa8, 0x34, 0x98, 0xb8, 0x16, 0x70, 0xae,
+  0x84, 0xb5, 0xbe, 0xba, 0x0c, 0x48, 0x34, 0x09, 0x5c, 0xf4, 0x0e, 0x47, 0x23, 0x1d, 0xf7, 0xc3,
+  0x12, 0xd6, 0x3d, 0xb5, 0x92, 0xa4, 0xfa, 0xba, 0xa7, 0x76, 0x57, 0x6a, 0x77, 0xe0, 0x05, 0x25,
+  0x20, 0x82, 0xf7, 0xf0, 0x4d, 0xe8, 0xb9, 0xc8, 0x1b, 0x48, 0x24, 0xa9, 0xcb, 0x0c, 0x03, 0xb0,
+  0x6d, 0x73, 0xb9, 0x29, 0xa5, 0x08, 0xea, 0xaa, 0x00, 0x35, 0x00, 0x51, 0x30, 0x57, 0xe0, 0xaf,
+  0x9e, 0xce, 0x9d, 0xae, 0x9c, 0xd6, 0xfb, 0x1e, 0x0e, 0x6c, 0x53, 0x21, 0xa1, 0xdf, 0xa8, 0x2b,
+  0x19, 0x50, 0xdd, 0x0d, 0x3e, 0x0c, 0xce, 0xa8, 0x1b, 0x9a, 0x4d, 0x23, 0x5b, 0xe0, 0x53, 0xf7,
+  0x62, 0xe1, 0x13, 0x36, 0x27, 0x63, 0x72, 0x7d, 0xea, 0x9a, 0x46, 0xd7, 0xa7, 0xee, 0x7e, 0x6e,
+  0x1d, 0x50, 0x52, 0x2e, 0xab, 0xf9, 0xf5, 0x7c, 0xf5, 0xa9, 0x7b, 0x6d, 0x32, 0x4e, 0x04, 0xde,
+  0xc4, 0xb5, 0x4b, 0xfc, 0x13, 0xbb, 0xb6, 0x37, 0x2e, 0xa9, 0xbf, 0x36, 0xc4, 0xec, 0x0a, 0x88,
+  0x45, 0xe8, 0x94, 0xbc, 0xc0, 0x11, 0x2e, 0x41, 0x3d, 0x6a, 0x57, 0x08, 0x68, 0x48, 0xa2, 0x13,
+  0x37, 0x22, 0xc1, 0x14, 0x3b, 0x29, 0xcb, 0xd5, 0x25, 0x1d, 0x94, 0xd8, 0xfc, 0x89, 0xc5, 0x4f,
+  0xd5, 0x85, 0x78, 0xa9, 0xcc, 0x2a, 0xe2, 0xba, 0x26, 0x61, 0xe4, 0x90, 0xb8, 0x24, 0xc0, 0x11,
+  0xaf, 0x5e, 0x5d, 0x69, 0x35, 0xc3, 0x30, 0x1e, 0x6a, 0x81, 0xcd, 0xd3, 0xc9, 0x60, 0x40, 0x02,
+  0xf3, 0xab, 0xa1, 0xd5, 0xb4, 0xba, 0xd6, 0xd0, 0x9a, 0xd7, 0x05, 0x9e, 0xf5, 0xd5, 0xb8, 0xa7,
+  0x4f, 0x75, 0x15, 0x14, 0x4c, 0x0a, 0x68, 0x1a, 0xbc, 0x36, 0x0b, 0xbb, 0x53, 0x1c, 0xbe, 0xf7,
+  0x6c, 0xc2, 0xe7, 0x3e, 0xf0, 0x8e, 0x8f, 0x91, 0xc2, 0xa6, 0x64, 0x5a, 0xae, 0x2e, 0x37, 0x59,
+  0x2f, 0x75, 0x6b, 0xdb, 0x00, 0x88, 0x26, 0x21, 0xd5, 0xba, 0x8f, 0xbe, 0x56, 0x3b, 0x97, 0x4b,
+  0x7e, 0x40, 0xc0, 0x3c, 0x3c, 0x04, 0x8a, 0x24, 0x62, 0x34, 0x5e, 0xad, 0xda, 0x5d, 0xad, 0x0a,
+  0xa0, 0xea, 0x96, 0x62, 0xda, 0x95, 0xd2, 0x7c, 0x60, 0xa8, 0xda, 0x5d, 0x15, 0x62, 0xfd, 0x07,
+  0xc3, 0xc3, 0x86, 0x75, 0x16, 0xaa, 0x7c, 0x66, 0x30, 0xb5, 0x37, 0x09, 0x1c, 0x73, 0x43, 0xf1,
+  0xf8, 0x81, 0x17, 0x79, 0x96, 0xe7, 0x98, 0xa6, 0x32, 0x8a, 0x22, 0x3f, 0xec, 0x28, 0xcf, 0x95,
+  0x59, 0x18, 0x2a, 0x1d, 0x65, 0x16, 0x2a, 0x6a, 0xb9, 0xd8, 0xa9, 0x56, 0x8b, 0xe5, 0x0d, 0x6d,
+  0xe5, 0x85, 0x11, 0x18, 0xae, 0xe5, 0x62, 0x75, 0x16, 0x16, 0xbb, 0x96, 0xe7, 0x86, 0x9e, 0x43,
+  0x74, 0xc7, 0x1b, 0x96, 0x14, 0x4e, 0x04, 0x34, 0xa6, 0x68, 0x93, 0x20, 0x56, 0x20, 0x33, 0xae,
+  0x87, 0xaf, 0x48, 0xff, 0xdc, 0xb3, 0x6e, 0x49, 0x54, 0x92, 0x8b, 0xf4, 0x3e, 0x75, 0x71, 0xb0,
+  0xb8, 0x60, 0x2a, 0x0c, 0x07, 0x01, 0x5e, 0xf0, 0xbe, 0x29, 0x09, 0x80, 0xe7, 0x8e, 0x49, 0x08,
+  0xeb, 0xa2, 0x59, 0x22, 0xaa, 0x79, 0x00, 0x1d, 0x24, 0x3a, 0x18, 0xba, 0x88, 0xba, 0x61, 0x84,
+  0x5d, 0x8b, 0x78, 0x03, 0xd4, 0x03, 0xcc, 0x43, 0xce, 0x15, 0x59, 0x7e, 0xa0, 0xe1, 0x4b, 0xea,
+  0x46, 0x7b, 0x0c, 0x40, 0x20, 0xb2, 0x21, 0xff, 0x6b, 0x42, 0x92, 0x51, 0x16, 0x8f, 0x1c, 0x3d,
+  0x94, 0x6d, 0xb5, 0x9e, 0xd6, 0x12, 0xaf, 0xc6, 0xba, 0x3f, 0x09, 0x47, 0x02, 0x46, 0x0f, 0x61,
+  0xe9, 0x2f, 0xd5, 0x55, 0x99, 0xda, 0xda, 0xb5, 0x50, 0xa5, 0x04, 0x64, 0x33, 0x96, 0x54, 0x0b,
+  0x90, 0x41, 0x9d, 0xad, 0xd7, 0xa7, 0x3a, 0xc4, 0x2d, 0x9b, 0xac, 0x58, 0x77, 0x88, 0x3b, 0x8c,
+  0x46, 0xdd, 0x54, 0x07, 0x1e, 0xe6, 0x72, 0xc8, 0x21, 0x2e, 0x5f, 0x28, 0xbd, 0xc1, 0x00, 0xb6,
+  0x4c, 0x8f, 0x69, 0x65, 0x29, 0x57, 0x08, 0x93, 0xba, 0xc4, 0x60, 0x35, 0x5e, 0x85, 0xda, 0xe5,
+  0x7f, 0xd7, 0x08, 0x89, 0x97, 0xa2, 0x8c, 0x2d, 0xd2, 0x4d, 0x14, 0x2c, 0x58, 0x1a, 0xdd, 0x28,
+  0x58, 0x2c, 0x59, 0xea, 0xcd, 0xf9, 0x87, 0xf7, 0xba, 0x0f, 0x9b, 0xb8, 0x12, 0x5b, 0x7a, 0xc9,
+  0x3c, 0x7a, 0x41, 0x2c, 0xcf, 0x86, 0xb5, 0x45, 0xb7, 0xd9, 0x57, 0x49, 0x26, 0x42, 0x55, 0xbb,
+  0x2b, 0x0b, 0xc3, 0xba, 0x42, 0x82, 0xc0, 0x0b, 0xd4, 0x65, 0x2c, 0xa6, 0x2c, 0x99, 0x08, 0x2a,
+  0x47, 0x61, 0x0d, 0x22, 0x56, 0xa2, 0x68, 0x1c, 0xbe, 0xbb, 0x02, 0x3d, 0xc2, 0xb4, 0xa1, 0xac,
+  0x23, 0x61, 0x15, 0x10, 0x3a, 0x32, 0x7f, 0x4c, 0x1b, 0x62, 0x4c, 0x05, 0xfc, 0x27, 0xec, 0x4c,
+  0x48, 0x98, 0x48, 0xdd, 0xd6, 0x49, 0xcc, 0xf3, 0x1f, 0xee, 0x7b, 0x52, 0x51, 0xa6, 0x6f, 0x29,
+  0x4e, 0x7e, 0x2f, 0x37, 0xba, 0xa7, 0xa5, 0x04, 0x3d, 0xdc, 0xcb, 0x74, 0x1a, 0x5a, 0x8e, 0x17,
+  0xc6, 0x93, 0x30, 0x33, 0xed, 0xaf, 0xce, 0x11, 0x2b, 0x63, 0xbb, 0xd5, 0x80, 0x44, 0xc1, 0x42,
+  0xd1, 0x88, 0xda, 0x0d, 0x49, 0x74, 0x41, 0xc7, 0xc4, 0x9b, 0x44, 0x25, 0x4e, 0x89, 0x56, 0x6b,
+  0x81, 0xb2, 0x4a, 0x94, 0x02, 0x90, 0x2c, 0x37, 0xe0, 0xf9, 0xc4, 0xdd, 0x52, 0x3f, 0x14, 0xb1,
+  0x4a, 0x65, 0x78, 0xd6, 0x99, 0x2d, 0x08, 0x71, 0x7f, 0x59, 0x1f, 0x36, 0x3a, 0xb6, 0x14, 0xfd,
+  0xd6, 0xc1, 0x74, 0xda, 0xd9, 0xf9, 0x0a, 0xbb, 0xfe, 0xb1, 0x67, 0x2b, 0x9a, 0x02, 0x83, 0xc3,
+  0xbf, 0xc2, 0x45, 0x08, 0x1f, 0xd7, 0xa9, 0x69, 0x96, 0x60, 0xa8, 0x7c, 0x16, 0x0e, 0x40, 0xc3,
+  0x9b, 0x03, 0xec, 0x84, 0x64, 0xcd, 0xbe, 0x90, 0xa7, 0x89, 0x64, 0x50, 0x41, 0xb3, 0x3c, 0x47,
+  0xa7, 0xb6, 0x69, 0xb2, 0xfa, 0xa8, 0xad, 0x16, 0x78, 0x45, 0x51, 0x30, 0x21, 0x7c, 0x48, 0x9e,
+  0xb0, 0x8c, 0x9d, 0x1d, 0x06, 0xe0, 0x6d, 0x35, 0x4d, 0xc4, 0x18, 0x31, 0xe9, 0x29, 0x64, 0x18,
+  0x00, 0x3e, 0x10, 0xa0, 0x41, 0x50, 0x83, 0x9d, 0x80, 0x60, 0x7b, 0x81, 0xe2, 0xc5, 0xd8, 0x56,
+  0x34, 0x19, 0x17, 0xc8, 0x7a, 0xc2, 0xa6, 0xbf, 0x4e, 0x43, 0xae, 0x06, 0x58, 0x71, 0x56, 0x98,
+  0x25, 0x03, 0x21, 0xaf, 0x49, 0x9b, 0x4c, 0x11, 0xd3, 0xdf, 0xc8, 0xf5, 0x22, 0x44, 0xe6, 0x3e,
+  0xb1, 0xe4, 0x86, 0x60, 0x10, 0xfe, 0x98, 0x90, 0x30, 0x62, 0x83, 0x00, 0x1b, 0x1c, 0xec, 0xda,
+  0x8c, 0x21, 0xdf, 0x63, 0x0e, 0xaf, 0x12, 0x72, 0x73, 0xd6, 0xb8, 0x80, 0xfc, 0xc1, 0x27, 0x4b,
+  0x18, 0x05, 0xd4, 0x1d, 0xd2, 0xc1, 0x22, 0x69, 0x27, 0x59, 0x4c, 0x42, 0xe2, 0xda, 0xa5, 0x80,
+  0xfc, 0x21, 0x8b, 0x85, 0x98, 0xa5, 0x58, 0x5e, 0x42, 0xa0, 0x6b, 0x11, 0x9a, 0x42, 0xc9, 0x39,
+  0xbd, 0x03, 0x9b, 0xac, 0xc6, 0x0c, 0x91, 0xa6, 0xd6, 0xd4, 0x6a, 0x75, 0xae, 0xa7, 0x40, 0xe7,
+  0x33, 0xf5, 0x09, 0x9c, 0xf9, 0x44, 0xc9, 0x2c, 0x53, 0x45, 0x57, 0xb2, 0x15, 0x65, 0x85, 0x5a,
+  0xeb, 0xce, 0x46, 0xd4, 0x21, 0x25, 0xa1, 0x14, 0x9b, 0xfb, 0x26, 0xd4, 0xa3, 0xf7, 0x17, 0x11,
+  0x39, 0x65, 0x9a, 0x91, 0xcb, 0xd6, 0x08, 0xbb, 0xb6, 0x43, 0x78, 0xd9, 0x90, 0x44, 0xa0, 0xa1,
+  0x6b, 0x6d, 0x81, 0xa4, 0x81, 0xa4, 0xf0, 0x06, 0x22, 0x3c, 0xcc, 0xc0, 0xec, 0xc5, 0xf5, 0xd6,
+  0x79, 0x79, 0xe0, 0xcd, 0xde, 0x07, 0xf9, 0x10, 0x8d, 0x54, 0x31, 0x37, 0x61, 0x89, 0x89, 0xf0,
+  0xf0, 0xc0, 0x4c, 0x7b, 0x2c, 0xf4, 0xf4, 0x9f, 0x7f, 0x0a, 0xa0, 0xb4, 0xe4, 0x6b, 0x84, 0x87,
+  0xd7, 0x07, 0x1b, 0x54, 0x6f, 0x48, 0x43, 0x86, 0xbd, 0x88, 0xba, 0x53, 0xec, 0x50, 0xd0, 0x0f,
+  0x96, 0x17, 0xd8, 0x8a, 0xc6, 0x3b, 0xa8, 0x45, 0x78, 0x98, 0xac, 0x13, 0xfd, 0x80, 0xe0, 0xdb,
+  0x2e, 0xb7, 0xb2, 0x59, 0x73, 0x82, 0x2c, 0x58, 0xa1, 0x59, 0x3a, 0xb7, 0x23, 0xea, 0x13, 0xd3,
+  0xe8, 0xc6, 0xba, 0x98, 0x41, 0xd7, 0xee, 0x83, 0xce, 0x82, 0xd6, 0x73, 0x40, 0xd7, 0xf9, 0x9c,
+  0x41, 0x68, 0xac, 0x21, 0x9c, 0xb8, 0x51, 0xa3, 0x7e, 0x0f, 0x7c, 0x73, 0x0d, 0xfe, 0xa5, 0xe3,
+  0xe1, 0x7c, 0x0c, 0x0e, 0xb7, 0x54, 0xe6, 0x4a, 0x67, 0x7b, 0xe5, 0x9a, 0xb2, 0xc8, 0x2f, 0x2e,
+  0x37, 0x63, 0x80, 0xbb, 0x2d, 0x00, 0x7b, 0x1c, 0x60, 0x95, 0x8c, 0xfa, 0xda, 0x88, 0x72, 0x99,
+  0xc6, 0x01, 0x05, 0x4f, 0xa7, 0x99, 0x51, 0x39, 0x03, 0xea, 0xda, 0x9f, 0x70, 0x70, 0xb8, 0x78,
+  0xcd, 0x06, 0xad, 0xc4, 0xc7, 0x8e, 0x19, 0x26, 0x31, 0x02, 0x97, 0x5a, 0x9f, 0xda, 0xd4, 0x36,
+  0xe3, 0x3c, 0xdd, 0xa7, 0x76, 0x59, 0xd1, 0x95, 0x72, 0x92, 0x41, 0x6d, 0xc0, 0x61, 0x42, 0xf9,
+  0xc4, 0xbc, 0x3c, 0x79, 0x7f, 0xb1, 0xf7, 0x8f, 0x77, 0xbd, 0xcf, 0x4c, 0x0d, 0x3c, 0x81, 0xb9,
+  0xf2, 0x95, 0x55, 0x70, 0xad, 0x4a, 0xdf, 0xe6, 0x52, 0x61, 0x84, 0x2a, 0x9d, 0xac, 0x86, 0x4a,
+  0xea, 0x64, 0xa5, 0xea, 0xf3, 0xaf, 0xba, 0xae, 0x67, 0xf3, 0xae, 0x3b, 0x5f, 0xaf, 0xf9, 0xb6,
+  0x4c, 0x54, 0xc5, 0xb3, 0xbf, 0xb2, 0xe6, 0xaf, 0x79, 0xf7, 0x63, 0x55, 0x96, 0xdb, 0x20, 0xfb,
+  0xb3, 0x4a, 0x16, 0xc1, 0x3c, 0x3d, 0xb8, 0x91, 0x07, 0x5d, 0xa1, 0xe1, 0x87, 0xfe, 0x37, 0x62,
+  0x45, 0xb1, 0x16, 0x8d, 0xd7, 0x86, 0x5b, 0xb2, 0x00, 0xa5, 0xcc, 0x0b, 0xf5, 0x5b, 0xb2, 0x08,
+  0x63, 0x88, 0x44, 0xe2, 0xd9, 0x9a, 0xf0, 0xf5, 0x96, 0x2c, 0xae, 0x0b, 0x29, 0x3f, 0x6f, 0xc9,
+  0x42, 0x0f, 0x7d, 0x87, 0x46, 0x25, 0x45, 0x57, 0xd4, 0xc2, 0x83, 0xe3, 0x54, 0x62, 0x68, 0x5f,
+  0x8d, 0x6b, 0x8d, 0x7f, 0xd4, 0xae, 0x73, 0x86, 0x2a, 0x4e, 0x1d, 0x31, 0x67, 0xc1, 0x14, 0x07,
+  0xa0, 0x98, 0x2f, 0x3c, 0x96, 0x4c, 0x41, 0xbb, 0x19, 0xb0, 0x0c, 0x0b, 0x38, 0xdf, 0x53, 0x33,
+  0xe8, 0x96, 0x2c, 0x4c, 0x53, 0x11, 0x1b, 0x24, 0x45, 0xac, 0x1d, 0xf1, 0xfe, 0x58, 0x30, 0x1b,
+  0xfe, 0x2b, 0x08, 0x85, 0x9f, 0x6e, 0x83, 0x98, 0x12, 0x4d, 0xfd, 0x54, 0x25, 0xb6, 0x45, 0x0a,
+  0x23, 0x94, 0x08, 0x88, 0x59, 0x6f, 0xb5, 0xba, 0x69, 0x5e, 0xad, 0x2d, 0x32, 0xdb, 0xb0, 0xa1,
+  0xaa, 0xd4, 0xba, 0xf1, 0xde, 0x11, 0x81, 0xdd, 0x6e, 0x25, 0x2e, 0x81, 0xc4, 0x3f, 0x35, 0x24,
+  0xd1, 0xb1, 0x43, 0xe0, 0xf3, 0x70, 0xc1, 0x20, 0xba, 0xab, 0x42, 0x82, 0x63, 0x1d, 0x97, 0xc8,
+  0x26, 0x0a, 0xf7, 0x76, 0x08, 0xac, 0x12, 0xc9, 0x62, 0x1c, 0x1d, 0x97, 0x7c, 0x4d, 0xf0, 0xd1,
+  0x35, 0xb7, 0xe3, 0xf8, 0x3a, 0xf6, 0x7d, 0xe2, 0xda, 0x47, 0x23, 0xea, 0xd8, 0x25, 0x57, 0xed,
+  0x8a, 0x56, 0x5c, 0xb9, 0x36, 0x1a, 0x9e, 0x7a, 0x33, 0x12, 0x1c, 0xe1, 0x90, 0x94, 0xc2, 0x84,
+  0x90, 0x50, 0x8f, 0xbc, 0x34, 0x5f, 0x35, 0xcd, 0x50, 0x46, 0x71, 0x69, 0x74, 0x84, 0x7d, 0x00,
+  0x07, 0x3d, 0xb3, 0xf0, 0x61, 0x0b, 0x14, 0x3e, 0x31, 0xcd, 0x22, 0x5f, 0xfa, 0x8a, 0x62, 0x59,
+  0x2c, 0x16, 0xc5, 0xc2, 0x18, 0x4e, 0x9c, 0xc8, 0x54, 0x94, 0xc4, 0x4a, 0xa1, 0xa6, 0xd1, 0xa5,
+  0xfb, 0xb1, 0x8e, 0xef, 0xd2, 0x72, 0x99, 0x0b, 0x2e, 0x68, 0xda, 0x02, 0x07, 0x2f, 0x9b, 0xa1,
+  0x0e, 0xe7, 0x26, 0xbd, 0xa8, 0x44, 0x55, 0x3d, 0xf2, 0x2e, 0x7d, 0x3f, 0x26, 0x26, 0xd1, 0x70,
+  0x4f, 0x32, 0xb4, 0xa7, 0xe0, 0xea, 0xce, 0x4e, 0x7e, 0x49, 0xa5, 0xa6, 0xaa, 0x69, 0x03, 0x0a,
+  0x52, 0xca, 0x12, 0x56, 0x52, 0xad, 0x94, 0x67, 0x9a, 0xc5, 0x4a, 0xf1, 0xcf, 0x3f, 0xb3, 0x39,
+  0xff, 0x28, 0x66, 0xea, 0xe0, 0x5e, 0xc0, 0x1c, 0xaa, 0xd9, 0xfc, 0x64, 0xdc, 0xe4, 0x85, 0x59,
+  0xae, 0x8b, 0x39, 0x3a, 0xc5, 0xdc, 0x2e, 0x5b, 0xd7, 0x2e, 0x8e, 0x2a, 0x98, 0x88, 0xb8, 0x81,
+  0xc7, 0x26, 0x90, 0x63, 0x9a, 0xcc, 0x6c, 0x4d, 0x86, 0x89, 0x97, 0xc5, 0xed, 0x94, 0xe2, 0xb1,
+  0xe0, 0x90, 0xc5, 0xb8, 0xb5, 0xa2, 0xfa, 0xe7, 0x9f, 0x6b, 0x45, 0x1e, 0x6b, 0xbd, 0xa8, 0x66,
+  0x04, 0x8b, 0xb9, 0xc2, 0x7a, 0xae, 0x7d, 0x3c, 0x27, 0xd6, 0x24, 0x22, 0xb0, 0x51, 0xd6, 0x60,
+  0xaf, 0xad, 0xf9, 0x38, 0x18, 0x87, 0x9a, 0x85, 0x1d, 0xa7, 0x8f, 0xad, 0x5b, 0xf6, 0x71, 0xcc,
+  0x8c, 0x5f, 0x46, 0x4c, 0x61, 0xc9, 0x10, 0x0b, 0x00, 0x5f, 0x66, 0xf0, 0xcb, 0x31, 0x89, 0x46,
+  0x9e, 0xdd, 0x29, 0x0e, 0x49, 0x54, 0x5c, 0xa9, 0xe0, 0x86, 0x74, 0x4b, 0x01, 0x09, 0xf9, 0xf6,
+  0xf9, 0x49, 0x40, 0x42, 0xdd, 0xbb, 0x65, 0xdd, 0x4e, 0xaa, 0x52, 0x93, 0xaf, 0x92, 0xf2, 0x92,
+  0x3a, 0x04, 0x29, 0xac, 0xaa, 0xb2, 0xc2, 0xec, 0x39, 0x66, 0x90, 0x2a, 0xb1, 0x00, 0x2b, 0x4a,
+  0x86, 0xb5, 0x7a, 0x44, 0xe6, 0x51, 0x09, 0xdc, 0x6c, 0xbc, 0x21, 0x48, 0x82, 0x49, 0x2e, 0xc8,
+  0x2d, 0x71, 0xea, 0x21, 0x97, 0xc1, 0xf0, 0xcd, 0x4b, 0xe2, 0xef, 0x11, 0xbb, 0x98, 0x2d, 0xb4,
+  0x70, 0x5c, 0x85, 0x25, 0xd0, 0x90, 0x44, 0x11, 0x75, 0x87, 0x82, 0x34, 0x35, 0xe3, 0x7c, 0x88,
+  0x37, 0x6e, 0x2a, 0x68, 0x41, 0xec, 0x38, 0x8b, 0x52, 0x09, 0xf6, 0x05, 0x2b, 0xb5, 0xbb, 0xda,
+  0xaf, 0x0a, 0xe7, 0x7d, 0xe2, 0xc5, 0x2f, 0xfc, 0xd3, 0xb9, 0xf1, 0x99, 0xff, 0x78, 0x29, 0xfb,
+  0x60, 0x97, 0x92, 0x17, 0x3b, 0xeb, 0x22, 0xf6, 0x0f, 0xf6, 0x1d, 0xdc, 0x27, 0xce, 0x01, 0x43,
+  0xda, 0xaf, 0xf2, 0x04, 0xfa, 0x6f, 0x2e, 0x42, 0x08, 0xed, 0x87, 0xc4, 0x21, 0x56, 0x24, 0x0e,
+  0x25, 0x99, 0x7f, 0xba, 0xc2, 0xb3, 0x14, 0xe6, 0x55, 0xce, 0xe6, 0x78, 0xae, 0x35, 0xc2, 0xee,
+  0x10, 0xdc, 0xcb, 0xa9, 0xd7, 0x8a, 0x3b, 0xb5, 0xc3, 0xd8, 0xa9, 0xcd, 0x14, 0x3d, 0x5f, 0x0d,
+  0x94, 0x03, 0xde, 0x08, 0x42, 0xfb, 0x9e, 0xcf, 0x44, 0x9a, 0xaf, 0x6a, 0x4a, 0x18, 0xe1, 0x00,
+  0x4e, 0x23, 0x15, 0xe6, 0x5a, 0x3f, 0xc4, 0x21, 0xd9, 0xaf, 0x72, 0x88, 0xfb, 0x30, 0x1c, 0x70,
+  0xc1, 0x2b, 0xa9, 0x37, 0xfe, 0x21, 0x9c, 0x99, 0x43, 0x6c, 0xe5, 0xe0, 0xea, 0xf4, 0xf8, 0xc5,
+  0x43, 0x90, 0xc3, 0x00, 0x2f, 0x08, 0x71, 0x95, 0x83, 0x57, 0xfc, 0xe3, 0x21, 0x78, 0x9b, 0x4c,
+  0x95, 0x83, 0x17, 0x64, 0xfa, 0x10, 0x9c, 0xa0, 0xf8, 0x51, 0xd4, 0xda, 0x38, 0xb8, 0x85, 0x4a,
+  0x71, 0x34, 0x82, 0x1e, 0x3e, 0x04, 0xde, 0x07, 0x9b, 0xe4, 0xe0, 0xd0, 0x99, 0x3c, 0xc8, 0x3a,
+  0x9f, 0xba, 0xb7, 0xca, 0xc1, 0x19, 0x75, 0x6f, 0x1f, 0x64, 0xb2, 0x8f, 0x2d, 0x18, 0x13, 0xf8,
+  0xf3, 0x10, 0xac, 0xbb, 0xc0, 0xae, 0x72, 0xf0, 0x7e, 0x81, 0x73, 0x98, 0x55, 0xe5, 0xf2, 0x72,
+  0xb0, 0x1f, 0xfa, 0xd8, 0x3d, 0x40, 0x7f, 0x42, 0x0e, 0x7c, 0x89, 0xd3, 0x0a, 0x7e, 0x40, 0xd1,
+  0x9f, 0x44, 0x11, 0x1c, 0x57, 0x88, 0xfa, 0x98, 0x45, 0x41, 0xad, 0xcb, 0x13, 0x2e, 0x77, 0x7d,
+  0x29, 0x0d, 0xbe, 0x06, 0x6a, 0xdd, 0xc2, 0xe9, 0x3a, 0x33, 0x15, 0x60, 0xf7, 0x5f, 0x2a, 0x3e,
+  0x5d, 0xe6, 0x6e, 0x15, 0x03, 0xe2, 0x3b, 0xd8, 0x22, 0x25, 0xa5, 0xea, 0x92, 0xd9, 0x84, 0x2a,
+  0x9a, 0xa2, 0xa8, 0xab, 0x22, 0xd2, 0x8a, 0xff, 0x08, 0x89, 0x33, 0x28, 0xaa, 0x5d, 0xe5, 0x60,
+  0xbf, 0xca, 0xe8, 0x90, 0xe8, 0xf5, 0x0f, 0x6e, 0x56, 0x89, 0x00, 0x93, 0xb5, 0xcd, 0x4b, 0x5c,
+  0x00, 0xee, 0x03, 0x8d, 0x1d, 0x11, 0x9c, 0x47, 0x5e, 0x80, 0x87, 0x4c, 0xe6, 0x4f, 0x22, 0x32,
+  0x2e, 0xf1, 0x59, 0xc2, 0xca, 0x93, 0xd5, 0x3f, 0xfe, 0x10, 0xeb, 0xbf, 0xce, 0xe6, 0x2d, 0x1c,
+  0x88, 0x99, 0x64, 0x95, 0x1e, 0x00, 0x31, 0x9b, 0x81, 0x98, 0x99, 0x5a, 0x87, 0xd9, 0x5a, 0xd5,
+  0x2e, 0xd9, 0xd9, 0x51, 0x40, 0xb3, 0x2b, 0x4f, 0x4c, 0xb2, 0xb3, 0xc3, 0xdd, 0xed, 0x99, 0x79,
+  0xa9, 0xf2, 0xf9, 0x66, 0x12, 0x75, 0xb5, 0x2a, 0xc8, 0xea, 0x2d, 0x5a, 0x38, 0xe4, 0xa0, 0xd0,
+  0x09, 0x3c, 0x2f, 0xd2, 0xd8, 0xbf, 0x7a, 0x3c, 0xf3, 0x96, 0x95, 0x4a, 0x7f, 0x58, 0xb1, 0x3c,
+  0xc7, 0x0b, 0x3a, 0xbf, 0xd4, 0xea, 0xf0, 0xbf, 0x6e, 0xa5, 0x02, 0x4a, 0x39, 0xce, 0xb4, 0x06,
+  0xb6, 0xf1, 0xac, 0x0d, 0x99, 0xa3, 0x24, 0xab, 0xbe, 0x4b, 0xda, 0x90, 0xb5, 0x99, 0xd3, 0xf7,
+  0x02, 0x9b, 0x04, 0x49, 0xb6, 0x8d, 0xed, 0x36, 0xee, 0x56, 0x04, 0x81, 0x49, 0x3b, 0x78, 0x0f,
+  0x0f, 0x06, 0xdd, 0x4a, 0x85, 0xa9, 0xa0, 0x38, 0x77, 0xaf, 0x61, 0xb5, 0x48, 0xbf, 0x5b, 0xa9,
+  0x30, 0x05, 0xe9, 0x26, 0xd0, 0xad, 0x67, 0x7b, 0xb8, 0xd9, 0xe8, 0x56, 0x2a, 0x03, 0xcf, 0x8d,
+  0x2a, 0x21, 0xbd, 0x23, 0x9d, 0x5a, 0xd3, 0x9f, 0xaf, 0xd2, 0x8e, 0xb0, 0xe9, 0x25, 0xf7, 0xc4,
+  0xa1, 0x2e, 0xc1, 0x41, 0x65, 0x18, 0x60, 0x9b, 0x82, 0xd1, 0x15, 0x79, 0xa8, 0xef, 0x45, 0x91,
+  0x37, 0xd6, 0xd0, 0x2f, 0x83, 0x41, 0x9f, 0x34, 0x1a, 0xc8, 0xf8, 0x9b, 0x86, 0x7e, 0xe9, 0xb7,
+  0x8d, 0x41, 0xbb, 0x8e, 0x6a, 0x86, 0xf1, 0x37, 0x75, 0xad, 0xdb, 0x46, 0x03, 0xfe, 0x97, 0xe9,
+  0x36, 0x87, 0xde, 0xab, 0xc9, 0x1d, 0xe7, 0x79, 0x1b, 0x1d, 0x6f, 0x33, 0x66, 0x64, 0x7b, 0xfd,
+  0x92, 0xfd, 0xb7, 0xd1, 0xeb, 0x36, 0xe9, 0xef, 0xad, 0xf5, 0xce, 0x48, 0x7a, 0x07, 0xaa, 0xeb,
+  0xe1, 0x21, 0x1a, 0x30, 0x66, 0x26, 0x84, 0x06, 0xc3, 0x7e, 0xa9, 0xde, 0x6a, 0x69, 0xa8, 0xd6,
+  0x36, 0x34, 0x64, 0xa8, 0x12, 0xbd, 0x39, 0x45, 0x19, 0xc2, 0x73, 0xca, 0x33, 0x9d, 0xc8, 0x29,
+  0xcf, 0xa5, 0x5b, 0x28, 0xd2, 0xc7, 0x8e, 0xc9, 0xb3, 0xdd, 0x67, 0xf5, 0x67, 0x4d, 0x3e, 0x26,
+  0xcd, 0xdd, 0x66, 0xab, 0x99, 0x3f, 0x26, 0x83, 0xfe, 0xa0, 0x39, 0x68, 0x66, 0xc6, 0xa4, 0x5e,
+  0x6b, 0xee, 0xd5, 0xfb, 0xf2, 0x88, 0x24, 0x39, 0xd9, 0x11, 0x49, 0xb2, 0xb3, 0x83, 0x92, 0x64,
+  0x67, 0xbb, 0x21, 0x67, 0x54, 0xc2, 0xce, 0x5e, 0xd2, 0x31, 0x9b, 0x4c, 0xff, 0x49, 0xa7, 0x4c,
+  0x3a, 0x38, 0x1b, 0xd3, 0x25, 0x16, 0x20, 0xa9, 0x0b, 0xb5, 0x7a, 0x43, 0x26, 0xd6, 0x60, 0xff,
+  0x65, 0x7a, 0xd4, 0xb6, 0xdb, 0x7b, 0x6d, 0xcc, 0x66, 0x43, 0x96, 0xd4, 0xb8, 0x20, 0xe6, 0x18,
+  0x0e, 0x6e, 0x1f, 0x66, 0x59, 0xfb, 0x59, 0xdb, 0xde, 0xb5, 0x05, 0x0a, 0xac, 0x69, 0x19, 0x14,
+  0xa3, 0xd5, 0x78, 0xd6, 0x3e, 0x5c, 0x43, 0x39, 0xde, 0x7d, 0x59, 0x7b, 0x79, 0xfc, 0xf8, 0x19,
+  0x9a, 0xa5, 0x32, 0x06, 0x15, 0x4d, 0xc2, 0xe2, 0xb8, 0xc6, 0x12, 0x0b, 0xdb, 0xcd, 0xb5, 0x26,
+  0xc9, 0x6e, 0xab, 0xb9, 0x67, 0x6c, 0xd4, 0xc5, 0xb3, 0x63, 0x85, 0x04, 0xab, 0x66, 0x96, 0x7a,
+  0xce, 0x39, 0x59, 0x90, 0xeb, 0x7d, 0xbb, 0xc6, 0xc6, 0x7e, 0x58, 0x99, 0x04, 0x4e, 0x67, 0x12,
+  0x38, 0xa5, 0x22, 0xbb, 0xa5, 0x05, 0xf7, 0xcc, 0x28, 0x5f, 0xc7, 0xaa, 0x9e, 0x15, 0x91, 0xa8,
+  0x12, 0x46, 0x01, 0xc1, 0xe3, 0xf8, 0xd2, 0x56, 0x31, 0x99, 0x72, 0x03, 0x3c, 0xa6, 0xce, 0xa2,
+  0x53, 0x3c, 0x0b, 0x48, 0x18, 0x22, 0x30, 0x15, 0x22, 0x54, 0x3f, 0x2b, 0x6a, 0xd6, 0x24, 0x08,
+  0xe9, 0x94, 0x08, 0x6a, 0x60, 0x79, 0xce, 0x12, 0x53, 0x6b, 0x34, 0xda, 0xbb, 0xb9, 0x0a, 0xe4,
+  0x27, 0x10, 0x73, 0xe4, 0x8d, 0xa9, 0x85, 0xde, 0x93, 0x09, 0x49, 0x09, 0x81, 0x95, 0x88, 0x2d,
+  0x40, 0x99, 0xdb, 0x32, 0xec, 0x72, 0x08, 0x5b, 0x76, 0x63, 0xd3, 0x8f, 0x19, 0xcf, 0x03, 0x2a,
+  0x72, 0x11, 0x5c, 0x30, 0x70, 0xf1, 0x54, 0xff, 0x16, 0xb2, 0x02, 0x1b, 0x47, 0xa2, 0xa0, 0x6e,
+  0xd4, 0x9b, 0xb5, 0x7a, 0xed, 0x19, 0xcb, 0x0e, 0x88, 0xef, 0xf1, 0x6c, 0x7e, 0x56, 0x59, 0xad,
+  0x0e, 0x69, 0x34, 0x9a, 0xf4, 0xc1, 0x46, 0xae, 0x92, 0x99, 0x37, 0xa3, 0xd5, 0xb8, 0x7e, 0x0d,
+  0x85, 0x93, 0xfe, 0x98, 0xc2, 0x91, 0x15, 0xd8, 0xae, 0x21, 0x8a, 0x3c, 0xe6, 0x8d, 0x47, 0xac,
+  0x4d, 0x1c, 0xa2, 0xb3, 0x8f, 0x2c, 0x2f, 0x8b, 0xc5, 0x5a, 0xe9, 0xb1, 0xcb, 0x78, 0xe1, 0x63,
+  0x5a, 0xa9, 0xc2, 0x54, 0xa4, 0x51, 0x58, 0x05, 0xfa, 0x19, 0xf2, 0x91, 0xe7, 0x2f, 0x02, 0x76,
+  0x6b, 0xe4, 0xff, 0xfc, 0x4f, 0x46, 0x3c, 0x7a, 0xc5, 0x90, 0x93, 0x8e, 0xa3, 0x23, 0x86, 0x82,
+  0x44, 0x2b, 0xff, 0x4c, 0xbb, 0x90, 0x42, 0xf5, 0xd7, 0x5f, 0x0b, 0xe8, 0x57, 0xd8, 0x87, 0xb0,
+  0x01, 0x43, 0x92, 0xc8, 0xf0, 0x0b, 0x27, 0x50, 0x7a, 0x16, 0xd0, 0x29, 0x0c, 0x9f, 0xcf, 0xb6,
+  0x9f, 0x21, 0xc2, 0x01, 0x41, 0x7e, 0x40, 0x06, 0x74, 0x4e, 0x6c, 0x34, 0xa3, 0xd1, 0x08, 0x61,
+  0x54, 0xfc, 0xa5, 0x88, 0x42, 0x18, 0x10, 0xb2, 0x40, 0x33, 0xea, 0x38, 0x40, 0xc7, 0x98, 0xba,
+  0x74, 0x4c, 0xef, 0x88, 0x0d, 0x97, 0x86, 0xa2, 0x11, 0x41, 0xfd, 0x09, 0x78, 0x18, 0x83, 0x02,
+  0xfa, 0xb5, 0x2a, 0x36, 0x40, 0xe2, 0x9e, 0x0a, 0x5a, 0x16, 0x0a, 0x08, 0xc9, 0xfb, 0x20, 0xb4,
+  0x2c, 0x80, 0x54, 0xc4, 0x97, 0x7b, 0x90, 0x89, 0xe4, 0xeb, 0x3d, 0x05, 0x56, 0xc8, 0xae, 0xd1,
+  0xb0, 0x7a, 0x4e, 0x69, 0x18, 0xa1, 0xb2, 0x89, 0x14, 0xbb, 0x32, 0x70, 0xc8, 0x1c, 0xc1, 0x3f,
+  0x30, 0x39, 0x26, 0x63, 0x57, 0x91, 0x81, 0x93, 0x0d, 0x15, 0x00, 0xdf, 0xec, 0x3f, 0xa9, 0x54,
+  0x50, 0xcf, 0x21, 0x41, 0xc4, 0xfa, 0x84, 0x51, 0x08, 0x97, 0x32, 0x71, 0xc4, 0x68, 0x8d, 0x3c,
+  0x1f, 0xe1, 0xbe, 0x37, 0x25, 0x2c, 0xc5, 0x98, 0xe3, 0xe2, 0x29, 0x1d, 0x72, 0x1b, 0x15, 0xf5,
+  0x1c, 0xc7, 0x9b, 0xb1, 0xa2, 0x11, 0x61, 0xc2, 0x01, 0x92, 0x37, 0xf7, 0xe1, 0xac, 0x6c, 0x4a,
+  0x82, 0x88, 0xc2, 0x5e, 0x77, 0x01, 0x99, 0x03, 0x1a, 0x21, 0xec, 0x2e, 0xe2, 0x8b, 0xa0, 0xa8,
+  0xc0, 0xc5, 0x1d, 0x79, 0x01, 0x0a, 0x47, 0x01, 0x5c, 0xf8, 0xa4, 0x70, 0xaa, 0x44, 0x02, 0x82,
+  0x68, 0x08, 0xbb, 0xf2, 0x11, 0xec, 0x85, 0x23, 0x0f, 0x85, 0x23, 0x6f, 0x86, 0xa8, 0xcb, 0xda,
+  0xc0, 0x12, 0x91, 0x95, 0xca, 0x41, 0x01, 0xa1, 0x7d, 0x9b, 0x4e, 0x99, 0x85, 0xcd, 0x8b, 0x92,
+  0xeb, 0x41, 0x5c, 0x2d, 0x10, 0xb8, 0x7f, 0x81, 0xfa, 0xc3, 0x0a, 0x3f, 0x30, 0x3b, 0x60, 0x8d,
+  0xb2, 0xee, 0x9e, 0x81, 0x55, 0x9d, 0xd6, 0x89, 0x00, 0x1e, 0x5a, 0xc1, 0xc8, 0xc7, 0xb6, 0x4d,
+  0x6c, 0x04, 0xf5, 0xb2, 0x81, 0xc4, 0x11, 0x9a, 0x8d, 0x88, 0x8b, 0x68, 0x54, 0x64, 0x74, 0xc1,
+  0x90, 0x87, 0xd0, 0x83, 0x14, 0x99, 0xd1, 0x13, 0x8f, 0xf6, 0x88, 0xda, 0x36, 0x71, 0x39, 0x75,
+  0xa2, 0x31, 0x46, 0xa4, 0x20, 0xcc, 0xc7, 0x95, 0x06, 0x92, 0xa8, 0x53, 0x0e, 0x42, 0x6f, 0x2c,
+  0x53, 0xb1, 0x5f, 0xb5, 0xe9, 0xf4, 0x40, 0xf4, 0x8e, 0x7d, 0x17, 0x10, 0x70, 0x8b, 0xd5, 0xf4,
+  0x2e, 0xcb, 0x7f, 0xd4, 0xc7, 0x01, 0x1a, 0xe1, 0x10, 0x61, 0xc4, 0xa5, 0x50, 0x0c, 0x02, 0xb0,
+  0x3f, 0xf4, 0x10, 0x8d, 0x80, 0x97, 0xd8, 0x99, 0xe1, 0x45, 0x88, 0xa6, 0x34, 0xa4, 0x7d, 0x87,
+  0xac, 0xf3, 0x0d, 0x46, 0xb4, 0xe2, 0xe2, 0x69, 0xc2, 0x39, 0x21, 0x3a, 0xd8, 0xa1, 0x43, 0x97,
+  0x29, 0xca, 0xc8, 0x1a, 0x71, 0x41, 0xe2, 0xe3, 0x54, 0x31, 0x60, 0xcb, 0xc1, 0xe8, 0xca, 0x50,
+  0xc5, 0x98, 0x00, 0xa3, 0x8b, 0xa9, 0x1b, 0x32, 0xe6, 0xf8, 0x78, 0x48, 0x92, 0xf1, 0x06, 0x92,
+  0x06, 0xd4, 0x71, 0x42, 0x34, 0x25, 0x6b, 0x62, 0xc1, 0x18, 0x39, 0xc5, 0xd4, 0x01, 0x57, 0x2c,
+  0xea, 0x07, 0x5e, 0x38, 0x23, 0x01, 0x62, 0x0b, 0x90, 0x8e, 0x3e, 0x4c, 0x49, 0x30, 0x00, 0x19,
+  0xa3, 0x21, 0x0a, 0x49, 0x2a, 0x37, 0x91, 0x27, 0x38, 0x0d, 0x1d, 0xc5, 0x89, 0xb0, 0xa1, 0xd0,
+  0x82, 0x7d, 0x3c, 0xf0, 0xc5, 0x25, 0x53, 0xa8, 0x66, 0xe4, 0xcd, 0x42, 0x0d, 0x61, 0x90, 0x53,
+  0x26, 0x51, 0x23, 0x82, 0x06, 0x9e, 0x07, 0x72, 0x01, 0xa6, 0x1b, 0x11, 0x8c, 0x13, 0xd2, 0xce,
+  0x4d, 0xb9, 0x3c, 0x1e, 0x25, 0xfc, 0x61, 0xac, 0x18, 0x06, 0xde, 0xac, 0x52, 0x43, 0x9e, 0x20,
+  0xae, 0xc2, 0x49, 0x91, 0x05, 0x8c, 0xf1, 0x24, 0xe9, 0x3c, 0xf0, 0x86, 0x8f, 0x53, 0x48, 0x2c,
+  0xcf, 0xb5, 0x71, 0xb0, 0x40, 0x21, 0xb5, 0x89, 0x3c, 0x96, 0xc0, 0x21, 0x2c, 0xf8, 0x38, 0xf0,
+  0x02, 0xce, 0x16, 0x2b, 0xa2, 0x53, 0xc1, 0xc9, 0x44, 0xa4, 0x32, 0x43, 0x27, 0x9a, 0x58, 0x1f,
+  0xbe, 0x51, 0xa5, 0x66, 0x18, 0x82, 0x1e, 0x09, 0x85, 0xb7, 0x9e, 0x19, 0xef, 0xcc, 0xd0, 0xa6,
+  0x3d, 0x5a, 0x54, 0xf0, 0x24, 0xf2, 0xd2, 0x1a, 0x62, 0x49, 0xcc, 0x54, 0x07, 0x74, 0xe5, 0x32,
+  0x46, 0xae, 0xb4, 0xb6, 0x51, 0x29, 0x62, 0x0b, 0xa9, 0xa9, 0xcc, 0xbc, 0xc0, 0xae, 0xb0, 0x73,
+  0xb1, 0x0e, 0x62, 0x7f, 0x2a, 0x90, 0xa3, 0x1c, 0x14, 0x36, 0x1b, 0x4d, 0x25, 0x4e, 0xf0, 0xf7,
+  0x02, 0x96, 0x3c, 0x90, 0x6e, 0x17, 0x91, 0x39, 0x1e, 0xfb, 0xfc, 0x58, 0x1a, 0x73, 0x56, 0xb1,
+  0x59, 0x1b, 0xb7, 0xca, 0x56, 0x43, 0x2e, 0x16, 0x92, 0x4e, 0xd2, 0x40, 0xdf, 0x2c, 0xbc, 0x09,
+  0x72, 0x09, 0xb1, 0x39, 0x82, 0x3c, 0x67, 0x1f, 0xc1, 0x69, 0xc6, 0xe2, 0xed, 0x0c, 0x1b, 0xd5,
+  0xe2, 0x6e, 0xf2, 0x49, 0xd9, 0x69, 0x91, 0xb1, 0x72, 0xf0, 0x9a, 0x60, 0x1b, 0xc4, 0xf0, 0x83,
+  0x4b, 0xd8, 0xc5, 0xcb, 0xc7, 0x41, 0x5f, 0xcc, 0xbc, 0xef, 0x81, 0x1e, 0x05, 0xe4, 0x7b, 0x6a,
+  0x7f, 0xe9, 0x4d, 0x82, 0xef, 0x01, 0xa7, 0x53, 0xa9, 0x76, 0x69, 0x8c, 0x80, 0x7f, 0xdf, 0x33,
+  0x40, 0x5c, 0x1d, 0x80, 0x98, 0x13, 0x37, 0xa2, 0x81, 0xd0, 0x15, 0xf3, 0x44, 0x9f, 0x46, 0x23,
+  0x6f, 0x12, 0x89, 0x91, 0xa3, 0xee, 0xf0, 0xa7, 0x8f, 0x98, 0x98, 0xb4, 0x71, 0x5f, 0xc1, 0x9b,
+  0x3b, 0x64, 0xf7, 0xda, 0x84, 0x3d, 0x89, 0x86, 0x01, 0x59, 0x28, 0x69, 0xdf, 0x04, 0x77, 0xd8,
+  0xf2, 0x31, 0x89, 0x40, 0xe7, 0xc2, 0x4c, 0x23, 0xdc, 0x23, 0x02, 0x8b, 0x07, 0x5b, 0xbd, 0x98,
+  0x21, 0xc0, 0x75, 0x3b, 0xb1, 0x91, 0x05, 0x87, 0x23, 0x01, 0x71, 0x93, 0x95, 0x8c, 0xd1, 0xcd,
+  0x15, 0x73, 0x84, 0x6f, 0x81, 0x9f, 0x13, 0x9f, 0x2b, 0xa5, 0x89, 0xe3, 0x20, 0xf6, 0xc6, 0x82,
+  0x69, 0x02, 0xa1, 0xc9, 0xb3, 0xed, 0xca, 0xf3, 0x2f, 0x67, 0xbe, 0x0b, 0xa5, 0x2d, 0x96, 0xbd,
+  0x6f, 0x93, 0x30, 0xa2, 0x83, 0x45, 0xb2, 0xce, 0xc4, 0x9a, 0x13, 0xc6, 0xf7, 0xe0, 0x82, 0x84,
+  0x11, 0xb3, 0x8a, 0x80, 0xf4, 0x97, 0xd0, 0xf4, 0x15, 0x6b, 0xba, 0x8c, 0x5e, 0x13, 0xee, 0xde,
+  0x93, 0xe4, 0x21, 0x19, 0xe2, 0xcd, 0xc1, 0xde, 0x58, 0xa1, 0x5e, 0x72, 0xdd, 0x2a, 0x9b, 0x10,
+  0x42, 0xa9, 0x0a, 0x0b, 0x29, 0xb3, 0x50, 0xad, 0x29, 0x5a, 0xae, 0x98, 0xb7, 0xa8, 0x26, 0x79,
+  0x49, 0x67, 0xdf, 0x51, 0x30, 0x71, 0x2d, 0x66, 0x90, 0xe1, 0x4a, 0x43, 0x39, 0xd8, 0xb1, 0x3c,
+  0x7f, 0xd1, 0x45, 0xcc, 0x4b, 0x27, 0x6a, 0x28, 0x42, 0x56, 0xf1, 0x40, 0xf8, 0xeb, 0x32, 0x17,
+  0xb6, 0xff, 0xef, 0xff, 0xf8, 0xdf, 0xa8, 0xc2, 0x6c, 0xd7, 0x77, 0x9e, 0xad, 0xa5, 0x46, 0x2c,
+  0xf0, 0x3e, 0xbd, 0x20, 0x4d, 0xc3, 0xd8, 0xac, 0xb4, 0xd1, 0xc4, 0xb5, 0x49, 0x20, 0xcc, 0x4f,
+  0xd1, 0xed, 0x1b, 0x2e, 0xef, 0xd5, 0x2a, 0xba, 0xf4, 0x99, 0x65, 0x0f, 0xdd, 0xb5, 0x12, 0x43,
+  0xd9, 0xf5, 0x22, 0x6a, 0x91, 0xd8, 0x78, 0xe1, 0x9d, 0x63, 0x08, 0x89, 0x5b, 0xed, 0x8f, 0x09,
+  0x09, 0x16, 0xe7, 0x6c, 0x17, 0xe6, 0x05, 0xa5, 0xe2, 0x2f, 0x62, 0x65, 0xd2, 0x19, 0xdd, 0xc2,
+  0xf1, 0x0d, 0xf7, 0xc1, 0x90, 0x89, 0xc4, 0x5d, 0x0c, 0x52, 0x52, 0xd9, 0x49, 0xfb, 0xc4, 0x71,
+  0x7e, 0x27, 0x18, 0x8e, 0x13, 0x11, 0x5a, 0xa1, 0x6a, 0x15, 0xdb, 0xf6, 0xa1, 0x67, 0x2f, 0x0a,
+  0x40, 0x11, 0xb3, 0x66, 0x11, 0xfa, 0x15, 0x9d, 0x93, 0x48, 0x5e, 0x46, 0xb8, 0xe5, 0xcb, 0x8b,
+  0xfe, 0xee, 0xe3, 0x00, 0x8f, 0xd1, 0x92, 0x1f, 0xd5, 0xac, 0xe2, 0xcb, 0x34, 0x15, 0xd4, 0x93,
+  0xc1, 0xaa, 0x05, 0xc4, 0x56, 0x5d, 0x5e, 0xc1, 0xbb, 0xe4, 0xb6, 0xb0, 0x7c, 0x71, 0x58, 0x98,
+  0xa8, 0x74, 0x80, 0x4a, 0x4f, 0xe4, 0x6c, 0x7e, 0x84, 0xc2, 0x39, 0xc4, 0xbc, 0xe8, 0xbf, 0xac,
+  0xd7, 0x82, 0x4c, 0xe9, 0xc6, 0x32, 0x07, 0xcc, 0x75, 0x48, 0x16, 0x65, 0xc4, 0x13, 0xbb, 0xa8,
+  0x49, 0x68, 0x70, 0xc5, 0xa8, 0x9b, 0x37, 0x0c, 0x6b, 0xa6, 0xea, 0x3d, 0x7c, 0xef, 0x39, 0x4e,
+  0xa9, 0xf8, 0x4b, 0x6c, 0x08, 0x21, 0x7d, 0x4c, 0xdc, 0x49, 0x85, 0x46, 0x64, 0x5c, 0x54, 0xf5,
+  0x81, 0x17, 0x1c, 0x63, 0x6b, 0x54, 0x82, 0x3c, 0xa0, 0x05, 0x99, 0x07, 0xa2, 0xbf, 0xbc, 0xc7,
+  0x71, 0x3e, 0xbb, 0x73, 0x16, 0x92, 0x88, 0xdd, 0xa0, 0x42, 0xa6, 0xb9, 0xa5, 0xc7, 0xfc, 0x82,
+  0x55, 0x52, 0x03, 0x42, 0x09, 0x7e, 0x62, 0xbf, 0xc3, 0x15, 0xa8, 0x52, 0x91, 0xef, 0xcc, 0x89,
+  0x5d, 0x54, 0x05, 0xe8, 0x0a, 0xb1, 0x03, 0xc4, 0x7b, 0x31, 0x03, 0x32, 0xf6, 0xa6, 0x24, 0x0f,
+  0x99, 0xfd, 0x5d, 0xa9, 0x79, 0x7c, 0x4a, 0x0d, 0x92, 0xef, 0x60, 0x56, 0x6a, 0x47, 0xfc, 0x45,
+  0x76, 0x51, 0xfb, 0x1e, 0x66, 0x51, 0xfb, 0xbf, 0x16, 0xab, 0x64, 0x83, 0x36, 0x91, 0x79, 0x4e,
+  0x7b, 0xba, 0x67, 0x7b, 0x39, 0x71, 0x53, 0xaa, 0x61, 0xb3, 0x56, 0x04, 0xb4, 0xa2, 0x74, 0x8a,
+  0x85, 0xcc, 0xd8, 0x8a, 0xbd, 0xc9, 0xd1, 0xe4, 0xd2, 0x9e, 0x0d, 0xe5, 0x2f, 0x58, 0x92, 0x26,
+  0x97, 0xd0, 0xd7, 0x4c, 0xf4, 0x04, 0x86, 0xaf, 0xe7, 0xf1, 0xb6, 0x08, 0xdc, 0x15, 0xca, 0xc1,
+  0xd3, 0xe5, 0x56, 0x8e, 0xaf, 0x64, 0xcd, 0xbf, 0x66, 0xf7, 0x49, 0x9a, 0x9a, 0xe3, 0xe8, 0x19,
+  0xcb, 0x78, 0xc3, 0x14, 0xca, 0x1a, 0x8d, 0x2c, 0x71, 0x23, 0x52, 0x39, 0x5c, 0x2b, 0xe5, 0xd3,
+  0xa4, 0xf1, 0x1d, 0xaf, 0xdc, 0xa0, 0xca, 0x07, 0x6b, 0x55, 0x10, 0xba, 0xef, 0x21, 0x0d, 0xf5,
+  0xb0, 0x4e, 0xe4, 0x4e, 0x14, 0xd8, 0x0c, 0x04, 0x61, 0x84, 0x3c, 0x37, 0x51, 0xda, 0xa2, 0xd8,
+  0x81, 0x8d, 0xf5, 0x6c, 0x04, 0xd7, 0x40, 0xd9, 0x04, 0x1f, 0xc3, 0x29, 0x2f, 0x09, 0xb3, 0xaa,
+  0x94, 0x5f, 0x4f, 0x88, 0x55, 0x29, 0x5c, 0xfa, 0x46, 0x15, 0xee, 0x52, 0x10, 0x6d, 0x2c, 0x7c,
+  0xa1, 0x7c, 0xa3, 0x80, 0x0e, 0x87, 0xcc, 0x3e, 0xe8, 0x2f, 0x98, 0x74, 0xc6, 0x87, 0x42, 0x5b,
+  0x95, 0x2e, 0xd4, 0x56, 0x4a, 0x2b, 0x8e, 0x25, 0x8c, 0xb1, 0x2c, 0x47, 0xad, 0xe6, 0xdc, 0xc2,
+  0xe7, 0x8f, 0x4f, 0xe0, 0x12, 0x8d, 0xc4, 0x1a, 0x98, 0x9f, 0xe3, 0xac, 0x76, 0x82, 0xf9, 0x28,
+  0x35, 0x24, 0xa9, 0xef, 0x09, 0x9b, 0x09, 0xe7, 0xb1, 0xbe, 0x78, 0x47, 0xdc, 0x49, 0x49, 0xed,
+  0x16, 0xc4, 0x40, 0x3c, 0x8e, 0xc1, 0x22, 0x15, 0xfa, 0xc4, 0xa2, 0x03, 0x9a, 0xba, 0x44, 0xa8,
+  0x9d, 0xcf, 0x4b, 0x6a, 0x67, 0x79, 0x18, 0xc3, 0x7d, 0x3f, 0x07, 0x4f, 0xec, 0x52, 0xaa, 0x4f,
+  0x7e, 0x32, 0xdf, 0xb8, 0x16, 0x83, 0xcb, 0xae, 0x31, 0x33, 0xaa, 0xe8, 0x95, 0x60, 0xc3, 0xc4,
+  0xa5, 0x7f, 0x4c, 0x84, 0x04, 0xa5, 0x97, 0x56, 0x81, 0xd3, 0x20, 0x3e, 0x82, 0xa9, 0xb0, 0x5b,
+  0xe4, 0xfc, 0x14, 0x04, 0xf2, 0xfb, 0x40, 0x1c, 0x97, 0xbd, 0x77, 0xb9, 0x87, 0x38, 0x86, 0xa0,
+  0x0f, 0xa8, 0x13, 0x91, 0xa0, 0x24, 0x11, 0xa9, 0x21, 0xea, 0xda, 0x64, 0x1e, 0xaf, 0x96, 0xa1,
+  0x2a, 0x6b, 0x63, 0x71, 0xc1, 0x41, 0xbe, 0x5c, 0x75, 0x02, 0xd0, 0x25, 0xa6, 0xb3, 0xc7, 0xb1,
+  0x28, 0x98, 0xeb, 0xe2, 0xa1, 0xb2, 0x4c, 0x56, 0x71, 0xac, 0x29, 0x59, 0xf3, 0x63, 0xec, 0xdf,
+  0x2f, 0x57, 0xa9, 0x46, 0x85, 0x15, 0x42, 0xe6, 0x03, 0xea, 0x13, 0xcb, 0x1b, 0xc3, 0x7b, 0x60,
+  0xe6, 0x6d, 0x72, 0xc8, 0x94, 0x38, 0x6c, 0x4c, 0x25, 0x4e, 0xb0, 0x3b, 0xbf, 0xa6, 0xcc, 0x10,
+  0xd1, 0x0f, 0xd6, 0x30, 0x27, 0xf6, 0x40, 0x52, 0xf9, 0x1c, 0x2b, 0xd6, 0xee, 0xc8, 0x44, 0x8f,
+  0x58, 0x97, 0xd1, 0x73, 0x94, 0xae, 0x07, 0xa8, 0x83, 0x8a, 0xc5, 0xa4, 0x3a, 0xc1, 0x2d, 0xae,
+  0xaf, 0x93, 0x03, 0x5c, 0x79, 0x40, 0xc4, 0x3b, 0xb2, 0xf5, 0x39, 0xcb, 0xaf, 0xb0, 0xc9, 0xc6,
+  0x41, 0xa2, 0x2e, 0x93, 0x75, 0x53, 0x90, 0xc9, 0xbc, 0x1f, 0x4f, 0x97, 0x31, 0x05, 0x2b, 0x30,
+  0x6b, 0x9b, 0x0a, 0x02, 0xdc, 0x0a, 0x3f, 0x63, 0x7e, 0xba, 0x84, 0xbf, 0x2b, 0xa6, 0xbf, 0xe1,
+  0x23, 0xab, 0x52, 0x57, 0xf1, 0x12, 0xa6, 0x7f, 0xf3, 0xa8, 0x5b, 0x2a, 0x8a, 0x25, 0x8d, 0x2d,
+  0x41, 0xb1, 0x71, 0xb3, 0xb6, 0x0c, 0x01, 0x57, 0x25, 0x91, 0x7d, 0xc0, 0x2a, 0x88, 0xc7, 0x24,
+  0x5f, 0x11, 0x64, 0x04, 0x57, 0x88, 0xd5, 0xfd, 0x33, 0x8a, 0xc9, 0xeb, 0x83, 0xba, 0xe8, 0x3e,
+  0x43, 0xaa, 0xb0, 0x29, 0x21, 0xa2, 0x91, 0x6d, 0x42, 0x19, 0x4b, 0xc8, 0x86, 0x7c, 0x6c, 0xcc,
+  0xe6, 0xad, 0x2b, 0xe4, 0x56, 0x31, 0xf9, 0x21, 0x21, 0x39, 0xb1, 0xb3, 0x22, 0x42, 0xed, 0xc7,
+  0x0b, 0x48, 0xce, 0x2e, 0x88, 0x8b, 0x0b, 0xac, 0xd0, 0x4f, 0x97, 0x99, 0x2e, 0x31, 0xa9, 0x19,
+  0xaf, 0xad, 0xf4, 0xa9, 0xf8, 0xc4, 0xd3, 0x78, 0x53, 0x74, 0x52, 0x53, 0xef, 0x3e, 0xe1, 0x89,
+  0x95, 0xbf, 0x24, 0x42, 0x97, 0x27, 0x89, 0x2e, 0xae, 0x56, 0xb9, 0xc8, 0x5c, 0x9e, 0xc0, 0x8e,
+  0x6a, 0x8c, 0x6d, 0x82, 0xf0, 0x00, 0x36, 0x3a, 0xd8, 0x71, 0x12, 0x59, 0x19, 0xe1, 0x29, 0xa8,
+  0x02, 0x22, 0x6e, 0x8a, 0x11, 0x5b, 0x43, 0x6c, 0xc3, 0xec, 0x21, 0x6c, 0x63, 0x3f, 0xe2, 0x1f,
+  0x36, 0x5b, 0x9c, 0x39, 0xca, 0xf3, 0x02, 0x42, 0x71, 0xbd, 0x19, 0xb5, 0xb7, 0x61, 0x8c, 0x09,
+  0xcd, 0x13, 0xdf, 0xca, 0x0a, 0x11, 0xb8, 0x80, 0xc0, 0x69, 0x0f, 0x8e, 0x5d, 0xce, 0x4f, 0xd8,
+  0x89, 0x63, 0x69, 0xeb, 0x93, 0x67, 0xa1, 0x80, 0x38, 0xcb, 0xe9, 0xc2, 0xc6, 0xe2, 0x98, 0xea,
+  0xf1, 0xee, 0x63, 0x16, 0xce, 0xc4, 0xb7, 0x9f, 0x95, 0x08, 0x64, 0xa2, 0xdc, 0x2b, 0x14, 0xeb,
+  0xfb, 0x20, 0xd1, 0x08, 0x33, 0xac, 0xd7, 0xc5, 0x37, 0x0b, 0x9a, 0x5a, 0xa4, 0xdb, 0x56, 0x3e,
+  0x69, 0x9a, 0x70, 0x83, 0x2a, 0x59, 0x61, 0x53, 0x5b, 0x8b, 0x29, 0x89, 0x93, 0x8c, 0x9b, 0x7e,
+  0x6d, 0x95, 0x07, 0x44, 0x1a, 0x6d, 0x58, 0x53, 0x09, 0x99, 0xeb, 0xfd, 0x34, 0x11, 0xdc, 0x04,
+  0x41, 0x3b, 0x3b, 0x5b, 0x77, 0x88, 0x26, 0x2a, 0x16, 0xa1, 0x7c, 0xab, 0x1e, 0xe1, 0xb7, 0x3c,
+  0x1f, 0xee, 0xe0, 0xb6, 0x0a, 0xbe, 0x1a, 0xd7, 0x85, 0xd8, 0xf0, 0x5f, 0x33, 0x64, 0x22, 0x2f,
+  0x10, 0x5b, 0xfa, 0x49, 0x10, 0x10, 0x37, 0x72, 0x16, 0x39, 0x3b, 0x69, 0x90, 0xef, 0xbc, 0x9d,
+  0x6d, 0xb1, 0xc8, 0xb5, 0x6a, 0x08, 0xb5, 0x84, 0xc2, 0xc5, 0x23, 0xae, 0x42, 0xb2, 0x43, 0x12,
+  0x76, 0x0b, 0x12, 0x3e, 0x6d, 0x1a, 0xfa, 0x0e, 0x5e, 0x48, 0x92, 0x0d, 0x55, 0xae, 0x4b, 0x1e,
+  0x7b, 0x50, 0x54, 0x58, 0x6d, 0xde, 0x87, 0x81, 0x13, 0x1d, 0x0d, 0x26, 0xe3, 0x52, 0x78, 0xeb,
+  0xe0, 0xce, 0x41, 0x77, 0x8c, 0x83, 0x21, 0x75, 0x3b, 0x46, 0x17, 0xce, 0x33, 0xa8, 0x3b, 0xec,
+  0x18, 0x2b, 0x00, 0x5c, 0xa6, 0x5e, 0x2e, 0x7e, 0xa2, 0x2b, 0x1d, 0x9d, 0xca, 0x47, 0xa0, 0x21,
+  0x76, 0xc3, 0x4a, 0x48, 0x02, 0x3a, 0x58, 0xe9, 0xfd, 0x61, 0x25, 0x9c, 0x58, 0x16, 0x09, 0xc3,
+  0xe5, 0x86, 0x8f, 0xec, 0x97, 0xa6, 0x85, 0x07, 0x2d, 0x83, 0x01, 0x51, 0x77, 0xe0, 0xe5, 0x40,
+  0xd4, 0x6b, 0xcf, 0xda, 0x83, 0x06, 0x83, 0x98, 0xe1, 0xc0, 0xcd, 0x81, 0x18, 0x0c, 0xac, 0x9a,
+  0xb1, 0xcb, 0x20, 0xd8, 0x41, 0x4d, 0x2e, 0x48, 0xab, 0xde, 0xaa, 0xaf, 0x92, 0x5d, 0x7a, 0x0e,
+  0x48, 0xa3, 0xd1, 0x58, 0x09, 0x07, 0x4a, 0x6e, 0x69, 0x73, 0xa5, 0xdb, 0x95, 0xbe, 0xe3, 0x59,
+  0xb7, 0x4b, 0xc1, 0xf1, 0x0e, 0x4b, 0x41, 0x36, 0x6c, 0x9e, 0x92, 0x5c, 0x48, 0x40, 0xa6, 0xeb,
+  0xb9, 0x24, 0xc9, 0x84, 0xc4, 0x4a, 0x97, 0x36, 0x67, 0x4b, 0xf6, 0x6d, 0xd3, 0x80, 0xb0, 0x31,
+  0xed, 0xf0, 0x5c, 0x01, 0xc2, 0xdd, 0xe0, 0xcb, 0xe4, 0xbb, 0x53, 0x13, 0x05, 0xf1, 0x06, 0x6d,
+  0x29, 0xa5, 0x3a, 0x46, 0xb6, 0xb0, 0x96, 0x29, 0xac, 0xad, 0xf4, 0xb5, 0x0d, 0xe0, 0x32, 0x4e,
+  0x77, 0x78, 0x5a, 0x02, 0xe0, 0x3b, 0xaf, 0x65, 0x9a, 0xee, 0x40, 0x7a, 0xa5, 0xcf, 0x60, 0x23,
+  0xb9, 0x64, 0xde, 0x45, 0x26, 0x1e, 0x2b, 0x9d, 0x6d, 0x2d, 0x65, 0x89, 0x59, 0xe9, 0x63, 0x5c,
+  0x31, 0x96, 0xb1, 0xdc, 0xb0, 0x64, 0x3d, 0x4e, 0xc2, 0xcd, 0x11, 0x7d, 0xbc, 0x48, 0x32, 0x2a,
+  0x91, 0xe7, 0x43, 0xa6, 0x10, 0xb3, 0x0a, 0x77, 0xf1, 0x09, 0xb0, 0x80, 0x13, 0x21, 0x8a, 0x98,
+  0x2b, 0x4c, 0x90, 0xe1, 0x43, 0x95, 0xb1, 0x40, 0x32, 0x60, 0x58, 0xb4, 0x92, 0x9c, 0x5a, 0x5d,
+  0x64, 0x35, 0xd3, 0xac, 0x36, 0xcb, 0x5a, 0xa4, 0x50, 0xac, 0x69, 0x80, 0x8c, 0x25, 0x3b, 0x6e,
+  0x9c, 0x63, 0x4b, 0x5e, 0xc2, 0x25, 0xfb, 0x66, 0x3e, 0xd1, 0x0e, 0xcf, 0x11, 0xc5, 0xf1, 0x92,
+  0xb9, 0xce, 0xc8, 0x2e, 0x2b, 0x4d, 0x32, 0x89, 0xe3, 0x50, 0x3f, 0xa4, 0x21, 0xbc, 0x69, 0x8a,
+  0x48, 0x85, 0x1d, 0x48, 0x75, 0x5c, 0x6f, 0x16, 0x60, 0x7f, 0xa5, 0xcb, 0xae, 0xd6, 0x25, 0x4f,
+  0xc0, 0x52, 0x1d, 0x26, 0x2d, 0x65, 0x0e, 0xd0, 0x32, 0x10, 0x22, 0x6f, 0xa5, 0xc7, 0x1e, 0xda,
+  0x3e, 0x89, 0x66, 0x70, 0xcd, 0x28, 0xf1, 0xd8, 0x72, 0x17, 0x43, 0x87, 0xb5, 0x18, 0x97, 0xa6,
+  0xe0, 0xa2, 0xd1, 0x75, 0xe8, 0xb8, 0xe1, 0xd4, 0x58, 0x58, 0xc2, 0xdd, 0x05, 0x2f, 0xe8, 0xf8,
+  0x1e, 0x5d, 0x2f, 0xea, 0x8c, 0xa0, 0x9b, 0x9b, 0xf3, 0x24, 0x18, 0xf6, 0x31, 0xbb, 0x1a, 0x15,
+  0xff, 0xbf, 0x5e, 0x57, 0x57, 0x3a, 0x84, 0xe1, 0x49, 0x66, 0x02, 0x75, 0xe1, 0x0e, 0x14, 0x9f,
+  0x49, 0x5d, 0x2e, 0x52, 0x0d, 0x18, 0x0e, 0x21, 0x4b, 0xec, 0x5b, 0xaa, 0x37, 0x20, 0x3e, 0xc1,
+  0x51, 0xc7, 0xf5, 0xc4, 0x97, 0x5c, 0xe6, 0x7b, 0x21, 0xe5, 0x93, 0x47, 0xd0, 0x0e, 0x0d, 0x55,
+  0xc0, 0xee, 0x91, 0x29, 0x63, 0x21, 0x7f, 0xa4, 0xfb, 0x1c, 0x3c, 0x04, 0x50, 0x38, 0x1d, 0x96,
+  0xe7, 0x63, 0xa7, 0x1b, 0x87, 0x3f, 0xba, 0xbc, 0x78, 0x59, 0xd9, 0xd3, 0xf6, 0xc3, 0xe9, 0x10,
+  0xcd, 0xc7, 0x8e, 0x1b, 0xf2, 0x67, 0xdf, 0x9d, 0x6a, 0x75, 0x36, 0x9b, 0xe9, 0xb3, 0x86, 0xee,
+  0x05, 0xc3, 0x6a, 0xdd, 0x30, 0x0c, 0x40, 0x54, 0xb8, 0xa3, 0xdd, 0x54, 0x1a, 0x86, 0x22, 0x5c,
+  0xd1, 0xfc, 0x9b, 0xbf, 0x74, 0x9e, 0x9b, 0x8a, 0x81, 0x0c, 0xd4, 0x80, 0xff, 0x53, 0x0e, 0xf6,
+  0x7d, 0x1c, 0x8d, 0x10, 0xf8, 0x3c, 0x5a, 0x68, 0x57, 0x6f, 0x8d, 0xea, 0xc6, 0xbb, 0x16, 0xaa,
+  0x89, 0xbf, 0xf5, 0x3a, 0xcb, 0x81, 0x43, 0x84, 0xc0, 0xbb, 0x85, 0x33, 0x2d, 0x90, 0x95, 0x38,
+  0x59, 0x11, 0xcd, 0x34, 0x93, 0x0c, 0x60, 0x9d, 0x85, 0x7d, 0x53, 0x61, 0x5d, 0x53, 0xaa, 0xe0,
+  0x9b, 0x9e, 0x0e, 0x0f, 0x8a, 0xaa, 0xa4, 0xda, 0xe2, 0x43, 0x97, 0x86, 0x3f, 0xef, 0x4a, 0x37,
+  0x9f, 0xf6, 0xe2, 0xe4, 0x8c, 0x97, 0xef, 0x1a, 0xc6, 0x2a, 0xcf, 0x6b, 0xa9, 0xc7, 0x06, 0xe2,
+  0xb2, 0xef, 0x81, 0x16, 0xc1, 0xb6, 0x37, 0xeb, 0x50, 0x17, 0x96, 0x66, 0x03, 0x55, 0x5a, 0xfe,
+  0x1c, 0x19, 0xe8, 0x97, 0xf6, 0xde, 0x60, 0x25, 0x79, 0xf1, 0x62, 0xd5, 0xd0, 0xfa, 0x5b, 0x77,
+  0x4c, 0xdd, 0x4a, 0x9c, 0x32, 0xd8, 0x0c, 0x9f, 0x8b, 0x74, 0xdd, 0x80, 0xf4, 0x46, 0xa5, 0x95,
+  0x1a, 0xab, 0xd2, 0x80, 0x3b, 0x89, 0x83, 0xe6, 0x2a, 0xdf, 0x37, 0x28, 0x11, 0xb5, 0xa1, 0x9a,
+  0xdb, 0x7b, 0x83, 0x66, 0x4e, 0xb5, 0xad, 0xb8, 0x5a, 0x46, 0x2b, 0xf3, 0xbd, 0x8d, 0x6a, 0x3c,
+  0x1a, 0x4b, 0xa2, 0xa5, 0xba, 0x5b, 0x6b, 0x63, 0x97, 0xd1, 0x62, 0xcd, 0xe0, 0xcf, 0x51, 0xe8,
+  0xc1, 0xfb, 0x3c, 0x46, 0x62, 0x37, 0xa3, 0x6f, 0x36, 0xef, 0xf5, 0xfc, 0x53, 0xdd, 0x9f, 0x67,
+  0xfb, 0x18, 0x11, 0x14, 0xe3, 0xe4, 0x83, 0x69, 0x74, 0x33, 0x39, 0x1f, 0x09, 0xb6, 0x3f, 0xb8,
+  0xce, 0xc2, 0xac, 0xad, 0xe7, 0x87, 0x10, 0xbc, 0xc4, 0x36, 0xeb, 0xd9, 0xfc, 0x73, 0x9f, 0x9a,
+  0x8d, 0x6c, 0xd6, 0x09, 0x7f, 0xda, 0x98, 0x3e, 0x68, 0xeb, 0x8a, 0x2b, 0x2b, 0x9c, 0x98, 0x25,
+  0x33, 0xa2, 0x20, 0xaa, 0x07, 0x7f, 0x37, 0x17, 0x42, 0xf4, 0x10, 0xe9, 0x06, 0x8b, 0x64, 0x97,
+  0xfb, 0x18, 0x8c, 0x28, 0x1e, 0x62, 0x20, 0xfd, 0x4e, 0xf7, 0x14, 0xe6, 0x4d, 0x7a, 0x7c, 0xa7,
+  0x6f, 0x6e, 0x5f, 0xe2, 0xed, 0x4a, 0x8e, 0x21, 0x17, 0x91, 0x30, 0x2a, 0x29, 0xf0, 0xaf, 0xa2,
+  0x16, 0x24, 0x3c, 0xf7, 0xaf, 0x87, 0x54, 0x89, 0x9f, 0x88, 0xa5, 0xbe, 0x1b, 0x5e, 0xf3, 0x5f,
+  0x78, 0x67, 0x26, 0x71, 0x07, 0x76, 0x58, 0x37, 0x9b, 0x9d, 0xbd, 0x51, 0xe1, 0xea, 0x33, 0xeb,
+  0x15, 0x7b, 0x0b, 0xb2, 0x5c, 0x15, 0x72, 0x63, 0xb6, 0x2c, 0xd7, 0xf6, 0xcb, 0xe6, 0x7a, 0xda,
+  0x8c, 0xdf, 0x7e, 0x3f, 0x4f, 0xe2, 0x17, 0x75, 0x36, 0x61, 0xe2, 0x67, 0xe1, 0xcf, 0x95, 0xcb,
+  0x90, 0x04, 0x4a, 0x47, 0x39, 0x5f, 0x84, 0x11, 0x19, 0x2b, 0xdd, 0x34, 0x88, 0x01, 0x0f, 0xde,
+  0x20, 0x35, 0xdd, 0xcd, 0xd9, 0xd7, 0xe6, 0x6d, 0xc6, 0x58, 0x15, 0x69, 0x8f, 0xe1, 0x45, 0xd0,
+  0x0c, 0x3b, 0xb7, 0x17, 0xa3, 0xc0, 0x9b, 0x0c, 0x79, 0x38, 0x1d, 0x18, 0x1f, 0x21, 0x1c, 0xe2,
+  0xfd, 0x51, 0x1e, 0xf3, 0x39, 0xc0, 0x73, 0xfe, 0x47, 0x77, 0x3b, 0x29, 0x6d, 0xd2, 0x7b, 0xf5,
+  0x4f, 0x38, 0x30, 0x07, 0x13, 0xb7, 0xc4, 0xa1, 0xb4, 0x74, 0x04, 0xe8, 0xa0, 0x14, 0x03, 0x24,
+  0x2f, 0x9f, 0x44, 0x5a, 0x7e, 0x3d, 0x08, 0xe3, 0x9a, 0x54, 0xc4, 0x9f, 0x55, 0xe7, 0x11, 0xfb,
+  0xb8, 0x7a, 0xe1, 0x39, 0x60, 0x36, 0x42, 0xcc, 0x72, 0x6b, 0x95, 0x5c, 0x3e, 0xd7, 0xc9, 0x86,
+  0x77, 0x43, 0x3c, 0xef, 0x2f, 0x88, 0x5b, 0x96, 0x84, 0xee, 0x6a, 0xa5, 0xae, 0x0a, 0xd2, 0x5b,
+  0x4a, 0x8d, 0xda, 0xc9, 0x9c, 0xf8, 0x01, 0xf2, 0xe4, 0xe7, 0xb0, 0xa6, 0xe9, 0x53, 0x7b, 0x67,
+  0x47, 0x7a, 0x10, 0x6b, 0x9a, 0xe0, 0x14, 0x15, 0xb5, 0xc7, 0xf9, 0x5d, 0x89, 0x82, 0xf5, 0x57,
+  0xb7, 0xe9, 0xf3, 0x77, 0xa1, 0x4e, 0xbe, 0xf2, 0xbf, 0xd7, 0xf2, 0xc3, 0x71, 0xd0, 0x31, 0xdd,
+  0xbf, 0x42, 0xeb, 0xe8, 0x09, 0x17, 0xb4, 0xb8, 0x8d, 0xb4, 0xe0, 0xda, 0x94, 0xa8, 0x2c, 0xc8,
+  0x84, 0x98, 0xe2, 0x6f, 0xfa, 0x38, 0x2c, 0x8f, 0xcc, 0x2e, 0xef, 0xd9, 0x19, 0x6b, 0xfd, 0xe7,
+  0x70, 0x98, 0xe7, 0xed, 0xec, 0x08, 0xc9, 0x7f, 0x90, 0xcd, 0x1c, 0x8e, 0x31, 0xf9, 0x81, 0xd8,
+  0x2d, 0x3c, 0x96, 0x0c, 0x14, 0x1e, 0xc1, 0xda, 0xc9, 0xc2, 0xc0, 0x6c, 0x46, 0x03, 0xe2, 0xd1,
+  0x9e, 0x44, 0xb8, 0xa7, 0xb0, 0xae, 0xa8, 0x29, 0x86, 0xa9, 0xf8, 0x93, 0xc0, 0x77, 0x88, 0x92,
+  0xbc, 0x6e, 0x7c, 0x10, 0xbf, 0x91, 0xc5, 0x67, 0xef, 0x7e, 0x38, 0xb6, 0x9c, 0x3d, 0x0c, 0xe0,
+  0xfd, 0x12, 0x7b, 0xdf, 0x69, 0x45, 0x73, 0x33, 0x25, 0x1d, 0x7c, 0x21, 0x47, 0xfc, 0x9a, 0x48,
+  0xa9, 0x58, 0x07, 0x17, 0x08, 0x8b, 0x4b, 0x71, 0x65, 0xde, 0x13, 0xc6, 0x68, 0xdf, 0x6c, 0x1a,
+  0xcf, 0xeb, 0x9d, 0x26, 0x07, 0x7d, 0x7d, 0x1f, 0x68, 0x75, 0x7c, 0xc5, 0xa0, 0xfc, 0xb3, 0x53,
+  0x1e, 0xe7, 0x68, 0x4c, 0x5d, 0x89, 0x71, 0x3a, 0x33, 0x84, 0xaa, 0xe3, 0x2b, 0x4d, 0xca, 0xe3,
+  0xe6, 0x5a, 0xb5, 0x34, 0x7e, 0x5d, 0x86, 0x78, 0x36, 0x8c, 0xa7, 0x57, 0xa6, 0x7f, 0x76, 0xfa,
+  0x6b, 0xcd, 0xe0, 0xa9, 0xd7, 0xe6, 0xf8, 0xf5, 0xaf, 0xfe, 0xd9, 0x29, 0x4b, 0x39, 0x1f, 0x06,
+  0xbc, 0xea, 0x81, 0xe3, 0x79, 0x41, 0x69, 0xa3, 0xf6, 0x4a, 0xff, 0x4a, 0xad, 0x8a, 0x00, 0x07,
+  0xbe, 0xc7, 0x44, 0xdd, 0x8a, 0xe6, 0xba, 0xe5, 0x10, 0x1c, 0x7c, 0x84, 0x37, 0x9d, 0x86, 0x66,
+  0x68, 0xeb, 0x48, 0x9b, 0xf4, 0xa8, 0x5d, 0xdf, 0x0b, 0xf5, 0xb9, 0xe9, 0x7c, 0x18, 0xb0, 0xaf,
+  0x05, 0x50, 0xc4, 0x6a, 0xea, 0x93, 0x21, 0x75, 0xcf, 0x70, 0x34, 0x2a, 0xa9, 0x2c, 0x0d, 0xd7,
+  0x70, 0xce, 0xd9, 0x15, 0x18, 0x49, 0x14, 0xe2, 0x02, 0xd6, 0x22, 0xab, 0x49, 0x63, 0xb5, 0x68,
+  0xfd, 0x2b, 0xad, 0xff, 0x7a, 0x1d, 0x91, 0xbd, 0xf6, 0x3a, 0x64, 0x43, 0x09, 0x41, 0x40, 0xae,
+  0x20, 0xf4, 0x40, 0x61, 0xb3, 0x8a, 0x72, 0x4d, 0x6f, 0x01, 0x1f, 0x34, 0x43, 0x03, 0xf6, 0xec,
+  0xb2, 0x7f, 0x1b, 0x22, 0xd0, 0x5d, 0x0e, 0x78, 0x3d, 0x03, 0xde, 0x8a, 0xc1, 0xd7, 0xda, 0x86,
+  0x47, 0x1a, 0x8f, 0x6c, 0x97, 0x75, 0xa1, 0xdc, 0xe0, 0xdf, 0x09, 0x05, 0xbb, 0x0f, 0x53, 0xb0,
+  0x8e, 0xc8, 0x69, 0x69, 0xa9, 0xf9, 0x0c, 0xf5, 0xdc, 0x88, 0x8f, 0xbf, 0xde, 0x2a, 0x2b, 0x60,
+  0x7b, 0x82, 0x1f, 0x45, 0x59, 0xa7, 0xbb, 0xef, 0x60, 0xeb, 0x96, 0xe7, 0x82, 0x38, 0xf7, 0x60,
+  0x87, 0x68, 0x2a, 0xe2, 0xb6, 0x4e, 0x02, 0x0c, 0xb7, 0x3f, 0xb6, 0xce, 0x2a, 0x8d, 0x53, 0x29,
+  0xd3, 0xd8, 0x86, 0x6f, 0x35, 0x65, 0xc7, 0x72, 0x7b, 0xab, 0x6b, 0x7d, 0x6d, 0x4b, 0xb5, 0xd4,
+  0xea, 0x49, 0x57, 0xeb, 0x71, 0x57, 0x57, 0x85, 0x0d, 0xc6, 0x93, 0x45, 0x6e, 0x4d, 0x0d, 0xc1,
+  0xb5, 0xfe, 0xeb, 0x4a, 0x5c, 0x4b, 0x23, 0x1e, 0x3c, 0xf6, 0x40, 0x1b, 0x4e, 0x8f, 0xa4, 0xe0,
+  0x4b, 0xf0, 0x3d, 0xdf, 0x1f, 0x5f, 0x75, 0xe7, 0xf0, 0x54, 0x3b, 0xce, 0x5d, 0x98, 0x46, 0x77,
+  0xb1, 0x3f, 0x7e, 0xdd, 0x5d, 0x40, 0xae, 0x08, 0x5a, 0xc6, 0xce, 0x54, 0x72, 0xd8, 0x91, 0x84,
+  0x85, 0x63, 0x75, 0xf3, 0x70, 0x0f, 0x3e, 0x75, 0xb9, 0x3a, 0xf9, 0x7a, 0xdd, 0x0d, 0x67, 0x14,
+  0xde, 0xe5, 0x0a, 0x30, 0x75, 0x69, 0xc1, 0x5d, 0x9f, 0xc4, 0x6c, 0xee, 0x14, 0x52, 0xd8, 0xdd,
+  0x3d, 0xad, 0xb6, 0xdb, 0xd0, 0x5a, 0xc6, 0xb5, 0x08, 0xd9, 0x21, 0x83, 0xc6, 0xf6, 0xb4, 0x8c,
+  0x50, 0xaf, 0xed, 0x69, 0xb5, 0xc6, 0x33, 0xad, 0xf9, 0x2c, 0x1f, 0x83, 0x5b, 0xda, 0x32, 0x46,
+  0xad, 0xd5, 0xd6, 0x5a, 0x86, 0x56, 0x6f, 0xb6, 0x63, 0x0c, 0x9b, 0x0c, 0xf0, 0xc4, 0x89, 0x32,
+  0x40, 0xcf, 0xea, 0x5a, 0x73, 0x4f, 0x6b, 0xec, 0x5d, 0x6f, 0x70, 0xfe, 0x86, 0xed, 0xd2, 0x9f,
+  0x2e, 0x63, 0xe0, 0xaf, 0xc6, 0xf5, 0x4a, 0x93, 0x92, 0xb5, 0x6c, 0xb2, 0xce, 0x92, 0x22, 0x90,
+  0x13, 0xe3, 0x4f, 0xb9, 0x75, 0xbd, 0x52, 0x6f, 0x84, 0x5e, 0x28, 0x2d, 0xca, 0x86, 0xde, 0x52,
+  0x61, 0xc4, 0xca, 0x79, 0x3a, 0x82, 0x0e, 0x4a, 0xa5, 0xb9, 0x69, 0x1a, 0x3b, 0x3b, 0x5c, 0xa2,
+  0xfe, 0xfc, 0xb3, 0x34, 0xdf, 0x37, 0x6b, 0x3c, 0xd9, 0x54, 0xd5, 0x02, 0x57, 0x34, 0xa5, 0x79,
+  0x5a, 0x0d, 0x28, 0x9d, 0x78, 0x45, 0x10, 0xb3, 0x32, 0x17, 0xa8, 0xbc, 0xc7, 0xd4, 0x22, 0x9b,
+  0x7d, 0xf9, 0x00, 0x4c, 0x28, 0x19, 0x49, 0x38, 0xb0, 0x32, 0x8a, 0x08, 0xe4, 0xc9, 0xd0, 0x9b,
+  0x9a, 0xa1, 0xd5, 0x7f, 0x65, 0xfa, 0xf4, 0xec, 0x24, 0x55, 0x0d, 0xa5, 0x07, 0x66, 0xa6, 0xf1,
+  0xb3, 0x66, 0x26, 0x3f, 0x61, 0x95, 0xe8, 0x02, 0x16, 0x56, 0x9b, 0x6a, 0x97, 0xf3, 0xb9, 0xcc,
+  0xa2, 0x42, 0xa4, 0x6f, 0xe0, 0xb7, 0x99, 0x6c, 0x4b, 0x21, 0x9f, 0xc9, 0x9a, 0x1e, 0x25, 0x52,
+  0xca, 0xae, 0xb2, 0x2b, 0x9d, 0x78, 0x75, 0x8f, 0x23, 0x84, 0x7d, 0x12, 0x90, 0x92, 0xd9, 0xc7,
+  0xa0, 0xdd, 0xc9, 0xb8, 0x0f, 0x36, 0xbc, 0x0c, 0xff, 0x9e, 0xe5, 0x6d, 0xc3, 0x48, 0x22, 0x69,
+  0x66, 0x70, 0x8e, 0x44, 0xee, 0x36, 0xac, 0x00, 0x1e, 0x9f, 0x64, 0x51, 0x3e, 0x42, 0xd6, 0x36,
+  0x78, 0xf1, 0x3e, 0x36, 0x83, 0x70, 0xc8, 0xf2, 0xb6, 0x61, 0x88, 0xd7, 0xa0, 0x19, 0x0c, 0x7e,
+  0x0b, 0x69, 0x1b, 0x86, 0x1f, 0x78, 0x43, 0x78, 0x46, 0x94, 0xc5, 0x39, 0x13, 0xb9, 0x5b, 0xfb,
+  0xcf, 0x96, 0xce, 0xb5, 0xde, 0xb3, 0xbc, 0xad, 0x18, 0x9e, 0x17, 0xd8, 0x8d, 0x17, 0x6b, 0x28,
+  0x3c, 0x73, 0x1b, 0x0e, 0xf3, 0xba, 0xad, 0x0d, 0x23, 0x64, 0xe5, 0xc0, 0x27, 0xca, 0x40, 0x82,
+  0xcd, 0x01, 0x5b, 0xad, 0xc4, 0xe3, 0x91, 0xb8, 0x8c, 0xc7, 0x75, 0x0a, 0x26, 0xec, 0x2e, 0x61,
+  0x2a, 0x5a, 0xe2, 0x05, 0xbb, 0x08, 0xa9, 0x12, 0x7f, 0x70, 0xdb, 0xd6, 0x8d, 0xe3, 0x01, 0xb2,
+  0x14, 0x0b, 0xa8, 0x52, 0x62, 0x51, 0x1b, 0xf8, 0x27, 0x0f, 0xb0, 0x94, 0x0d, 0x65, 0xc3, 0xf3,
+  0xa4, 0xcc, 0x8c, 0x39, 0xbc, 0x11, 0x1d, 0x27, 0x9b, 0x4b, 0xed, 0x82, 0x88, 0x67, 0xf1, 0x1d,
+  0x28, 0x65, 0xe5, 0x17, 0xa5, 0xcc, 0x9a, 0x8d, 0x3d, 0x0b, 0x60, 0xe7, 0x94, 0x52, 0x17, 0x82,
+  0xb6, 0x41, 0x27, 0x8b, 0x5d, 0xe2, 0xd9, 0xa4, 0x10, 0x07, 0x8c, 0x4c, 0xaa, 0x0b, 0x3c, 0x75,
+  0xc9, 0x7a, 0x7d, 0xc3, 0x2f, 0x8a, 0xf2, 0xa3, 0x52, 0xa9, 0xfb, 0xac, 0x2e, 0x75, 0x95, 0x9c,
+  0xc2, 0x3e, 0xcd, 0x32, 0x50, 0x4f, 0x8f, 0xe0, 0x33, 0xd9, 0x3c, 0x9c, 0x8e, 0xb8, 0x69, 0x7a,
+  0xc3, 0x43, 0x79, 0x89, 0x76, 0xd2, 0xa0, 0xb6, 0xf9, 0x0d, 0x25, 0x87, 0xfb, 0x39, 0xed, 0xdc,
+  0x4f, 0x45, 0xfc, 0xda, 0x3c, 0x9f, 0x98, 0xf4, 0x69, 0xf8, 0xcd, 0xaa, 0x90, 0xe7, 0x70, 0x29,
+  0x9b, 0x40, 0x61, 0xc6, 0x5d, 0x73, 0x1f, 0x53, 0xf3, 0xab, 0x88, 0x9d, 0x36, 0xc8, 0x44, 0xb9,
+  0xfd, 0xfb, 0x87, 0x9d, 0xba, 0x6e, 0x60, 0x58, 0x6c, 0x3a, 0x4d, 0xa2, 0x50, 0xde, 0xe4, 0x23,
+  0xdc, 0xb0, 0x40, 0xa7, 0x52, 0x73, 0x40, 0x26, 0x78, 0x2f, 0x9e, 0x98, 0xca, 0xc5, 0x0b, 0x45,
+  0x2d, 0x88, 0x3a, 0xb2, 0x64, 0xf0, 0x40, 0x10, 0x4f, 0x97, 0x71, 0xfc, 0x98, 0x75, 0x31, 0x52,
+  0x57, 0x71, 0xb0, 0x08, 0x11, 0xed, 0x58, 0x92, 0x25, 0x51, 0x21, 0xef, 0xb3, 0xba, 0x29, 0x35,
+  0x3c, 0x00, 0x44, 0xbe, 0xf8, 0x6f, 0xc4, 0x44, 0xcc, 0xc5, 0x2d, 0xa4, 0xd1, 0x9c, 0x1f, 0x82,
+  0x15, 0x31, 0x9c, 0x04, 0x31, 0xab, 0x4d, 0x6a, 0xdc, 0x9d, 0x9d, 0x4d, 0x69, 0x78, 0x62, 0x0a,
+  0x1d, 0xa3, 0x2e, 0x73, 0xd9, 0x13, 0xbb, 0xd6, 0x72, 0x59, 0x9e, 0x5e, 0xe2, 0x73, 0x6d, 0x3a,
+  0x4d, 0x07, 0x2c, 0x0d, 0x8f, 0x49, 0x1d, 0xd8, 0xae, 0x27, 0xa1, 0xff, 0x64, 0x87, 0x49, 0x02,
+  0x90, 0xeb, 0x96, 0x88, 0x51, 0xd5, 0x42, 0x0a, 0xb3, 0xee, 0x02, 0xdb, 0xa0, 0xa8, 0xac, 0xfc,
+  0xc3, 0x55, 0x54, 0xc1, 0x01, 0xd0, 0x74, 0x79, 0x9c, 0xe7, 0x0d, 0xf3, 0x20, 0x78, 0x6c, 0x9b,
+  0xc4, 0x3f, 0x75, 0xcf, 0xbd, 0x3c, 0x31, 0xbf, 0xca, 0x1a, 0xed, 0x5a, 0xf6, 0x56, 0xe5, 0x85,
+  0xea, 0x5b, 0x0f, 0x98, 0xc7, 0xe3, 0x3f, 0x6d, 0xd7, 0x2b, 0x66, 0x2e, 0xd5, 0x4c, 0x70, 0x5c,
+  0xe6, 0xdf, 0x14, 0x1f, 0x89, 0xe4, 0x9a, 0xa6, 0x72, 0x7e, 0xd6, 0x7b, 0xaf, 0xa4, 0x25, 0xc9,
+  0xe0, 0x08, 0x5f, 0x44, 0x21, 0x9b, 0x1b, 0x07, 0x95, 0x8a, 0x63, 0x02, 0xb2, 0x52, 0x96, 0x97,
+  0x81, 0x17, 0xf1, 0xd7, 0xe2, 0x00, 0x54, 0x71, 0x27, 0x8e, 0xf8, 0x43, 0xea, 0x92, 0x78, 0x50,
+  0xcd, 0x03, 0xd0, 0xc4, 0xdf, 0x31, 0xdb, 0xc4, 0xec, 0x32, 0x93, 0x95, 0x40, 0x97, 0xa6, 0x5c,
+  0xf6, 0x66, 0xba, 0x22, 0xe0, 0x15, 0xd6, 0xc5, 0x27, 0x12, 0x36, 0x44, 0x97, 0x48, 0xab, 0x82,
+  0xe0, 0x51, 0x79, 0xd5, 0x69, 0x69, 0x05, 0xab, 0x82, 0x84, 0x90, 0xde, 0x70, 0x37, 0x45, 0xee,
+  0x2a, 0x1b, 0x76, 0xcc, 0x0f, 0x3c, 0x1f, 0xde, 0xec, 0x90, 0x30, 0x0d, 0xfe, 0xcb, 0x39, 0xcc,
+  0x2c, 0x7c, 0xd6, 0x40, 0xbe, 0xd8, 0x6d, 0x7a, 0x89, 0xb3, 0x8e, 0x99, 0x8d, 0xb5, 0x47, 0xdb,
+  0x50, 0x18, 0x5c, 0x0d, 0x25, 0x14, 0xe8, 0x4c, 0x7b, 0x88, 0x18, 0xb5, 0xf0, 0xf9, 0x68, 0xee,
+  0x31, 0x68, 0xce, 0xbb, 0x04, 0x51, 0x2d, 0x24, 0x9f, 0x12, 0x17, 0xd6, 0x5b, 0x93, 0x82, 0xc0,
+  0xaf, 0xb7, 0x21, 0xfb, 0xcd, 0x63, 0xdd, 0xb7, 0x8e, 0x9e, 0xaa, 0xbc, 0xf2, 0xfd, 0x75, 0xac,
+  0xd6, 0xba, 0x2a, 0x4b, 0xda, 0xb2, 0x50, 0xad, 0x3e, 0x31, 0x91, 0x01, 0x77, 0x15, 0x44, 0xe8,
+  0x4a, 0x64, 0x14, 0x36, 0xa2, 0x4a, 0xad, 0x63, 0xab, 0xf1, 0x8a, 0x91, 0x89, 0xae, 0xc6, 0xa7,
+  0xd7, 0x06, 0x6c, 0xa2, 0x69, 0xf8, 0x94, 0x33, 0xba, 0xec, 0xef, 0xfe, 0x3a, 0x5c, 0x1c, 0xd3,
+  0x8b, 0x95, 0xc2, 0xb6, 0x70, 0x53, 0xa1, 0xae, 0xa3, 0xac, 0x69, 0x53, 0x11, 0x14, 0xf4, 0x61,
+  0x3c, 0x75, 0xb5, 0xce, 0x13, 0x79, 0x32, 0xc9, 0x3d, 0xdb, 0xa2, 0x86, 0x33, 0xca, 0x3e, 0x9e,
+  0x90, 0x39, 0xd5, 0x71, 0x82, 0x36, 0x5a, 0x83, 0xe7, 0xdc, 0x5c, 0xd6, 0x26, 0x81, 0xf3, 0x9d,
+  0x91, 0xf5, 0x0b, 0x10, 0x11, 0x5b, 0xe1, 0x41, 0xe7, 0x15, 0xbe, 0xf2, 0x40, 0xce, 0x8d, 0x38,
+  0x11, 0xcd, 0x89, 0x35, 0x23, 0xe2, 0x5e, 0xaf, 0xaa, 0xd0, 0x6c, 0xf5, 0xa6, 0x90, 0x17, 0xac,
+  0x6b, 0x8d, 0xb8, 0xec, 0x7c, 0xd1, 0x12, 0x1f, 0x66, 0x92, 0xc3, 0x62, 0x62, 0x2d, 0x13, 0xee,
+  0x00, 0x8e, 0x1c, 0xef, 0x97, 0x87, 0xcc, 0xca, 0x14, 0xeb, 0x2e, 0x99, 0xf1, 0x48, 0xb1, 0x99,
+  0x90, 0x35, 0x92, 0x42, 0xe0, 0xaf, 0xdc, 0xc5, 0x05, 0x31, 0x45, 0x93, 0x66, 0xab, 0x96, 0xa9,
+  0x89, 0x9d, 0xe1, 0xc8, 0x0e, 0x78, 0x3e, 0xc8, 0xb1, 0x1f, 0xf6, 0xe6, 0xe9, 0xf2, 0x9e, 0x30,
+  0xe6, 0x2d, 0x75, 0x75, 0xb3, 0xe6, 0xba, 0x27, 0xf3, 0x28, 0xc0, 0xa6, 0xa2, 0xc8, 0xd1, 0x0c,
+  0x15, 0x85, 0x19, 0x34, 0x21, 0xf1, 0xe1, 0x33, 0xd6, 0x4e, 0x6b, 0x0d, 0xca, 0x8a, 0x0a, 0x0e,
+  0x15, 0x7e, 0x86, 0x5e, 0xea, 0x26, 0x02, 0xf8, 0x09, 0x07, 0xeb, 0x52, 0xc7, 0x69, 0xbb, 0x81,
+  0x7b, 0x82, 0xfe, 0x0a, 0xc5, 0xd1, 0x1e, 0xc5, 0xaa, 0xbf, 0x46, 0xdc, 0xea, 0x86, 0x0b, 0x47,
+  0x3e, 0xce, 0xd7, 0x2d, 0x48, 0x1a, 0xfa, 0xde, 0x82, 0xeb, 0x9b, 0x02, 0x70, 0xe9, 0x46, 0xbb,
+  0x61, 0x52, 0xce, 0x98, 0xa9, 0x2e, 0x39, 0x4f, 0x45, 0xab, 0x37, 0x65, 0x96, 0x64, 0x70, 0x8a,
+  0xa6, 0xf0, 0x38, 0xa9, 0x62, 0x8a, 0xa4, 0x94, 0xc5, 0xab, 0x48, 0x07, 0x6d, 0xd8, 0xbc, 0xb0,
+  0x4f, 0x40, 0x4a, 0x39, 0x33, 0x96, 0x7a, 0xe4, 0x9d, 0xb3, 0x8b, 0xe4, 0xa5, 0x46, 0x5b, 0x4d,
+  0x62, 0x8e, 0xaf, 0x94, 0xcc, 0x21, 0xa2, 0xbc, 0xdc, 0x48, 0xe2, 0x79, 0xb3, 0xcc, 0x9a, 0x4a,
+  0xea, 0x4a, 0xe9, 0x2c, 0x9f, 0x2e, 0xb9, 0x69, 0x8d, 0x9e, 0x72, 0xea, 0xe1, 0x23, 0x59, 0xb8,
+  0xe0, 0xd8, 0x2e, 0xdd, 0x95, 0xc9, 0x9b, 0x74, 0x44, 0xe6, 0x11, 0x71, 0x6d, 0x69, 0xab, 0xb6,
+  0x45, 0x2c, 0x95, 0x58, 0x2e, 0x1f, 0xea, 0x40, 0xd2, 0x4c, 0x76, 0x6f, 0xbf, 0xd9, 0xd0, 0xff,
+  0xdf, 0x30, 0x7d, 0xc7, 0x86, 0x09, 0x42, 0x35, 0x6c, 0x16, 0x8e, 0xa9, 0x0b, 0x45, 0x78, 0x9e,
+  0x53, 0x84, 0xe7, 0x2b, 0xe5, 0xd1, 0xfb, 0xac, 0x1f, 0xd6, 0x45, 0xf1, 0x60, 0xaf, 0x3b, 0x65,
+  0x7e, 0x78, 0xb8, 0xb7, 0x6d, 0xe5, 0x1e, 0xe2, 0x7c, 0xf9, 0x2f, 0xf0, 0x3e, 0xe1, 0x92, 0xfc,
+  0x42, 0x93, 0x7b, 0x9f, 0xc6, 0x2c, 0x58, 0x5c, 0x22, 0x0b, 0x3f, 0xd3, 0x14, 0x87, 0x73, 0x32,
+  0xc9, 0x94, 0x61, 0x06, 0x90, 0xf8, 0x49, 0x0f, 0x6e, 0x36, 0xc7, 0x76, 0xb7, 0x4d, 0x22, 0x12,
+  0x8c, 0xa9, 0x8b, 0x23, 0x62, 0xf2, 0x36, 0x4d, 0xb3, 0x52, 0x63, 0xba, 0x76, 0x63, 0x42, 0x70,
+  0x1c, 0x9b, 0x86, 0x90, 0xc1, 0x63, 0x9b, 0x3f, 0xbc, 0xd4, 0x88, 0x31, 0xdd, 0xd7, 0x1b, 0x8d,
+  0xe7, 0x95, 0x5a, 0x67, 0x2d, 0xb3, 0xdd, 0x7e, 0x6e, 0x74, 0x6a, 0xd2, 0x58, 0x67, 0xbc, 0x69,
+  0xff, 0xe9, 0x03, 0x7d, 0xef, 0x30, 0xb3, 0x59, 0x62, 0x88, 0x29, 0x51, 0x6f, 0xb5, 0xbe, 0x6f,
+  0xe0, 0xb7, 0x6e, 0x42, 0x83, 0xe9, 0x83, 0x5a, 0xe2, 0x51, 0x92, 0x11, 0x4e, 0xfc, 0x54, 0xad,
+  0x6f, 0x40, 0xf2, 0x10, 0xc3, 0x41, 0xea, 0x84, 0xc8, 0xdb, 0x7c, 0x06, 0x53, 0x6e, 0xad, 0x73,
+  0xb0, 0xac, 0x0c, 0x15, 0x82, 0xe9, 0x9a, 0xd1, 0xce, 0x89, 0xfc, 0xeb, 0xd3, 0x3b, 0xeb, 0x0f,
+  0xfd, 0xaf, 0x35, 0xe6, 0x8f, 0x54, 0xab, 0xdb, 0x9d, 0x2f, 0x19, 0x2d, 0x99, 0xcf, 0x2a, 0x76,
+  0xc7, 0x39, 0xe1, 0x46, 0xd6, 0xd7, 0xfb, 0xc3, 0xdc, 0xc8, 0x9d, 0xbf, 0xdb, 0x58, 0xf4, 0x1f,
+  0xb8, 0xc2, 0x71, 0x4b, 0x6b, 0x6b, 0xc3, 0x3c, 0x6e, 0xe9, 0x0f, 0x36, 0xfd, 0xb0, 0x1f, 0x50,
+  0x84, 0xb0, 0xbc, 0xf9, 0xc9, 0x6e, 0x0e, 0x16, 0xfa, 0x9f, 0x85, 0xcb, 0x0c, 0xd9, 0x1a, 0x07,
+  0xc7, 0xf3, 0xbd, 0x88, 0xff, 0x98, 0x23, 0x29, 0x29, 0xa2, 0x88, 0xcf, 0x25, 0x91, 0x50, 0x97,
+  0x31, 0x82, 0xf8, 0x1b, 0x47, 0xff, 0xd6, 0x14, 0x35, 0xdf, 0xfa, 0x90, 0x71, 0xd3, 0x06, 0x8f,
+  0xbc, 0x09, 0x9c, 0xc7, 0x48, 0xc7, 0x88, 0x22, 0xa2, 0xa7, 0x37, 0x40, 0x09, 0x78, 0x82, 0x1a,
+  0x43, 0x9b, 0x62, 0xbb, 0xe9, 0x66, 0x67, 0x30, 0x07, 0x2a, 0x64, 0x60, 0xf9, 0xe1, 0x4d, 0xf2,
+  0x9b, 0x0c, 0x59, 0xf7, 0x8c, 0x58, 0x49, 0xd2, 0x3d, 0xb8, 0xd8, 0x0c, 0x3c, 0x9e, 0xb6, 0x35,
+  0x7f, 0x0f, 0x08, 0x41, 0x26, 0x24, 0xe9, 0xd3, 0xe5, 0x1a, 0x35, 0xab, 0x83, 0x38, 0x6b, 0x95,
+  0xc4, 0x28, 0xe5, 0xf6, 0xb4, 0xdc, 0x27, 0xc9, 0x21, 0xb4, 0x5a, 0x3d, 0xd2, 0x99, 0xb2, 0xb3,
+  0x23, 0x6d, 0xed, 0x04, 0x7d, 0xf1, 0x82, 0xf9, 0x98, 0x6d, 0xfe, 0x0f, 0xee, 0xdd, 0x1f, 0x2b,
+  0x65, 0xac, 0x5f, 0x61, 0xae, 0x60, 0x69, 0x9b, 0x84, 0x67, 0xb7, 0xf8, 0xdf, 0x8f, 0x9b, 0x59,
+  0x3d, 0xd6, 0xd9, 0xf6, 0x5d, 0x8b, 0xbc, 0x91, 0xb3, 0xc6, 0xd7, 0x3a, 0xf5, 0x8d, 0xbd, 0x65,
+  0xbc, 0x62, 0x65, 0x32, 0x6f, 0x12, 0x3a, 0x3b, 0x5f, 0x15, 0x42, 0x81, 0x5e, 0xe5, 0x6e, 0x46,
+  0x20, 0x02, 0xac, 0x1d, 0x10, 0xaa, 0x5c, 0xdf, 0xa8, 0x89, 0xa6, 0x5c, 0x3f, 0xe1, 0xfa, 0xe9,
+  0x2b, 0x47, 0x7c, 0xb0, 0x76, 0x8f, 0x11, 0xfc, 0xb0, 0xea, 0x4a, 0x4e, 0xe7, 0x0e, 0xf6, 0xab,
+  0xf1, 0xf7, 0x81, 0x64, 0xdb, 0x66, 0x8e, 0xdc, 0x7e, 0x7a, 0x17, 0xf8, 0x29, 0xdf, 0x0f, 0xeb,
+  0xf6, 0xfd, 0x2a, 0xaf, 0x00, 0x66, 0xdc, 0x23, 0x8f, 0x4b, 0x36, 0x74, 0x19, 0xf7, 0xe8, 0x6c,
+  0xe6, 0xa5, 0x5e, 0x8f, 0x58, 0xfa, 0xee, 0x69, 0x01, 0x0e, 0xe7, 0xee, 0x59, 0x3d, 0xa5, 0xfd,
+  0xa7, 0x7c, 0xba, 0xf8, 0x97, 0xf6, 0x85, 0xcc, 0xb3, 0x90, 0xb8, 0x77, 0x65, 0xa7, 0xae, 0xf0,
+  0x39, 0x74, 0x13, 0x08, 0xb8, 0x8b, 0x26, 0xef, 0x99, 0x0b, 0x69, 0x49, 0x1a, 0x31, 0x78, 0x93,
+  0xc1, 0x05, 0xe6, 0x37, 0x8e, 0x41, 0x35, 0x25, 0xe2, 0xf1, 0xed, 0x72, 0x4e, 0x3e, 0x04, 0x45,
+  0x41, 0x42, 0xce, 0x3a, 0x26, 0xfc, 0x32, 0xb2, 0xa2, 0x6a, 0x4a, 0x14, 0x28, 0xea, 0xe3, 0x8f,
+  0x2f, 0xa2, 0x51, 0xea, 0xbe, 0x0e, 0xe2, 0x9a, 0x98, 0x0b, 0x2f, 0xee, 0x55, 0x5c, 0x45, 0x72,
+  0x4a, 0x99, 0x64, 0x50, 0x3b, 0x06, 0x4b, 0xbb, 0x98, 0x14, 0xb2, 0xde, 0xc5, 0xb5, 0x24, 0x8b,
+  0x45, 0x6c, 0x25, 0x49, 0x75, 0x70, 0xb3, 0xf4, 0x31, 0xc7, 0x28, 0xe0, 0xca, 0x8f, 0xf1, 0xc4,
+  0xb9, 0x54, 0xc6, 0x5b, 0xc6, 0x0a, 0xb9, 0x0c, 0x40, 0x3b, 0x7c, 0x39, 0x51, 0x34, 0xe9, 0xf4,
+  0x45, 0x96, 0x7c, 0x6d, 0xad, 0xae, 0x42, 0xde, 0x4f, 0x98, 0xfc, 0xc8, 0xb9, 0x95, 0xf8, 0x15,
+  0xa5, 0xb4, 0x55, 0x59, 0xa5, 0x26, 0xbf, 0x42, 0x92, 0x6d, 0x7d, 0xa5, 0xca, 0x6b, 0x96, 0x64,
+  0xa2, 0x84, 0xb9, 0xd3, 0x6b, 0xe3, 0x57, 0x0d, 0x26, 0x24, 0x14, 0x0e, 0x37, 0x26, 0x41, 0x6b,
+  0xfe, 0xf9, 0x35, 0xa7, 0xbc, 0x10, 0xb2, 0x6e, 0x2a, 0x50, 0xa1, 0x99, 0xa0, 0x6d, 0x06, 0x3d,
+  0x61, 0x12, 0xd5, 0xcd, 0x2e, 0x75, 0x02, 0x2d, 0xb3, 0xb2, 0xed, 0x73, 0x3a, 0x72, 0x57, 0x3b,
+  0x49, 0x6e, 0x93, 0x96, 0xbe, 0x5b, 0x54, 0xed, 0x4d, 0x51, 0xb5, 0x15, 0x49, 0x7c, 0x3e, 0x49,
+  0x47, 0xfd, 0xf7, 0x1c, 0xc4, 0xc5, 0x60, 0xb2, 0xb2, 0xe1, 0x75, 0x73, 0x5e, 0x8b, 0x1f, 0xd4,
+  0xc9, 0xb9, 0xc4, 0x9c, 0xaa, 0xec, 0xec, 0x95, 0x87, 0x9f, 0xae, 0xb3, 0xff, 0x92, 0x35, 0x9e,
+  0x89, 0xce, 0x2e, 0x6e, 0xc5, 0x64, 0x77, 0xae, 0xed, 0x56, 0xab, 0xd1, 0x56, 0x10, 0x0b, 0xb0,
+  0x3e, 0xf2, 0x1c, 0x9b, 0x04, 0xa6, 0x32, 0x87, 0x27, 0x39, 0x3f, 0x84, 0xb9, 0xf8, 0x61, 0xcc,
+  0x3b, 0xfe, 0x0c, 0xe8, 0x3f, 0xd8, 0xf7, 0xb1, 0xb3, 0x23, 0x7c, 0x1f, 0xd4, 0x61, 0xa3, 0x1c,
+  0x8a, 0x2b, 0xd1, 0x60, 0x99, 0xcd, 0x37, 0x0a, 0xbf, 0x1a, 0xd7, 0xea, 0x66, 0x96, 0x6c, 0x5d,
+  0xea, 0xf3, 0xc4, 0xf4, 0xd4, 0x17, 0x9b, 0xf8, 0xb5, 0x4d, 0xfc, 0x5a, 0x16, 0x7f, 0x91, 0xe2,
+  0xdf, 0x6d, 0xe2, 0xd7, 0x37, 0xf1, 0xeb, 0x59, 0xfc, 0xbb, 0xed, 0x2e, 0x17, 0xf6, 0x3b, 0x53,
+  0xf7, 0xec, 0xbb, 0x1b, 0x6d, 0x03, 0xbc, 0xd5, 0xf0, 0x73, 0x53, 0x8f, 0x80, 0xba, 0x7b, 0x18,
+  0x0a, 0x36, 0xf1, 0xf9, 0x2f, 0x73, 0x97, 0xf2, 0xab, 0xda, 0x5e, 0x40, 0xb1, 0xa3, 0xbd, 0x26,
+  0x0e, 0x8f, 0x81, 0xa9, 0xa5, 0xaf, 0x6c, 0xbb, 0xf9, 0xef, 0x72, 0xa7, 0x38, 0x28, 0xc9, 0x31,
+  0x8e, 0x55, 0xe9, 0x41, 0x18, 0x2f, 0x4b, 0xd2, 0xea, 0x6a, 0x54, 0xd3, 0x46, 0xf5, 0xa5, 0x8c,
+  0x38, 0x8a, 0xb1, 0xd8, 0x8b, 0xbd, 0xf8, 0x5d, 0x99, 0x3f, 0x5f, 0xd9, 0x74, 0xba, 0x94, 0xf3,
+  0xea, 0x2b, 0x76, 0x4c, 0x98, 0x7d, 0xb3, 0xd9, 0xf6, 0xe7, 0x19, 0x32, 0xa4, 0x98, 0xdd, 0xea,
+  0x4a, 0x78, 0xbd, 0x79, 0xf7, 0x58, 0x7f, 0x3b, 0x34, 0xc2, 0x0e, 0xb5, 0xe2, 0x27, 0xa1, 0x0e,
+  0x19, 0x6c, 0x56, 0x91, 0x09, 0xf0, 0xad, 0xae, 0xd8, 0x74, 0x91, 0x9f, 0x24, 0xc3, 0x95, 0xd2,
+  0x47, 0x74, 0x9d, 0x3d, 0xdc, 0xe2, 0x5b, 0x5a, 0x19, 0xdb, 0x40, 0xc6, 0x63, 0x91, 0xb9, 0x71,
+  0xbd, 0xdc, 0x06, 0x2d, 0x55, 0xca, 0x0b, 0xe3, 0xc8, 0xd3, 0xea, 0x0a, 0xe7, 0x73, 0x98, 0x61,
+  0xc3, 0x8f, 0x75, 0x06, 0xec, 0x44, 0x8d, 0xbf, 0x17, 0x86, 0x4c, 0x08, 0x66, 0x28, 0xbd, 0xbc,
+  0xed, 0xca, 0x8f, 0xb4, 0xc5, 0x33, 0x35, 0x88, 0x25, 0x3f, 0x09, 0xf9, 0xa3, 0xd6, 0xc7, 0x75,
+  0x67, 0xc5, 0xad, 0x51, 0x51, 0x6f, 0xc3, 0x30, 0x92, 0xd7, 0x97, 0x86, 0x91, 0x5b, 0x2b, 0xcb,
+  0x92, 0x1f, 0xc2, 0x81, 0x8c, 0xad, 0xb7, 0xc5, 0x5f, 0x8b, 0x8a, 0xeb, 0x67, 0x2b, 0x1d, 0xae,
+  0x82, 0x2c, 0xe5, 0xd1, 0xac, 0x1b, 0xec, 0x85, 0x2d, 0x53, 0xed, 0x8f, 0x15, 0xeb, 0x24, 0x2a,
+  0xbc, 0x83, 0xfd, 0x90, 0x74, 0xe2, 0x0f, 0xf1, 0x70, 0x74, 0x83, 0x58, 0x23, 0x21, 0x56, 0x08,
+  0x95, 0x78, 0x99, 0x2b, 0x3d, 0x0f, 0x34, 0xd8, 0xab, 0x40, 0xe8, 0x0a, 0xfc, 0x3e, 0x81, 0xa0,
+  0x07, 0x45, 0xb6, 0x16, 0x7f, 0x8d, 0x96, 0xf9, 0xdd, 0x8d, 0x9f, 0xfd, 0x81, 0x50, 0xc6, 0x81,
+  0x40, 0xc5, 0xf3, 0xe0, 0xc8, 0xf3, 0x57, 0x29, 0xba, 0xf4, 0x6e, 0x18, 0xfa, 0xbd, 0xf9, 0xc8,
+  0x50, 0x8c, 0x47, 0x32, 0xf8, 0x5b, 0x67, 0x89, 0xce, 0x9f, 0x5f, 0x69, 0xe2, 0xac, 0x4f, 0xd3,
+  0xf9, 0xef, 0x6e, 0x6a, 0xba, 0x78, 0x72, 0x15, 0x53, 0x5a, 0x4f, 0x28, 0x15, 0xe2, 0x26, 0x05,
+  0xd3, 0xbf, 0x4f, 0x1a, 0xf3, 0xd8, 0x17, 0x77, 0xb3, 0x95, 0x3c, 0xcf, 0x66, 0x9f, 0x62, 0x74,
+  0x21, 0xec, 0xd9, 0x4a, 0x8f, 0x3c, 0xcf, 0x89, 0xa8, 0xbf, 0x4c, 0x1e, 0xe0, 0x06, 0xc4, 0xc1,
+  0x10, 0xc2, 0xa0, 0x9b, 0xfb, 0xca, 0x77, 0xf3, 0x39, 0xa5, 0xed, 0x45, 0x10, 0x37, 0x05, 0xf8,
+  0x9a, 0xd4, 0x86, 0xe2, 0x0f, 0xe0, 0xdf, 0x92, 0xc5, 0x1b, 0xa6, 0x0e, 0x8d, 0x16, 0xf1, 0x18,
+  0x8a, 0x49, 0x50, 0x37, 0xb2, 0x0f, 0x84, 0x65, 0xe6, 0xa5, 0x1d, 0xdb, 0xd4, 0x2b, 0xdb, 0xf5,
+  0x48, 0x77, 0xe3, 0xa1, 0xb7, 0xcc, 0x04, 0xb4, 0x2e, 0x64, 0x30, 0xfe, 0x49, 0xc7, 0x71, 0x3f,
+  0xf4, 0x9c, 0x49, 0x44, 0xba, 0x77, 0x15, 0x76, 0x65, 0xb7, 0x53, 0xeb, 0x26, 0xef, 0xc9, 0x5b,
+  0x7f, 0xeb, 0x32, 0xb9, 0x6f, 0x25, 0xf1, 0x14, 0xf8, 0x3c, 0xa8, 0xb4, 0xa1, 0x0b, 0x9e, 0x8f,
+  0x2d, 0xe8, 0x9d, 0xd1, 0x8d, 0x02, 0xec, 0x8a, 0xea, 0x44, 0x26, 0xd2, 0x1b, 0x61, 0x3e, 0x5f,
+  0x3a, 0x1d, 0x16, 0xf9, 0x64, 0x19, 0xbf, 0xda, 0x56, 0x94, 0x1c, 0x5a, 0xd8, 0x13, 0x77, 0x50,
+  0x10, 0xf9, 0xcd, 0xb7, 0xd2, 0x49, 0xc2, 0x79, 0xda, 0x5a, 0x9f, 0x35, 0x4c, 0x96, 0xba, 0xd9,
+  0x9f, 0x64, 0x68, 0xb5, 0x5a, 0x88, 0x51, 0xca, 0xcd, 0xad, 0x6d, 0xdf, 0x09, 0xd9, 0xfc, 0x89,
+  0xf8, 0xd6, 0x41, 0x15, 0xf1, 0xa4, 0x13, 0x36, 0xd4, 0x56, 0x79, 0x6f, 0x7c, 0xc5, 0x78, 0xc9,
+  0x3f, 0x34, 0xa0, 0xe6, 0x3d, 0xb9, 0x4d, 0x6e, 0x48, 0x27, 0xef, 0x14, 0xc5, 0x5a, 0xae, 0xbc,
+  0x20, 0x63, 0x4f, 0x59, 0x25, 0xe5, 0xe2, 0xf7, 0x85, 0xcf, 0x49, 0x34, 0xf1, 0xc1, 0x16, 0x5d,
+  0x2f, 0x28, 0xb9, 0xc9, 0x7e, 0xb8, 0x66, 0x9a, 0x2e, 0x5c, 0x8d, 0x2f, 0x6c, 0xfc, 0x44, 0x96,
+  0xb0, 0xd0, 0xe8, 0xd8, 0xf7, 0x82, 0x68, 0x8c, 0x7d, 0x25, 0x0d, 0x0c, 0x24, 0x32, 0x43, 0xa5,
+  0x23, 0x45, 0x93, 0x52, 0x22, 0x08, 0xa9, 0x0b, 0xa7, 0xce, 0x71, 0xe0, 0xfc, 0x89, 0xeb, 0xdf,
+  0x0e, 0x59, 0xdc, 0x7c, 0x56, 0xf4, 0x77, 0x43, 0xaf, 0xb5, 0xda, 0x7a, 0xad, 0xda, 0x9f, 0x50,
+  0xc7, 0xe6, 0x79, 0x62, 0xce, 0xeb, 0xdf, 0x42, 0x45, 0x5b, 0xab, 0x09, 0xa2, 0x75, 0x7a, 0x6e,
+  0x58, 0x7d, 0x4c, 0x8d, 0x22, 0x78, 0x6e, 0x58, 0xfd, 0x16, 0x8e, 0xab, 0x4a, 0x36, 0x4a, 0x21,
+  0x92, 0x7a, 0x56, 0x85, 0x9d, 0xef, 0x01, 0xda, 0x67, 0x61, 0xe2, 0xd9, 0x6f, 0x0e, 0xc1, 0xf6,
+  0x06, 0x79, 0xae, 0xe3, 0x61, 0x3b, 0x13, 0x86, 0xc8, 0x73, 0x4f, 0x3d, 0x6c, 0x97, 0x54, 0xf0,
+  0x6a, 0x00, 0xd0, 0x01, 0x2a, 0xec, 0x57, 0x21, 0x80, 0xc8, 0xc1, 0xff, 0x03, 0x52, 0x48, 0x08,
+  0x52, 0x70, 0x88, 0x00, 0x00
 };
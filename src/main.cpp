@@ -40,6 +40,14 @@ AppModDemo *appModDemo;
   #include "User/UserModE131.h"
   UserModE131 *e131mod;
 #endif
+#ifdef STARBASE_USERMOD_ARTNET
+  #include "User/UserModArtNetIn.h"
+  UserModArtNetIn *artNetInMod;
+#endif
+#ifdef STARBASE_USERMOD_DDP
+  #include "User/UserModDDPIn.h"
+  UserModDDPIn *ddpInMod;
+#endif
 #ifdef STARBASE_USERMOD_HA
   #include "User/UserModHA.h"
   UserModHA *hamod;
@@ -78,6 +86,12 @@ void setup() {
   #ifdef STARBASE_USERMOD_E131
     e131mod = new UserModE131();
   #endif
+  #ifdef STARBASE_USERMOD_ARTNET
+    artNetInMod = new UserModArtNetIn();
+  #endif
+  #ifdef STARBASE_USERMOD_DDP
+    ddpInMod = new UserModDDPIn();
+  #endif
   #ifdef STARBASE_USERMOD_HA
     hamod = new UserModHA();
   #endif
@@ -106,6 +120,12 @@ void setup() {
   #ifdef STARBASE_USERMOD_E131
     mdls->add(e131mod);
   #endif
+  #ifdef STARBASE_USERMOD_ARTNET
+    mdls->add(artNetInMod);
+  #endif
+  #ifdef STARBASE_USERMOD_DDP
+    mdls->add(ddpInMod);
+  #endif
   #ifdef STARBASE_USERMOD_HA
     mdls->add(hamod); //no ui
   #endif
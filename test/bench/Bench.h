@@ -0,0 +1,98 @@
+/*
+   @title     StarBase
+   @file      Bench.h
+   @date      20241219
+   @repo      https://github.com/ewowi/StarBase, submit changes to this file as PRs to ewowi/StarBase
+   @Authors   https://github.com/ewowi/StarBase/commits/main
+   @Copyright © 2024 Github StarBase Commit Authors
+   @license   GNU GENERAL PUBLIC LICENSE Version 3, 29 June 2007
+   @license   For non GPL-v3 usage, commercial licenses must be purchased. Contact moonmodules@icloud.com
+*/
+
+//benchmark harness of the native and device tests: runs a path iterations times (after a warm up run) and reports
+//  ns/op, cycles/op (ESP.getCycleCount, on the host a 240MHz equivalent, see test/shim/Arduino.h)
+//  allocations/op: heap allocations counted by BenchAllocator and the shim (psram), on device also heap bytes/op
+//checkBench compares with the tracked thresholds of BenchThresholds.h: a regression fails the test and so pio test
+
+#pragma once
+
+#include <unity.h>
+#include "SysModule.h"
+#include "BenchThresholds.h"
+
+#ifdef NATIVE
+  uint32_t shimAllocations = 0;
+  #define benchHeapAllocations() shimAllocations
+  #define benchFreeHeap() 0
+#else
+  #define benchHeapAllocations() 0
+  #define benchFreeHeap() ESP.getFreeHeap()
+#endif
+
+//ArduinoJson allocator of the documents made by a bench, counting its heap allocations
+class BenchAllocator: public ArduinoJson::Allocator {
+public:
+  uint32_t allocations = 0;
+
+  void* allocate(size_t size) override {allocations++; return malloc(size);}
+  void deallocate(void* pointer) override {free(pointer);}
+  void* reallocate(void* pointer, size_t size) override {allocations++; return realloc(pointer, size);}
+};
+
+BenchAllocator benchAllocator;
+
+struct BenchResult {
+  const char * name;
+  uint32_t iterations;
+  uint32_t nsPerOp;
+  uint32_t cyclesPerOp;
+  float allocationsPerOp;
+  int32_t heapBytesPerOp; //device only: free heap lost per op
+};
+
+template<typename Fun>
+BenchResult bench(const char * name, uint32_t iterations, Fun fun) {
+  fun(); //warm up: arenas, pools and caches filled once are not what a bench measures
+
+  uint32_t allocationsStart = benchAllocator.allocations + benchHeapAllocations();
+  uint32_t freeHeapStart = benchFreeHeap();
+  unsigned long microsStart = micros();
+  uint32_t cycles = 0; //summed per op: the cycle counter wraps every 18s at 240MHz
+  for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+    uint32_t cyclesStart = ESP.getCycleCount();
+    fun();
+    cycles += ESP.getCycleCount() - cyclesStart;
+  }
+  unsigned long elapsed = micros() - microsStart;
+
+  BenchResult result;
+  result.name = name;
+  result.iterations = iterations;
+  result.nsPerOp = elapsed * 1000ULL / iterations;
+  result.cyclesPerOp = cycles / iterations;
+  result.allocationsPerOp = (float)(benchAllocator.allocations + benchHeapAllocations() - allocationsStart) / iterations;
+  result.heapBytesPerOp = ((int32_t)freeHeapStart - (int32_t)benchFreeHeap()) / (int32_t)iterations;
+
+  char line[128];
+  snprintf(line, sizeof(line), "%-24s %6u x %9u ns/op %9u cycles/op %7.2f allocs/op %6d heap B/op", name, iterations, result.nsPerOp, result.cyclesPerOp, result.allocationsPerOp, result.heapBytesPerOp);
+  TEST_MESSAGE(line);
+  return result;
+}
+
+//fails the running test if the bench regressed: maxNs on the host, maxCycles on device (0: not tracked)
+inline void checkBench(const BenchResult &result, uint32_t maxNs, uint32_t maxCycles, float maxAllocations) {
+  char message[96];
+  #ifdef NATIVE
+    if (maxNs) {
+      snprintf(message, sizeof(message), "%s: %u ns/op above threshold %u", result.name, result.nsPerOp, maxNs);
+      TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(maxNs, result.nsPerOp, message);
+    }
+  #else
+    if (maxCycles) {
+      snprintf(message, sizeof(message), "%s: %u cycles/op above threshold %u", result.name, result.cyclesPerOp, maxCycles);
+      TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(maxCycles, result.cyclesPerOp, message);
+    }
+  #endif
+  snprintf(message, sizeof(message), "%s: %.2f allocs/op above threshold %.2f", result.name, result.allocationsPerOp, maxAllocations);
+  TEST_ASSERT_TRUE_MESSAGE(result.allocationsPerOp <= maxAllocations, message);
+}
@@ -0,0 +1,39 @@
+/*
+   @title     StarBase
+   @file      BenchThresholds.h
+   @date      20241219
+   @repo      https://github.com/ewowi/StarBase, submit changes to this file as PRs to ewowi/StarBase
+   @Authors   https://github.com/ewowi/StarBase/commits/main
+   @Copyright © 2024 Github StarBase Commit Authors
+   @license   GNU GENERAL PUBLIC LICENSE Version 3, 29 June 2007
+   @license   For non GPL-v3 usage, commercial licenses must be purchased. Contact moonmodules@icloud.com
+*/
+
+//tracked thresholds of the benches, see Bench.h: a bench above its threshold fails pio test
+//ns: host (env:native), with headroom for slower build machines. cycles: device (env:esp32dev_bench, 240MHz esp32)
+//lower a threshold when an optimization lands, raise it only with the reason in the commit message
+
+#pragma once
+
+//native: test/native/test_json
+#define BENCH_NS_MODEL_DESERIALIZE 2000000 //misc/model.json (35KB) into the model arena
+#define BENCH_ALLOCS_MODEL_DESERIALIZE 64 //ArduinoJson pools and long strings go to the heap (fallbacks)
+#define BENCH_NS_FIXTURE_DESERIALIZE 3000000 //misc/F_Panel2x2-16x16.json (64KB)
+#define BENCH_ALLOCS_FIXTURE_DESERIALIZE 16
+#define BENCH_NS_FIXTURE_STARJSON 3000000 //misc/F_Panel2x2-16x16.json read by StarJson: dimensions and 1024 led coordinates
+#define BENCH_ALLOCS_FIXTURE_STARJSON 0 //no documents: only the read buffer (heap, not counted)
+#define BENCH_NS_FINDVAR 500 //VarIndex lookup of pid.id of each var of misc/model.json, per var
+#define BENCH_ALLOCS_FINDVAR 0
+#define BENCH_NS_RESPONSE 200000 //32 value updates in a bump arena response, measured and serialized
+#define BENCH_ALLOCS_RESPONSE 0 //the bump arena reuses its chunks: no heap per response
+#define BENCH_NS_ARENA 20000 //256 value sized allocations and frees in the model arena
+#define BENCH_ALLOCS_ARENA 0 //size class free lists: no heap after the warm up
+#define BENCH_NS_MODEL_SERIALIZE 1000000 //misc/model.json back to text
+
+//device: test/device/test_model
+#define BENCH_CYCLES_FINDVAR 400000 //pid.id lookup of each var of the model, per var
+#define BENCH_CYCLES_SETVALUE 200000 //Variable::setValue of a number, incl. the response and onChange
+#define BENCH_CYCLES_PROCESSJSON 600000 //{"pid.id":{"value":n}} as received over the websocket
+#define BENCH_CYCLES_MODEL_DESERIALIZE 120000000 //model.json in LittleFS into a JsonDocument
+#define BENCH_CYCLES_RESPONSE 2000000 //measure, serialize and send the response of the loopTask
+#define BENCH_ALLOCS_DEVICE 4 //BenchAllocator documents only, the model arena is not counted on device
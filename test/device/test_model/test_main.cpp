@@ -0,0 +1,176 @@
+/*
+   @title     StarBase
+   @file      test_main.cpp
+   @date      20241219
+   @repo      https://github.com/ewowi/StarBase, submit changes to this file as PRs to ewowi/StarBase
+   @Authors   https://github.com/ewowi/StarBase/commits/main
+   @Copyright © 2024 Github StarBase Commit Authors
+   @license   GNU GENERAL PUBLIC LICENSE Version 3, 29 June 2007
+   @license   For non GPL-v3 usage, commercial licenses must be purchased. Contact moonmodules@icloud.com
+*/
+
+//benches of the model paths on device (pio test -e esp32dev_bench): the modules are set up as in main.cpp, then
+//findVar, setValue, processJson, model.json deserialize and the response are run against the model of the device
+//reports cycles/op (ESP.getCycleCount) and heap bytes/op, thresholds in test/bench/BenchThresholds.h
+
+#include "SysModule.h"
+#include "SysModules.h"
+#include "Sys/SysModPrint.h"
+#include "Sys/SysModWeb.h"
+#include "Sys/SysModUI.h"
+#include "Sys/SysModSystem.h"
+#include "Sys/SysModFiles.h"
+#include "Sys/SysModModel.h"
+#include "Sys/SysModNetwork.h"
+#include "Sys/SysModPins.h"
+#include "Sys/SysModInstances.h"
+#include "User/UserModMDNS.h"
+#include "App/AppModDemo.h"
+#include "Bench.h"
+
+//the globals of main.cpp (excluded from this env by build_src_filter)
+SysModules *mdls;
+SysModPrint *print;
+SysModWeb *web;
+SysModUI *ui;
+SysModSystem *sys;
+SysModFiles *files;
+SysModModel *mdl;
+SysModNetwork *net;
+SysModPins *pinsM;
+SysModInstances *instances;
+UserModMDNS *mdns;
+AppModDemo *appModDemo;
+
+//usermods referenced by the sources of the env, not benched
+#ifdef STARBASE_USERMOD_E131
+  #include "User/UserModE131.h"
+  UserModE131 *e131mod;
+#endif
+#ifdef STARBASE_USERMOD_ARTNET
+  #include "User/UserModArtNetIn.h"
+  UserModArtNetIn *artNetInMod;
+#endif
+#ifdef STARBASE_USERMOD_DDP
+  #include "User/UserModDDPIn.h"
+  UserModDDPIn *ddpInMod;
+#endif
+#ifdef STARBASE_USERMOD_LIVE
+  #include "User/UserModLive.h"
+  UserModLive *liveM;
+#endif
+
+SET_LOOP_TASK_STACK_SIZE(16 * 1024); // 16KB
+
+struct PidId {
+  const char * pid;
+  const char * id;
+};
+static std::vector<PidId> pidIds; //all vars of the model
+
+static uint16_t benchValue = 0;
+static Variable benchVar = Variable();
+
+void setUp() {}
+void tearDown() {}
+
+void test_findVar() {
+  TEST_ASSERT_GREATER_THAN(0, pidIds.size());
+  BenchResult result = bench("findVar", 100, []() {
+    for (const PidId &pidId: pidIds)
+      TEST_ASSERT_FALSE(mdl->findVar(pidId.pid, pidId.id).isNull());
+  });
+  result.cyclesPerOp /= pidIds.size(); //per var
+  checkBench(result, 0, BENCH_CYCLES_FINDVAR, BENCH_ALLOCS_DEVICE);
+}
+
+void test_setValue() {
+  BenchResult result = bench("setValue", 1000, []() {
+    benchVar.setValue((uint16_t)(benchValue + 1));
+  });
+  web->getResponseDoc()->to<JsonObject>(); //not sent
+  checkBench(result, 0, BENCH_CYCLES_SETVALUE, BENCH_ALLOCS_DEVICE);
+}
+
+void test_processJson() {
+  JsonDocument doc(&benchAllocator);
+  uint16_t value = 0;
+  BenchResult result = bench("processJson", 1000, [&doc, &value]() {
+    doc.to<JsonObject>();
+    doc["Bench.value"]["value"] = value++ % 1000;
+    ui->processJson(doc.as<JsonVariant>());
+  });
+  web->getResponseDoc()->to<JsonObject>();
+  checkBench(result, 0, BENCH_CYCLES_PROCESSJSON, BENCH_ALLOCS_DEVICE);
+}
+
+void test_model_deserialize() {
+  BenchResult result = bench("model.json deserialize", 10, []() {
+    JsonDocument doc(&benchAllocator);
+    TEST_ASSERT_TRUE(files->readObjectFromFile("/model.json", &doc));
+  });
+  checkBench(result, 0, BENCH_CYCLES_MODEL_DESERIALIZE, 1000); //cycles tracked, allocations are the pools of the document
+}
+
+void test_response() {
+  BenchResult result = bench("response", 100, []() {
+    JsonObject responseObject = web->getResponseObject();
+    for (size_t varNr = 0; varNr < 32 && varNr < pidIds.size(); varNr++) {
+      char pidid[64];
+      snprintf(pidid, sizeof(pidid), "%s.%s", pidIds[varNr].pid, pidIds[varNr].id);
+      responseObject[pidid]["value"] = varNr;
+    }
+    web->sendResponseObject(); //measureJson, serializeJson and send to the clients (none during the test)
+  });
+  checkBench(result, 0, BENCH_CYCLES_RESPONSE, BENCH_ALLOCS_DEVICE);
+}
+
+void setup() {
+  delay(2000); //time for the test runner to open the serial port
+
+  mdls = new SysModules();
+  print = new SysModPrint();
+  files = new SysModFiles();
+  mdl = new SysModModel();
+  net = new SysModNetwork();
+  web = new SysModWeb();
+  ui = new SysModUI();
+  sys = new SysModSystem();
+  pinsM = new SysModPins();
+  instances = new SysModInstances();
+  mdns = new UserModMDNS();
+  appModDemo = new AppModDemo();
+
+  //same order as main.cpp, without the usermods
+  mdls->add(appModDemo);
+  mdls->add(files);
+  mdls->add(sys);
+  mdls->add(pinsM);
+  mdls->add(print);
+  mdls->add(web);
+  mdls->add(net);
+  mdls->add(mdl);
+  mdls->add(ui);
+  mdls->add(mdns);
+  mdls->add(instances);
+  mdls->setup();
+
+  Variable parentVar = ui->initAppMod(Variable(), "Bench", 9000);
+  benchVar = ui->initNumber(parentVar, "value", &benchValue, 0, 1000);
+
+  mdl->walkThroughModel([](JsonObject parentVar, JsonObject var) {
+    Variable variable = Variable(var);
+    if (variable.pid() && variable.id()) pidIds.push_back({variable.pid(), variable.id()});
+    return JsonObject(); //continue
+  });
+
+  UNITY_BEGIN();
+  RUN_TEST(test_findVar);
+  RUN_TEST(test_setValue);
+  RUN_TEST(test_processJson);
+  RUN_TEST(test_model_deserialize);
+  RUN_TEST(test_response);
+  UNITY_END();
+}
+
+void loop() {}
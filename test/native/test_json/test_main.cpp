@@ -0,0 +1,184 @@
+/*
+   @title     StarBase
+   @file      test_main.cpp
+   @date      20241219
+   @repo      https://github.com/ewowi/StarBase, submit changes to this file as PRs to ewowi/StarBase
+   @Authors   https://github.com/ewowi/StarBase/commits/main
+   @Copyright © 2024 Github StarBase Commit Authors
+   @license   GNU GENERAL PUBLIC LICENSE Version 3, 29 June 2007
+   @license   For non GPL-v3 usage, commercial licenses must be purchased. Contact moonmodules@icloud.com
+*/
+
+//benches of the json paths on the host (pio test -e native): the model and a fixture in a JsonArena, responses in a JsonBumpArena,
+//the fixture read by StarJson and the pid.id lookup of findVar (VarIndex) on the model
+//SysModModel and SysModUI need the web and network stack, setValue and processJson are benched on device (test/device/test_model)
+
+#include "Sys/SysJsonAllocators.cpp"
+#include "Sys/SysStarJson.cpp"
+#include "Sys/SysVarIndex.h"
+#include "Bench.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+static std::string readMisc(const char * fileName) {
+  std::ifstream file(std::string(BENCH_MISC_DIR) + fileName);
+  std::stringstream text;
+  text << file.rdbuf();
+  return text.str();
+}
+
+static std::string modelJson;
+static std::string fixtureJson;
+
+//the modules StarJson uses, on the host: files->open reads from misc/, ppf only formats (on device the print task outputs)
+SysModPrint *print;
+SysModFiles *files;
+
+SysModPrint::SysModPrint(): SysModule("Print") {}
+void SysModPrint::setup() {}
+void SysModPrint::loop20ms() {}
+void SysModPrint::printf(const char * format, ...) {
+  char text[256];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(text, sizeof(text), format, args);
+  va_end(args);
+}
+
+SysModFiles::SysModFiles(): SysModule("Files") {}
+void SysModFiles::setup() {}
+void SysModFiles::loop20ms() {}
+void SysModFiles::loop10s() {}
+File SysModFiles::open(const char * path, const char * mode, const bool create) {
+  return File(fopen((std::string(BENCH_MISC_DIR) + (*path == '/'?path + 1:path)).c_str(), mode));
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_model_deserialize() {
+  JsonArena arena("bench model");
+  BenchResult result = bench("model deserialize", 50, [&arena]() {
+    JsonDocument doc(&arena);
+    DeserializationError error = deserializeJson(doc, modelJson);
+    TEST_ASSERT_FALSE_MESSAGE(error, error.c_str());
+  });
+  checkBench(result, BENCH_NS_MODEL_DESERIALIZE, 0, BENCH_ALLOCS_MODEL_DESERIALIZE);
+}
+
+void test_fixture_deserialize() {
+  JsonArena arena("bench fixture");
+  BenchResult result = bench("fixture deserialize", 50, [&arena]() {
+    JsonDocument doc(&arena);
+    DeserializationError error = deserializeJson(doc, fixtureJson);
+    TEST_ASSERT_FALSE_MESSAGE(error, error.c_str());
+  });
+  checkBench(result, BENCH_NS_FIXTURE_DESERIALIZE, 0, BENCH_ALLOCS_FIXTURE_DESERIALIZE);
+}
+
+//as the fixture is read on device: SAX over the file, the dimensions and each led coordinate
+void test_fixture_starjson() {
+  BenchResult result = bench("fixture StarJson", 50, []() {
+    StarJson starJson("/F_Panel2x2-16x16.json");
+    int32_t nrOfLeds = 0;
+    uint16_t leds = 0;
+    starJson.lookFor("nrOfLeds", &nrOfLeds);
+    starJson.lookFor("leds", [&leds](std::vector<uint16_t> coordinate) {
+      leds++;
+    });
+    starJson.deserialize();
+    TEST_ASSERT_EQUAL_INT32(1024, nrOfLeds);
+    TEST_ASSERT_EQUAL_UINT16(nrOfLeds, leds);
+  });
+  checkBench(result, BENCH_NS_FIXTURE_STARJSON, 0, BENCH_ALLOCS_FIXTURE_STARJSON);
+}
+
+struct PidId {
+  const char * pid;
+  const char * id;
+};
+
+static void addPidIds(JsonObject var, std::vector<PidId> &pidIds) {
+  if (var["pid"].is<const char *>() && var["id"].is<const char *>()) pidIds.push_back({var["pid"].as<const char *>(), var["id"].as<const char *>()});
+  for (JsonObject childVar: var["n"].as<JsonArray>()) addPidIds(childVar, pidIds);
+}
+
+//pid.id lookup of SysModModel::findVar, of each var of the model, per var
+void test_findVar() {
+  JsonArena arena("bench findVar");
+  JsonDocument doc(&arena);
+  deserializeJson(doc, modelJson);
+  VarIndex varIndex;
+  TEST_ASSERT_EQUAL_UINT16(0, varIndex.build(doc.as<JsonArray>())); //no hash collisions
+  std::vector<PidId> pidIds;
+  for (JsonObject moduleVar: doc.as<JsonArray>()) addPidIds(moduleVar, pidIds);
+  TEST_ASSERT_GREATER_THAN(0, pidIds.size());
+
+  BenchResult result = bench("findVar", 1000, [&varIndex, &pidIds]() {
+    for (const PidId &pidId: pidIds)
+      TEST_ASSERT_FALSE(varIndex.find(pidId.pid, pidId.id).isNull());
+  });
+  result.nsPerOp /= pidIds.size(); //per var
+  checkBench(result, BENCH_NS_FINDVAR, 0, BENCH_ALLOCS_FINDVAR);
+}
+
+void test_model_serialize() {
+  JsonArena arena("bench serialize");
+  JsonDocument doc(&arena);
+  deserializeJson(doc, modelJson);
+  std::vector<char> text(measureJson(doc) + 1);
+  BenchResult result = bench("model serialize", 50, [&doc, &text]() {
+    serializeJson(doc, text.data(), text.size());
+  });
+  checkBench(result, BENCH_NS_MODEL_SERIALIZE, 0, 0);
+}
+
+//as SysModWeb::addResponse and sendResponseObject: {"pid.id":{"value":v}} per changed var, measured, serialized and cleared
+void test_response() {
+  JsonBumpArena arena("bench response");
+  JsonDocument doc(&arena);
+  doc.to<JsonObject>();
+  char text[2048];
+  uint16_t value = 0;
+  BenchResult result = bench("response", 1000, [&doc, &text, &value]() {
+    JsonObject responseObject = doc.as<JsonObject>();
+    for (uint8_t varNr = 0; varNr < 32; varNr++) {
+      char pidid[32];
+      snprintf(pidid, sizeof(pidid), "Fixture.var%d", varNr);
+      responseObject[pidid]["value"] = value++;
+    }
+    size_t length = measureJson(responseObject);
+    TEST_ASSERT_LESS_THAN(sizeof(text), length);
+    serializeJson(responseObject, text, sizeof(text));
+    doc.to<JsonObject>();
+  });
+  checkBench(result, BENCH_NS_RESPONSE, 0, BENCH_ALLOCS_RESPONSE);
+}
+
+void test_arena() {
+  JsonArena arena("bench arena");
+  void *pointers[256];
+  BenchResult result = bench("arena alloc/free", 1000, [&arena, &pointers]() {
+    for (uint16_t nr = 0; nr < 256; nr++) pointers[nr] = arena.allocate(8 + nr % 13 * 8); //8..104: values and short strings
+    for (uint16_t nr = 0; nr < 256; nr++) arena.deallocate(pointers[nr]);
+  });
+  TEST_ASSERT_EQUAL_UINT32(0, arena.used);
+  checkBench(result, BENCH_NS_ARENA, 0, BENCH_ALLOCS_ARENA);
+}
+
+int main() {
+  modelJson = readMisc("model.json");
+  fixtureJson = readMisc("F_Panel2x2-16x16.json");
+
+  UNITY_BEGIN();
+  RUN_TEST(test_model_deserialize); //fails with EmptyInput if not run from the project folder (misc/)
+  RUN_TEST(test_fixture_deserialize);
+  RUN_TEST(test_fixture_starjson);
+  RUN_TEST(test_findVar);
+  RUN_TEST(test_model_serialize);
+  RUN_TEST(test_response);
+  RUN_TEST(test_arena);
+  return UNITY_END();
+}
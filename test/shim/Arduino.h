@@ -0,0 +1,100 @@
+/*
+   @title     StarBase
+   @file      Arduino.h
+   @date      20241219
+   @repo      https://github.com/ewowi/StarBase, submit changes to this file as PRs to ewowi/StarBase
+   @Authors   https://github.com/ewowi/StarBase/commits/main
+   @Copyright © 2024 Github StarBase Commit Authors
+   @license   GNU GENERAL PUBLIC LICENSE Version 3, 29 June 2007
+   @license   For non GPL-v3 usage, commercial licenses must be purchased. Contact moonmodules@icloud.com
+*/
+
+//thin Arduino / FreeRTOS / ESP shim for the native env (benchmarks of the core paths on the host, see test/README)
+//only what the natively compiled sources use: timing, the ESP object, psram allocation, critical sections and Print
+//single threaded: critical sections do nothing
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <cstdarg>
+#include <cmath>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+
+inline uint64_t shimNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+inline unsigned long millis() {return shimNanos() / 1000000;}
+inline unsigned long micros() {return shimNanos() / 1000;}
+inline void delay(unsigned long) {}
+inline long random(long max) {return max > 0?rand() % max:0;}
+inline long random(long min, long max) {return max > min?min + rand() % (max - min):min;}
+
+//heap allocations by the natively compiled sources: psram is the counted heap (see Bench.h)
+extern uint32_t shimAllocations;
+inline bool psramFound() {return true;}
+inline void *ps_malloc(size_t size) {shimAllocations++; return malloc(size);}
+inline void *ps_realloc(void *pointer, size_t size) {shimAllocations++; return realloc(pointer, size);}
+
+//a 240MHz cycle counter from the steady clock, so device and host thresholds have the same unit
+class EspClass {
+public:
+  uint32_t getCycleCount() {return shimNanos() * 240 / 1000;}
+  uint32_t getCpuFreqMHz() {return 240;}
+  uint32_t getFreeHeap() {return UINT32_MAX;}
+};
+inline EspClass ESP;
+
+//FreeRTOS
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL(mux)
+typedef void *TaskHandle_t;
+inline TaskHandle_t xTaskGetCurrentTaskHandle() {return nullptr;}
+
+//what StarJson writes to, ArduinoJson writes to it as a custom writer (write of a byte and of a buffer)
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t written = 0;
+    while (size--) written += write(*buffer++);
+    return written;
+  }
+};
+
+class __FlashStringHelper;
+
+#if !defined(__GLIBC__) || !__GLIBC_PREREQ(2, 38)
+inline size_t strlcpy(char *dst, const char *src, size_t size) {
+  size_t length = strlen(src);
+  if (size) {
+    size_t copy = length < size - 1?length:size - 1;
+    memcpy(dst, src, copy);
+    dst[copy] = '\0';
+  }
+  return length;
+}
+inline size_t strlcat(char *dst, const char *src, size_t size) {
+  size_t length = strnlen(dst, size);
+  if (length == size) return size + strlen(src);
+  return length + strlcpy(dst + length, src, size - length);
+}
+#endif
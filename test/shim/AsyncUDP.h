@@ -0,0 +1,4 @@
+//native env: included by SysModPrint.h, for its members only (see Arduino.h)
+#pragma once
+
+class AsyncUDP {};
@@ -0,0 +1,19 @@
+//native env: File on stdio, opened by the native SysModFiles::open of the test (paths on the host)
+#pragma once
+
+#include <Arduino.h>
+
+class File: public Print {
+public:
+  File(FILE *file = nullptr): file(file) {}
+  explicit operator bool() const {return file != nullptr;}
+  size_t read(uint8_t *buffer, size_t size) {return file?fread(buffer, 1, size, file):0;}
+  size_t write(uint8_t c) override {return write(&c, 1);}
+  size_t write(const uint8_t *buffer, size_t size) override {return file?fwrite(buffer, 1, size, file):0;}
+  void close() {
+    if (file) fclose(file);
+    file = nullptr;
+  }
+private:
+  FILE *file; //not closed by the destructor: copies share it, as with the Arduino File
+};
@@ -0,0 +1,4 @@
+//native env: included by SysModule.h, IPAddress for the members of SysModPrint (see Arduino.h)
+#pragma once
+
+class IPAddress {};
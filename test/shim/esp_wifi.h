@@ -0,0 +1,2 @@
+//native env: included by SysModule.h, nothing used by the natively compiled sources (see Arduino.h)
+#pragma once
@@ -29,6 +29,7 @@
 const fs = require("fs");
 const inliner = require("inliner");
 const zlib = require("zlib");
+const crypto = require("crypto");
 const CleanCSS = require("clean-css");
 const MinifyHTML = require("html-minifier-terser").minify;
 const packageJson = require("../package.json");
@@ -152,6 +153,7 @@ function writeHtmlGzipped(sourceFile, resultFile, page) {
  
 // Autogenerated from ${sourceFile}, do not edit!!
 const uint16_t PAGE_${page}_L = ${result.length};
+const char PAGE_${page}_ETag[] = "\\"${crypto.createHash("sha1").update(result).digest("hex").substring(0, 16)}\\""; //sha1 of the gzipped page
 const uint8_t PAGE_${page}[] PROGMEM = {
 ${array}
 };